@@ -52,6 +52,18 @@ public:
         return false; // TODO return trigger value
     }
 
+    /**
+     * @brief Retrieves a native handle which becomes readable when the trigger_value of the Condition may have
+     * changed, so the Condition can be waited on with poll, epoll or select together with sockets and timers.
+     *
+     * The handle is created on the first call. It is readable right away if the Condition is already triggered.
+     * It stays readable until it is read by the application, after which get_trigger_value should be checked again.
+     * The handle is owned by the Condition and must not be closed by the application.
+     *
+     * @return The native handle, or -1 if not supported on this platform.
+     */
+    FASTDDS_EXPORTED_API int get_native_handle() const;
+
     detail::ConditionNotifier* get_notifier() const
     {
         return notifier_.get();
@@ -96,6 +96,19 @@ public:
     FASTDDS_EXPORTED_API ReturnCode_t get_conditions(
             ConditionSeq& attached_conditions) const;
 
+    /**
+     * @brief Retrieves a native handle which becomes readable when any of the attached conditions may have been
+     * triggered, so the WaitSet can be waited on with poll, epoll or select together with sockets and timers.
+     *
+     * The handle is created on the first call. It is readable right away if an attached condition is already
+     * triggered. It stays readable until the next call to wait, which should be done with a zero timeout to
+     * retrieve the active conditions.
+     * The handle is owned by the WaitSet and must not be closed by the application.
+     *
+     * @return The native handle, or -1 if not supported on this platform.
+     */
+    FASTDDS_EXPORTED_API int get_native_handle() const;
+
 private:
 
     std::unique_ptr<detail::WaitSetImpl> impl_;
@@ -160,6 +160,10 @@ enum ParameterId_t : uint16_t
     PID_DISABLE_POSITIVE_ACKS               = 0x8005,
     PID_DATASHARING                         = 0x8006,
     PID_NETWORK_CONFIGURATION_SET           = 0x8007,
+    PID_COMPACT_PARTICIPANT_ANNOUNCEMENT    = 0x8008,
+    PID_PARTICIPANT_DATA_REQUEST            = 0x8009,
+    PID_SAMPLE_BATCH                        = 0x800a,
+    PID_COMPACT_ANNOUNCEMENTS_SUPPORT       = 0x800b,
 };
 
 /*!
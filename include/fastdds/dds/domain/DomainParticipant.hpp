@@ -30,6 +30,7 @@
 #include <fastdds/dds/core/Entity.hpp>
 #include <fastdds/dds/core/ReturnCode.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
+#include <fastdds/dds/domain/ListenerExecutorMetrics.hpp>
 #include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
 #include <fastdds/dds/domain/qos/ReplierQos.hpp>
 #include <fastdds/dds/domain/qos/RequesterQos.hpp>
@@ -39,8 +40,10 @@
 #include <fastdds/dds/topic/TopicListener.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SampleIdentity.h>
 #include <fastdds/rtps/common/Time_t.h>
+#include <fastdds/rtps/flowcontrol/FlowControllerStatistics.hpp>
 
 namespace dds {
 namespace domain {
@@ -909,6 +912,56 @@ public:
     FASTDDS_EXPORTED_API ReturnCode_t unregister_content_filter_factory(
             const char* filter_class_name);
 
+    /**
+     * @brief Get the memory held by the entities of this participant.
+     *
+     * The memory of each enabled DataWriter and DataReader is broken down into its pool of changes, its pool of
+     * payloads, its history and the structures kept for each matched remote endpoint.
+     * The memory of the transport buffers is reported for the whole participant.
+     * Values are taken from counters kept by each component, so this operation does not walk the heap.
+     *
+     * @param [out] usage Memory used by the entities of the participant.
+     *
+     * @return RETCODE_NOT_ENABLED if the participant has not been enabled.
+     * @return RETCODE_OK if the memory usage is returned.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t get_memory_usage(
+            fastdds::rtps::ParticipantMemoryUsage& usage) const;
+
+    /**
+     * @brief Get the counters of a flow controller of this participant.
+     *
+     * Only the flow controllers using the earliest deadline first scheduler keep counters of the samples sent, the
+     * samples dropped before being sent because their lifespan expired, and the deadline slack of the samples sent.
+     *
+     * @param flow_controller_name Name of the flow controller, as set on its descriptor.
+     * @param [out] statistics Counters of the flow controller.
+     *
+     * @return RETCODE_NOT_ENABLED if the participant has not been enabled.
+     * @return RETCODE_BAD_PARAMETER if there is no flow controller with that name keeping counters.
+     * @return RETCODE_OK if the counters are returned.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t get_flow_controller_statistics(
+            const std::string& flow_controller_name,
+            fastdds::rtps::FlowControllerStatistics& statistics) const;
+
+    /**
+     * @brief Get the metrics of the executor running the DataReader listener callbacks.
+     *
+     * The executor is enabled by setting DomainParticipantQos::listener_executor_threads to the number of threads
+     * it should use. Each DataReader then has its @c on_data_available callback (or the
+     * @c on_data_on_readers callback of its Subscriber) called from those threads instead of the thread receiving
+     * the data. Callbacks of the same DataReader are never called at the same time.
+     * The settings of those threads are taken from DomainParticipantQos::listener_executor_thread.
+     *
+     * @param [out] metrics Queue depth and latency metrics of the executor.
+     *
+     * @return RETCODE_NOT_ENABLED if the participant has not been enabled, or the executor is not configured.
+     * @return RETCODE_OK if the metrics are returned.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t get_listener_executor_metrics(
+            ListenerExecutorMetrics& metrics) const;
+
     /**
      * @brief Check if the Participant has any Publisher, Subscriber or Topic
      *
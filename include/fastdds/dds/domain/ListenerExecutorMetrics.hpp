@@ -0,0 +1,60 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ListenerExecutorMetrics.hpp
+ */
+
+#ifndef _FASTDDS_DOMAIN_LISTENEREXECUTORMETRICS_HPP_
+#define _FASTDDS_DOMAIN_LISTENEREXECUTORMETRICS_HPP_
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Metrics of the executor running the DataReader listener callbacks of a DomainParticipant.
+ * @ingroup FASTDDS_MODULE
+ */
+struct ListenerExecutorMetrics
+{
+    //! Number of callbacks waiting to be executed.
+    uint64_t queue_depth = 0;
+
+    //! Highest number of callbacks that have been waiting to be executed at the same time.
+    uint64_t max_queue_depth = 0;
+
+    //! Number of callbacks executed.
+    uint64_t executed_callbacks = 0;
+
+    //! Mean time, in nanoseconds, from the reception of the data to the start of its callback.
+    uint64_t mean_dispatch_latency_ns = 0;
+
+    //! Highest time, in nanoseconds, from the reception of the data to the start of its callback.
+    uint64_t max_dispatch_latency_ns = 0;
+
+    //! Mean time, in nanoseconds, spent on a callback.
+    uint64_t mean_callback_duration_ns = 0;
+
+    //! Highest time, in nanoseconds, spent on a callback.
+    uint64_t max_callback_duration_ns = 0;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif /* _FASTDDS_DOMAIN_LISTENEREXECUTORMETRICS_HPP_ */
@@ -85,8 +85,12 @@ public:
                (this->name_ == b.name()) &&
                (this->builtin_controllers_sender_thread_ == b.builtin_controllers_sender_thread()) &&
                (this->timed_events_thread_ == b.timed_events_thread()) &&
+               (this->timed_events_threads_ == b.timed_events_threads()) &&
                (this->discovery_server_thread_ == b.discovery_server_thread()) &&
                (this->typelookup_service_thread_ == b.typelookup_service_thread()) &&
+               (this->persistence_thread_ == b.persistence_thread()) &&
+               (this->listener_executor_thread_ == b.listener_executor_thread()) &&
+               (this->listener_executor_threads_ == b.listener_executor_threads()) &&
 #if HAVE_SECURITY
                (this->security_log_thread_ == b.security_log_thread()) &&
 #endif // if HAVE_SECURITY
@@ -403,6 +407,37 @@ public:
         timed_events_thread_ = value;
     }
 
+    /**
+     * Getter for the number of timed event threads
+     *
+     * @return uint32_t reference
+     */
+    uint32_t& timed_events_threads()
+    {
+        return timed_events_threads_;
+    }
+
+    /**
+     * Getter for the number of timed event threads
+     *
+     * @return uint32_t
+     */
+    uint32_t timed_events_threads() const
+    {
+        return timed_events_threads_;
+    }
+
+    /**
+     * Setter for the number of timed event threads
+     *
+     * @param value New number of timed event threads
+     */
+    void timed_events_threads(
+            uint32_t value)
+    {
+        timed_events_threads_ = value;
+    }
+
     /**
      * Getter for discovery server ThreadSettings
      *
@@ -465,6 +500,100 @@ public:
         typelookup_service_thread_ = value;
     }
 
+    /**
+     * Getter for the persistence services ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    rtps::ThreadSettings& persistence_thread()
+    {
+        return persistence_thread_;
+    }
+
+    /**
+     * Getter for the persistence services ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    const rtps::ThreadSettings& persistence_thread() const
+    {
+        return persistence_thread_;
+    }
+
+    /**
+     * Setter for the persistence services ThreadSettings
+     *
+     * @param value New ThreadSettings to be set
+     */
+    void persistence_thread(
+            const rtps::ThreadSettings& value)
+    {
+        persistence_thread_ = value;
+    }
+
+    /**
+     * Getter for the listener executor ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    rtps::ThreadSettings& listener_executor_thread()
+    {
+        return listener_executor_thread_;
+    }
+
+    /**
+     * Getter for the listener executor ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    const rtps::ThreadSettings& listener_executor_thread() const
+    {
+        return listener_executor_thread_;
+    }
+
+    /**
+     * Setter for the listener executor ThreadSettings
+     *
+     * @param value New ThreadSettings to be set
+     */
+    void listener_executor_thread(
+            const rtps::ThreadSettings& value)
+    {
+        listener_executor_thread_ = value;
+    }
+
+    /**
+     * Getter for the number of threads of the listener executor
+     *
+     * @return uint32_t reference
+     */
+    uint32_t& listener_executor_threads()
+    {
+        return listener_executor_threads_;
+    }
+
+    /**
+     * Getter for the number of threads of the listener executor
+     *
+     * @return uint32_t
+     */
+    uint32_t listener_executor_threads() const
+    {
+        return listener_executor_threads_;
+    }
+
+    /**
+     * Setter for the number of threads of the listener executor
+     *
+     * @param value New number of threads. 0 disables the executor, so listeners are called from the reception
+     *              threads.
+     */
+    void listener_executor_threads(
+            uint32_t value)
+    {
+        listener_executor_threads_ = value;
+    }
+
 #if HAVE_SECURITY
     /**
      * Getter for security log ThreadSettings
@@ -534,12 +663,24 @@ private:
     //! Thread settings for the timed events thread
     rtps::ThreadSettings timed_events_thread_;
 
+    //! Number of threads running timed events, all of them with the timed_events_thread_ settings
+    uint32_t timed_events_threads_ = 1;
+
     //! Thread settings for the discovery server thread
     rtps::ThreadSettings discovery_server_thread_;
 
     //! Thread settings for the builtin TypeLookup service requests and replies threads
     rtps::ThreadSettings typelookup_service_thread_;
 
+    //! Thread settings for the background threads of the persistence services
+    rtps::ThreadSettings persistence_thread_;
+
+    //! Thread settings for the threads of the DataReader listener executor
+    rtps::ThreadSettings listener_executor_thread_;
+
+    //! Number of threads of the DataReader listener executor, or 0 to call listeners from the reception threads
+    uint32_t listener_executor_threads_ = 0;
+
 #if HAVE_SECURITY
     //! Thread settings for the security log thread
     rtps::ThreadSettings security_log_thread_;
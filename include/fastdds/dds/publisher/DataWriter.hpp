@@ -19,6 +19,8 @@
 #ifndef _FASTDDS_DDS_PUBLISHER_DATAWRITER_HPP_
 #define _FASTDDS_DDS_PUBLISHER_DATAWRITER_HPP_
 
+#include <vector>
+
 #include <fastdds/dds/builtin/topic/SubscriptionBuiltinTopicData.hpp>
 #include <fastdds/dds/core/Entity.hpp>
 #include <fastdds/dds/core/ReturnCode.hpp>
@@ -182,6 +184,23 @@ public:
             const InstanceHandle_t& handle,
             const fastrtps::Time_t& timestamp);
 
+    /**
+     * @brief Writes several samples in a single operation.
+     *
+     * All the samples are serialized and added to the history holding the writer's resources only once, and when
+     * the DataWriter publishes synchronously, they are packed together into as few RTPS messages as possible.
+     * The instance of each sample is deduced from its key.
+     * Samples are written in order. If writing one of them fails, the operation stops and the samples preceding it
+     * remain written.
+     *
+     * @param data Pointers to the samples to be written. Loaned samples are accepted.
+     * @return RETCODE_BAD_PARAMETER if any of the pointers is nullptr, in which case no sample is written.
+     * @return RETCODE_OK if all the samples are written, or any of the standard return codes of the write operation
+     * otherwise.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t write_many(
+            const std::vector<void*>& data);
+
     /*!
      * @brief Informs that the application will be modifying a particular instance.
      * It gives an opportunity to the middleware to pre-configure itself to improve performance.
@@ -36,6 +36,7 @@
 #include <fastdds/dds/core/status/SubscriptionMatchedStatus.hpp>
 #include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleInfoColumns.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 
 #include <fastdds/fastdds_dll.hpp>
@@ -709,6 +710,57 @@ public:
             void* data,
             SampleInfo* info);
 
+    /**
+     * @brief This operation takes a collection of samples into a caller-provided array, storing the requested fields
+     * of their SampleInfo as caller-provided columns.
+     *
+     * The samples are selected as in @ref take, holding the DataReader's resources only once for the whole
+     * operation. Samples carrying valid data are deserialized straight into consecutive positions of
+     * @c data_values, and the fields of each SampleInfo are stored on the same position of the non-null columns of
+     * @c info_columns. The position of samples without valid data is left untouched on @c data_values.
+     * Loans are never used, so there is nothing to return after the operation.
+     *
+     * @param [out] data_values   Array of at least @c max_samples constructed samples of the type of the DataReader.
+     *                            May be nullptr when only the information of the samples is required.
+     * @param [in] sample_size    Size in bytes of each element of @c data_values.
+     * @param [in] info_columns   Columns where the fields of the SampleInfo are stored.
+     * @param [in] max_samples    Maximum number of samples to be taken. Each array must have room for this number.
+     * @param [out] num_samples   Number of samples taken.
+     * @param [in] sample_states  Only data samples with @c sample_state matching one of these will be returned.
+     * @param [in] view_states    Only data samples with @c view_state matching one of these will be returned.
+     * @param [in] instance_states Only data samples with @c instance_state matching one of these will be returned.
+     *
+     * @return RETCODE_BAD_PARAMETER if @c max_samples is not positive, or @c sample_size is zero with a non-null
+     * @c data_values.
+     * @return RETCODE_NO_DATA if no samples were taken, or any of the standard return codes otherwise.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t take_columns(
+            void* data_values,
+            size_t sample_size,
+            const SampleInfoColumns& info_columns,
+            int32_t max_samples,
+            int32_t& num_samples,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
+    /**
+     * @brief Typed version of @ref take_columns, taking the size of each sample from the type of the array.
+     */
+    template<typename T>
+    ReturnCode_t take_columns(
+            T* data_values,
+            const SampleInfoColumns& info_columns,
+            int32_t max_samples,
+            int32_t& num_samples,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE)
+    {
+        return take_columns(static_cast<void*>(data_values), sizeof(T), info_columns, max_samples, num_samples,
+                       sample_states, view_states, instance_states);
+    }
+
     ///@}
 
     /**
@@ -0,0 +1,76 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SampleInfoColumns.hpp
+ *
+ */
+
+#ifndef _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFOCOLUMNS_HPP_
+#define _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFOCOLUMNS_HPP_
+
+#include <fastdds/dds/subscriber/InstanceState.hpp>
+#include <fastdds/dds/subscriber/SampleState.hpp>
+#include <fastdds/dds/subscriber/ViewState.hpp>
+
+#include <fastdds/rtps/common/SampleIdentity.h>
+#include <fastdds/rtps/common/Time_t.h>
+#include <fastdds/dds/common/InstanceHandle.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/*!
+ * @brief Caller-provided buffers where the fields of the SampleInfo of several samples are stored as columns.
+ *
+ * Each non-null pointer must point to an array with room for the maximum number of samples requested, and the
+ * field of the i-th sample is stored on its i-th position. Fields whose pointer is nullptr are not filled.
+ * The meaning of each field is the same as in @ref SampleInfo.
+ */
+struct SampleInfoColumns
+{
+    //! Column for @ref SampleInfo::sample_state
+    SampleStateKind* sample_state = nullptr;
+
+    //! Column for @ref SampleInfo::view_state
+    ViewStateKind* view_state = nullptr;
+
+    //! Column for @ref SampleInfo::instance_state
+    InstanceStateKind* instance_state = nullptr;
+
+    //! Column for @ref SampleInfo::source_timestamp
+    fastrtps::rtps::Time_t* source_timestamp = nullptr;
+
+    //! Column for @ref SampleInfo::reception_timestamp
+    fastrtps::rtps::Time_t* reception_timestamp = nullptr;
+
+    //! Column for @ref SampleInfo::instance_handle
+    InstanceHandle_t* instance_handle = nullptr;
+
+    //! Column for @ref SampleInfo::publication_handle
+    InstanceHandle_t* publication_handle = nullptr;
+
+    //! Column for @ref SampleInfo::sample_identity
+    fastrtps::rtps::SampleIdentity* sample_identity = nullptr;
+
+    //! Column for @ref SampleInfo::valid_data
+    bool* valid_data = nullptr;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif /* _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFOCOLUMNS_HPP_ */
@@ -0,0 +1,155 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTTAdaptiveTiming.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_ATTRIBUTES_RTTADAPTIVETIMING_HPP_
+#define _FASTDDS_RTPS_ATTRIBUTES_RTTADAPTIVETIMING_HPP_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Bounds used by reliable endpoints to adapt their protocol timings to the estimated round-trip time of each
+ * matched remote endpoint.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ *
+ * It is configured through the following endpoint properties:
+ * - @c fastdds.rtt_adaptive_timing: @c true enables the adaptive mode.
+ * - @c fastdds.rtt_adaptive_timing.min_ms: lower bound of the adapted timings, in milliseconds.
+ *   Defaults to the configured static timing, so the adapted timings are never shorter than the static ones and
+ *   a low round-trip time does not increase the protocol traffic. Setting a lower value lets the timings be
+ *   shortened on fast networks, at the cost of sending more heartbeats.
+ * - @c fastdds.rtt_adaptive_timing.max_ms: upper bound of the adapted timings, in milliseconds.
+ *   Defaults to ten times the configured static timing.
+ * - @c fastdds.rtt_adaptive_timing.remote_response_delay_ms: time the remote endpoints wait before answering a
+ *   request, in milliseconds, which is subtracted from every round-trip time sample.
+ *   Defaults to the default response delay of the remote endpoints (heartbeat response delay of readers and
+ *   NACK response delay of writers).
+ */
+struct RTTAdaptiveTiming
+{
+    //! Whether the adaptive mode is enabled.
+    bool enabled = false;
+    //! Lower bound of the adapted timings, in milliseconds.
+    double min_ms = 0;
+    //! Upper bound of the adapted timings, in milliseconds.
+    double max_ms = 0;
+    //! Response delay of the remote endpoints, in milliseconds.
+    double remote_response_delay_ms = 0;
+
+    /**
+     * Keep a timing inside the configured bounds.
+     * @param value Timing to bound.
+     * @return The bounded timing, in milliseconds.
+     */
+    double bound(
+            std::chrono::nanoseconds value) const
+    {
+        double value_ms = std::chrono::duration<double, std::milli>(value).count();
+        return (std::min)((std::max)(value_ms, min_ms), max_ms);
+    }
+
+    //! Response delay of the remote endpoints, to be subtracted from the round-trip time samples.
+    std::chrono::nanoseconds remote_response_delay() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<double, std::milli>(remote_response_delay_ms));
+    }
+
+    /**
+     * Load the configuration from the properties of an endpoint.
+     * @param properties Endpoint properties.
+     * @param static_ms Static timing configured on the endpoint, in milliseconds.
+     * @param remote_response_delay_ms Default response delay of the remote endpoints, in milliseconds.
+     * @return The loaded configuration.
+     */
+    static RTTAdaptiveTiming from_properties(
+            const PropertyPolicy& properties,
+            double static_ms,
+            double remote_response_delay_ms)
+    {
+        RTTAdaptiveTiming ret;
+
+        const std::string* enabled = PropertyPolicyHelper::find_property(properties, "fastdds.rtt_adaptive_timing");
+        ret.enabled = (nullptr != enabled) && ("true" == *enabled);
+        ret.min_ms = static_ms;
+        ret.max_ms = static_ms * 10;
+        ret.remote_response_delay_ms = remote_response_delay_ms;
+
+        if (ret.enabled)
+        {
+            read_bound(properties, "fastdds.rtt_adaptive_timing.min_ms", ret.min_ms);
+            read_bound(properties, "fastdds.rtt_adaptive_timing.max_ms", ret.max_ms);
+            read_bound(properties, "fastdds.rtt_adaptive_timing.remote_response_delay_ms",
+                    ret.remote_response_delay_ms);
+
+            if (ret.min_ms > ret.max_ms)
+            {
+                EPROSIMA_LOG_ERROR(RTPS_QOS_CHECK,
+                        "fastdds.rtt_adaptive_timing.min_ms is greater than fastdds.rtt_adaptive_timing.max_ms. "
+                        "Adaptive timing disabled");
+                ret.enabled = false;
+            }
+        }
+
+        return ret;
+    }
+
+private:
+
+    static void read_bound(
+            const PropertyPolicy& properties,
+            const char* name,
+            double& value)
+    {
+        const std::string* property = PropertyPolicyHelper::find_property(properties, name);
+
+        if (nullptr != property)
+        {
+            char* ptr = nullptr;
+            double read_value = strtod(property->c_str(), &ptr);
+
+            if (property->c_str() != ptr && 0 <= read_value)     // A valid number was read.
+            {
+                value = read_value;
+            }
+            else
+            {
+                EPROSIMA_LOG_ERROR(RTPS_QOS_CHECK, "Wrong value for " << name << " property. Using default value");
+            }
+        }
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_RTPS_ATTRIBUTES_RTTADAPTIVETIMING_HPP_
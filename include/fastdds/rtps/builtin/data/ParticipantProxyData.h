@@ -219,6 +219,25 @@ public:
         return lease_duration_;
     }
 
+    /**
+     * Set whether the participant understands compact announcements and requests of full DATA(p).
+     * @param compact_announcements true when the participant understands them.
+     */
+    inline void compact_announcements(
+            bool compact_announcements)
+    {
+        compact_announcements_ = compact_announcements;
+    }
+
+    /**
+     * Get whether the participant understands compact announcements and requests of full DATA(p).
+     * @return true when the participant understands them.
+     */
+    inline bool compact_announcements() const
+    {
+        return compact_announcements_;
+    }
+
 private:
 
     //! Store the last timestamp it was received a RTPS message from the remote participant.
@@ -226,6 +245,9 @@ private:
 
     //! Remote participant lease duration in microseconds.
     std::chrono::microseconds lease_duration_;
+
+    //! Whether the participant understands compact announcements.
+    bool compact_announcements_ = false;
 };
 
 } /* namespace rtps */
@@ -387,6 +387,25 @@ public:
         return m_qos.m_disablePositiveACKs.enabled;
     }
 
+    /**
+     * Set whether the reader is able to unbatch changes carrying several samples.
+     * @param sample_batches true when the reader accepts sample batches.
+     */
+    inline void sample_batches(
+            bool sample_batches)
+    {
+        sample_batches_ = sample_batches;
+    }
+
+    /**
+     * Get whether the reader is able to unbatch changes carrying several samples.
+     * @return true when the reader accepts sample batches.
+     */
+    inline bool sample_batches() const
+    {
+        return sample_batches_;
+    }
+
     /**
      * Set participant client server sample identity
      * @param sid valid SampleIdentity
@@ -511,6 +530,8 @@ private:
     ParameterPropertyList_t m_properties;
     //!Information on the content filter applied by the reader.
     fastdds::rtps::ContentFilterProperty content_filter_;
+    //!Whether the reader accepts sample batches.
+    bool sample_batches_ = false;
 };
 
 } // namespace rtps
@@ -390,6 +390,25 @@ public:
     //!WriterQOS
     fastdds::dds::WriterQos m_qos;
 
+    /**
+     * Set whether the writer sends changes carrying several samples.
+     * @param sample_batches true when the writer sends sample batches.
+     */
+    inline void sample_batches(
+            bool sample_batches)
+    {
+        sample_batches_ = sample_batches;
+    }
+
+    /**
+     * Get whether the writer sends changes carrying several samples.
+     * @return true when the writer sends sample batches.
+     */
+    inline bool sample_batches() const
+    {
+        return sample_batches_;
+    }
+
     /**
      * Set participant client server sample identity
      * @param sid valid SampleIdentity
@@ -506,6 +525,9 @@ private:
 
     //!
     ParameterPropertyList_t m_properties;
+
+    //!Whether the writer sends sample batches.
+    bool sample_batches_ = false;
 };
 
 } /* namespace rtps */
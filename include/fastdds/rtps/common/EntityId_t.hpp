@@ -67,6 +67,8 @@ namespace rtps {
 #define ENTITYID_DS_SERVER_VIRTUAL_WRITER 0x00030073
 #define ENTITYID_DS_SERVER_VIRTUAL_READER 0x00030074
 
+#define ENTITYID_SPDP_UNSEQUENCED_WRITER 0x00010043
+
 #ifdef FASTDDS_STATISTICS
 #define ENTITYID_MONITOR_SERVICE_WRITER 0x004000D2
 #endif // ifdef FASTDDS_STATISTICS
@@ -377,6 +379,8 @@ const EntityId_t c_EntityId_spdp_reliable_participant_secure_writer =
 const EntityId_t ds_server_virtual_writer = ENTITYID_DS_SERVER_VIRTUAL_WRITER;
 const EntityId_t ds_server_virtual_reader = ENTITYID_DS_SERVER_VIRTUAL_READER;
 
+const EntityId_t c_EntityId_SPDPUnsequencedWriter = ENTITYID_SPDP_UNSEQUENCED_WRITER;
+
 #ifdef FASTDDS_STATISTICS
 const EntityId_t monitor_service_status_writer = ENTITYID_MONITOR_SERVICE_WRITER;
 #endif // if FASTDDS_STATISTICS
@@ -0,0 +1,115 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MemoryUsage.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_MEMORYUSAGE_HPP_
+#define _FASTDDS_RTPS_COMMON_MEMORYUSAGE_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <fastdds/rtps/common/Guid.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Amount of memory held by a component.
+ * @ingroup COMMON_MODULE
+ */
+struct MemoryUsage
+{
+    //! Bytes holding data which is currently in use.
+    uint64_t live_bytes = 0;
+
+    //! Bytes allocated by the component, including the ones kept for later reuse.
+    uint64_t reserved_bytes = 0;
+
+    MemoryUsage& operator +=(
+            const MemoryUsage& other)
+    {
+        live_bytes += other.live_bytes;
+        reserved_bytes += other.reserved_bytes;
+        return *this;
+    }
+
+};
+
+/**
+ * Memory held by an endpoint, broken down by component.
+ * @ingroup COMMON_MODULE
+ */
+struct EndpointMemoryUsage
+{
+    //! GUID of the endpoint.
+    fastrtps::rtps::GUID_t guid;
+
+    //! Change descriptors on the pool of changes.
+    MemoryUsage change_pool;
+
+    /**
+     * Payloads on the payload pool.
+     * Payload pools shared by the endpoints of a topic are reported by each of them.
+     */
+    MemoryUsage payload_pool;
+
+    //! Bookkeeping of the history, including its instances.
+    MemoryUsage history;
+
+    //! Structures kept for each matched remote endpoint (ReaderProxy, WriterProxy, ReaderLocator).
+    MemoryUsage proxies;
+
+    //! Sum of all the components.
+    MemoryUsage total() const
+    {
+        MemoryUsage ret;
+        ret += change_pool;
+        ret += payload_pool;
+        ret += history;
+        ret += proxies;
+        return ret;
+    }
+
+};
+
+/**
+ * Memory held by a participant.
+ * @ingroup COMMON_MODULE
+ */
+struct ParticipantMemoryUsage
+{
+    //! Memory held by each of the user writers.
+    std::vector<EndpointMemoryUsage> writers;
+
+    //! Memory held by each of the user readers.
+    std::vector<EndpointMemoryUsage> readers;
+
+    /**
+     * Send and receive buffers of the transports, including the shared memory segment.
+     * Send buffers are live while taken by a sender. Receive buffers and the shared memory segment are held for
+     * the whole life of the participant, so they are always live.
+     */
+    MemoryUsage transport_buffers;
+
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif /* _FASTDDS_RTPS_COMMON_MEMORYUSAGE_HPP_ */
@@ -0,0 +1,162 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RoundTripTimeEstimator.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_ROUNDTRIPTIMEESTIMATOR_HPP_
+#define _FASTDDS_RTPS_COMMON_ROUNDTRIPTIMEESTIMATOR_HPP_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <chrono>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Smoothed estimation of the round-trip time to a remote endpoint, following the algorithm of RFC 6298.
+ *
+ * A request is timed from the moment it is sent until its response is received. When a new request is sent while
+ * another one is still pending, the response cannot be associated to either of them, so no sample is taken
+ * (Karn's algorithm).
+ * @ingroup COMMON_MODULE
+ */
+class RoundTripTimeEstimator
+{
+public:
+
+    using clock = std::chrono::steady_clock;
+    using duration = std::chrono::nanoseconds;
+
+    /**
+     * Notify that a request expecting a response has been sent.
+     * @param now Time point when the request was sent.
+     */
+    void request_sent(
+            const clock::time_point& now)
+    {
+        ambiguous_ = pending_;
+        pending_ = true;
+        request_time_ = now;
+    }
+
+    /**
+     * Notify that the response to the pending request has been received.
+     * @param now Time point when the response was received.
+     * @param response_delay Time the remote endpoint waited before sending the response, which is not part of the
+     * round-trip time.
+     * @return true when a new sample was added to the estimation, false otherwise.
+     */
+    bool response_received(
+            const clock::time_point& now,
+            duration response_delay = duration::zero())
+    {
+        if (!pending_)
+        {
+            return false;
+        }
+
+        bool take_sample = !ambiguous_;
+        pending_ = false;
+        ambiguous_ = false;
+
+        if (take_sample)
+        {
+            duration sample = std::chrono::duration_cast<duration>(now - request_time_);
+            add_sample(sample > response_delay ? sample - response_delay : duration::zero());
+        }
+
+        return take_sample;
+    }
+
+    /**
+     * Add a round-trip time sample to the estimation.
+     * @param sample Measured round-trip time.
+     */
+    void add_sample(
+            duration sample)
+    {
+        if (!has_estimation_)
+        {
+            srtt_ = sample;
+            rttvar_ = sample / 2;
+            has_estimation_ = true;
+        }
+        else
+        {
+            duration deviation = (srtt_ > sample) ? (srtt_ - sample) : (sample - srtt_);
+            rttvar_ += (deviation - rttvar_) / 4;
+            srtt_ += (sample - srtt_) / 8;
+        }
+    }
+
+    //! Forget all the samples and any pending request.
+    void reset()
+    {
+        has_estimation_ = false;
+        pending_ = false;
+        ambiguous_ = false;
+        srtt_ = duration::zero();
+        rttvar_ = duration::zero();
+    }
+
+    //! Whether at least one sample has been taken.
+    bool has_estimation() const
+    {
+        return has_estimation_;
+    }
+
+    //! Whether a request is waiting for its response.
+    bool is_pending() const
+    {
+        return pending_;
+    }
+
+    //! Smoothed round-trip time.
+    duration srtt() const
+    {
+        return srtt_;
+    }
+
+    //! Round-trip time variation.
+    duration rttvar() const
+    {
+        return rttvar_;
+    }
+
+    //! Time after which a request without response can be considered lost.
+    duration retransmission_timeout() const
+    {
+        return srtt_ + 4 * rttvar_;
+    }
+
+private:
+
+    bool has_estimation_ = false;
+    bool pending_ = false;
+    bool ambiguous_ = false;
+    clock::time_point request_time_;
+    duration srtt_ = duration::zero();
+    duration rttvar_ = duration::zero();
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_RTPS_COMMON_ROUNDTRIPTIMEESTIMATOR_HPP_
@@ -0,0 +1,71 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FASTDDS_RTPS_FLOWCONTROL_FLOWCONTROLLERCONGESTIONCONTROL_HPP
+#define FASTDDS_RTPS_FLOWCONTROL_FLOWCONTROLLERCONGESTIONCONTROL_HPP
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Configuration of the congestion control applied by an asynchronous flow controller.
+ *
+ * When enabled, the flow controller keeps a sending window for each remote reliable reader, measured in bytes per
+ * period. The window grows additively on every ACKNACK not reporting lost samples while at least half of it is being
+ * used, and shrinks multiplicatively when an ACKNACK reports lost samples. Samples not fitting in the window of a
+ * reader are deferred for that reader only, so a congested reader does not slow down the rest.
+ */
+struct FlowControllerCongestionControl
+{
+    //! Whether the congestion control is applied.
+    //!
+    //! Default value: false
+    bool enabled = false;
+
+    //! Window assigned to a remote reader when it is first seen, in bytes per period.
+    //!
+    //! Default value: 65536
+    uint32_t initial_window = 65536;
+
+    //! Lower bound of the window, in bytes per period.
+    //!
+    //! Default value: 1500
+    uint32_t min_window = 1500;
+
+    //! Upper bound of the window, in bytes per period.
+    //!
+    //! 0 value means no limit other than the range of the type.
+    //! Default value: 0
+    uint32_t max_window = 0;
+
+    //! Bytes added to the window on each ACKNACK without lost samples.
+    //!
+    //! Default value: 1500
+    uint32_t additive_increase = 1500;
+
+    //! Factor applied to the window on each ACKNACK reporting lost samples.
+    //!
+    //! Range: (0, 1).
+    //! Default value: 0.5
+    double multiplicative_decrease = 0.5;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_FLOWCONTROL_FLOWCONTROLLERCONGESTIONCONTROL_HPP
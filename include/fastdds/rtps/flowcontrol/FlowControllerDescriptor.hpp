@@ -17,7 +17,9 @@
 
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
 
+#include "FlowControllerCongestionControl.hpp"
 #include "FlowControllerConsts.hpp"
+#include "FlowControllerDestinationRateLimit.hpp"
 #include "FlowControllerSchedulerPolicy.hpp"
 
 namespace eprosima {
@@ -56,6 +58,26 @@ struct FlowControllerDescriptor
     //! Thread settings for the sender thread
     ThreadSettings sender_thread;
 
+    //! Number of sender threads of an asynchronous flow controller without bandwidth limitation.
+    //!
+    //! Each writer is always served by the same thread, so its samples keep their order. The scheduler policy orders
+    //! the samples of the writers served by each thread.
+    //! Several threads only increase the throughput when there are several writers and sending a sample blocks, or
+    //! there are idle cores to run the sends in parallel.
+    //! Default value: 1
+    uint32_t num_sender_threads = 1;
+
+    //! Congestion control applied to reliable remote readers.
+    //!
+    //! Period of the sending windows is period_ms.
+    //! Default value: disabled.
+    FlowControllerCongestionControl congestion_control;
+
+    //! Rate limit applied to each remote participant.
+    //!
+    //! Default value: disabled.
+    FlowControllerDestinationRateLimit destination_rate_limit;
+
 };
 
 } // namespace rtps
@@ -0,0 +1,51 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FASTDDS_RTPS_FLOWCONTROL_FLOWCONTROLLERDESTINATIONRATELIMIT_HPP
+#define FASTDDS_RTPS_FLOWCONTROL_FLOWCONTROLLERDESTINATIONRATELIMIT_HPP
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Configuration of the rate limit applied by an asynchronous flow controller to each remote participant.
+ *
+ * When enabled, the flow controller keeps a token bucket for each remote participant its writers send samples to.
+ * The bucket is refilled at bytes_per_second and holds at most burst_bytes, so a participant that has been idle can
+ * receive a burst before being limited to the sustained rate. Samples not fitting in the bucket of a participant are
+ * deferred for the readers of that participant only, so a slow destination does not slow down the rest.
+ */
+struct FlowControllerDestinationRateLimit
+{
+    //! Sustained rate allowed to each remote participant, in bytes per second.
+    //!
+    //! 0 value means no limit.
+    //! Default value: 0
+    uint64_t bytes_per_second = 0;
+
+    //! Capacity of the bucket of each remote participant, in bytes.
+    //!
+    //! A sample bigger than the bucket is sent when the bucket is full.
+    //! Default value: 65536
+    uint32_t burst_bytes = 65536;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_FLOWCONTROL_FLOWCONTROLLERDESTINATIONRATELIMIT_HPP
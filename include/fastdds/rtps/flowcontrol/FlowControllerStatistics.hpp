@@ -0,0 +1,56 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FASTDDS_RTPS_FLOWCONTROL_FLOWCONTROLLERSTATISTICS_HPP
+#define FASTDDS_RTPS_FLOWCONTROL_FLOWCONTROLLERSTATISTICS_HPP
+
+#include <cstdint>
+#include <limits>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Counters kept by a flow controller using the earliest deadline first scheduler.
+ *
+ * The deadline slack of a sample is the time between sending it and its deadline, which is the time it was written
+ * plus the deadline period of its DataWriter.
+ */
+struct FlowControllerStatistics
+{
+    //! Number of samples sent.
+    uint64_t samples_sent = 0;
+
+    //! Number of samples discarded because their lifespan expired before being sent.
+    uint64_t samples_dropped_before_send = 0;
+
+    //! Number of samples sent after their deadline.
+    uint64_t deadline_misses = 0;
+
+    //! Number of samples sent with a finite deadline, used to compute the deadline slack.
+    uint64_t samples_with_deadline = 0;
+
+    //! Minimum deadline slack, in nanoseconds. Negative for deadline misses.
+    int64_t min_deadline_slack_ns = (std::numeric_limits<int64_t>::max)();
+
+    //! Sum of the deadline slack of the samples sent with a finite deadline, in nanoseconds.
+    int64_t total_deadline_slack_ns = 0;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_FLOWCONTROL_FLOWCONTROLLERSTATISTICS_HPP
@@ -25,6 +25,7 @@
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
 #include <fastdds/utils/TimedMutex.hpp>
 
@@ -243,6 +244,13 @@ public:
             const GUID_t& guid,
             CacheChange_t** change) const;
 
+    /**
+     * Get the memory held by the list of changes of the history.
+     * The mutex of the history should be locked by the caller.
+     * @return Memory used by the list of changes.
+     */
+    FASTDDS_EXPORTED_API fastdds::rtps::MemoryUsage get_memory_usage_nts() const;
+
     const_iterator get_change_nts(
             const SequenceNumber_t& seq,
             const GUID_t& guid,
@@ -24,6 +24,14 @@
 #include <fastdds/dds/log/Log.hpp>
 
 namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DataWriterHistory;
+
+} // namespace dds
+} // namespace fastdds
+
 namespace fastrtps {
 namespace rtps {
 
@@ -39,6 +47,7 @@ class WriterHistory : public rtps::History
     friend class RTPSWriter;
     friend class PersistentWriter;
     friend class IPersistenceService;
+    friend class fastdds::dds::DataWriterHistory;
 
     WriterHistory(
             WriterHistory&&) = delete;
@@ -150,6 +159,21 @@ protected:
     FASTDDS_EXPORTED_API void do_release_cache(
             CacheChange_t* ch) override;
 
+    /**
+     * Make the last change added to the history cover several consecutive sequence numbers.
+     * It should be called from a pre-commit hook, before the writer is notified of the change.
+     *
+     * @param [in] count  Number of sequence numbers covered by the last change.
+     */
+    void extend_last_sequence_number(
+            uint32_t count)
+    {
+        if (1 < count)
+        {
+            m_lastCacheChangeSeqNum += static_cast<int>(count - 1);
+        }
+    }
+
     /**
      * Introduce a change into the history, and let the associated writer send it.
      *
@@ -234,6 +258,21 @@ private:
             CacheChange_t* a_change,
             WriteParams& wparams);
 
+    /**
+     * Check a change and assign it the next sequence number, without introducing it into the history.
+     *
+     * @param [in,out] a_change  The change to be prepared.
+     *                           Its @c sequenceNumber and sourceTimestamp will be filled by this method.
+     *                           Its @c wparams will be filled from parameter @c wparams.
+     * @param [in,out] wparams   On input, it holds the WriteParams to be copied into @c a_change.
+     *                           On output, will be filled with the sample identity assigned to @c a_change.
+     *
+     * @return whether @c a_change is valid for this history.
+     */
+    bool prepare_change(
+            CacheChange_t* a_change,
+            WriteParams& wparams);
+
     /**
      * Notifies the RTPS writer associated with this history that a change has been added.
      * Depending on the publish mode, it will be directly sent to the wire, or put into a sending queue.
@@ -232,6 +232,19 @@ public:
         sender_ = msg_sender;
     }
 
+    /**
+     * Change the endpoint whose submessages are added, keeping the sender and the submessages already added.
+     * This allows sending submessages of several endpoints in the same RTPS message.
+     * @param endpoint Pointer to the endpoint adding the next submessages. Cannot be nullptr.
+     * @pre The message is not protected by security.
+     */
+    void endpoint(
+            Endpoint* endpoint)
+    {
+        assert(nullptr != endpoint && nullptr != sender_);
+        endpoint_ = endpoint;
+    }
+
     //! Maximum fragment size minus the headers
     static inline constexpr uint32_t get_max_fragment_payload_size()
     {
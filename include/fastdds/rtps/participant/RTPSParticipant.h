@@ -28,6 +28,8 @@
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerStatistics.hpp>
 #include <fastdds/statistics/IListeners.hpp>
 #include <fastdds/fastdds_dll.hpp>
 
@@ -220,6 +222,14 @@ public:
 
     ResourceEvent& get_resource_event() const;
 
+    /**
+     * Retrieves the event resource running the timed events owned by an entity.
+     * All the events of an entity run on the same thread.
+     * @param entity_guid GUID of the entity owning the events.
+     */
+    ResourceEvent& get_resource_event(
+            const GUID_t& entity_guid) const;
+
     /**
      * @brief A method to retrieve the built-in writer liveliness protocol
      * @return Writer liveliness protocol
@@ -292,6 +302,25 @@ public:
      */
     std::vector<fastdds::rtps::TransportNetmaskFilterInfo> get_netmask_filter_info() const;
 
+    /**
+     * @brief Returns the memory held by the send and receive buffers of the registered transports.
+     *
+     * @return Memory used by the transport buffers, including the shared memory segments.
+     */
+    fastdds::rtps::MemoryUsage get_transport_memory_usage() const;
+
+    /**
+     * @brief Get the counters of a flow controller of this participant.
+     * Only the flow controllers using the earliest deadline first scheduler keep counters.
+     *
+     * @param flow_controller_name Name of the flow controller.
+     * @param [out] statistics Counters of the flow controller.
+     * @return true if the flow controller exists and keeps counters, false otherwise.
+     */
+    bool get_flow_controller_statistics(
+            const std::string& flow_controller_name,
+            fastdds::rtps::FlowControllerStatistics& statistics) const;
+
 #if HAVE_SECURITY
 
     /**
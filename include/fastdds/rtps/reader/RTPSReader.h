@@ -24,6 +24,7 @@
 #include <fastdds/dds/core/status/LivelinessChangedStatus.hpp>
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastdds/rtps/common/VendorId_t.hpp>
@@ -117,6 +118,13 @@ public:
     FASTDDS_EXPORTED_API virtual bool matched_writer_is_matched(
             const GUID_t& writer_guid) = 0;
 
+    /**
+     * Get the memory held by this reader.
+     * @param [out] usage Filled with the memory used by the pools, the history and the matched writers.
+     */
+    FASTDDS_EXPORTED_API void get_memory_usage(
+            fastdds::rtps::EndpointMemoryUsage& usage) const;
+
     /**
      * Processes a new DATA message. Previously the message must have been accepted by function acceptMsgDirectedTo.
      *
@@ -485,6 +493,17 @@ protected:
     bool is_datasharing_compatible_with(
             const WriterProxyData& wdata);
 
+    /**
+     * Processes a DATA message carrying a batch of samples, by processing each of them as an individual change.
+     *
+     * @param batch Pointer to the CacheChange_t holding the batch.
+     * @param process_sample Functor processing each sample as a DATA message carrying a single sample.
+     * @return true if at least one of the samples was accepted.
+     */
+    bool process_data_batch_msg(
+            CacheChange_t* batch,
+            const std::function<bool(CacheChange_t*)>& process_sample);
+
     //!ReaderHistory
     ReaderHistory* mp_history;
     //!Listener
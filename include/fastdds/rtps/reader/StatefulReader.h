@@ -23,6 +23,7 @@
 
 #include <mutex>
 
+#include <fastdds/rtps/attributes/RTTAdaptiveTiming.hpp>
 #include <fastdds/rtps/common/CDRMessage_t.h>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
@@ -102,6 +103,14 @@ public:
     bool matched_writer_is_matched(
             const GUID_t& writer_guid) override;
 
+    /**
+     * Get the memory held by the structures kept for each matched writer, including the ones kept for later reuse.
+     * The mutex of the reader should be locked by the caller.
+     * @param [out] usage Memory used by the writer proxies.
+     */
+    void get_matched_writers_memory_usage_nts(
+            fastdds::rtps::MemoryUsage& usage) const;
+
     /**
      * Look for a specific WriterProxy.
      * @param writerGUID GUID_t of the writer we are looking for.
@@ -189,8 +198,8 @@ public:
     }
 
     /**
-     * Get reference to associated RTPS partiicipant's \c ResourceEvent
-     * @return Reference to associated RTPS partiicipant's \c ResourceEvent
+     * Get reference to the RTPS participant's \c ResourceEvent running the events of this reader
+     * @return Reference to the RTPS participant's \c ResourceEvent running the events of this reader
      */
     ResourceEvent& getEventResource() const;
 
@@ -268,10 +277,21 @@ public:
      * @param heartbeat_was_final Final flag of the last received heartbeat.
      */
     void send_acknack(
-            const WriterProxy* writer,
+            WriterProxy* writer,
             RTPSMessageSenderInterface* sender,
             bool heartbeat_was_final);
 
+    /**
+     * Get the estimated round-trip time to a matched writer.
+     * The estimation is only available when the RTT adaptive timing mode is enabled.
+     * @param writer_guid GUID of the writer.
+     * @param[out] rtt Smoothed round-trip time, measured from ACKNACK to the reception of the requested change.
+     * @return true when the writer is matched and there is an estimation available, false otherwise.
+     */
+    bool get_round_trip_time(
+            const GUID_t& writer_guid,
+            Duration_t& rtt) const;
+
     /**
      * Use the participant of this reader to send a message to certain locator.
      * @param message Message to be sent.
@@ -343,6 +363,22 @@ private:
             const GUID_t& entityGUID,
             WriterProxy** wp) const;
 
+    /**
+     * Processes a DATA message carrying a single sample.
+     * @param change Pointer to the CacheChange_t.
+     * @return true if the reader accepts messages from the writer.
+     */
+    bool process_data_sample_msg(
+            CacheChange_t* change);
+
+    /**
+     * Check whether a matched writer has announced it sends changes carrying a batch of samples.
+     * @param writer_guid GUID of the writer.
+     * @return true when the writer is matched and sends sample batches.
+     */
+    bool writer_sends_sample_batches(
+            const GUID_t& writer_guid);
+
     /*!
      * @remarks Non thread-safe.
      */
@@ -373,6 +409,8 @@ private:
     bool disable_positive_acks_;
     //! False when being destroyed
     bool is_alive_;
+    //! Bounds for adapting the heartbeat response delay to the round-trip time of the matched writers.
+    RTTAdaptiveTiming rtt_adaptive_timing_;
 };
 
 } /* namespace rtps */
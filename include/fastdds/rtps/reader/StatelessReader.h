@@ -22,6 +22,7 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <functional>
 #include <map>
 #include <mutex>
 
@@ -99,6 +100,14 @@ public:
     bool matched_writer_is_matched(
             const GUID_t& writer_guid) override;
 
+    /**
+     * Get the memory held by the structures kept for each matched writer, including the ones kept for later reuse.
+     * The mutex of the reader should be locked by the caller.
+     * @param [out] usage Memory used by the information kept for the matched writers.
+     */
+    void get_matched_writers_memory_usage_nts(
+            fastdds::rtps::MemoryUsage& usage) const;
+
     /**
      * Method to indicate the reader that some change has been removed due to HistoryQos requirements.
      * @param change Pointer to the CacheChange_t.
@@ -217,6 +226,18 @@ public:
     void assert_writer_liveliness(
             const GUID_t& guid) override;
 
+    /**
+     * Set a function processing the samples which are not part of the sequence of changes of their writer, like
+     * compact participant announcements.
+     * It is called without the mutex of the reader taken for every alive sample, before checking whether its writer
+     * is accepted and whether its sequence number was already received. The samples it consumes are not added to the
+     * history, and their sequence numbers are not recorded.
+     *
+     * @param processor Function returning true when it has consumed the sample.
+     */
+    void set_unsequenced_sample_processor(
+            std::function<bool(CacheChange_t&)> processor);
+
     /**
      * Called just before a change is going to be deserialized.
      * @param [in]  change            Pointer to the change being accessed.
@@ -268,12 +289,29 @@ private:
         CacheChange_t* fragmented_change = nullptr;
         bool is_datasharing = false;
         uint32_t ownership_strength;
+        bool sends_sample_batches = false;
     };
 
     bool acceptMsgFrom(
             const GUID_t& entityId,
             ChangeKind_t change_kind);
 
+    /**
+     * Processes a DATA message carrying a single sample.
+     * @param change Pointer to the CacheChange_t.
+     * @return true if the reader accepts messages from the writer.
+     */
+    bool process_data_sample_msg(
+            CacheChange_t* change);
+
+    /**
+     * Check whether a matched writer has announced it sends changes carrying a batch of samples.
+     * @param writer_guid GUID of the writer.
+     * @return true when the writer is matched and sends sample batches.
+     */
+    bool writer_sends_sample_batches(
+            const GUID_t& writer_guid);
+
     bool thereIsUpperRecordOf(
             const GUID_t& guid,
             const SequenceNumber_t& seq);
@@ -294,6 +332,9 @@ private:
     //!List of GUID_t os matched writers.
     //!Is only used in the Discovery, to correctly notify the user using SubscriptionListener::onSubscriptionMatched();
     ResourceLimitedVector<RemoteWriterInfo_t> matched_writers_;
+
+    //! Processor of the samples which are not part of the sequence of changes of their writer.
+    std::function<bool(CacheChange_t&)> unsequenced_sample_processor_;
 };
 
 } /* namespace rtps */
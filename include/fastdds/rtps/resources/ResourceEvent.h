@@ -39,6 +39,7 @@ namespace fastrtps {
 namespace rtps {
 
 class TimedEventImpl;
+class TimingWheel;
 
 /**
  * This class centralizes all operations over timed events in the same thread.
@@ -66,6 +67,22 @@ public:
             const char* name_fmt = "event %u",
             uint32_t thread_id = 0);
 
+    /*!
+     * @brief Method to initialize the internal thread.
+     *
+     * @param[in]  thread_cfg    Settings to apply to the created thread.
+     * @param[in]  name_fmt      A null-terminated string to be used as the format argument of
+     *                           a `snprintf` like function, taking `thread_id` and `thread_index`
+     *                           as additional arguments, and used to give a name to the created thread.
+     * @param[in]  thread_id     First variadic argument passed to the formatting function.
+     * @param[in]  thread_index  Second variadic argument passed to the formatting function.
+     */
+    void init_thread(
+            const fastdds::rtps::ThreadSettings& thread_cfg,
+            const char* name_fmt,
+            uint32_t thread_id,
+            uint32_t thread_index);
+
     void stop_thread();
 
     /*!
@@ -134,10 +151,10 @@ private:
     std::vector<TimedEventImpl*> pending_timers_;
 
     //! Collection of registered events waiting completion.
-    std::vector<TimedEventImpl*> active_timers_;
+    std::unique_ptr<TimingWheel> active_timers_;
 
-    //! Prevents iterator invalidation when active_timers are manipulated inside loops
-    std::atomic<bool> skip_checking_active_timers_;
+    //! Events being triggered by the execution thread.
+    std::vector<TimedEventImpl*> expired_timers_;
 
     //! Current time as seen by the execution thread.
     std::chrono::steady_clock::time_point current_time_;
@@ -157,9 +174,6 @@ private:
     //! Method called by the internal thread.
     void event_service();
 
-    //! Sorts waiting timers in ascending order of trigger time.
-    void sort_timers();
-
     //! Updates internal register of current time.
     void update_current_time();
 
@@ -170,7 +184,7 @@ private:
     void resize_collections()
     {
         pending_timers_.reserve(timers_count_);
-        active_timers_.reserve(timers_count_);
+        expired_timers_.reserve(timers_count_);
     }
 
 };
@@ -33,7 +33,8 @@ typedef enum MemoryManagementPolicy{
     PREALLOCATED_MEMORY_MODE, //!< Preallocated memory. Size set to the data type maximum. Largest memory footprint but smallest allocation count.
     PREALLOCATED_WITH_REALLOC_MEMORY_MODE, //!< Default size preallocated, requires reallocation when a bigger message arrives. Smaller memory footprint at the cost of an increased allocation count.
     DYNAMIC_RESERVE_MEMORY_MODE, //< Dynamic allocation at the time of message arrival. Least memory footprint but highest allocation count.
-    DYNAMIC_REUSABLE_MEMORY_MODE //< Like DYNAMIC_RESERVE_MEMORY_MODE but allocated memory is reused for future messages. Smaller allocation count at the cost of an increased memory footprint.
+    DYNAMIC_REUSABLE_MEMORY_MODE, //< Like DYNAMIC_RESERVE_MEMORY_MODE but allocated memory is reused for future messages. Smaller allocation count at the cost of an increased memory footprint.
+    DYNAMIC_SIZE_CLASS_MEMORY_MODE //< Like DYNAMIC_REUSABLE_MEMORY_MODE but allocated memory is only reused for messages of the same power of two size class. Occasional large messages do not increase the memory used by the small ones.
 }MemoryManagementPolicy_t;
 
 
@@ -11,7 +11,9 @@ enum class DeliveryRetCode : uint32_t
 {
     DELIVERED,
     NOT_DELIVERED,
-    EXCEEDED_LIMIT
+    EXCEEDED_LIMIT,
+    //! None of the destinations of the sample could be served because of their sending windows or rate limits.
+    EXCEEDED_DESTINATION_LIMIT
 };
 
 } // namespace rtps
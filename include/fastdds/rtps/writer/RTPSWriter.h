@@ -30,6 +30,7 @@
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 #include <fastdds/rtps/common/CdrSerialization.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/Endpoint.h>
 #include <fastdds/rtps/interfaces/IReaderDataFilter.hpp>
@@ -183,6 +184,13 @@ public:
     FASTDDS_EXPORTED_API virtual bool matched_reader_is_matched(
             const GUID_t& reader_guid) = 0;
 
+    /**
+     * Get the memory held by this writer.
+     * @param [out] usage Filled with the memory used by the pools, the history and the matched readers.
+     */
+    FASTDDS_EXPORTED_API void get_memory_usage(
+            fastdds::rtps::EndpointMemoryUsage& usage) const;
+
     /**
      * @brief Set a content filter to perform content filtering on this writer.
      *
@@ -492,6 +500,39 @@ public:
      */
     bool is_datasharing_compatible() const;
 
+    /**
+     * Make this writer send changes carrying a batch of samples, as built by the DataWriter.
+     * It should be called before the writer is announced, so the batches are only sent to readers supporting them.
+     */
+    void enable_sample_batches()
+    {
+        sample_batches_ = true;
+    }
+
+    /**
+     * @return Whether this writer sends changes carrying a batch of samples.
+     */
+    bool sends_sample_batches() const
+    {
+        return sample_batches_;
+    }
+
+    /**
+     * Check whether a change of this writer carries a batch of samples.
+     * @param change Change of this writer.
+     * @return true when the change carries a batch of samples.
+     */
+    bool is_sample_batch(
+            const CacheChange_t& change) const;
+
+    /**
+     * Get the number of sequence numbers covered by a change of this writer.
+     * @param change Change of this writer.
+     * @return the number of samples when the change carries a batch of samples, 1 otherwise.
+     */
+    uint32_t sequence_number_span(
+            const CacheChange_t& change) const;
+
     /*!
      * Tells writer the sample can be sent to the network.
      * This function should be used by a fastdds::rtps::FlowController.
@@ -514,6 +555,22 @@ public:
 
     virtual LocatorSelectorSender& get_async_locator_selector() = 0;
 
+    /**
+     * Opens a batch of new changes.
+     * While the batch is open, the new changes sent synchronously by the flow controller are packed into the same
+     * RTPS messages, which are sent when the batch is closed with end_sample_batch().
+     *
+     * @param max_blocking_time Future timepoint where blocking send should end.
+     * @pre The writer's mutex must be kept locked until end_sample_batch() is called.
+     */
+    void begin_sample_batch(
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Closes the batch opened with begin_sample_batch(), sending the pending RTPS messages.
+     */
+    void end_sample_batch();
+
     /**
      * Send a message through this interface.
      *
@@ -543,6 +600,8 @@ protected:
     bool is_async_ = false;
     //!Separate sending activated
     bool m_separateSendingEnabled = false;
+    //!Changes may carry a batch of samples
+    bool sample_batches_ = false;
 
     //! The liveliness kind of this writer
     LivelinessQosPolicyKind liveliness_kind_;
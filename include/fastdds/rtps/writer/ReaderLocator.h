@@ -23,6 +23,7 @@
 #include <vector>
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
 #include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
@@ -64,6 +65,17 @@ public:
         return expects_inline_qos_;
     }
 
+    bool accepts_sample_batches() const
+    {
+        return accepts_sample_batches_;
+    }
+
+    void accepts_sample_batches(
+            bool accepts_sample_batches)
+    {
+        accepts_sample_batches_ = accepts_sample_batches;
+    }
+
     bool is_local_reader() const
     {
         return is_local_reader_;
@@ -236,6 +248,12 @@ public:
 
     }
 
+    /**
+     * Get the memory held by the locator lists of this reader.
+     * @return Memory used by the locators and the selection state of this reader.
+     */
+    fastdds::rtps::MemoryUsage get_memory_usage() const;
+
     /*
      * Do nothing.
      * This object always is protected by writer's mutex.
@@ -264,6 +282,7 @@ private:
     std::vector<GuidPrefix_t> guid_prefix_as_vector_;
     std::vector<GUID_t> guid_as_vector_;
     IDataSharingNotifier* datasharing_notifier_;
+    bool accepts_sample_batches_ = false;
 };
 
 } /* namespace rtps */
@@ -30,6 +30,8 @@
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/common/FragmentNumber.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+#include <fastdds/rtps/common/RoundTripTimeEstimator.hpp>
 
 #include <fastdds/rtps/writer/ChangeForReader.h>
 #include <fastdds/rtps/writer/ReaderLocator.h>
@@ -40,6 +42,7 @@
 #include <mutex>
 #include <set>
 #include <atomic>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -167,6 +170,22 @@ public:
             RTPSGapBuilder& gap_builder,
             const SequenceNumber_t& min_seq_in_history);
 
+    /**
+     * Append the sequence numbers of all the REQUESTED changes.
+     * @param[out] seq_nums Collection where the sequence numbers are appended, in ascending order.
+     */
+    void requested_changes_get(
+            std::vector<SequenceNumber_t>& seq_nums) const;
+
+    /**
+     * Mark as REQUESTED the UNACKNOWLEDGED changes whose sequence numbers were requested by another reader.
+     * Used to merge the repair requests of the readers sharing a multicast locator.
+     * @param seq_nums Sequence numbers requested by the other reader, in ascending order.
+     * @return the number of changes that have been marked as REQUESTED.
+     */
+    uint32_t requested_changes_merge(
+            const std::vector<SequenceNumber_t>& seq_nums);
+
     /**
      * Performs processing of preemptive acknack
      * @param func functor called, if the requester is a local reader, for each changes moved to UNSENT status.
@@ -422,6 +441,44 @@ public:
             const SequenceNumber_t& seq_number,
             bool& found) const;
 
+    /**
+     * Notify that a HEARTBEAT requiring a response has been sent to the remote reader.
+     * @param now Time point when the HEARTBEAT was sent.
+     */
+    void heartbeat_sent(
+            const std::chrono::steady_clock::time_point& now)
+    {
+        rtt_estimator_.request_sent(now);
+    }
+
+    /**
+     * Notify that an ACKNACK has been received from the remote reader.
+     * @param now Time point when the ACKNACK was received.
+     * @param response_delay Time the remote reader waits before answering a HEARTBEAT.
+     * @return true when the round-trip time estimation has been updated, false otherwise.
+     */
+    bool acknack_received(
+            const std::chrono::steady_clock::time_point& now,
+            std::chrono::nanoseconds response_delay)
+    {
+        return rtt_estimator_.response_received(now, response_delay);
+    }
+
+    /**
+     * Get the estimation of the round-trip time to the remote reader.
+     * @return the round-trip time estimator of this proxy.
+     */
+    const RoundTripTimeEstimator& rtt_estimator() const
+    {
+        return rtt_estimator_;
+    }
+
+    /**
+     * Get the memory held by the containers of this proxy.
+     * @return Memory used by the changes tracked for the reader and by its locators.
+     */
+    fastdds::rtps::MemoryUsage get_memory_usage() const;
+
 private:
 
     //!Is this proxy active? I.e. does it have a remote reader associated?
@@ -454,6 +511,9 @@ private:
 
     bool active_ = false;
 
+    //! Round-trip time estimation, measured from HEARTBEAT to ACKNACK.
+    RoundTripTimeEstimator rtt_estimator_;
+
     using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
     using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
 
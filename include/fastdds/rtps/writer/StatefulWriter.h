@@ -21,9 +21,13 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
+#include <vector>
 
+#include <fastdds/rtps/attributes/RTTAdaptiveTiming.hpp>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/history/IChangePool.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
@@ -35,6 +39,7 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class HeartbeatScheduler;
 class ReaderProxy;
 class TimedEvent;
 
@@ -46,6 +51,7 @@ class StatefulWriter : public RTPSWriter
 {
     friend class RTPSParticipantImpl;
     friend class ReaderProxy;
+    friend class HeartbeatScheduler;
 
 public:
 
@@ -206,6 +212,14 @@ public:
     bool matched_reader_is_matched(
             const GUID_t& reader_guid) override;
 
+    /**
+     * Get the memory held by the structures kept for each matched reader, including the ones kept for later reuse.
+     * The mutex of the writer should be locked by the caller.
+     * @param [out] usage Memory used by the reader proxies.
+     */
+    void get_matched_readers_memory_usage_nts(
+            fastdds::rtps::MemoryUsage& usage) const;
+
     /**
      * @brief Check if a specific change has been delivered to the transport layer at least once for every matched
      * remote RTPSReader.
@@ -332,6 +346,17 @@ public:
 
     SequenceNumber_t next_sequence_number() const;
 
+    /**
+     * Get the estimated round-trip time to a matched remote reader.
+     * The estimation is only available when the RTT adaptive timing mode is enabled.
+     * @param reader_guid GUID of the remote reader.
+     * @param[out] rtt Smoothed round-trip time, measured from HEARTBEAT to ACKNACK.
+     * @return true when the reader is matched and there is an estimation available, false otherwise.
+     */
+    bool get_round_trip_time(
+            const GUID_t& reader_guid,
+            Duration_t& rtt) const;
+
     /**
      * @brief Sends a periodic heartbeat
      *
@@ -344,6 +369,39 @@ public:
             bool final = false,
             bool liveliness = false);
 
+    /**
+     * Start the periodic heartbeats, either on the own timer or on the heartbeat scheduler of the participant.
+     */
+    void restart_periodic_heartbeat();
+
+    /**
+     * Start the periodic heartbeats, either on the own timer or on the heartbeat scheduler of the participant.
+     *
+     * @param max_blocking_time Maximum time to wait for the timer to be started.
+     */
+    void restart_periodic_heartbeat(
+            const std::chrono::steady_clock::time_point& max_blocking_time);
+
+    /**
+     * Prepare the periodic heartbeat of this writer in a tick of the heartbeat scheduler.
+     * Notifies the local readers, and passes the remote reliable readers to the scheduler, which will later call
+     * add_coalesced_heartbeat_nts() with the message of each remote participant.
+     * When there are no unacknowledged changes, the periodic heartbeats of the writer are deactivated.
+     *
+     * @param add_remote_reader Functor receiving the GUID and the locators of each remote reliable reader.
+     */
+    void prepare_coalesced_heartbeat(
+            const std::function<void(const GUID_t&, const LocatorSelectorEntry&)>& add_remote_reader);
+
+    /**
+     * Add the periodic heartbeat of this writer to a message of the heartbeat scheduler.
+     *
+     * @param group Message directed to a remote participant.
+     * @remarks This function is non thread-safe.
+     */
+    void add_coalesced_heartbeat_nts(
+            RTPSMessageGroup& group);
+
     /*!
      * @brief Sends a heartbeat to a remote reader.
      *
@@ -479,6 +537,27 @@ private:
 
     void check_acked_status();
 
+    /**
+     * Calculates the interval of the ACKNACK response event, taking into account the NACK aggregation window.
+     * @param times WriterTimes from which the NACK response delay is taken.
+     * @return Interval in milliseconds.
+     */
+    double nack_response_interval_ms(
+            const WriterTimes& times) const;
+
+    /**
+     * Merges the changes requested by each remote reader into the rest of remote readers sharing a multicast
+     * locator with it, so a single multicast repair is sent for all of them.
+     */
+    void merge_multicast_nack_requests_nts();
+
+    /**
+     * Adapts the protocol timings after the round-trip time estimation of a remote reader has been updated.
+     * @param reader The ReaderProxy whose estimation has been updated.
+     */
+    void on_reader_rtt_updated_nts(
+            ReaderProxy* reader);
+
     /**
      * @brief A method called when the ack timer expires
      *
@@ -543,6 +622,19 @@ private:
     LocatorSelectorSender locator_selector_general_;
 
     LocatorSelectorSender locator_selector_async_;
+
+    //! Time during which ACKNACKs are aggregated before answering them, in milliseconds [0, 60000]. 0 disables it.
+    double nack_aggregation_window_ms_ = 0;
+    //! Auxiliary collection of requested sequence numbers used while aggregating ACKNACKs.
+    std::vector<SequenceNumber_t> nack_aggregation_requested_;
+
+    //! Bounds for adapting the heartbeat period to the round-trip time of the matched readers.
+    RTTAdaptiveTiming rtt_adaptive_timing_;
+
+    //! Participant scheduler sending the periodic heartbeats. nullptr when the writer uses its own timer.
+    HeartbeatScheduler* heartbeat_scheduler_ = nullptr;
+    //! Whether the heartbeat scheduler has to send periodic heartbeats for this writer.
+    std::atomic<bool> coalesced_heartbeat_pending_{false};
 };
 
 } /* namespace rtps */
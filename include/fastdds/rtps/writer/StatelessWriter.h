@@ -33,6 +33,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -123,6 +124,14 @@ public:
     bool matched_reader_is_matched(
             const GUID_t& reader_guid) override;
 
+    /**
+     * Get the memory held by the structures kept for each matched reader, including the ones kept for later reuse.
+     * The mutex of the writer should be locked by the caller.
+     * @param [out] usage Memory used by the reader locators.
+     */
+    void get_matched_readers_memory_usage_nts(
+            fastdds::rtps::MemoryUsage& usage) const;
+
     /**
      * @brief Set a content filter to perform content filtering on this writer.
      *
@@ -266,10 +275,29 @@ private:
             CacheChange_t* change,
             ReaderLocator& reader_locator);
 
+    //! Check if a change should be sent to a matched reader
+    bool is_relevant_for(
+            const CacheChange_t& change,
+            const ReaderLocator& reader_locator) const;
+
     //! Check if a specific sequence number has been sent to every remote RTPSReader
     bool is_acked_by_all(
             const SequenceNumber_t& seq_num) const;
 
+    /*!
+     * Takes bytes from the rate limits of the participants a change is going to be sent to.
+     * Nothing is taken if any of them does not hold enough bytes.
+     *
+     * @return true if the change can be sent to all of them.
+     */
+    bool try_reserve_participants_bytes(
+            const CacheChange_t& change,
+            uint32_t bytes);
+
+    //! Gives back the bytes taken by try_reserve_participants_bytes() which were not sent.
+    void refund_participants_bytes(
+            uint32_t bytes);
+
 
     bool is_inline_qos_expected_ = false;
     LocatorList_t fixed_locators_;
@@ -290,6 +318,9 @@ private:
     LocatorSelectorSender locator_selector_;
 
     fastdds::rtps::IReaderDataFilter* reader_data_filter_ = nullptr;
+
+    //! Participants whose rate limits were charged for the submessage being sent.
+    std::vector<GuidPrefix_t> charged_participants_;
 };
 
 } /* namespace rtps */
@@ -19,6 +19,7 @@
 #ifndef _FASTDDS_STATISTICS_RTPS_STATISTICSCOMMON_HPP_
 #define _FASTDDS_STATISTICS_RTPS_STATISTICSCOMMON_HPP_
 
+#include <chrono>
 #include <memory>
 #include <type_traits>
 
@@ -207,6 +208,15 @@ protected:
      */
     void on_resent_data(
             uint32_t to_send);
+
+    /**
+     * @brief Report that the round-trip time estimation to a matched reader has been updated
+     * @param reader_guid GUID of the matched reader
+     * @param rtt smoothed round-trip time
+     */
+    void on_round_trip_time(
+            const fastrtps::rtps::GUID_t& reader_guid,
+            std::chrono::nanoseconds rtt);
 };
 
 // Members are private details
@@ -273,6 +283,15 @@ protected:
      */
     void on_subscribe_throughput(
             uint32_t payload);
+
+    /**
+     * @brief Report that the round-trip time estimation to a matched writer has been updated
+     * @param writer_guid GUID of the matched writer
+     * @param rtt smoothed round-trip time
+     */
+    void on_round_trip_time(
+            const fastrtps::rtps::GUID_t& writer_guid,
+            std::chrono::nanoseconds rtt);
 };
 
 #else // when FASTDDS_STATISTICS is not defined a dummy implementation is used
@@ -340,6 +359,17 @@ protected:
     {
     }
 
+    /**
+     * @brief Report that the round-trip time estimation to a matched reader has been updated
+     * Parameter: GUID of the matched reader
+     * Parameter: smoothed round-trip time
+     */
+    inline void on_round_trip_time(
+            const fastrtps::rtps::GUID_t&,
+            std::chrono::nanoseconds)
+    {
+    }
+
 };
 
 class StatisticsReaderImpl
@@ -388,6 +418,17 @@ protected:
     {
     }
 
+    /**
+     * @brief Report that the round-trip time estimation to a matched writer has been updated
+     * Parameter: GUID of the matched writer
+     * Parameter: smoothed round-trip time
+     */
+    inline void on_round_trip_time(
+            const fastrtps::rtps::GUID_t&,
+            std::chrono::nanoseconds)
+    {
+    }
+
 };
 
 #endif // FASTDDS_STATISTICS
@@ -59,6 +59,12 @@ constexpr const char* DISCOVERY_TOPIC = "_fastdds_statistics_discovered_entity";
 constexpr const char* SAMPLE_DATAS_TOPIC = "_fastdds_statistics_sample_datas";
 //! Statistics topic that reports the host, user and process where the module is running
 constexpr const char* PHYSICAL_DATA_TOPIC = "_fastdds_statistics_physical_data";
+//! Statistics topic that reports the round-trip time estimated by reliable endpoints using the RTT adaptive timing
+//! mode for each matched remote endpoint
+constexpr const char* ROUND_TRIP_TIME_TOPIC = "_fastdds_statistics_round_trip_time";
+//! Statistics topic that periodically reports the bytes reserved by each DataWriter and DataReader, and by the
+//! transport buffers of the participant
+constexpr const char* MEMORY_USAGE_TOPIC = "_fastdds_statistics_memory_usage";
 //! Statistics topic that enables the monitor service feature
 constexpr const char* MONITOR_SERVICE_TOPIC = "_fastdds_monitor_service_status";
 
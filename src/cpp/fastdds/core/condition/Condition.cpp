@@ -34,6 +34,11 @@ Condition::~Condition()
     notifier_->will_be_deleted(*this);
 }
 
+int Condition::get_native_handle() const
+{
+    return notifier_->get_native_handle(get_trigger_value());
+}
+
 }  // namespace dds
 }  // namespace fastdds
 }  // namespace eprosima
@@ -52,6 +52,8 @@ void ConditionNotifier::detach_from (
 
 void ConditionNotifier::notify ()
 {
+    event_.signal();
+
     std::lock_guard<std::mutex> guard(mutex_);
     for (WaitSetImpl* wait_set : entries_)
     {
@@ -59,6 +61,17 @@ void ConditionNotifier::notify ()
     }
 }
 
+int ConditionNotifier::get_native_handle (
+        bool is_triggered)
+{
+    int handle = event_.native_handle();
+    if (is_triggered)
+    {
+        event_.signal();
+    }
+    return handle;
+}
+
 void ConditionNotifier::will_be_deleted (
         const Condition& condition)
 {
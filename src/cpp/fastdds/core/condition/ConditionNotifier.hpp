@@ -23,6 +23,7 @@
 
 #include <fastdds/dds/core/condition/Condition.hpp>
 
+#include <fastdds/core/condition/PollableEvent.hpp>
 #include <utils/collections/unordered_vector.hpp>
 
 namespace eprosima {
@@ -52,10 +53,20 @@ struct ConditionNotifier
             WaitSetImpl* wait_set);
 
     /**
-     * Wake up all the WaitSet implementations attached to this notifier.
+     * Wake up all the WaitSet implementations attached to this notifier, and signal the native handle if it was
+     * requested.
      */
     void notify ();
 
+    /**
+     * Get the native handle signalled each time notify() is called.
+     * @param is_triggered Whether the condition is currently triggered. In that case the handle is signalled
+     *                     right away, so a trigger happening before the handle is created is not lost.
+     * @return The native handle, or -1 if not supported on this platform.
+     */
+    int get_native_handle (
+            bool is_triggered);
+
     /**
      * Inform all the WaitSet implementations attached to this notifier that
      * a condition is going to be deleted.
@@ -68,6 +79,7 @@ private:
 
     std::mutex mutex_;
     eprosima::utilities::collections::unordered_vector<WaitSetImpl*> entries_;
+    PollableEvent event_;
 };
 
 }  // namespace detail
@@ -0,0 +1,132 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PollableEvent.hpp
+ */
+
+#ifndef _FASTDDS_CORE_CONDITION_POLLABLEEVENT_HPP_
+#define _FASTDDS_CORE_CONDITION_POLLABLEEVENT_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif // ifdef __linux__
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Event exposing an OS handle which becomes readable when the event is signalled, so it can be waited on with
+ * poll, epoll or select together with other file descriptors.
+ * The handle is only created the first time it is requested, so users not asking for it pay nothing on signal().
+ * Only supported on Linux, where an eventfd is used. On other platforms no handle is ever created.
+ */
+class PollableEvent
+{
+public:
+
+    PollableEvent() = default;
+
+    ~PollableEvent()
+    {
+#ifdef __linux__
+        int fd = fd_.load();
+        if (0 <= fd)
+        {
+            ::close(fd);
+        }
+#endif // ifdef __linux__
+    }
+
+    // Non-copyable
+    PollableEvent(
+            const PollableEvent&) = delete;
+    PollableEvent& operator =(
+            const PollableEvent&) = delete;
+
+    /**
+     * Get the OS handle of this event, creating it if necessary.
+     * @return The handle, or -1 if it could not be created or it is not supported on this platform.
+     */
+    int native_handle()
+    {
+#ifdef __linux__
+        int fd = fd_.load();
+        if (0 > fd)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            fd = fd_.load();
+            if (0 > fd)
+            {
+                fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+                fd_.store(fd);
+            }
+        }
+        return fd;
+#else
+        return -1;
+#endif // ifdef __linux__
+    }
+
+    /**
+     * Make the handle readable. Does nothing if the handle has not been created.
+     */
+    void signal()
+    {
+#ifdef __linux__
+        int fd = fd_.load();
+        if (0 <= fd)
+        {
+            uint64_t value = 1;
+            ssize_t ret = ::write(fd, &value, sizeof(value));
+            static_cast<void>(ret);
+        }
+#endif // ifdef __linux__
+    }
+
+    /**
+     * Make the handle not readable until the next call to signal().
+     */
+    void clear()
+    {
+#ifdef __linux__
+        int fd = fd_.load();
+        if (0 <= fd)
+        {
+            uint64_t value = 0;
+            ssize_t ret = ::read(fd, &value, sizeof(value));
+            static_cast<void>(ret);
+        }
+#endif // ifdef __linux__
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::atomic<int> fd_{-1};
+};
+
+}  // namespace detail
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif // _FASTDDS_CORE_CONDITION_POLLABLEEVENT_HPP_
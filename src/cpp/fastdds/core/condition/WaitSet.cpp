@@ -59,6 +59,11 @@ ReturnCode_t WaitSet::get_conditions(
     return impl_->get_conditions(attached_conditions);
 }
 
+int WaitSet::get_native_handle() const
+{
+    return impl_->get_native_handle();
+}
+
 }  // namespace dds
 }  // namespace fastdds
 }  // namespace eprosima
@@ -72,9 +72,13 @@ ReturnCode_t WaitSetImpl::attach_condition(
             std::lock_guard<std::mutex> guard(mutex_);
 
             // Should wake_up when adding a new triggered condition
-            if (is_waiting_ && condition.get_trigger_value())
+            if (condition.get_trigger_value())
             {
-                cond_.notify_one();
+                event_.signal();
+                if (is_waiting_)
+                {
+                    cond_.notify_one();
+                }
             }
         }
     }
@@ -130,6 +134,10 @@ ReturnCode_t WaitSetImpl::wait(
                 return ret_val;
             };
 
+    // Conditions are checked below, so any previous signal on the native handle is consumed here. It is raised
+    // again before returning if some condition is still active, as the handle is level-triggered.
+    event_.clear();
+
     bool condition_value = false;
     is_waiting_ = true;
     if (fastrtps::c_TimeInfinite == timeout)
@@ -144,6 +152,11 @@ ReturnCode_t WaitSetImpl::wait(
     }
     is_waiting_ = false;
 
+    if (condition_value)
+    {
+        event_.signal();
+    }
+
     return condition_value ? RETCODE_OK : RETCODE_TIMEOUT;
 }
 
@@ -160,9 +173,26 @@ ReturnCode_t WaitSetImpl::get_conditions(
     return RETCODE_OK;
 }
 
+int WaitSetImpl::get_native_handle()
+{
+    int handle = event_.native_handle();
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (const Condition* c : entries_)
+    {
+        if (c->get_trigger_value())
+        {
+            event_.signal();
+            break;
+        }
+    }
+    return handle;
+}
+
 void WaitSetImpl::wake_up()
 {
     std::lock_guard<std::mutex> guard(mutex_);
+    event_.signal();
     cond_.notify_one();
 }
 
@@ -25,6 +25,8 @@
 #include <fastdds/dds/core/condition/Condition.hpp>
 #include <fastdds/dds/core/ReturnCode.hpp>
 #include <fastdds/rtps/common/Time_t.h>
+
+#include <fastdds/core/condition/PollableEvent.hpp>
 #include <utils/collections/unordered_vector.hpp>
 
 namespace eprosima {
@@ -94,7 +96,15 @@ struct WaitSetImpl
             ConditionSeq& attached_conditions) const;
 
     /**
-     * @brief Wake up this WaitSet implementation if it was waiting
+     * @brief Retrieve the native handle signalled when any of the attached conditions may have been triggered.
+     * The handle is signalled right away if any of the attached conditions is already triggered, and cleared
+     * on each call to wait.
+     * @return The native handle, or -1 if not supported on this platform
+     */
+    int get_native_handle();
+
+    /**
+     * @brief Wake up this WaitSet implementation if it was waiting, and signal the native handle if it was requested
      */
     void wake_up();
 
@@ -111,6 +121,7 @@ private:
     std::condition_variable cond_;
     eprosima::utilities::collections::unordered_vector<const Condition*> entries_;
     bool is_waiting_ = false;
+    PollableEvent event_;
 };
 
 }  // namespace detail
@@ -249,6 +249,25 @@ ReturnCode_t DomainParticipant::unregister_content_filter_factory(
     return impl_->unregister_content_filter_factory(filter_class_name);
 }
 
+ReturnCode_t DomainParticipant::get_memory_usage(
+        fastdds::rtps::ParticipantMemoryUsage& usage) const
+{
+    return impl_->get_memory_usage(usage);
+}
+
+ReturnCode_t DomainParticipant::get_flow_controller_statistics(
+        const std::string& flow_controller_name,
+        fastdds::rtps::FlowControllerStatistics& statistics) const
+{
+    return impl_->get_flow_controller_statistics(flow_controller_name, statistics);
+}
+
+ReturnCode_t DomainParticipant::get_listener_executor_metrics(
+        ListenerExecutorMetrics& metrics) const
+{
+    return impl_->get_listener_executor_metrics(metrics);
+}
+
 Topic* DomainParticipant::find_topic(
         const std::string& topic_name,
         const fastrtps::Duration_t& timeout)
@@ -284,6 +284,13 @@ ReturnCode_t DomainParticipantImpl::enable()
 
     guid_ = part->getGuid();
 
+    if (0 < qos_.listener_executor_threads())
+    {
+        uint32_t id_for_thread = static_cast<uint32_t>(part->getRTPSParticipantAttributes().participantID);
+        listener_executor_.reset(new ListenerExecutor(id_for_thread, qos_.listener_executor_threads(),
+                qos_.listener_executor_thread()));
+    }
+
     {
         std::lock_guard<std::mutex> _(mtx_gs_);
 
@@ -735,6 +742,66 @@ ReturnCode_t DomainParticipantImpl::unregister_content_filter_factory(
     return RETCODE_OK;
 }
 
+ReturnCode_t DomainParticipantImpl::get_memory_usage(
+        fastdds::rtps::ParticipantMemoryUsage& usage) const
+{
+    if (nullptr == rtps_participant_)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    usage.writers.clear();
+    usage.readers.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(mtx_pubs_);
+        for (auto& pub : publishers_)
+        {
+            pub.second->get_memory_usage(usage.writers);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mtx_subs_);
+        for (auto& sub : subscribers_)
+        {
+            sub.second->get_memory_usage(usage.readers);
+        }
+    }
+
+    usage.transport_buffers = rtps_participant_->get_transport_memory_usage();
+    return RETCODE_OK;
+}
+
+ReturnCode_t DomainParticipantImpl::get_flow_controller_statistics(
+        const std::string& flow_controller_name,
+        fastdds::rtps::FlowControllerStatistics& statistics) const
+{
+    if (nullptr == rtps_participant_)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    if (!rtps_participant_->get_flow_controller_statistics(flow_controller_name, statistics))
+    {
+        return RETCODE_BAD_PARAMETER;
+    }
+
+    return RETCODE_OK;
+}
+
+ReturnCode_t DomainParticipantImpl::get_listener_executor_metrics(
+        ListenerExecutorMetrics& metrics) const
+{
+    if (!listener_executor_)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    listener_executor_->get_metrics(metrics);
+    return RETCODE_OK;
+}
+
 IContentFilterFactory* DomainParticipantImpl::find_content_filter_factory(
         const char* filter_class_name)
 {
@@ -1823,6 +1890,12 @@ bool DomainParticipantImpl::can_qos_be_updated(
         EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
                 "Participant timed_events_thread cannot be changed after the participant is enabled");
     }
+    if (to.timed_events_threads() != from.timed_events_threads())
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant timed_events_threads cannot be changed after the participant is enabled");
+    }
     if (!(to.discovery_server_thread() == from.discovery_server_thread()))
     {
         updatable = false;
@@ -1835,6 +1908,24 @@ bool DomainParticipantImpl::can_qos_be_updated(
         EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
                 "Participant typelookup_service_thread cannot be changed after the participant is enabled");
     }
+    if (!(to.persistence_thread() == from.persistence_thread()))
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant persistence_thread cannot be changed after the participant is enabled");
+    }
+    if (!(to.listener_executor_thread() == from.listener_executor_thread()))
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant listener_executor_thread cannot be changed after the participant is enabled");
+    }
+    if (to.listener_executor_threads() != from.listener_executor_threads())
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant listener_executor_threads cannot be changed after the participant is enabled");
+    }
 #if HAVE_SECURITY
     if (!(to.security_log_thread() == from.security_log_thread()))
     {
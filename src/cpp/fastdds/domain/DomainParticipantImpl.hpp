@@ -23,10 +23,12 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 
 #include <fastdds/dds/core/ReturnCode.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
+#include <fastdds/dds/domain/ListenerExecutorMetrics.hpp>
 #include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
 #include <fastdds/dds/domain/qos/ReplierQos.hpp>
 #include <fastdds/dds/domain/qos/RequesterQos.hpp>
@@ -38,10 +40,12 @@
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/flowcontrol/FlowControllerStatistics.hpp>
 #include <fastdds/rtps/participant/RTPSParticipantListener.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
 
 #include "fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp"
+#include <fastdds/subscriber/ListenerExecutor.hpp>
 #include <fastdds/topic/TopicProxyFactory.hpp>
 
 
@@ -292,6 +296,25 @@ public:
     ReturnCode_t unregister_content_filter_factory(
             const char* filter_class_name);
 
+    ReturnCode_t get_memory_usage(
+            fastdds::rtps::ParticipantMemoryUsage& usage) const;
+
+    ReturnCode_t get_flow_controller_statistics(
+            const std::string& flow_controller_name,
+            fastdds::rtps::FlowControllerStatistics& statistics) const;
+
+    ReturnCode_t get_listener_executor_metrics(
+            ListenerExecutorMetrics& metrics) const;
+
+    /**
+     * Get the executor running the DataReader listener callbacks.
+     * @return The executor, or nullptr if callbacks are called from the reception threads.
+     */
+    ListenerExecutor* get_listener_executor() const
+    {
+        return listener_executor_.get();
+    }
+
     /**
      * Looks up an existing, locally created @ref TopicDescription, based on its name.
      * May be called on a disabled participant.
@@ -575,6 +598,9 @@ protected:
 
     std::atomic<uint32_t> id_counter_;
 
+    //! Executor of the DataReader listener callbacks. Created on enable, when configured.
+    std::unique_ptr<ListenerExecutor> listener_executor_;
+
     class MyRTPSParticipantListener : public fastrtps::rtps::RTPSParticipantListener
     {
         struct Sentry
@@ -106,6 +106,12 @@ ReturnCode_t DataWriter::write_w_timestamp(
     return impl_->write_w_timestamp(data, handle, timestamp);
 }
 
+ReturnCode_t DataWriter::write_many(
+        const std::vector<void*>& data)
+{
+    return impl_->write_many(data);
+}
+
 InstanceHandle_t DataWriter::register_instance(
         void* instance)
 {
@@ -26,6 +26,8 @@
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 
+#include <utils/collections/sorted_vector_find.hpp>
+
 namespace eprosima {
 namespace fastdds {
 namespace dds {
@@ -81,6 +83,14 @@ DataWriterHistory::DataWriterHistory(
     {
         resource_limited_qos_.max_samples_per_instance = std::numeric_limits<int32_t>::max();
     }
+
+    // With a preallocated memory policy, bounded instances are also preallocated
+    if (topic_att_.getTopicKind() == WITH_KEY &&
+            resource_limited_qos_.max_instances < std::numeric_limits<int32_t>::max() &&
+            (mempolicy == PREALLOCATED_MEMORY_MODE || mempolicy == PREALLOCATED_WITH_REALLOC_MEMORY_MODE))
+    {
+        keyed_changes_.reserve(static_cast<size_t>(resource_limited_qos_.max_instances));
+    }
 }
 
 DataWriterHistory::~DataWriterHistory()
@@ -172,6 +182,28 @@ bool DataWriterHistory::prepare_change(
 
     assert(!m_isHistoryFull);
 
+    // The depth is kept per sample, so older changes are removed until the samples of this one fit
+    if (history_qos_.kind == KEEP_LAST_HISTORY_QOS && topic_att_.getTopicKind() == NO_KEY &&
+            mp_writer->sends_sample_batches())
+    {
+        size_t samples = samples_in(m_changes) + mp_writer->sequence_number_span(*change);
+        while (samples > static_cast<size_t>(history_qos_.depth) && !m_changes.empty())
+        {
+            bool is_acked = change_is_acked_or_fully_delivered(m_changes.front());
+            uint32_t removed_samples = mp_writer->sequence_number_span(*m_changes.front());
+            if (!remove_min_change(max_blocking_time))
+            {
+                return false;
+            }
+
+            if (!is_acked)
+            {
+                unacknowledged_sample_removed_functor_(HANDLE_NIL);
+            }
+            samples -= removed_samples;
+        }
+    }
+
     // For NO_KEY we can directly add the change
     bool add = (topic_att_.getTopicKind() == NO_KEY);
     if (topic_att_.getTopicKind() == WITH_KEY)
@@ -191,7 +223,9 @@ bool DataWriterHistory::prepare_change(
 
             if (history_qos_.kind == KEEP_LAST_HISTORY_QOS)
             {
-                if (vit->second.cache_changes.size() < static_cast<size_t>(history_qos_.depth))
+                if (vit->second.cache_changes.empty() ||
+                        samples_in(vit->second.cache_changes) + mp_writer->sequence_number_span(*change) <=
+                        static_cast<size_t>(history_qos_.depth))
                 {
                     add = true;
                 }
@@ -279,6 +313,20 @@ bool DataWriterHistory::add_pub_change(
     return returnedValue;
 }
 
+bool DataWriterHistory::add_pub_batch(
+        CacheChange_t* change,
+        WriteParams& wparams,
+        uint32_t sample_count,
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    auto batch_hook = [this, sample_count](CacheChange_t&)
+            {
+                extend_last_sequence_number(sample_count);
+            };
+    return add_pub_change_with_commit_hook(change, wparams, batch_hook, lock, max_blocking_time);
+}
+
 bool DataWriterHistory::find_or_add_key(
         const InstanceHandle_t& instance_handle,
         const SerializedPayload_t& payload,
@@ -296,7 +344,7 @@ bool DataWriterHistory::find_or_add_key(
 
     if (static_cast<int>(keyed_changes_.size()) < resource_limited_qos_.max_instances)
     {
-        vit = keyed_changes_.insert(std::make_pair(instance_handle, detail::DataWriterInstance())).first;
+        vit = keyed_changes_.emplace(instance_handle).first;
         vit->second.key_payload.copy(&payload, false);
         *vit_out = vit;
         return true;
@@ -334,6 +382,18 @@ bool DataWriterHistory::removeAllChange(
     return false;
 }
 
+fastdds::rtps::MemoryUsage DataWriterHistory::get_instances_memory_usage() const
+{
+    fastdds::rtps::MemoryUsage usage;
+    if (mp_mutex != nullptr)
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(*this->mp_mutex);
+        usage.live_bytes = keyed_changes_.used_bytes();
+        usage.reserved_bytes = keyed_changes_.allocated_bytes();
+    }
+    return usage;
+}
+
 bool DataWriterHistory::removeMinChange()
 {
     if (mp_writer == nullptr || mp_mutex == nullptr)
@@ -379,7 +439,7 @@ bool DataWriterHistory::remove_change_pub(
 
     if (topic_att_.getTopicKind() == NO_KEY)
     {
-        if (remove_change(change, max_blocking_time))
+        if (remove_ordered_change_nts(change, max_blocking_time))
         {
             m_isHistoryFull = false;
             return true;
@@ -400,7 +460,7 @@ bool DataWriterHistory::remove_change_pub(
         {
             if (((*chit)->sequenceNumber == change->sequenceNumber) && ((*chit)->writerGUID == change->writerGUID))
             {
-                if (remove_change(change, max_blocking_time))
+                if (remove_ordered_change_nts(change, max_blocking_time))
                 {
                     vit->second.cache_changes.erase(chit);
                     m_isHistoryFull = false;
@@ -454,7 +514,7 @@ bool DataWriterHistory::remove_instance_changes(
 
     for (; chit != vit->second.cache_changes.end() && (*chit)->sequenceNumber <= seq_up_to; ++chit)
     {
-        if (remove_change(*chit))
+        if (remove_ordered_change_nts(*chit, std::chrono::steady_clock::now() + std::chrono::hours(24)))
         {
             m_isHistoryFull = false;
         }
@@ -488,12 +548,13 @@ bool DataWriterHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        t_m_Inst_Caches::iterator vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        vit->second.next_deadline_us = next_deadline_us;
         return true;
     }
 
@@ -583,6 +644,48 @@ bool DataWriterHistory::change_is_acked_or_fully_delivered(
     return is_acked;
 }
 
+bool DataWriterHistory::remove_ordered_change_nts(
+        CacheChange_t* change,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    const_iterator it = eprosima::utilities::collections::sorted_vector_find(m_changes, change,
+                    [](const CacheChange_t* lhs, const CacheChange_t* rhs)
+                    {
+                        return lhs->sequenceNumber < rhs->sequenceNumber;
+                    },
+                    [](const CacheChange_t* lhs, const CacheChange_t* rhs)
+                    {
+                        return lhs->sequenceNumber == rhs->sequenceNumber;
+                    });
+    if (it == changesEnd())
+    {
+        EPROSIMA_LOG_INFO(RTPS_WRITER_HISTORY, "Trying to remove a change not in history");
+        return false;
+    }
+
+    SequenceNumber_t sequence_number = (*it)->sequenceNumber;
+    iterator next = remove_change_nts(it, max_blocking_time);
+
+    // The change is still in the history when it could not be removed
+    return next == changesEnd() || (*next)->sequenceNumber != sequence_number;
+}
+
+size_t DataWriterHistory::samples_in(
+        const std::vector<CacheChange_t*>& changes) const
+{
+    if (!mp_writer->sends_sample_batches())
+    {
+        return changes.size();
+    }
+
+    size_t samples = 0;
+    for (const CacheChange_t* change : changes)
+    {
+        samples += mp_writer->sequence_number_span(*change);
+    }
+    return samples;
+}
+
 }  // namespace dds
 }  // namespace fastrtps
 }  // namespace eprosima
@@ -25,11 +25,13 @@
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/rtps/attributes/TopicAttributes.h>
 #include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/resources/ResourceManagement.h>
 
 #include <fastdds/publisher/history/DataWriterInstance.hpp>
+#include <utils/collections/InstanceHandleMap.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -109,6 +111,25 @@ public:
             std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
+    /**
+     * Add a change holding a batch of samples comming from the DataWriter.
+     * The change will cover as many sequence numbers as samples are in the batch.
+     *
+     * @param change             Pointer to the change
+     * @param wparams            Extra write parameters.
+     * @param sample_count       Number of samples in the batch.
+     * @param lock               Lock to the history mutex.
+     * @param max_blocking_time  Maximum time point to wait for room on the history.
+     *
+     * @return True if added.
+     */
+    bool add_pub_batch(
+            fastrtps::rtps::CacheChange_t* change,
+            fastrtps::rtps::WriteParams& wparams,
+            uint32_t sample_count,
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
     /**
      * Add a change comming from the DataWriter.
      *
@@ -152,6 +173,38 @@ public:
         return returnedValue;
     }
 
+    /**
+     * Send a change comming from the DataWriter without adding it to the history.
+     * Only valid for writers which never send a change again and deliver it before returning, as the caller is
+     * expected to release the change right after this call.
+     *
+     * @pre The mutex of the writer is locked.
+     *
+     * @param change             Pointer to the change
+     * @param wparams            Extra writer parameters.
+     * @param pre_commit         Functor receiving a CacheChange_t& to perform actions after the change information
+     *                           has been filled, but before notifying the RTPS writer.
+     * @param max_blocking_time  Maximum time point to wait for the change to be sent.
+     *
+     * @return True if sent.
+     */
+    template<typename PreCommitHook>
+    bool send_pub_change_with_commit_hook(
+            fastrtps::rtps::CacheChange_t* change,
+            fastrtps::rtps::WriteParams& wparams,
+            PreCommitHook pre_commit,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+    {
+        if (!WriterHistory::prepare_change(change, wparams))
+        {
+            return false;
+        }
+
+        pre_commit(*change);
+        WriterHistory::notify_writer(change, max_blocking_time);
+        return true;
+    }
+
     /**
      * Remove all change from the associated history.
      * @param removed Number of elements removed.
@@ -235,9 +288,15 @@ public:
             std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
+    /**
+     * Get the memory held by the instances of the history.
+     * @return Memory used by the collection of instances.
+     */
+    fastdds::rtps::MemoryUsage get_instances_memory_usage() const;
+
 private:
 
-    typedef std::map<fastrtps::rtps::InstanceHandle_t, detail::DataWriterInstance> t_m_Inst_Caches;
+    typedef InstanceHandleMap<detail::DataWriterInstance> t_m_Inst_Caches;
 
     //!Map where keys are instance handles and values are vectors of cache changes associated
     t_m_Inst_Caches keyed_changes_;
@@ -287,6 +346,30 @@ private:
     bool change_is_acked_or_fully_delivered(
             const fastrtps::rtps::CacheChange_t* change);
 
+    /**
+     * @brief Remove a change from the history, locating it with the sequence number order of the changes instead
+     *        of a linear search.
+     *
+     * Locating the oldest or newest change is O(1), and any other change O(log n). Erasing it from the history
+     * is still O(n), as the changes after it are moved.
+     *
+     * @param change             Pointer to the change.
+     * @param max_blocking_time  Maximum time point to wait for the removal.
+     * @return true if removed.
+     */
+    bool remove_ordered_change_nts(
+            fastrtps::rtps::CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * @brief Count the samples kept on a collection of changes, as a change may carry a batch of samples.
+     *
+     * @param changes Collection of changes.
+     * @return Number of samples on the changes.
+     */
+    size_t samples_in(
+            const std::vector<fastrtps::rtps::CacheChange_t*>& changes) const;
+
 };
 
 }  // namespace dds
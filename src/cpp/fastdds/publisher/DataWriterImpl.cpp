@@ -18,6 +18,7 @@
  */
 #include <fastdds/publisher/DataWriterImpl.hpp>
 
+#include <cstring>
 #include <functional>
 #include <iostream>
 
@@ -46,6 +47,7 @@
 #include <rtps/builtin/liveliness/WLP.h>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
+#include <rtps/history/PoolNumaNode.hpp>
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/RTPSDomainImpl.hpp>
@@ -83,6 +85,57 @@ static bool qos_has_pull_mode_request(
     return (nullptr != push_mode) && ("false" == *push_mode);
 }
 
+static bool read_batching_property(
+        const DataWriterQos& qos,
+        const char* name,
+        double& value)
+{
+    auto property = PropertyPolicyHelper::find_property(qos.properties(), name);
+    if (nullptr == property)
+    {
+        return false;
+    }
+
+    char* ptr = nullptr;
+    double read_value = strtod(property->c_str(), &ptr);
+    if (property->c_str() == ptr || 0.0 > read_value)
+    {
+        EPROSIMA_LOG_ERROR(DATA_WRITER, "Not valid value for " << name << " property. Using default value");
+        return false;
+    }
+
+    value = read_value;
+    return true;
+}
+
+/**
+ * Get the settings of the thread consuming the payloads of a writer, which is the one sending them.
+ */
+static fastdds::rtps::ThreadSettings get_sender_thread_settings(
+        const DataWriterQos& qos,
+        const RTPSParticipantAttributes& participant_attributes)
+{
+    if (ASYNCHRONOUS_PUBLISH_MODE != qos.publish_mode().kind)
+    {
+        // Samples are sent by the thread calling write
+        return fastdds::rtps::ThreadSettings();
+    }
+
+    const char* flow_controller_name = qos.publish_mode().flow_controller_name;
+    if (nullptr != flow_controller_name)
+    {
+        for (const auto& descriptor : participant_attributes.flow_controllers)
+        {
+            if (nullptr != descriptor->name && 0 == strcmp(descriptor->name, flow_controller_name))
+            {
+                return descriptor->sender_thread;
+            }
+        }
+    }
+
+    return participant_attributes.builtin_controllers_sender_thread;
+}
+
 class DataWriterImpl::LoanCollection
 {
 public:
@@ -291,6 +344,21 @@ ReturnCode_t DataWriterImpl::enable()
         w_att.endpoint.properties.properties().push_back(std::move(property));
     }
 
+    // Insert deadline and lifespan, used by the earliest deadline first scheduler of flow controllers
+    if (qos_.deadline().period != c_TimeInfinite)
+    {
+        property.name("fastdds.sfc.deadline_ns");
+        property.value(std::to_string(qos_.deadline().period.to_ns()));
+        w_att.endpoint.properties.properties().push_back(std::move(property));
+    }
+
+    if (qos_.lifespan().duration != c_TimeInfinite)
+    {
+        property.name("fastdds.sfc.lifespan_ns");
+        property.value(std::to_string(qos_.lifespan().duration.to_ns()));
+        w_att.endpoint.properties.properties().push_back(std::move(property));
+    }
+
     if (qos_.reliable_writer_qos().disable_positive_acks.enabled &&
             qos_.reliable_writer_qos().disable_positive_acks.duration != c_TimeInfinite)
     {
@@ -398,20 +466,23 @@ ReturnCode_t DataWriterImpl::enable()
     // In case it has been loaded from the persistence DB, rebuild instances on history
     history_.rebuild_instances();
 
-    deadline_timer_ = new TimedEvent(publisher_->get_participant()->get_resource_event(),
+    deadline_timer_ = new TimedEvent(publisher_->rtps_participant()->get_resource_event(guid_),
                     [&]() -> bool
                     {
                         return deadline_missed();
                     },
                     qos_.deadline().period.to_ns() * 1e-6);
 
-    lifespan_timer_ = new TimedEvent(publisher_->get_participant()->get_resource_event(),
+    lifespan_timer_ = new TimedEvent(publisher_->rtps_participant()->get_resource_event(guid_),
                     [&]() -> bool
                     {
                         return lifespan_expired();
                     },
                     qos_.lifespan().duration.to_ns() * 1e-6);
 
+    configure_sample_batching();
+    configure_history_bypass();
+
     // In case it has been loaded from the persistence DB, expire old samples.
     if (qos_.lifespan().duration != c_TimeInfinite)
     {
@@ -464,6 +535,15 @@ ReturnCode_t DataWriterImpl::check_delete_preconditions()
 
 DataWriterImpl::~DataWriterImpl()
 {
+    if (nullptr != batch_flush_timer_)
+    {
+        // Samples waiting on a batch were already accepted, so try to send them.
+        std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+        flush_batch_nts(lock, steady_clock::now());
+        lock.unlock();
+        delete batch_flush_timer_;
+    }
+
     delete lifespan_timer_;
     delete deadline_timer_;
 
@@ -697,6 +777,79 @@ ReturnCode_t DataWriterImpl::write_w_timestamp(
     return ret;
 }
 
+ReturnCode_t DataWriterImpl::write_many(
+        const std::vector<void*>& data)
+{
+    if (writer_ == nullptr)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    // Validate all the samples and deduce their instances before writing any of them.
+    std::vector<InstanceHandle_t> handles(data.size());
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        ReturnCode_t ret_code = check_new_change_preconditions(ALIVE, data[i]);
+        if (RETCODE_OK != ret_code)
+        {
+            return ret_code;
+        }
+
+        if (type_->m_isGetKeyDefined)
+        {
+            bool is_key_protected = false;
+#if HAVE_SECURITY
+            is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
+#endif // if HAVE_SECURITY
+            type_->getKey(data[i], &handles[i], is_key_protected);
+        }
+    }
+
+    if (data.empty())
+    {
+        return RETCODE_OK;
+    }
+
+    EPROSIMA_LOG_INFO(DATA_WRITER, "Writing " << data.size() << " new samples");
+
+    // Block lowlevel writer
+    auto max_blocking_time = steady_clock::now() +
+            microseconds(rtps::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+
+#if HAVE_STRICT_REALTIME
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex(), std::defer_lock);
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return RETCODE_TIMEOUT;
+    }
+#else
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+#endif // if HAVE_STRICT_REALTIME
+
+    // A reliable KEEP_ALL history may release the writer's mutex while waiting for acknowledgements, so the samples
+    // cannot be kept in a batch holding the locator selector.
+    bool use_batch = !(RELIABLE_RELIABILITY_QOS == qos_.reliability().kind &&
+            KEEP_ALL_HISTORY_QOS == qos_.history().kind);
+    if (use_batch)
+    {
+        writer_->begin_sample_batch(max_blocking_time);
+    }
+
+    ReturnCode_t ret_code = RETCODE_OK;
+    for (size_t i = 0; RETCODE_OK == ret_code && i < data.size(); ++i)
+    {
+        WriteParams wparams;
+        ret_code = perform_create_new_change_nts(ALIVE, data[i], wparams, handles[i], lock, max_blocking_time);
+    }
+
+    if (use_batch)
+    {
+        writer_->end_sample_batch();
+    }
+
+    return ret_code;
+}
+
 ReturnCode_t DataWriterImpl::check_instance_preconditions(
         void* data,
         const InstanceHandle_t& handle,
@@ -976,6 +1129,30 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
     std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
 #endif // if HAVE_STRICT_REALTIME
 
+    return perform_create_new_change_nts(change_kind, data, wparams, handle, lock, max_blocking_time);
+}
+
+ReturnCode_t DataWriterImpl::perform_create_new_change_nts(
+        ChangeKind_t change_kind,
+        void* data,
+        WriteParams& wparams,
+        const InstanceHandle_t& handle,
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    // Only plain writes can be batched, as a batch does not carry inline QoS.
+    bool use_batch = (1 < batch_max_samples_) && (ALIVE == change_kind) &&
+            (SampleIdentity::unknown() == wparams.sample_identity()) &&
+            (SampleIdentity::unknown() == wparams.related_sample_identity());
+    if (!use_batch && !batch_.empty())
+    {
+        ReturnCode_t ret_code = flush_batch_nts(lock, max_blocking_time);
+        if (RETCODE_OK != ret_code)
+        {
+            return ret_code;
+        }
+    }
+
     PayloadInfo_t payload;
     bool was_loaned = check_and_remove_loan(data, payload);
     if (!was_loaned)
@@ -993,11 +1170,83 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
         }
     }
 
+    if (use_batch)
+    {
+        ReturnCode_t ret_code = RETCODE_OK;
+        bool fits_in_batch = batch_max_bytes_ >= fastrtps::rtps::detail::SampleBatch::header_size +
+                fastrtps::rtps::detail::SampleBatch::entry_size(payload.payload.length);
+
+        // The batch is sent before adding a sample of a different instance, or a sample not fitting in it.
+        if (!batch_.empty() &&
+                (!fits_in_batch || batch_handle_ != handle || batch_.count() >= batch_max_samples_ ||
+                batch_max_bytes_ < batch_.size_with(payload.payload.length)))
+        {
+            ret_code = flush_batch_nts(lock, max_blocking_time);
+        }
+
+        if (RETCODE_OK == ret_code && fits_in_batch)
+        {
+            ret_code = add_sample_to_batch_nts(payload, wparams, handle, lock, max_blocking_time);
+        }
+
+        if (RETCODE_OK != ret_code || fits_in_batch)
+        {
+            // The sample has been copied to the batch, so its payload is no longer needed.
+            if (was_loaned && RETCODE_OK != ret_code)
+            {
+                add_loan(data, payload);
+            }
+            else
+            {
+                return_payload_to_pool(payload);
+            }
+            return ret_code;
+        }
+    }
+
+    // Readers decode any payload of this writer starting like a batch, so such a sample is only sent inside one
+    if ((1 < batch_max_samples_) && fastrtps::rtps::detail::SampleBatch::is_batch(payload.payload))
+    {
+        EPROSIMA_LOG_WARNING(DATA_WRITER, "A sample starting like a batch can only be sent inside a batch");
+        if (was_loaned)
+        {
+            add_loan(data, payload);
+        }
+        else
+        {
+            return_payload_to_pool(payload);
+        }
+        return RETCODE_ERROR;
+    }
+
     CacheChange_t* ch = writer_->new_change(change_kind, handle);
     if (ch != nullptr)
     {
         payload.move_into_change(*ch);
 
+        if (use_history_bypass(change_kind))
+        {
+            auto related_sample_identity = wparams.related_sample_identity();
+            auto filter_hook = [&related_sample_identity, this](CacheChange_t& ch)
+                    {
+                        if (reader_filters_)
+                        {
+                            reader_filters_->update_filter_info(static_cast<DataWriterFilteredChange&>(ch),
+                                    related_sample_identity);
+                        }
+                    };
+
+            // The change has been delivered when this returns, and it is never sent again.
+            bool sent = history_.send_pub_change_with_commit_hook(ch, wparams, filter_hook, max_blocking_time);
+            if (!sent && was_loaned)
+            {
+                payload.move_from_change(*ch);
+                add_loan(data, payload);
+            }
+            writer_->release_change(ch);
+            return sent ? RETCODE_OK : RETCODE_ERROR;
+        }
+
         bool added = false;
         if (reader_filters_)
         {
@@ -1025,39 +1274,197 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
             return RETCODE_TIMEOUT;
         }
 
-        if (qos_.deadline().period != c_TimeInfinite)
+        on_change_added_nts(handle);
+        return RETCODE_OK;
+    }
+
+    return RETCODE_OUT_OF_RESOURCES;
+}
+
+void DataWriterImpl::on_change_added_nts(
+        const InstanceHandle_t& handle)
+{
+    if (qos_.deadline().period != c_TimeInfinite)
+    {
+        if (!history_.set_next_deadline(
+                    handle,
+                    steady_clock::now() + duration_cast<system_clock::duration>(deadline_duration_us_)))
         {
-            if (!history_.set_next_deadline(
-                        handle,
-                        steady_clock::now() + duration_cast<system_clock::duration>(deadline_duration_us_)))
-            {
-                EPROSIMA_LOG_ERROR(DATA_WRITER, "Could not set the next deadline in the history");
-            }
-            else
+            EPROSIMA_LOG_ERROR(DATA_WRITER, "Could not set the next deadline in the history");
+        }
+        else
+        {
+            if (timer_owner_ == handle || timer_owner_ == InstanceHandle_t())
             {
-                if (timer_owner_ == handle || timer_owner_ == InstanceHandle_t())
+                if (deadline_timer_reschedule())
                 {
-                    if (deadline_timer_reschedule())
-                    {
-                        deadline_timer_->cancel_timer();
-                        deadline_timer_->restart_timer();
-                    }
+                    deadline_timer_->cancel_timer();
+                    deadline_timer_->restart_timer();
                 }
             }
         }
+    }
 
-        if (qos_.lifespan().duration != c_TimeInfinite)
+    if (qos_.lifespan().duration != c_TimeInfinite)
+    {
+        lifespan_duration_us_ = duration<double, std::ratio<1, 1000000>>(
+            qos_.lifespan().duration.to_ns() * 1e-3);
+        lifespan_timer_->update_interval_millisec(qos_.lifespan().duration.to_ns() * 1e-6);
+        lifespan_timer_->restart_timer();
+    }
+}
+
+void DataWriterImpl::configure_sample_batching()
+{
+    double max_samples = 0;
+    if (!read_batching_property(qos_, "fastdds.batch.max_samples", max_samples) || 2 > max_samples)
+    {
+        return;
+    }
+
+    if (0 != fixed_payload_size_ || is_data_sharing_compatible_ ||
+            TRANSIENT_DURABILITY_QOS <= qos_.durability().kind)
+    {
+        EPROSIMA_LOG_WARNING(DATA_WRITER,
+                "Sample batching is not compatible with PREALLOCATED memory policy, data-sharing or persistence. "
+                "Batching disabled");
+        return;
+    }
+
+    // A batch should never be fragmented
+    double max_bytes = writer_->getMaxDataSize();
+    read_batching_property(qos_, "fastdds.batch.max_bytes", max_bytes);
+    double max_flush_delay_ms = 1.0;
+    read_batching_property(qos_, "fastdds.batch.max_flush_delay_ms", max_flush_delay_ms);
+
+    // A batch never holds more samples than the history keeps
+    if (KEEP_LAST_HISTORY_QOS == qos_.history().kind)
+    {
+        max_samples = (std::min)(max_samples, static_cast<double>(qos_.history().depth));
+        if (2 > max_samples)
         {
-            lifespan_duration_us_ = duration<double, std::ratio<1, 1000000>>(
-                qos_.lifespan().duration.to_ns() * 1e-3);
-            lifespan_timer_->update_interval_millisec(qos_.lifespan().duration.to_ns() * 1e-6);
-            lifespan_timer_->restart_timer();
+            EPROSIMA_LOG_WARNING(DATA_WRITER, "Sample batching needs a history depth of at least 2. Batching disabled");
+            return;
         }
+    }
+
+    batch_max_samples_ = static_cast<uint32_t>((std::min)(max_samples, 4294967295.0));
+    batch_max_bytes_ = static_cast<uint32_t>((std::min)(max_bytes, static_cast<double>(writer_->getMaxDataSize())));
+    batch_flush_timer_ = new TimedEvent(publisher_->rtps_participant()->get_resource_event(guid_),
+                    [&]() -> bool
+                    {
+                        return batch_flush_delay_expired();
+                    },
+                    max_flush_delay_ms);
+
+    // Announced on discovery, so only readers able to unbatch the changes receive them
+    writer_->enable_sample_batches();
+}
+
+ReturnCode_t DataWriterImpl::add_sample_to_batch_nts(
+        PayloadInfo_t& payload,
+        WriteParams& wparams,
+        const InstanceHandle_t& handle,
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    fastrtps::rtps::Time_t source_timestamp = wparams.source_timestamp();
+    if (source_timestamp.seconds() < 0)
+    {
+        fastrtps::rtps::Time_t::now(source_timestamp);
+    }
+
+    if (batch_.empty())
+    {
+        batch_handle_ = handle;
+        batch_timestamp_ = source_timestamp;
+        batch_flush_timer_->restart_timer();
+    }
+
+    // The batch will take the next sequence number, and the samples the consecutive ones.
+    wparams.sample_identity().writer_guid(guid_);
+    wparams.sample_identity().sequence_number(history_.next_sequence_number() + static_cast<int>(batch_.count()));
+    wparams.related_sample_identity(wparams.sample_identity());
 
+    batch_.add(payload.payload, handle, source_timestamp);
+
+    // The sample is already accepted, so a full batch which cannot be sent now is retried by the timer.
+    if (batch_.count() >= batch_max_samples_ && RETCODE_OK != flush_batch_nts(lock, max_blocking_time))
+    {
+        batch_flush_timer_->restart_timer();
+    }
+
+    return RETCODE_OK;
+}
+
+ReturnCode_t DataWriterImpl::flush_batch_nts(
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    if (batch_.empty())
+    {
         return RETCODE_OK;
     }
 
-    return RETCODE_OUT_OF_RESOURCES;
+    PayloadInfo_t payload;
+    uint32_t batch_size = batch_.size();
+    if (!get_free_payload_from_pool([batch_size]()
+            {
+                return batch_size;
+            }, payload))
+    {
+        return RETCODE_OUT_OF_RESOURCES;
+    }
+    batch_.copy_to(payload.payload);
+
+    CacheChange_t* ch = writer_->new_change(ALIVE, batch_handle_);
+    if (nullptr == ch)
+    {
+        return_payload_to_pool(payload);
+        return RETCODE_OUT_OF_RESOURCES;
+    }
+    payload.move_into_change(*ch);
+
+    // Readers filter each sample of the batch on reception
+    if (reader_filters_)
+    {
+        static_cast<DataWriterFilteredChange*>(ch)->filtered_out_readers.clear();
+    }
+
+    WriteParams wparams;
+    wparams.source_timestamp(batch_timestamp_);
+    if (!history_.add_pub_batch(ch, wparams, batch_.count(), lock, max_blocking_time))
+    {
+        writer_->release_change(ch);
+        return RETCODE_TIMEOUT;
+    }
+
+    batch_.clear();
+    batch_flush_timer_->cancel_timer();
+    on_change_added_nts(batch_handle_);
+    return RETCODE_OK;
+}
+
+void DataWriterImpl::configure_history_bypass()
+{
+    // Only the pure synchronous flow controller guarantees the samples are not queued to be sent later.
+    history_bypass_ =
+            BEST_EFFORT_RELIABILITY_QOS == qos_.reliability().kind &&
+            VOLATILE_DURABILITY_QOS == qos_.durability().kind &&
+            KEEP_LAST_HISTORY_QOS == qos_.history().kind && 1 == qos_.history().depth &&
+            !type_->m_isGetKeyDefined &&
+            SYNCHRONOUS_PUBLISH_MODE == qos_.publish_mode().kind &&
+            0 == strcmp(qos_.publish_mode().flow_controller_name, fastdds::rtps::FASTDDS_FLOW_CONTROLLER_DEFAULT) &&
+            !is_data_sharing_compatible_ &&
+            2 > batch_max_samples_;
+}
+
+bool DataWriterImpl::batch_flush_delay_expired()
+{
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+
+    // Try again later when the batch could not be added to the history
+    return RETCODE_OK != flush_batch_nts(lock, steady_clock::now());
 }
 
 ReturnCode_t DataWriterImpl::create_new_change_with_params(
@@ -1107,6 +1514,13 @@ bool DataWriterImpl::remove_min_seq_change()
 ReturnCode_t DataWriterImpl::clear_history(
         size_t* removed)
 {
+    if (nullptr != batch_flush_timer_)
+    {
+        // Samples waiting on a batch already have a sequence number, so they are added to be removed as well
+        std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+        flush_batch_nts(lock, steady_clock::now());
+    }
+
     return (history_.removeAllChange(removed) ? RETCODE_OK : RETCODE_ERROR);
 }
 
@@ -1122,6 +1536,19 @@ ReturnCode_t DataWriterImpl::get_sending_locators(
     return RETCODE_OK;
 }
 
+ReturnCode_t DataWriterImpl::get_memory_usage(
+        rtps::EndpointMemoryUsage& usage) const
+{
+    if (nullptr == writer_)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    writer_->get_memory_usage(usage);
+    usage.history += history_.get_instances_memory_usage();
+    return RETCODE_OK;
+}
+
 const fastrtps::rtps::GUID_t& DataWriterImpl::guid() const
 {
     return guid_;
@@ -1299,7 +1726,8 @@ void DataWriterImpl::InnerDataWriterListener::onWriterChangeReceivedByAll(
     {
         data_writer_->history_.remove_instance_changes(ch->instanceHandle, ch->sequenceNumber);
     }
-    else if (data_writer_->qos_.durability().kind == VOLATILE_DURABILITY_QOS)
+    else if (data_writer_->qos_.durability().kind == VOLATILE_DURABILITY_QOS &&
+            !data_writer_->use_history_bypass(ch->kind))
     {
         data_writer_->history_.remove_change_g(ch);
     }
@@ -1377,6 +1805,17 @@ ReturnCode_t DataWriterImpl::wait_for_acknowledgments(
         return RETCODE_NOT_ENABLED;
     }
 
+    if (nullptr != batch_flush_timer_)
+    {
+        std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+        auto max_blocking_time = steady_clock::now() +
+                microseconds(rtps::TimeConv::Time_t2MicroSecondsInt64(max_wait));
+        if (RETCODE_OK != flush_batch_nts(lock, max_blocking_time))
+        {
+            return RETCODE_TIMEOUT;
+        }
+    }
+
     if (writer_->wait_for_all_acked(max_wait))
     {
         return RETCODE_OK;
@@ -1416,6 +1855,11 @@ ReturnCode_t DataWriterImpl::wait_for_acknowledgments(
         return RETCODE_PRECONDITION_NOT_MET;
     }
 
+    if (batch_handle_ == ih && RETCODE_OK != flush_batch_nts(lock, max_blocking_time))
+    {
+        return RETCODE_TIMEOUT;
+    }
+
     if (history_.wait_for_acknowledgement_last_change(ih, lock, max_blocking_time))
     {
         return RETCODE_OK;
@@ -2040,6 +2484,8 @@ std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
         }
 
         PoolConfig config = PoolConfig::from_history_attributes(history_.m_att);
+        config.numa_node = get_pool_numa_node(qos_.properties(), get_sender_thread_settings(qos_,
+                        publisher_->rtps_participant()->getRTPSParticipantAttributes()));
 
         // Avoid calling the serialization size functors on PREALLOCATED mode
         fixed_payload_size_ = config.memory_policy == PREALLOCATED_MEMORY_MODE ? config.payload_initial_size : 0u;
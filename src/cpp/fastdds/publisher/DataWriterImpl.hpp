@@ -19,7 +19,10 @@
 #ifndef _FASTDDS_DATAWRITERIMPL_HPP_
 #define _FASTDDS_DATAWRITERIMPL_HPP_
 
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <fastdds/dds/core/ReturnCode.hpp>
 #include <fastdds/dds/core/status/BaseStatus.hpp>
@@ -38,10 +41,12 @@
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <fastdds/rtps/interfaces/IReaderDataFilter.hpp>
 #include <fastdds/rtps/writer/WriterListener.h>
+#include <fastdds/utils/TimedMutex.hpp>
 
 #include <fastdds/publisher/DataWriterHistory.hpp>
 #include <fastdds/publisher/filtering/ReaderFilterCollection.hpp>
 #include <rtps/common/PayloadInfo_t.hpp>
+#include <rtps/common/SampleBatch.hpp>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 
@@ -211,6 +216,17 @@ public:
             const InstanceHandle_t& handle,
             const fastrtps::Time_t& timestamp);
 
+    /**
+     * @brief Writes several samples holding the writer's mutex only once.
+     * Samples sent synchronously are packed together into the same RTPS messages.
+     *
+     * @param[in] data  Pointers to the samples to publish.
+     *
+     * @return any of the standard return codes.
+     */
+    ReturnCode_t write_many(
+            const std::vector<void*>& data);
+
     /**
      * @brief Implementation of the DDS `register_instance` operation.
      * It deduces the instance's key and tries to get resources in the DataWriterHistory.
@@ -374,6 +390,17 @@ public:
     ReturnCode_t get_sending_locators(
             rtps::LocatorList& locators) const;
 
+    /**
+     * @brief Get the memory held by this DataWriter.
+     *
+     * @param [out] usage  Memory used by the pools, the history, the instances and the matched readers.
+     *
+     * @return NOT_ENABLED if the writer has not been enabled.
+     * @return OK if the memory usage is returned.
+     */
+    ReturnCode_t get_memory_usage(
+            rtps::EndpointMemoryUsage& usage) const;
+
     /**
      * Called from the DomainParticipant when a filter factory is being unregistered.
      *
@@ -504,6 +531,27 @@ protected:
 
     DataRepresentationId_t data_representation_ {DEFAULT_DATA_REPRESENTATION};
 
+    //! Maximum number of samples on a batch. Batching is disabled when lower than 2.
+    uint32_t batch_max_samples_ = 0u;
+
+    //! Maximum size of the serialized payload of a batch.
+    uint32_t batch_max_bytes_ = 0u;
+
+    //! Samples waiting to be added to the history as a single change.
+    fastrtps::rtps::detail::SampleBatchBuilder batch_;
+
+    //! Instance of the samples in the batch.
+    InstanceHandle_t batch_handle_;
+
+    //! Source timestamp of the first sample in the batch.
+    fastrtps::rtps::Time_t batch_timestamp_;
+
+    //! A timer used to send a batch which is not full after the maximum flush delay.
+    fastrtps::rtps::TimedEvent* batch_flush_timer_ = nullptr;
+
+    //! Whether the samples can be sent without being stored on the history.
+    bool history_bypass_ = false;
+
     ReturnCode_t check_write_preconditions(
             void* data,
             const InstanceHandle_t& handle,
@@ -589,6 +637,86 @@ protected:
             fastrtps::rtps::WriteParams& wparams,
             const InstanceHandle_t& handle);
 
+    /**
+     * Serializes a sample and adds it to the history.
+     *
+     * @pre The writer's mutex is held by @c lock.
+     */
+    ReturnCode_t perform_create_new_change_nts(
+            fastrtps::rtps::ChangeKind_t change_kind,
+            void* data,
+            fastrtps::rtps::WriteParams& wparams,
+            const InstanceHandle_t& handle,
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Reads the batching configuration from the properties of the DataWriter.
+     *
+     * @pre The RTPS writer has been created.
+     */
+    void configure_sample_batching();
+
+    /**
+     * Checks whether the samples of this DataWriter can be sent without being stored on the history.
+     * That is the case for best-effort volatile writers keeping only the last sample, as their samples are never
+     * sent again, when they are delivered before write returns.
+     * This is not a lock-free path: the writer mutex is still held while sending, and the change is still taken
+     * from the pool. Only the insertion on the history and its removal once delivered are skipped.
+     *
+     * @pre The batching configuration has been read.
+     */
+    void configure_history_bypass();
+
+    /**
+     * Checks whether a change can be sent without being stored on the history.
+     *
+     * @param change_kind  Kind of the change being written.
+     *
+     * @return true if the change can be sent without being stored on the history.
+     */
+    bool use_history_bypass(
+            fastrtps::rtps::ChangeKind_t change_kind) const
+    {
+        // Deadline and lifespan need the samples on the history, and they can be changed at any time.
+        return history_bypass_ && fastrtps::rtps::ALIVE == change_kind &&
+               fastrtps::c_TimeInfinite == qos_.deadline().period &&
+               fastrtps::c_TimeInfinite == qos_.lifespan().duration;
+    }
+
+    /**
+     * Adds a serialized sample to the current batch, sending the batch when it is full.
+     *
+     * @pre The writer's mutex is held by @c lock.
+     */
+    ReturnCode_t add_sample_to_batch_nts(
+            PayloadInfo_t& payload,
+            fastrtps::rtps::WriteParams& wparams,
+            const InstanceHandle_t& handle,
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Adds the current batch to the history as a single change.
+     * The batch is kept when it could not be added, so it can be sent later.
+     *
+     * @pre The writer's mutex is held by @c lock.
+     */
+    ReturnCode_t flush_batch_nts(
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * @brief A method called when the maximum flush delay of a batch expires
+     */
+    bool batch_flush_delay_expired();
+
+    /**
+     * Updates the deadline and lifespan timers after a change of an instance has been added to the history.
+     */
+    void on_change_added_nts(
+            const InstanceHandle_t& handle);
+
     static fastrtps::TopicAttributes get_topic_attributes(
             const DataWriterQos& qos,
             const Topic& topic,
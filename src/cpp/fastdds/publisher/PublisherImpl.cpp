@@ -368,6 +368,23 @@ bool PublisherImpl::get_datawriters(
     return true;
 }
 
+void PublisherImpl::get_memory_usage(
+        std::vector<rtps::EndpointMemoryUsage>& usages) const
+{
+    std::lock_guard<std::mutex> lock(mtx_writers_);
+    for (auto vit : writers_)
+    {
+        for (DataWriterImpl* dw : vit.second)
+        {
+            rtps::EndpointMemoryUsage usage;
+            if (RETCODE_OK == dw->get_memory_usage(usage))
+            {
+                usages.push_back(usage);
+            }
+        }
+    }
+}
+
 bool PublisherImpl::has_datawriters() const
 {
     if (writers_.empty())
@@ -34,6 +34,7 @@
 #include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
 #include <fastdds/dds/publisher/qos/PublisherQos.hpp>
 #include <fastdds/dds/topic/qos/TopicQos.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 
 #ifdef FASTDDS_STATISTICS
 #include <statistics/rtps/monitor-service/interfaces/IStatusQueryable.hpp>
@@ -129,6 +130,13 @@ public:
     bool get_datawriters(
             std::vector<DataWriter*>& writers) const;
 
+    /**
+     * Get the memory held by the enabled DataWriters of this publisher.
+     * @param [out] usages Vector where the memory usage of each DataWriter is appended.
+     */
+    void get_memory_usage(
+            std::vector<rtps::EndpointMemoryUsage>& usages) const;
+
     bool has_datawriters() const;
 
     /* TODO
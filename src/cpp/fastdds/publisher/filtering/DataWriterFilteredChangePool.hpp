@@ -59,6 +59,11 @@ protected:
         delete writer_change;
     }
 
+    size_t change_size() const final
+    {
+        return sizeof(DataWriterFilteredChange);
+    }
+
     fastrtps::ResourceLimitedContainerConfig filter_allocation_;
 };
 
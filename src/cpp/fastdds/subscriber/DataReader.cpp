@@ -272,6 +272,20 @@ ReturnCode_t DataReader::take_next_sample(
     return impl_->take_next_sample(data, info);
 }
 
+ReturnCode_t DataReader::take_columns(
+        void* data_values,
+        size_t sample_size,
+        const SampleInfoColumns& info_columns,
+        int32_t max_samples,
+        int32_t& num_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->take_columns(data_values, sample_size, info_columns, max_samples, num_samples,
+                   sample_states, view_states, instance_states);
+}
+
 ReturnCode_t DataReader::get_first_untaken_info(
         SampleInfo* info)
 {
@@ -48,6 +48,7 @@
 #include <fastdds/subscriber/SubscriberImpl.hpp>
 #include <fastdds/topic/ContentFilteredTopicImpl.hpp>
 
+#include <rtps/history/PoolNumaNode.hpp>
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <utils/TimeConversion.hpp>
@@ -258,14 +259,14 @@ ReturnCode_t DataReaderImpl::enable()
 
     reader_ = reader;
 
-    deadline_timer_ = new TimedEvent(subscriber_->get_participant()->get_resource_event(),
+    deadline_timer_ = new TimedEvent(subscriber_->rtps_participant()->get_resource_event(guid_),
                     [&]() -> bool
                     {
                         return deadline_missed();
                     },
                     qos_.deadline().period.to_ns() * 1e-6);
 
-    lifespan_timer_ = new TimedEvent(subscriber_->get_participant()->get_resource_event(),
+    lifespan_timer_ = new TimedEvent(subscriber_->rtps_participant()->get_resource_event(guid_),
                     [&]() -> bool
                     {
                         return lifespan_expired();
@@ -335,6 +336,13 @@ void DataReaderImpl::stop()
         reader_ = nullptr;
         release_payload_pool();
     }
+
+    // No more callbacks can be posted once the RTPS reader is removed.
+    ListenerExecutor* executor = subscriber_->get_participant_impl()->get_listener_executor();
+    if (nullptr != executor)
+    {
+        executor->cancel(listener_strand_);
+    }
 }
 
 DataReaderImpl::~DataReaderImpl()
@@ -766,6 +774,72 @@ ReturnCode_t DataReaderImpl::read_or_take_next_sample(
     return code;
 }
 
+ReturnCode_t DataReaderImpl::take_columns(
+        void* data_values,
+        size_t sample_size,
+        const SampleInfoColumns& info_columns,
+        int32_t max_samples,
+        int32_t& num_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    num_samples = 0;
+
+    if (reader_ == nullptr)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    if (max_samples <= 0 || (nullptr != data_values && 0 == sample_size))
+    {
+        return RETCODE_BAD_PARAMETER;
+    }
+
+#if HAVE_STRICT_REALTIME
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+            std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+    std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex(), std::defer_lock);
+
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return RETCODE_TIMEOUT;
+    }
+#else
+    std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+#endif // if HAVE_STRICT_REALTIME
+
+    set_read_communication_status(false);
+
+    auto it = history_.lookup_available_instance(HANDLE_NIL, false);
+    if (!it.first)
+    {
+        return RETCODE_NO_DATA;
+    }
+
+    detail::StateFilter states = { sample_states, view_states, instance_states };
+    detail::ReadTakeCommand cmd(
+        *this,
+        data_values,
+        sample_size,
+        info_columns,
+        max_samples,
+        states,
+        it.second,
+        false,
+        true);
+
+    while (!cmd.is_finished())
+    {
+        cmd.add_instance(true);
+    }
+    num_samples = static_cast<int32_t>(cmd.num_samples());
+
+    try_notify_read_conditions();
+
+    return cmd.return_value();
+}
+
 ReturnCode_t DataReaderImpl::read_next_sample(
         void* data,
         SampleInfo* info)
@@ -916,27 +990,49 @@ void DataReaderImpl::InnerDataReaderListener::on_data_available(
 
     if (data_reader_->on_data_available(writer_guid, first_sequence, last_sequence))
     {
-        auto user_reader = data_reader_->user_datareader_;
-
-        //First check if we can handle with on_data_on_readers
-        SubscriberListener* subscriber_listener =
-                data_reader_->subscriber_->get_listener_for(StatusMask::data_on_readers());
-        if (subscriber_listener != nullptr)
+        ListenerExecutor* executor = data_reader_->subscriber_->get_participant_impl()->get_listener_executor();
+        if (nullptr == executor)
         {
-            subscriber_listener->on_data_on_readers(data_reader_->subscriber_->user_subscriber_);
+            data_reader_->notify_data_available();
         }
-        else
+        else if (!data_reader_->data_available_pending_.exchange(true))
         {
-            // If not, try with on_data_available
-            DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::data_available());
-            if (listener != nullptr)
-            {
-                listener->on_data_available(user_reader);
-            }
+            // A single callback is queued for each reader, as it will see all the data received until it runs.
+            DataReaderImpl* data_reader = data_reader_;
+            executor->post(data_reader->listener_strand_, [data_reader]()
+                    {
+                        data_reader->data_available_pending_.store(false);
+                        data_reader->notify_data_available();
+                    });
+        }
+    }
+}
+
+void DataReaderImpl::notify_data_available()
+{
+    //First check if we can handle with on_data_on_readers
+    SubscriberListener* subscriber_listener = subscriber_->get_listener_for(StatusMask::data_on_readers());
+    if (subscriber_listener != nullptr)
+    {
+        subscriber_listener->on_data_on_readers(subscriber_->user_subscriber_);
+    }
+    else
+    {
+        // If not, try with on_data_available
+        DataReaderListener* listener = get_listener_for(StatusMask::data_available());
+        if (listener != nullptr)
+        {
+            listener->on_data_available(user_datareader_);
         }
+    }
 
-        data_reader_->set_read_communication_status(true);
+    if (ListenerExecutor::is_current_strand_cancelled())
+    {
+        // This reader has been deleted from its own listener.
+        return;
     }
+
+    set_read_communication_status(true);
 }
 
 void DataReaderImpl::InnerDataReaderListener::onReaderMatched(
@@ -1834,6 +1930,11 @@ std::shared_ptr<IPayloadPool> DataReaderImpl::get_payload_pool()
     }
     if (!is_custom_payload_pool_)
     {
+        // Payloads are consumed by the reception threads, which deserialize the incoming samples into them
+        config.numa_node = get_pool_numa_node(qos_.properties(),
+                        subscriber_->rtps_participant()->getRTPSParticipantAttributes().
+                                builtin_transports_reception_threads);
+
         std::shared_ptr<ITopicPayloadPool> topic_payload_pool = TopicPayloadPoolRegistry::get(
             topic_->get_impl()->get_rtps_topic_name(), config);
         topic_payload_pool->reserve_history(config, true);
@@ -1948,6 +2049,20 @@ ReturnCode_t DataReaderImpl::get_listening_locators(
     return RETCODE_OK;
 }
 
+ReturnCode_t DataReaderImpl::get_memory_usage(
+        rtps::EndpointMemoryUsage& usage) const
+{
+    if (nullptr == reader_)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    reader_->get_memory_usage(usage);
+    std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+    usage.history += history_.get_instances_memory_usage_nts();
+    return RETCODE_OK;
+}
+
 ReturnCode_t DataReaderImpl::delete_contained_entities()
 {
     std::lock_guard<std::recursive_mutex> _(get_conditions_mutex());
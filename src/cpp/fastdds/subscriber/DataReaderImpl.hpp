@@ -21,6 +21,7 @@
 #define _FASTDDS_DATAREADERIMPL_HPP_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <atomic>
 #include <mutex>
 
 #include <fastdds/dds/core/ReturnCode.hpp>
@@ -32,6 +33,7 @@
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleInfoColumns.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastdds/rtps/attributes/TopicAttributes.h>
@@ -45,6 +47,7 @@
 #include <fastdds/subscriber/DataReaderImpl/SampleLoanManager.hpp>
 #include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
 #include <fastdds/subscriber/history/DataReaderHistory.hpp>
+#include <fastdds/subscriber/ListenerExecutor.hpp>
 #include <fastdds/subscriber/SubscriberImpl.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 
@@ -189,6 +192,16 @@ public:
             void* data,
             SampleInfo* info);
 
+    ReturnCode_t take_columns(
+            void* data_values,
+            size_t sample_size,
+            const SampleInfoColumns& info_columns,
+            int32_t max_samples,
+            int32_t& num_samples,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
     ///@}
 
     ReturnCode_t return_loan(
@@ -356,6 +369,17 @@ public:
     ReturnCode_t get_listening_locators(
             rtps::LocatorList& locators) const;
 
+    /**
+     * Get the memory held by this DataReader.
+     *
+     * @param [out] usage  Memory used by the pools, the history, the instances and the matched writers.
+     *
+     * @return NOT_ENABLED if the reader has not been enabled.
+     * @return OK if the memory usage is returned.
+     */
+    ReturnCode_t get_memory_usage(
+            rtps::EndpointMemoryUsage& usage) const;
+
     ReturnCode_t delete_contained_entities();
 
     void filter_has_been_updated();
@@ -399,6 +423,12 @@ protected:
     DataReaderListener* listener_ = nullptr;
     mutable std::mutex listener_mutex_;
 
+    //! Callbacks of this reader posted on the listener executor of the participant
+    ListenerExecutor::Strand listener_strand_;
+
+    //! Whether a data available callback is already posted on the listener executor
+    std::atomic<bool> data_available_pending_{false};
+
     fastrtps::rtps::GUID_t guid_;
 
     class InnerDataReaderListener : public fastrtps::rtps::ReaderListener
@@ -574,6 +604,12 @@ protected:
     void set_read_communication_status(
             bool trigger_value);
 
+    /**
+     * Call on_data_on_readers on the subscriber listener or, if not available, on_data_available on the listener
+     * of this reader, and set the data available statuses.
+     */
+    void notify_data_available();
+
     void update_subscription_matched_status(
             const SubscriptionMatchedStatus& status);
 
@@ -27,6 +27,7 @@
 #include <fastdds/dds/core/LoanableTypedCollection.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleInfoColumns.hpp>
 
 #include <fastdds/subscriber/DataReaderImpl.hpp>
 #include <fastdds/subscriber/DataReaderImpl/DataReaderLoanManager.hpp>
@@ -71,8 +72,8 @@ struct ReadTakeCommand
         , reader_(reader.reader_)
         , info_pool_(reader.sample_info_pool_)
         , sample_pool_(reader.sample_pool_)
-        , data_values_(data_values)
-        , sample_infos_(sample_infos)
+        , data_values_(&data_values)
+        , sample_infos_(&sample_infos)
         , remaining_samples_(max_samples)
         , states_(states)
         , instance_(instance)
@@ -82,17 +83,59 @@ struct ReadTakeCommand
     {
         assert(0 <= remaining_samples_);
 
-        current_slot_ = data_values_.length();
+        current_slot_ = data_values_->length();
+        finished_ = false;
+    }
+
+    /**
+     * Constructs a command that stores the samples on a caller-provided array and the fields of their SampleInfo
+     * as caller-provided columns.
+     *
+     * @param reader        DataReader on which the command is performed.
+     * @param data_values   Array of samples where the data is deserialized. May be nullptr to skip deserialization.
+     * @param sample_size   Distance in bytes between two consecutive samples of @c data_values.
+     * @param info_columns  Columns where the fields of the SampleInfo are stored.
+     * @param max_samples   Maximum number of samples to return.
+     */
+    ReadTakeCommand(
+            DataReaderImpl& reader,
+            void* data_values,
+            size_t sample_size,
+            const SampleInfoColumns& info_columns,
+            int32_t max_samples,
+            const StateFilter& states,
+            const history_type::instance_info& instance,
+            bool single_instance,
+            bool loop_for_data)
+        : type_(reader.type_)
+        , loan_manager_(reader.loan_manager_)
+        , history_(reader.history_)
+        , reader_(reader.reader_)
+        , info_pool_(reader.sample_info_pool_)
+        , sample_pool_(reader.sample_pool_)
+        , info_columns_(&info_columns)
+        , column_values_(static_cast<uint8_t*>(data_values))
+        , column_value_size_(sample_size)
+        , remaining_samples_(max_samples)
+        , states_(states)
+        , instance_(instance)
+        , handle_(instance->first)
+        , single_instance_(single_instance)
+        , loop_for_data_(loop_for_data)
+    {
+        assert(0 <= remaining_samples_);
+
+        current_slot_ = 0;
         finished_ = false;
     }
 
     ~ReadTakeCommand()
     {
-        if (!data_values_.has_ownership() && RETCODE_NO_DATA == return_value_)
+        if (!has_ownership() && RETCODE_NO_DATA == return_value_)
         {
-            loan_manager_.return_loan(data_values_, sample_infos_);
-            data_values_.unloan();
-            sample_infos_.unloan();
+            loan_manager_.return_loan(*data_values_, *sample_infos_);
+            data_values_->unloan();
+            sample_infos_->unloan();
         }
     }
 
@@ -122,7 +165,7 @@ struct ReadTakeCommand
                 if (reader_->begin_sample_access_nts(change, wp, is_future_change))
                 {
                     //Check if the payload is dirty
-                    remove_change = !check_datasharing_validity(change, data_values_.has_ownership());
+                    remove_change = !check_datasharing_validity(change, has_ownership());
                 }
                 else
                 {
@@ -149,13 +192,12 @@ struct ReadTakeCommand
                     reader_->end_sample_access_nts(change, wp, added);
 
                     // Check if the payload is dirty
-                    if (added && !check_datasharing_validity(change, data_values_.has_ownership()))
+                    if (added && !check_datasharing_validity(change, has_ownership()))
                     {
                         // Decrement length of collections
                         --current_slot_;
                         ++remaining_samples_;
-                        data_values_.length(current_slot_);
-                        sample_infos_.length(current_slot_);
+                        set_length(current_slot_);
 
                         return_value_ = previous_return_value;
                         finished_ = false;
@@ -185,13 +227,16 @@ struct ReadTakeCommand
             ret_val = true;
 
             // complete sample infos
-            LoanableCollection::size_type slot = current_slot_;
-            LoanableCollection::size_type n = 0;
-            while (slot > first_slot)
+            if (nullptr != sample_infos_)
             {
-                --slot;
-                sample_infos_[slot].sample_rank = n;
-                ++n;
+                LoanableCollection::size_type slot = current_slot_;
+                LoanableCollection::size_type n = 0;
+                while (slot > first_slot)
+                {
+                    --slot;
+                    (*sample_infos_)[slot].sample_rank = n;
+                    ++n;
+                }
             }
         }
 
@@ -219,6 +264,12 @@ struct ReadTakeCommand
         return return_value_;
     }
 
+    //! Number of samples stored on the output. Only meaningful for commands storing samples as columns.
+    inline LoanableCollection::size_type num_samples() const
+    {
+        return current_slot_;
+    }
+
     static void generate_info(
             SampleInfo& info,
             const DataReaderInstance& instance,
@@ -247,18 +298,66 @@ struct ReadTakeCommand
         info.sample_identity.sequence_number(item->sequenceNumber);
         info.related_sample_identity = item->write_params.sample_identity();
 
-        info.valid_data = true;
+        info.valid_data = has_valid_data(item);
+    }
+
+    static void generate_info(
+            const SampleInfoColumns& columns,
+            LoanableCollection::size_type slot,
+            const DataReaderInstance& instance,
+            const DataReaderCacheChange& item)
+    {
+        if (nullptr != columns.sample_state)
+        {
+            columns.sample_state[slot] = item->isRead ? READ_SAMPLE_STATE : NOT_READ_SAMPLE_STATE;
+        }
+        if (nullptr != columns.view_state)
+        {
+            columns.view_state[slot] = instance.view_state;
+        }
+        if (nullptr != columns.instance_state)
+        {
+            columns.instance_state[slot] = instance.instance_state;
+        }
+        if (nullptr != columns.source_timestamp)
+        {
+            columns.source_timestamp[slot] = item->sourceTimestamp;
+        }
+        if (nullptr != columns.reception_timestamp)
+        {
+            columns.reception_timestamp[slot] = item->reader_info.receptionTimestamp;
+        }
+        if (nullptr != columns.instance_handle)
+        {
+            columns.instance_handle[slot] = item->instanceHandle;
+        }
+        if (nullptr != columns.publication_handle)
+        {
+            columns.publication_handle[slot] = InstanceHandle_t(item->writerGUID);
+        }
+        if (nullptr != columns.sample_identity)
+        {
+            columns.sample_identity[slot].writer_guid(item->writerGUID);
+            columns.sample_identity[slot].sequence_number(item->sequenceNumber);
+        }
+        if (nullptr != columns.valid_data)
+        {
+            columns.valid_data[slot] = has_valid_data(item);
+        }
+    }
 
-        switch (item->kind)
+    static bool has_valid_data(
+            const CacheChange_t* change)
+    {
+        switch (change->kind)
         {
             case eprosima::fastrtps::rtps::NOT_ALIVE_DISPOSED:
             case eprosima::fastrtps::rtps::NOT_ALIVE_DISPOSED_UNREGISTERED:
             case eprosima::fastrtps::rtps::NOT_ALIVE_UNREGISTERED:
-                info.valid_data = false;
-                break;
+                return false;
             case eprosima::fastrtps::rtps::ALIVE:
             default:
-                break;
+                return true;
         }
     }
 
@@ -270,8 +369,11 @@ private:
     RTPSReader* reader_;
     SampleInfoPool& info_pool_;
     std::shared_ptr<detail::SampleLoanManager> sample_pool_;
-    LoanableCollection& data_values_;
-    SampleInfoSeq& sample_infos_;
+    LoanableCollection* data_values_ = nullptr;
+    SampleInfoSeq* sample_infos_ = nullptr;
+    const SampleInfoColumns* info_columns_ = nullptr;
+    uint8_t* column_values_ = nullptr;
+    size_t column_value_size_ = 0;
     int32_t remaining_samples_;
     StateFilter states_;
     history_type::instance_info instance_;
@@ -332,19 +434,15 @@ private:
         if (remaining_samples_ > 0)
         {
             // Increment length of collections
-            auto new_len = current_slot_ + 1;
-            data_values_.length(new_len);
-            sample_infos_.length(new_len);
+            set_length(current_slot_ + 1);
 
             // Add information
-            generate_info(item);
-            if (sample_infos_[current_slot_].valid_data)
+            if (generate_info(item))
             {
                 if (!deserialize_sample(item))
                 {
                     // Decrement length of collections
-                    data_values_.length(current_slot_);
-                    sample_infos_.length(current_slot_);
+                    set_length(current_slot_);
                     deserialization_error = true;
                     return false;
                 }
@@ -366,34 +464,69 @@ private:
             CacheChange_t* change)
     {
         auto payload = &(change->serializedPayload);
-        if (data_values_.has_ownership())
+        if (nullptr != info_columns_)
+        {
+            // deserialize straight into the caller's array
+            return nullptr == column_values_ ||
+                   type_->deserialize(payload, column_values_ + current_slot_ * column_value_size_);
+        }
+        else if (data_values_->has_ownership())
         {
             // perform deserialization
-            return type_->deserialize(payload, data_values_.buffer()[current_slot_]);
+            return type_->deserialize(payload, data_values_->buffer()[current_slot_]);
         }
         else
         {
             // loan
             void* sample;
             sample_pool_->get_loan(change, sample);
-            const_cast<void**>(data_values_.buffer())[current_slot_] = sample;
+            const_cast<void**>(data_values_->buffer())[current_slot_] = sample;
             return true;
         }
     }
 
-    void generate_info(
+    /**
+     * Fills the information of the sample on the current slot.
+     *
+     * @return Whether the sample carries valid data.
+     */
+    bool generate_info(
             const DataReaderCacheChange& item)
     {
+        if (nullptr != info_columns_)
+        {
+            generate_info(*info_columns_, current_slot_, *instance_->second, item);
+            return has_valid_data(item);
+        }
+
         // Loan when necessary
-        if (!sample_infos_.has_ownership())
+        if (!sample_infos_->has_ownership())
         {
             SampleInfo* pool_item = info_pool_.get_item();
             assert(pool_item != nullptr);
-            const_cast<void**>(sample_infos_.buffer())[current_slot_] = pool_item;
+            const_cast<void**>(sample_infos_->buffer())[current_slot_] = pool_item;
         }
 
-        SampleInfo& info = sample_infos_[current_slot_];
+        SampleInfo& info = (*sample_infos_)[current_slot_];
         generate_info(info, *instance_->second, item);
+        return info.valid_data;
+    }
+
+    //! Whether the samples are stored on memory owned by the caller, as opposed to loaned by the reader.
+    bool has_ownership() const
+    {
+        return nullptr == data_values_ || data_values_->has_ownership();
+    }
+
+    //! Sets the length of the output collections. Columns have no length to update.
+    void set_length(
+            LoanableCollection::size_type length)
+    {
+        if (nullptr != data_values_)
+        {
+            data_values_->length(length);
+            sample_infos_->length(length);
+        }
     }
 
     bool check_datasharing_validity(
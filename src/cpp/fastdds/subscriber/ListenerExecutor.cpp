@@ -0,0 +1,209 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ListenerExecutor.cpp
+ */
+
+#include <fastdds/subscriber/ListenerExecutor.hpp>
+
+#include <algorithm>
+
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+//! Strand of the callback being executed by the current thread, or nullptr once it has been cancelled from it.
+static thread_local ListenerExecutor::Strand* current_strand = nullptr;
+
+//! Whether the strand of the callback being executed by the current thread has been cancelled from it.
+static thread_local bool current_strand_cancelled = false;
+
+ListenerExecutor::ListenerExecutor(
+        uint32_t participant_id,
+        uint32_t num_threads,
+        const fastdds::rtps::ThreadSettings& thread_settings)
+{
+    threads_.reserve(num_threads);
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads_.emplace_back(create_thread([this]()
+                {
+                    run();
+                }, thread_settings, "dds.lstnr.%u.%u", participant_id, i));
+    }
+}
+
+ListenerExecutor::~ListenerExecutor()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        running_ = false;
+    }
+    ready_cv_.notify_all();
+
+    for (eprosima::thread& thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+void ListenerExecutor::post(
+        Strand& strand,
+        std::function<void()>&& function)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!running_)
+    {
+        return;
+    }
+
+    strand.tasks_.push_back({std::move(function), Clock::now()});
+    max_queue_depth_ = std::max(max_queue_depth_, ++queue_depth_);
+
+    if (!strand.scheduled_)
+    {
+        strand.scheduled_ = true;
+        ready_.push_back(&strand);
+        ready_cv_.notify_one();
+    }
+}
+
+void ListenerExecutor::cancel(
+        Strand& strand)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    queue_depth_ -= strand.tasks_.size();
+    strand.tasks_.clear();
+
+    if (&strand == current_strand)
+    {
+        // Cancelled from its own callback (e.g. the reader is deleted from its listener), so waiting for the callback
+        // to finish would deadlock. The strand may be destroyed before the callback returns, so the thread running
+        // it will not touch it again.
+        strand.running_ = false;
+        strand.scheduled_ = false;
+        current_strand = nullptr;
+        current_strand_cancelled = true;
+        idle_cv_.notify_all();
+    }
+    else if (!strand.running_)
+    {
+        ready_.erase(std::remove(ready_.begin(), ready_.end(), &strand), ready_.end());
+        strand.scheduled_ = false;
+    }
+    else
+    {
+        // The thread running the callback will unschedule the strand, as it has no more tasks.
+        idle_cv_.wait(lock, [&strand]()
+                {
+                    return !strand.scheduled_;
+                });
+    }
+}
+
+bool ListenerExecutor::is_current_strand_cancelled()
+{
+    return current_strand_cancelled;
+}
+
+void ListenerExecutor::get_metrics(
+        ListenerExecutorMetrics& metrics) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    metrics.queue_depth = queue_depth_;
+    metrics.max_queue_depth = max_queue_depth_;
+    metrics.executed_callbacks = executed_callbacks_;
+    metrics.max_dispatch_latency_ns = max_dispatch_latency_ns_;
+    metrics.max_callback_duration_ns = max_callback_duration_ns_;
+    if (0 < executed_callbacks_)
+    {
+        metrics.mean_dispatch_latency_ns = total_dispatch_latency_ns_ / executed_callbacks_;
+        metrics.mean_callback_duration_ns = total_callback_duration_ns_ / executed_callbacks_;
+    }
+    else
+    {
+        metrics.mean_dispatch_latency_ns = 0;
+        metrics.mean_callback_duration_ns = 0;
+    }
+}
+
+void ListenerExecutor::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        ready_cv_.wait(lock, [this]()
+                {
+                    return !running_ || !ready_.empty();
+                });
+
+        if (!running_)
+        {
+            break;
+        }
+
+        // Only one callback is executed each time a strand is taken from the queue, so a busy strand does not
+        // starve the others.
+        Strand* strand = ready_.front();
+        ready_.pop_front();
+        Strand::Task task = std::move(strand->tasks_.front());
+        strand->tasks_.pop_front();
+        strand->running_ = true;
+        current_strand = strand;
+        --queue_depth_;
+        lock.unlock();
+
+        Clock::time_point start = Clock::now();
+        task.function();
+        Clock::time_point end = Clock::now();
+
+        lock.lock();
+        uint64_t dispatch_latency_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(start - task.posted).count());
+        uint64_t callback_duration_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        ++executed_callbacks_;
+        total_dispatch_latency_ns_ += dispatch_latency_ns;
+        max_dispatch_latency_ns_ = std::max(max_dispatch_latency_ns_, dispatch_latency_ns);
+        total_callback_duration_ns_ += callback_duration_ns;
+        max_callback_duration_ns_ = std::max(max_callback_duration_ns_, callback_duration_ns);
+
+        if (current_strand_cancelled)
+        {
+            current_strand_cancelled = false;
+            continue;
+        }
+
+        current_strand = nullptr;
+        strand->running_ = false;
+        if (strand->tasks_.empty())
+        {
+            strand->scheduled_ = false;
+            idle_cv_.notify_all();
+        }
+        else
+        {
+            ready_.push_back(strand);
+        }
+    }
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
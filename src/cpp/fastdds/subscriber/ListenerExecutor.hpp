@@ -0,0 +1,148 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ListenerExecutor.hpp
+ */
+
+#ifndef _FASTDDS_SUBSCRIBER_LISTENEREXECUTOR_HPP_
+#define _FASTDDS_SUBSCRIBER_LISTENEREXECUTOR_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/dds/domain/ListenerExecutorMetrics.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+#include <utils/thread.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Pool of threads running the listener callbacks of the DataReaders of a participant, so the threads receiving
+ * the data are not blocked by user code.
+ * Callbacks are posted on a Strand. Callbacks of the same Strand are executed in order and never at the same time,
+ * while callbacks of different Strands are executed in parallel.
+ */
+class ListenerExecutor
+{
+public:
+
+    using Clock = std::chrono::steady_clock;
+
+    //! Sequence of callbacks executed in order.
+    class Strand
+    {
+        friend class ListenerExecutor;
+
+        struct Task
+        {
+            std::function<void()> function;
+            Clock::time_point posted;
+        };
+
+        std::deque<Task> tasks_;
+
+        //! Whether the strand is on the ready queue or running.
+        bool scheduled_ = false;
+
+        //! Whether a callback of this strand is being executed.
+        bool running_ = false;
+    };
+
+    /**
+     * Create the executor and start its threads.
+     *
+     * @param [in] participant_id   Identifier of the participant, used to name the threads.
+     * @param [in] num_threads      Number of threads running callbacks.
+     * @param [in] thread_settings  Settings applied to the threads.
+     */
+    ListenerExecutor(
+            uint32_t participant_id,
+            uint32_t num_threads,
+            const fastdds::rtps::ThreadSettings& thread_settings);
+
+    /**
+     * Stop the threads, discarding the callbacks not yet executed.
+     */
+    ~ListenerExecutor();
+
+    /**
+     * Post a callback at the end of a strand.
+     *
+     * @param [in,out] strand    Strand where the callback is posted.
+     * @param [in]     function  Callback to execute.
+     */
+    void post(
+            Strand& strand,
+            std::function<void()>&& function);
+
+    /**
+     * Discard the callbacks posted on a strand, and wait for the one being executed to finish.
+     * When called from a callback of the same strand it does not wait, and the strand is not accessed again by the
+     * executor, so it can be destroyed before the callback returns.
+     *
+     * @param [in,out] strand Strand to cancel.
+     */
+    void cancel(
+            Strand& strand);
+
+    /**
+     * Check whether the strand of the callback being executed by the calling thread has been cancelled from that
+     * same callback, so the callback should not access the owner of the strand anymore.
+     *
+     * @return true when called from a callback whose strand has been cancelled, false otherwise.
+     */
+    static bool is_current_strand_cancelled();
+
+    /**
+     * Get the queue and latency metrics of this executor.
+     *
+     * @param [out] metrics Metrics of the executor.
+     */
+    void get_metrics(
+            ListenerExecutorMetrics& metrics) const;
+
+private:
+
+    void run();
+
+    mutable std::mutex mutex_;
+    std::condition_variable ready_cv_;
+    std::condition_variable idle_cv_;
+    std::deque<Strand*> ready_;
+    std::vector<eprosima::thread> threads_;
+    bool running_ = true;
+
+    uint64_t queue_depth_ = 0;
+    uint64_t max_queue_depth_ = 0;
+    uint64_t executed_callbacks_ = 0;
+    uint64_t total_dispatch_latency_ns_ = 0;
+    uint64_t max_dispatch_latency_ns_ = 0;
+    uint64_t total_callback_duration_ns_ = 0;
+    uint64_t max_callback_duration_ns_ = 0;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif /* _FASTDDS_SUBSCRIBER_LISTENEREXECUTOR_HPP_ */
@@ -329,6 +329,23 @@ ReturnCode_t SubscriberImpl::get_datareaders(
     return RETCODE_OK;
 }
 
+void SubscriberImpl::get_memory_usage(
+        std::vector<rtps::EndpointMemoryUsage>& usages) const
+{
+    std::lock_guard<std::mutex> lock(mtx_readers_);
+    for (auto it : readers_)
+    {
+        for (DataReaderImpl* dr : it.second)
+        {
+            rtps::EndpointMemoryUsage usage;
+            if (RETCODE_OK == dr->get_memory_usage(usage))
+            {
+                usages.push_back(usage);
+            }
+        }
+    }
+}
+
 bool SubscriberImpl::has_datareaders() const
 {
     if (readers_.empty())
@@ -30,6 +30,7 @@
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/qos/SubscriberQos.hpp>
 #include <fastdds/dds/topic/qos/TopicQos.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 
 #include <statistics/rtps/monitor-service/interfaces/IStatusQueryable.hpp>
 
@@ -132,6 +133,13 @@ public:
     ReturnCode_t get_datareaders(
             std::vector<DataReader*>& readers) const;
 
+    /**
+     * Get the memory held by the enabled DataReaders of this subscriber.
+     * @param [out] usages Vector where the memory usage of each DataReader is appended.
+     */
+    void get_memory_usage(
+            std::vector<rtps::EndpointMemoryUsage>& usages) const;
+
     bool has_datareaders() const;
 
     ReturnCode_t notify_datareaders() const;
@@ -32,6 +32,7 @@
 
 #include <rtps/common/ChangeComparison.hpp>
 #include <rtps/reader/WriterProxy.h>
+#include <utils/collections/sorted_vector_find.hpp>
 #include <utils/collections/sorted_vector_insert.hpp>
 
 using namespace eprosima::fastrtps::rtps;
@@ -106,6 +107,20 @@ DataReaderHistory::DataReaderHistory(
         data_available_instances_[c_InstanceHandle_Unknown] = instances_[c_InstanceHandle_Unknown];
     }
 
+    // With a preallocated memory policy, bounded instances are also preallocated
+    auto mempolicy = qos.endpoint().history_memory_policy;
+    if (has_keys_ && resource_limited_qos_.max_instances < std::numeric_limits<int32_t>::max() &&
+            (PREALLOCATED_MEMORY_MODE == mempolicy || PREALLOCATED_WITH_REALLOC_MEMORY_MODE == mempolicy))
+    {
+        size_t max_instances = static_cast<size_t>(resource_limited_qos_.max_instances);
+        instances_.reserve(max_instances);
+        instance_pool_.collection().reserve(max_instances);
+        for (size_t i = 0; i < max_instances; ++i)
+        {
+            instance_pool_.put(std::make_shared<DataReaderInstance>(key_changes_allocation_, key_writers_allocation_));
+        }
+    }
+
     using std::placeholders::_1;
     using std::placeholders::_2;
     using std::placeholders::_3;
@@ -341,7 +356,12 @@ void DataReaderHistory::add_to_instance(
     // ADD TO KEY VECTOR
     DataReaderCacheChange item = a_change;
     eprosima::utilities::collections::sorted_vector_insert(instance.cache_changes, item, rtps::history_order_cmp);
-    data_available_instances_[a_change->instanceHandle] = instances_[a_change->instanceHandle];
+    auto available_it = data_available_instances_.lower_bound(a_change->instanceHandle);
+    if (data_available_instances_.end() == available_it || available_it->first != a_change->instanceHandle)
+    {
+        data_available_instances_.emplace_hint(available_it, a_change->instanceHandle,
+                instances_.find(a_change->instanceHandle)->second);
+    }
 
     EPROSIMA_LOG_INFO(SUBSCRIBER, mp_reader->getGuid().entityId
             << ": Change " << a_change->sequenceNumber << " added from: "
@@ -392,8 +412,7 @@ bool DataReaderHistory::find_key(
 
     if (instances_.size() < static_cast<size_t>(resource_limited_qos_.max_instances))
     {
-        vit_out = instances_.emplace(handle,
-                        std::make_shared<DataReaderInstance>(key_changes_allocation_, key_writers_allocation_)).first;
+        vit_out = add_instance(handle);
         return true;
     }
 
@@ -402,10 +421,8 @@ bool DataReaderHistory::find_key(
         if (InstanceStateKind::ALIVE_INSTANCE_STATE != vit->second->instance_state)
         {
             data_available_instances_.erase(vit->first);
-            instances_.erase(vit);
-            vit_out = instances_.emplace(handle,
-                            std::make_shared<DataReaderInstance>(key_changes_allocation_,
-                            key_writers_allocation_)).first;
+            remove_instance(vit);
+            vit_out = add_instance(handle);
             return true;
         }
     }
@@ -414,6 +431,29 @@ bool DataReaderHistory::find_key(
     return false;
 }
 
+DataReaderHistory::InstanceCollection::iterator DataReaderHistory::add_instance(
+        const InstanceHandle_t& handle)
+{
+    std::shared_ptr<DataReaderInstance> instance = instance_pool_.get([this]()
+                    {
+                        return std::make_shared<DataReaderInstance>(key_changes_allocation_, key_writers_allocation_);
+                    });
+    return instances_.emplace(handle, std::move(instance)).first;
+}
+
+void DataReaderHistory::remove_instance(
+        InstanceCollection::iterator it)
+{
+    std::shared_ptr<DataReaderInstance> instance = std::move(it->second);
+    instances_.erase(it);
+
+    if (1 == instance.use_count())
+    {
+        instance->reset();
+        instance_pool_.put(std::move(instance));
+    }
+}
+
 void DataReaderHistory::writer_unmatched(
         const GUID_t& writer_guid,
         const SequenceNumber_t& last_notified_seq)
@@ -461,7 +501,19 @@ bool DataReaderHistory::remove_change_sub(
         EPROSIMA_LOG_ERROR(SUBSCRIBER, "Change not found on this key, something is wrong");
     }
 
-    if (remove_change(change))
+    const_iterator chit = find_ordered_change_nts(change);
+    if (chit == changesEnd())
+    {
+        EPROSIMA_LOG_INFO(RTPS_READER_HISTORY, "Trying to remove a change not in history");
+        return false;
+    }
+
+    CacheChange_t dummy_change;
+    dummy_change.sequenceNumber = change->sequenceNumber;
+    dummy_change.writerGUID = change->writerGUID;
+
+    auto new_it = remove_change_nts(chit);
+    if (new_it == changesEnd() || !matches_change(&dummy_change, *new_it)) // Change was successfully removed.
     {
         m_isHistoryFull = false;
         counters_.samples_unread = mp_reader->get_unread_count();
@@ -471,6 +523,16 @@ bool DataReaderHistory::remove_change_sub(
     return false;
 }
 
+History::const_iterator DataReaderHistory::find_ordered_change_nts(
+        CacheChange_t* change)
+{
+    return eprosima::utilities::collections::sorted_vector_find(m_changes, change, rtps::history_order_cmp,
+                   [](const CacheChange_t* lhs, const CacheChange_t* rhs)
+                   {
+                       return lhs->sequenceNumber == rhs->sequenceNumber && lhs->writerGUID == rhs->writerGUID;
+                   });
+}
+
 bool DataReaderHistory::remove_change_sub(
         CacheChange_t* change,
         DataReaderInstance::ChangeCollection::iterator& it)
@@ -489,7 +551,7 @@ bool DataReaderHistory::remove_change_sub(
 
     std::lock_guard<RecursiveTimedMutex> guard(*getMutex());
 
-    const_iterator chit = find_change_nts(change);
+    const_iterator chit = find_ordered_change_nts(change);
     if (chit == changesEnd())
     {
         EPROSIMA_LOG_INFO(RTPS_WRITER_HISTORY, "Trying to remove a change not in history");
@@ -600,7 +662,7 @@ std::pair<bool, DataReaderHistory::instance_info> DataReaderHistory::lookup_avai
         const InstanceHandle_t& handle,
         bool exact)
 {
-    InstanceCollection::iterator it = data_available_instances_.end();
+    instance_info it = data_available_instances_.end();
 
     if (!has_keys_)
     {
@@ -632,7 +694,7 @@ std::pair<bool, DataReaderHistory::instance_info> DataReaderHistory::lookup_avai
             else
             {
                 // Looking for an instance with a handle greater than the one on the input
-                auto comp = [](const InstanceHandle_t& h, const InstanceCollection::value_type& it)
+                auto comp = [](const InstanceHandle_t& h, const AvailableInstanceCollection::value_type& it)
                         {
                             return h < it.first;
                         };
@@ -668,14 +730,21 @@ void DataReaderHistory::check_and_remove_instance(
 
     if (instance->cache_changes.empty())
     {
-        if (InstanceStateKind::ALIVE_INSTANCE_STATE != instance->instance_state &&
+        bool remove_instance_info = InstanceStateKind::ALIVE_INSTANCE_STATE != instance->instance_state &&
                 instance->alive_writers.empty() &&
-                instance_info->first.isDefined())
-        {
-            instances_.erase(instance_info->first);
-        }
+                instance_info->first.isDefined();
+        InstanceHandle_t handle = instance_info->first;
 
         instance_info = data_available_instances_.erase(instance_info);
+
+        if (remove_instance_info)
+        {
+            auto it = instances_.find(handle);
+            if (instances_.end() != it)
+            {
+                remove_instance(it);
+            }
+        }
     }
 }
 
@@ -895,6 +964,17 @@ StateFilter DataReaderHistory::get_mask_status() const noexcept
     };
 }
 
+fastdds::rtps::MemoryUsage DataReaderHistory::get_instances_memory_usage_nts() const
+{
+    uint64_t instances_bytes = instances_.size() * sizeof(DataReaderInstance) +
+            data_available_instances_.size() * sizeof(AvailableInstanceCollection::value_type);
+
+    fastdds::rtps::MemoryUsage usage;
+    usage.live_bytes = instances_.used_bytes() + instances_bytes;
+    usage.reserved_bytes = instances_.allocated_bytes() + instances_bytes;
+    return usage;
+}
+
 void DataReaderHistory::writer_update_its_ownership_strength_nts(
         const GUID_t& writer_guid,
         const uint32_t ownership_strength)
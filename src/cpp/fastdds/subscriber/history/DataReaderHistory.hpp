@@ -38,6 +38,7 @@
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/rtps/resources/ResourceManagement.h>
@@ -46,6 +47,9 @@
 
 #include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
 
+#include <utils/collections/InstanceHandleMap.hpp>
+#include <utils/collections/ObjectPool.hpp>
+
 #include "DataReaderHistoryCounters.hpp"
 #include "DataReaderInstance.hpp"
 
@@ -67,8 +71,9 @@ public:
     using GUID_t = eprosima::fastrtps::rtps::GUID_t;
     using SequenceNumber_t = eprosima::fastrtps::rtps::SequenceNumber_t;
 
-    using InstanceCollection = std::map<InstanceHandle_t, std::shared_ptr<DataReaderInstance>>;
-    using instance_info = InstanceCollection::iterator;
+    using InstanceCollection = InstanceHandleMap<std::shared_ptr<DataReaderInstance>>;
+    using AvailableInstanceCollection = std::map<InstanceHandle_t, std::shared_ptr<DataReaderInstance>>;
+    using instance_info = AvailableInstanceCollection::iterator;
 
     /**
      * Constructor.
@@ -367,6 +372,13 @@ public:
             const GUID_t& writer_guid,
             const uint32_t ownership_strength) override;
 
+    /**
+     * Get the memory held by the instances of the history.
+     * The mutex of the history should be locked by the caller.
+     * @return Memory used by the collections of instances and the instances themselves.
+     */
+    fastdds::rtps::MemoryUsage get_instances_memory_usage_nts() const;
+
 private:
 
     //!Resource limits for allocating the array of changes per instance
@@ -375,8 +387,10 @@ private:
     eprosima::fastrtps::ResourceLimitedContainerConfig key_writers_allocation_;
     //!Collection of DataReaderInstance objects accessible by their handle
     InstanceCollection instances_;
-    //!Collection of DataReaderInstance objects with available data, accessible by their handle
-    InstanceCollection data_available_instances_;
+    //!Collection of DataReaderInstance objects with available data, ordered by their handle
+    AvailableInstanceCollection data_available_instances_;
+    //!DataReaderInstance objects no longer in use, ready to be reused
+    ObjectPool<std::shared_ptr<DataReaderInstance>> instance_pool_;
     //!HistoryQosPolicy values.
     HistoryQosPolicy history_qos_;
     //!ResourceLimitsQosPolicy values.
@@ -413,6 +427,33 @@ private:
             const InstanceHandle_t& handle,
             InstanceCollection::iterator& map_it);
 
+    /**
+     * @brief Adds a new instance, reusing a DataReaderInstance object from the pool when possible.
+     * @param handle Handle of the new instance.
+     * @return Iterator to the new instance.
+     */
+    InstanceCollection::iterator add_instance(
+            const InstanceHandle_t& handle);
+
+    /**
+     * @brief Removes an instance, returning its DataReaderInstance object to the pool when not referenced elsewhere.
+     * @param it Iterator to the instance to remove.
+     */
+    void remove_instance(
+            InstanceCollection::iterator it);
+
+    /**
+     * @brief Locates a change using the order of the history instead of a linear search.
+     *
+     * Locating the oldest or newest change is O(1), and any other change O(log n), unless the order is ambiguous
+     * among the changes of several writers, where it is O(n).
+     *
+     * @param change The change to find.
+     * @return Iterator to the change, or changesEnd() if it is not in the history.
+     */
+    const_iterator find_ordered_change_nts(
+            CacheChange_t* change);
+
     /**
      * @name Variants of incoming change processing.
      *       Will be called with the history mutex taken.
@@ -166,6 +166,20 @@ struct DataReaderInstance
         }
     }
 
+    //! Returns the instance to its initial state, so it can be reused for another handle.
+    void reset()
+    {
+        cache_changes.clear();
+        alive_writers.clear();
+        current_owner = { {}, (std::numeric_limits<uint32_t>::max)() };
+        next_deadline_us = std::chrono::steady_clock::time_point();
+        view_state = ViewStateKind::NEW_VIEW_STATE;
+        instance_state = InstanceStateKind::ALIVE_INSTANCE_STATE;
+        disposed_generation_count = 0;
+        no_writers_generation_count = 0;
+        has_been_accounted_ = false;
+    }
+
 private:
 
     //! Whether this instance has ever been included in the history counters
@@ -160,8 +160,10 @@ void set_qos_from_attributes(
     qos.flow_controllers() = attr.flow_controllers;
     qos.builtin_controllers_sender_thread() = attr.builtin_controllers_sender_thread;
     qos.timed_events_thread() = attr.timed_events_thread;
+    qos.timed_events_threads() = attr.timed_events_threads;
     qos.discovery_server_thread() = attr.discovery_server_thread;
     qos.typelookup_service_thread() = attr.typelookup_service_thread;
+    qos.persistence_thread() = attr.persistence_thread;
 #if HAVE_SECURITY
     qos.security_log_thread() = attr.security_log_thread;
 #endif // if HAVE_SECURITY
@@ -209,8 +211,10 @@ void set_attributes_from_qos(
     attr.flow_controllers = qos.flow_controllers();
     attr.builtin_controllers_sender_thread = qos.builtin_controllers_sender_thread();
     attr.timed_events_thread = qos.timed_events_thread();
+    attr.timed_events_threads = qos.timed_events_threads();
     attr.discovery_server_thread = qos.discovery_server_thread();
     attr.typelookup_service_thread = qos.typelookup_service_thread();
+    attr.persistence_thread = qos.persistence_thread();
 #if HAVE_SECURITY
     attr.security_log_thread = qos.security_log_thread();
 #endif // if HAVE_SECURITY
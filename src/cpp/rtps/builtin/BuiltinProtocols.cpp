@@ -288,6 +288,7 @@ bool BuiltinProtocols::removeLocalWriter(
     }
     if (mp_PDP != nullptr && mp_PDP->getEDP() != nullptr)
     {
+        mp_PDP->getEDP()->unindex_local_writer(W);
         ok |= mp_PDP->getEDP()->removeLocalWriter(W);
     }
     return ok;
@@ -303,6 +304,7 @@ bool BuiltinProtocols::removeLocalReader(
     }
     if (mp_PDP != nullptr && mp_PDP->getEDP() != nullptr)
     {
+        mp_PDP->getEDP()->unindex_local_reader(R);
         ok |= mp_PDP->getEDP()->removeLocalReader(R);
     }
     return ok;
@@ -105,6 +105,7 @@ ParticipantProxyData::ParticipantProxyData(
     , m_writers(nullptr)
     , m_sample_identity(pdata.m_sample_identity)
     , lease_duration_(pdata.lease_duration_)
+    , compact_announcements_(pdata.compact_announcements_)
 {
 }
 
@@ -219,6 +220,12 @@ uint32_t ParticipantProxyData::get_serialized_size(
     }
 #endif // if HAVE_SECURITY
 
+    if (compact_announcements_)
+    {
+        // PID_COMPACT_ANNOUNCEMENTS_SUPPORT
+        ret_val += 4 + PARAMETER_BOOL_LENGTH;
+    }
+
     // PID_SENTINEL
     return ret_val + 4;
 }
@@ -383,6 +390,16 @@ bool ParticipantProxyData::writeToCDRMessage(
     }
 #endif // if HAVE_SECURITY
 
+    if (compact_announcements_)
+    {
+        ParameterBool_t p(fastdds::dds::PID_COMPACT_ANNOUNCEMENTS_SUPPORT, PARAMETER_BOOL_LENGTH,
+                compact_announcements_);
+        if (!fastdds::dds::ParameterSerializer<ParameterBool_t>::add_to_cdr_message(p, msg))
+        {
+            return false;
+        }
+    }
+
     return fastdds::dds::ParameterSerializer<Parameter_t>::add_parameter_sentinel(msg);
 }
 
@@ -712,6 +729,32 @@ bool ParticipantProxyData::readFromCDRMessage(
 #endif // if HAVE_SECURITY
                         break;
                     }
+                    case fastdds::dds::PID_COMPACT_ANNOUNCEMENTS_SUPPORT:
+                    {
+                        VendorId_t local_vendor_id = source_vendor_id;
+                        if (c_VendorId_Unknown == local_vendor_id)
+                        {
+                            local_vendor_id = ((c_VendorId_Unknown == m_VendorId) ? c_VendorId_eProsima : m_VendorId);
+                        }
+
+                        // Ignore custom PID when coming from other vendors
+                        if (c_VendorId_eProsima != local_vendor_id)
+                        {
+                            EPROSIMA_LOG_INFO(RTPS_PROXY_DATA,
+                                    "Ignoring custom PID" << pid << " from vendor " << local_vendor_id);
+                            return true;
+                        }
+
+                        ParameterBool_t p(pid, plength);
+                        if (!fastdds::dds::ParameterSerializer<ParameterBool_t>::read_from_cdr_message(p, msg,
+                                plength))
+                        {
+                            return false;
+                        }
+
+                        compact_announcements_ = p.value;
+                        break;
+                    }
                     default:
                     {
                         break;
@@ -762,6 +805,7 @@ void ParticipantProxyData::clear()
     m_properties.length = 0;
     m_userData.clear();
     m_userData.length = 0;
+    compact_announcements_ = false;
 }
 
 void ParticipantProxyData::copy(
@@ -785,6 +829,7 @@ void ParticipantProxyData::copy(
     m_userData = pdata.m_userData;
     m_properties = pdata.m_properties;
     m_sample_identity = pdata.m_sample_identity;
+    compact_announcements_ = pdata.compact_announcements_;
 
     // This method is only called when a new participant is discovered.The destination of the copy
     // will always be a new ParticipantProxyData or one from the pool, so there is no need for
@@ -807,6 +852,8 @@ bool ParticipantProxyData::updateData(
     isAlive = true;
     m_userData = pdata.m_userData;
     m_properties = pdata.m_properties;
+    m_sample_identity = pdata.m_sample_identity;
+    compact_announcements_ = pdata.compact_announcements_;
 #if HAVE_SECURITY
     identity_token_ = pdata.identity_token_;
     permissions_token_ = pdata.permissions_token_;
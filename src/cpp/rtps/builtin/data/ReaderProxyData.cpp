@@ -105,6 +105,7 @@ ReaderProxyData::ReaderProxyData(
     , m_type_information(nullptr)
     , m_properties(readerInfo.m_properties)
     , content_filter_(readerInfo.content_filter_)
+    , sample_batches_(readerInfo.sample_batches_)
 {
     if (readerInfo.m_type_id)
     {
@@ -145,6 +146,7 @@ ReaderProxyData& ReaderProxyData::operator =(
     m_topicKind = readerInfo.m_topicKind;
     m_qos.setQos(readerInfo.m_qos, true);
     m_properties = readerInfo.m_properties;
+    sample_batches_ = readerInfo.sample_batches_;
     content_filter_ = readerInfo.content_filter_;
 
     if (readerInfo.m_type_id)
@@ -288,6 +290,11 @@ uint32_t ReaderProxyData::get_serialized_size(
         ret_val += fastdds::dds::QosPoliciesSerializer<DisablePositiveACKsQosPolicy>::cdr_serialized_size(
             m_qos.m_disablePositiveACKs);
     }
+    if (sample_batches_)
+    {
+        // PID_SAMPLE_BATCH
+        ret_val += 4 + PARAMETER_BOOL_LENGTH;
+    }
     if (m_type_information && m_type_information->assigned())
     {
         ret_val +=
@@ -560,6 +567,14 @@ bool ReaderProxyData::writeToCDRMessage(
             return false;
         }
     }
+    if (sample_batches_)
+    {
+        ParameterBool_t p(fastdds::dds::PID_SAMPLE_BATCH, PARAMETER_BOOL_LENGTH, sample_batches_);
+        if (!fastdds::dds::ParameterSerializer<ParameterBool_t>::add_to_cdr_message(p, msg))
+        {
+            return false;
+        }
+    }
 
     if ((m_qos.data_sharing.send_always() || m_qos.data_sharing.hasChanged) &&
             m_qos.data_sharing.kind() != fastdds::dds::OFF)
@@ -1020,6 +1035,32 @@ bool ReaderProxyData::readFromCDRMessage(
                         }
                         break;
                     }
+                    case fastdds::dds::PID_SAMPLE_BATCH:
+                    {
+                        VendorId_t local_vendor_id = source_vendor_id;
+                        if (c_VendorId_Unknown == local_vendor_id)
+                        {
+                            local_vendor_id = ((c_VendorId_Unknown == vendor_id) ? c_VendorId_eProsima : vendor_id);
+                        }
+
+                        // Ignore custom PID when coming from other vendors
+                        if (c_VendorId_eProsima != local_vendor_id)
+                        {
+                            EPROSIMA_LOG_INFO(RTPS_PROXY_DATA,
+                                    "Ignoring custom PID" << pid << " from vendor " << local_vendor_id);
+                            return true;
+                        }
+
+                        ParameterBool_t p(pid, plength);
+                        if (!fastdds::dds::ParameterSerializer<ParameterBool_t>::read_from_cdr_message(p, msg,
+                                plength))
+                        {
+                            return false;
+                        }
+
+                        sample_batches_ = p.value;
+                        break;
+                    }
 #if HAVE_SECURITY
                     case fastdds::dds::PID_ENDPOINT_SECURITY_INFO:
                     {
@@ -1148,6 +1189,7 @@ void ReaderProxyData::clear()
     m_qos.clear();
     m_properties.clear();
     m_properties.length = 0;
+    sample_batches_ = false;
     content_filter_.filter_class_name = "";
     content_filter_.content_filtered_topic_name = "";
     content_filter_.related_topic_name = "";
@@ -1211,6 +1253,7 @@ void ReaderProxyData::copy(
     m_isAlive = rdata->m_isAlive;
     m_topicKind = rdata->m_topicKind;
     m_properties = rdata->m_properties;
+    sample_batches_ = rdata->sample_batches_;
     content_filter_ = rdata->content_filter_;
 
     if (rdata->m_type_id)
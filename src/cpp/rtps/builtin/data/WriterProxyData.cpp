@@ -90,6 +90,7 @@ WriterProxyData::WriterProxyData(
     , m_type(nullptr)
     , m_type_information(nullptr)
     , m_properties(writerInfo.m_properties)
+    , sample_batches_(writerInfo.sample_batches_)
 {
     if (writerInfo.m_type_id)
     {
@@ -138,6 +139,7 @@ WriterProxyData& WriterProxyData::operator =(
     persistence_guid_ = writerInfo.persistence_guid_;
     m_qos.setQos(writerInfo.m_qos, true);
     m_properties = writerInfo.m_properties;
+    sample_batches_ = writerInfo.sample_batches_;
 
     if (writerInfo.m_type_id)
     {
@@ -286,6 +288,11 @@ uint32_t WriterProxyData::get_serialized_size(
         ret_val += fastdds::dds::QosPoliciesSerializer<DisablePositiveACKsQosPolicy>::cdr_serialized_size(
             m_qos.m_disablePositiveACKs);
     }
+    if (sample_batches_)
+    {
+        // PID_SAMPLE_BATCH
+        ret_val += 4 + PARAMETER_BOOL_LENGTH;
+    }
     if ((m_qos.data_sharing.send_always() || m_qos.data_sharing.hasChanged) &&
             m_qos.data_sharing.kind() != fastdds::dds::OFF)
     {
@@ -556,6 +563,14 @@ bool WriterProxyData::writeToCDRMessage(
             return false;
         }
     }
+    if (sample_batches_)
+    {
+        ParameterBool_t p(fastdds::dds::PID_SAMPLE_BATCH, PARAMETER_BOOL_LENGTH, sample_batches_);
+        if (!fastdds::dds::ParameterSerializer<ParameterBool_t>::add_to_cdr_message(p, msg))
+        {
+            return false;
+        }
+    }
     if ((m_qos.data_sharing.send_always() || m_qos.data_sharing.hasChanged) &&
             m_qos.data_sharing.kind() != fastdds::dds::OFF)
     {
@@ -997,6 +1012,32 @@ bool WriterProxyData::readFromCDRMessage(
                         }
                         break;
                     }
+                    case fastdds::dds::PID_SAMPLE_BATCH:
+                    {
+                        VendorId_t local_vendor_id = source_vendor_id;
+                        if (c_VendorId_Unknown == local_vendor_id)
+                        {
+                            local_vendor_id = ((c_VendorId_Unknown == vendor_id) ? c_VendorId_eProsima : vendor_id);
+                        }
+
+                        // Ignore custom PID when coming from other vendors
+                        if (c_VendorId_eProsima != local_vendor_id)
+                        {
+                            EPROSIMA_LOG_INFO(RTPS_PROXY_DATA,
+                                    "Ignoring custom PID" << pid << " from vendor " << local_vendor_id);
+                            return true;
+                        }
+
+                        ParameterBool_t p(pid, plength);
+                        if (!fastdds::dds::ParameterSerializer<ParameterBool_t>::read_from_cdr_message(p, msg,
+                                plength))
+                        {
+                            return false;
+                        }
+
+                        sample_batches_ = p.value;
+                        break;
+                    }
 #if HAVE_SECURITY
                     case fastdds::dds::PID_ENDPOINT_SECURITY_INFO:
                     {
@@ -1131,6 +1172,7 @@ void WriterProxyData::clear()
     persistence_guid_ = c_Guid_Unknown;
     m_properties.clear();
     m_properties.length = 0;
+    sample_batches_ = false;
 
     if (m_type_id)
     {
@@ -1162,6 +1204,7 @@ void WriterProxyData::copy(
     m_topicKind = wdata->m_topicKind;
     persistence_guid_ = wdata->persistence_guid_;
     m_properties = wdata->m_properties;
+    sample_batches_ = wdata->sample_batches_;
 
     if (wdata->m_type_id)
     {
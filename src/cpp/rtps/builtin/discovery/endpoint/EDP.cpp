@@ -114,6 +114,7 @@ bool EDP::newLocalReaderProxyData(
 
                 rpd->isAlive(true);
                 rpd->m_expectsInlineQos = reader->expectsInlineQos();
+                rpd->sample_batches(true);
                 rpd->guid(reader->getGuid());
                 rpd->key() = rpd->guid();
                 if (ratt.multicastLocatorList.empty() && ratt.unicastLocatorList.empty())
@@ -199,6 +200,11 @@ bool EDP::newLocalReaderProxyData(
     }
 #endif //FASTDDS_STATISTICS
 
+    {
+        std::lock_guard<shared_mutex> _(local_endpoints_mutex_);
+        local_readers_.add(reader->getGuid(), att.getTopicName().to_string(), reader);
+    }
+
     //PAIRING
     if (this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints())
     {
@@ -258,6 +264,7 @@ bool EDP::newLocalWriterProxyData(
                 wpd->m_qos.setQos(wqos, true);
                 wpd->userDefinedId(watt.getUserDefinedID());
                 wpd->persistence_guid(watt.persistence_guid);
+                wpd->sample_batches(writer->sends_sample_batches());
 #if HAVE_SECURITY
                 if (mp_RTPSParticipant->is_secure())
                 {
@@ -305,6 +312,11 @@ bool EDP::newLocalWriterProxyData(
     }
 #endif //FASTDDS_STATISTICS
 
+    {
+        std::lock_guard<shared_mutex> _(local_endpoints_mutex_);
+        local_writers_.add(writer->getGuid(), att.getTopicName().to_string(), writer);
+    }
+
     //PAIRING
     if (this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints())
     {
@@ -715,29 +727,71 @@ bool EDP::valid_matching(
     }
     else
     {
-        for (auto wnameit = wdata->m_qos.m_partition.begin();
-                wnameit !=  wdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            for (auto rnameit = rdata->m_qos.m_partition.begin();
-                    rnameit != rdata->m_qos.m_partition.end(); ++rnameit)
+        matched = partitions_match(wdata, rdata);
+    }
+    if (!matched) //Different partitions
+    {
+        EPROSIMA_LOG_WARNING(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "): Different Partitions");
+        reason.set(MatchingFailureMask::partitions);
+    }
+
+    return matched;
+}
+
+bool EDP::partitions_match(
+        const WriterProxyData* wdata,
+        const ReaderProxyData* rdata)
+{
+    // Partition names cannot contain the null character, so it is used as separator on the keys of the cache
+    auto partitions_key = [](const fastdds::dds::PartitionQosPolicy& partitions)
             {
-                if (StringMatching::matchString(wnameit->name(), rnameit->name()))
+                std::string key;
+                for (auto it = partitions.begin(); it != partitions.end(); ++it)
                 {
-                    matched = true;
-                    break;
+                    key.append(it->name());
+                    key.push_back('\0');
                 }
-            }
-            if (matched)
+                return key;
+            };
+
+    std::pair<std::string, std::string> key(partitions_key(wdata->m_qos.m_partition),
+            partitions_key(rdata->m_qos.m_partition));
+
+    {
+        std::lock_guard<std::mutex> guard(partition_cache_mutex_);
+        auto it = partition_cache_.find(key);
+        if (it != partition_cache_.end())
+        {
+            return it->second;
+        }
+    }
+
+    bool matched = false;
+    for (auto wnameit = wdata->m_qos.m_partition.begin();
+            wnameit !=  wdata->m_qos.m_partition.end(); ++wnameit)
+    {
+        for (auto rnameit = rdata->m_qos.m_partition.begin();
+                rnameit != rdata->m_qos.m_partition.end(); ++rnameit)
+        {
+            if (StringMatching::matchString(wnameit->name(), rnameit->name()))
             {
+                matched = true;
                 break;
             }
         }
+        if (matched)
+        {
+            break;
+        }
     }
-    if (!matched) //Different partitions
+
+    std::lock_guard<std::mutex> guard(partition_cache_mutex_);
+    // Keep the cache bounded, in case partitions are being continuously changed
+    if (partition_cache_.size() >= max_partition_cache_size_)
     {
-        EPROSIMA_LOG_WARNING(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "): Different Partitions");
-        reason.set(MatchingFailureMask::partitions);
+        partition_cache_.clear();
     }
+    partition_cache_.emplace(std::move(key), matched);
 
     return matched;
 }
@@ -830,80 +884,87 @@ bool EDP::pairingReader(
     EPROSIMA_LOG_INFO(RTPS_EDP, rdata.guid() << " in topic: \"" << rdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-    if (!this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints())
+    const auto* candidates = writer_proxies_.find(rdata.topicName().to_string());
+    if (nullptr == candidates)
     {
-        pit++;
+        return true;
     }
 
-    for (; pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    bool match_local_endpoints = this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints();
+    const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
+
+    // Only the writers on the same topic can match
+    for (const auto& candidate : *candidates)
     {
-        for (auto& pair : *(*pit)->m_writers)
+        if (!match_local_endpoints && local_prefix == candidate.first.guidPrefix)
+        {
+            continue;
+        }
+
+        WriterProxyData* wdatait = candidate.second;
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
+        const GUID_t& reader_guid = R->getGuid();
+        const GUID_t& writer_guid = wdatait->guid();
+
+        if (valid)
         {
-            WriterProxyData* wdatait = pair.second;
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
-            const GUID_t& reader_guid = R->getGuid();
-            const GUID_t& writer_guid = wdatait->guid();
-
-            if (valid)
-            {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid, (*pit)->m_guid,
-                        *wdatait, R->getAttributes().security_attributes()))
-                {
-                    EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
-                }
+            GUID_t remote_participant_guid(wdatait->guid().guidPrefix, c_EntityId_RTPSParticipant);
+            if (!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid, remote_participant_guid,
+                    *wdatait, R->getAttributes().security_attributes()))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
+            }
 #else
-                if (R->matched_writer_add(*wdatait))
+            if (R->matched_writer_add(*wdatait))
+            {
+                EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
+                        "WP:" << wdatait->guid() << " match R:" << R->getGuid() << ". RLoc:" <<
+                        wdatait->remote_locators());
+                //MATCHED AND ADDED CORRECTLY:
+                if (R->getListener() != nullptr)
                 {
-                    EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
-                            "WP:" << wdatait->guid() << " match R:" << R->getGuid() << ". RLoc:" <<
-                            wdatait->remote_locators());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (R->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        R->getListener()->onReaderMatched(R, info);
-
-                        const SubscriptionMatchedStatus& sub_info =
-                                update_subscription_matched_status(reader_guid, writer_guid, 1);
-                        R->getListener()->onReaderMatched(R, sub_info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    R->getListener()->onReaderMatched(R, info);
+
+                    const SubscriptionMatchedStatus& sub_info =
+                            update_subscription_matched_status(reader_guid, writer_guid, 1);
+                    R->getListener()->onReaderMatched(R, sub_info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && R->getListener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && R->getListener() != nullptr)
-                {
-                    R->getListener()->on_requested_incompatible_qos(R, incompatible_qos);
-                }
+                R->getListener()->on_requested_incompatible_qos(R, incompatible_qos);
+            }
 
-                //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
-                if (R->matched_writer_is_matched(wdatait->guid())
-                        && R->matched_writer_remove(wdatait->guid()))
-                {
+            //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
+            if (R->matched_writer_is_matched(wdatait->guid())
+                    && R->matched_writer_remove(wdatait->guid()))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
-                            wdatait->guid());
+                mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
+                        wdatait->guid());
 #endif // if HAVE_SECURITY
 
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (R->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        R->getListener()->onReaderMatched(R, info);
-
-                        const SubscriptionMatchedStatus& sub_info =
-                                update_subscription_matched_status(reader_guid, writer_guid, -1);
-                        R->getListener()->onReaderMatched(R, sub_info);
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if (R->getListener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    R->getListener()->onReaderMatched(R, info);
+
+                    const SubscriptionMatchedStatus& sub_info =
+                            update_subscription_matched_status(reader_guid, writer_guid, -1);
+                    R->getListener()->onReaderMatched(R, sub_info);
                 }
             }
         }
@@ -922,84 +983,91 @@ bool EDP::pairingWriter(
     EPROSIMA_LOG_INFO(RTPS_EDP, W->getGuid() << " in topic: \"" << wdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-    if (!this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints())
+    const auto* candidates = reader_proxies_.find(wdata.topicName().to_string());
+    if (nullptr == candidates)
     {
-        pit++;
+        return true;
     }
 
-    for (; pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    bool match_local_endpoints = this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints();
+    const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
+
+    // Only the readers on the same topic can match
+    for (const auto& candidate : *candidates)
     {
-        for (auto& pair : *(*pit)->m_readers)
+        if (!match_local_endpoints && local_prefix == candidate.first.guidPrefix)
         {
-            ReaderProxyData* rdatait = pair.second;
-            const GUID_t& reader_guid = rdatait->guid();
-            if (reader_guid == c_Guid_Unknown)
-            {
-                continue;
-            }
+            continue;
+        }
 
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
+        ReaderProxyData* rdatait = candidate.second;
+        const GUID_t& reader_guid = rdatait->guid();
+        if (reader_guid == c_Guid_Unknown)
+        {
+            continue;
+        }
 
-            if (valid)
-            {
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
+
+        if (valid)
+        {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), (*pit)->m_guid,
-                        *rdatait, W->getAttributes().security_attributes()))
-                {
-                    EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
-                }
+            GUID_t remote_participant_guid(rdatait->guid().guidPrefix, c_EntityId_RTPSParticipant);
+            if (!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), remote_participant_guid,
+                    *rdatait, W->getAttributes().security_attributes()))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
+            }
 #else
-                if (W->matched_reader_add(*rdatait))
+            if (W->matched_reader_add(*rdatait))
+            {
+                EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
+                        "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
+                        rdatait->remote_locators());
+                //MATCHED AND ADDED CORRECTLY:
+                if (W->getListener() != nullptr)
                 {
-                    EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
-                            "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
-                            rdatait->remote_locators());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (W->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        W->getListener()->onWriterMatched(W, info);
-
-                        const GUID_t& writer_guid = W->getGuid();
-                        const PublicationMatchedStatus& pub_info =
-                                update_publication_matched_status(reader_guid, writer_guid, 1);
-                        W->getListener()->onWriterMatched(W, pub_info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    W->getListener()->onWriterMatched(W, info);
+
+                    const GUID_t& writer_guid = W->getGuid();
+                    const PublicationMatchedStatus& pub_info =
+                            update_publication_matched_status(reader_guid, writer_guid, 1);
+                    W->getListener()->onWriterMatched(W, pub_info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && W->getListener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && W->getListener() != nullptr)
-                {
-                    W->getListener()->on_offered_incompatible_qos(W, incompatible_qos);
-                }
+                W->getListener()->on_offered_incompatible_qos(W, incompatible_qos);
+            }
 
-                //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
-                if (W->matched_reader_is_matched(reader_guid) && W->matched_reader_remove(reader_guid))
-                {
+            //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
+            if (W->matched_reader_is_matched(reader_guid) && W->matched_reader_remove(reader_guid))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), participant_guid, reader_guid);
+                mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), participant_guid, reader_guid);
 #endif // if HAVE_SECURITY
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (W->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        W->getListener()->onWriterMatched(W, info);
+                //MATCHED AND ADDED CORRECTLY:
+                if (W->getListener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    W->getListener()->onWriterMatched(W, info);
 
-                        const GUID_t& writer_guid = W->getGuid();
-                        const PublicationMatchedStatus& pub_info =
-                                update_publication_matched_status(reader_guid, writer_guid, -1);
-                        W->getListener()->onWriterMatched(W, pub_info);
+                    const GUID_t& writer_guid = W->getGuid();
+                    const PublicationMatchedStatus& pub_info =
+                            update_publication_matched_status(reader_guid, writer_guid, -1);
+                    W->getListener()->onWriterMatched(W, pub_info);
 
-                    }
                 }
             }
         }
@@ -1007,6 +1075,44 @@ bool EDP::pairingWriter(
     return true;
 }
 
+void EDP::index_reader_proxy(
+        ReaderProxyData& rdata)
+{
+    reader_proxies_.add(rdata.guid(), rdata.topicName().to_string(), &rdata);
+}
+
+void EDP::unindex_reader_proxy(
+        const GUID_t& reader_guid)
+{
+    reader_proxies_.remove(reader_guid);
+}
+
+void EDP::index_writer_proxy(
+        WriterProxyData& wdata)
+{
+    writer_proxies_.add(wdata.guid(), wdata.topicName().to_string(), &wdata);
+}
+
+void EDP::unindex_writer_proxy(
+        const GUID_t& writer_guid)
+{
+    writer_proxies_.remove(writer_guid);
+}
+
+void EDP::unindex_local_reader(
+        RTPSReader* reader)
+{
+    std::lock_guard<shared_mutex> _(local_endpoints_mutex_);
+    local_readers_.remove(reader->getGuid());
+}
+
+void EDP::unindex_local_writer(
+        RTPSWriter* writer)
+{
+    std::lock_guard<shared_mutex> _(local_endpoints_mutex_);
+    local_writers_.remove(writer->getGuid());
+}
+
 bool EDP::pairing_reader_proxy_with_any_local_writer(
         const GUID_t& participant_guid,
         ReaderProxyData* rdata)
@@ -1015,7 +1121,8 @@ bool EDP::pairing_reader_proxy_with_any_local_writer(
 
     EPROSIMA_LOG_INFO(RTPS_EDP, rdata->guid() << " in topic: \"" << rdata->topicName() << "\"");
 
-    mp_RTPSParticipant->forEachUserWriter([&, rdata](RTPSWriter& w) -> bool
+    // Only the writers on the same topic can match the reader
+    for_each_local_writer(rdata->topicName().to_string(), [&, rdata](RTPSWriter& w) -> bool
             {
                 auto temp_writer_proxy_data = get_temporary_writer_proxies_pool().get();
                 GUID_t writerGUID = w.getGuid();
@@ -1222,7 +1329,8 @@ bool EDP::pairing_writer_proxy_with_any_local_reader(
 
     EPROSIMA_LOG_INFO(RTPS_EDP, wdata->guid() << " in topic: \"" << wdata->topicName() << "\"");
 
-    mp_RTPSParticipant->forEachUserReader([&, wdata](RTPSReader& r) -> bool
+    // Only the readers on the same topic can match the writer
+    for_each_local_reader(wdata->topicName().to_string(), [&, wdata](RTPSReader& r) -> bool
             {
                 auto temp_reader_proxy_data = get_temporary_reader_proxies_pool().get();
                 GUID_t readerGUID = r.getGuid();
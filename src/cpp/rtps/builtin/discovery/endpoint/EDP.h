@@ -21,6 +21,11 @@
 #define _FASTDDS_RTPS_EDP_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
 
@@ -33,7 +38,9 @@
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
 #include <fastdds/rtps/common/Guid.h>
 
+#include <rtps/builtin/discovery/endpoint/EndpointTopicIndex.hpp>
 #include <utils/ProxyPool.hpp>
+#include <utils/shared_mutex.hpp>
 
 #define MATCH_FAILURE_REASON_COUNT size_t(16)
 
@@ -289,6 +296,54 @@ public:
             const GUID_t& participant_guid,
             const GUID_t& reader_guid);
 
+    /**
+     * Add a ReaderProxyData object to the index of known readers by topic.
+     * It should be called with the PDP mutex taken, once the proxy has been initialized.
+     * @param rdata Reference to the ReaderProxyData object. It should stay valid until it is removed from the index.
+     */
+    void index_reader_proxy(
+            ReaderProxyData& rdata);
+
+    /**
+     * Remove a ReaderProxyData object from the index of known readers by topic.
+     * It should be called with the PDP mutex taken, before the proxy is cleared or returned to the pool.
+     * @param reader_guid GUID of the reader.
+     */
+    void unindex_reader_proxy(
+            const GUID_t& reader_guid);
+
+    /**
+     * Add a WriterProxyData object to the index of known writers by topic.
+     * It should be called with the PDP mutex taken, once the proxy has been initialized.
+     * @param wdata Reference to the WriterProxyData object. It should stay valid until it is removed from the index.
+     */
+    void index_writer_proxy(
+            WriterProxyData& wdata);
+
+    /**
+     * Remove a WriterProxyData object from the index of known writers by topic.
+     * It should be called with the PDP mutex taken, before the proxy is cleared or returned to the pool.
+     * @param writer_guid GUID of the writer.
+     */
+    void unindex_writer_proxy(
+            const GUID_t& writer_guid);
+
+    /**
+     * Remove a local reader from the index of local readers by topic.
+     * It should be called before the reader is destroyed, without the PDP mutex taken.
+     * @param reader Pointer to the reader.
+     */
+    void unindex_local_reader(
+            RTPSReader* reader);
+
+    /**
+     * Remove a local writer from the index of local writers by topic.
+     * It should be called before the writer is destroyed, without the PDP mutex taken.
+     * @param writer Pointer to the writer.
+     */
+    void unindex_local_writer(
+            RTPSWriter* writer);
+
     /**
      * Try to pair/unpair ReaderProxyData.
      * @param participant_guid Identifier of the participant.
@@ -401,6 +456,67 @@ private:
             const WriterProxyData* wdata,
             const ReaderProxyData* rdata) const;
 
+    /**
+     * Check whether the partitions of a writer and a reader match, when both of them have partitions.
+     * The result is cached, as the same combinations of partitions are usually checked many times.
+     * @param wdata Pointer to the WriterProxyData object.
+     * @param rdata Pointer to the ReaderProxyData object.
+     * @return True if some partition of the writer matches some partition of the reader.
+     */
+    bool partitions_match(
+            const WriterProxyData* wdata,
+            const ReaderProxyData* rdata);
+
+    /**
+     * Apply a functor to the local writers on a topic.
+     * @param topic_name Name of the topic.
+     * @param f Functor applied to each writer. Should return true to keep iterating.
+     */
+    template<class Functor>
+    void for_each_local_writer(
+            const std::string& topic_name,
+            Functor f)
+    {
+        shared_lock<shared_mutex> _(local_endpoints_mutex_);
+
+        const auto* writers = local_writers_.find(topic_name);
+        if (nullptr != writers)
+        {
+            for (const auto& entry : *writers)
+            {
+                if (!f(*entry.second))
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * Apply a functor to the local readers on a topic.
+     * @param topic_name Name of the topic.
+     * @param f Functor applied to each reader. Should return true to keep iterating.
+     */
+    template<class Functor>
+    void for_each_local_reader(
+            const std::string& topic_name,
+            Functor f)
+    {
+        shared_lock<shared_mutex> _(local_endpoints_mutex_);
+
+        const auto* readers = local_readers_.find(topic_name);
+        if (nullptr != readers)
+        {
+            for (const auto& entry : *readers)
+            {
+                if (!f(*entry.second))
+                {
+                    break;
+                }
+            }
+        }
+    }
+
     using pool_allocator_t =
             foonathan::memory::memory_pool<foonathan::memory::node_pool, foonathan::memory::heap_allocator>;
 
@@ -409,6 +525,25 @@ private:
 
     foonathan::memory::map<GUID_t, fastdds::dds::SubscriptionMatchedStatus, pool_allocator_t> reader_status_;
     foonathan::memory::map<GUID_t, fastdds::dds::PublicationMatchedStatus, pool_allocator_t> writer_status_;
+
+    //! Protects the indexes of local endpoints.
+    shared_mutex local_endpoints_mutex_;
+    //! Local readers registered in the EDP, by topic.
+    EndpointTopicIndex<RTPSReader*> local_readers_;
+    //! Local writers registered in the EDP, by topic.
+    EndpointTopicIndex<RTPSWriter*> local_writers_;
+
+    //! Known reader proxies, both local and remote, by topic. Protected by the PDP mutex.
+    EndpointTopicIndex<ReaderProxyData*> reader_proxies_;
+    //! Known writer proxies, both local and remote, by topic. Protected by the PDP mutex.
+    EndpointTopicIndex<WriterProxyData*> writer_proxies_;
+
+    //! Protects the cache of partition matching results.
+    std::mutex partition_cache_mutex_;
+    //! Result of matching the partitions of a writer (first) with the partitions of a reader (second).
+    std::map<std::pair<std::string, std::string>, bool> partition_cache_;
+    //! Number of results after which the cache of partition matching results is cleared.
+    static constexpr size_t max_partition_cache_size_ = 1024;
 };
 
 } /* namespace rtps */
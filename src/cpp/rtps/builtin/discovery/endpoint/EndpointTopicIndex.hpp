@@ -0,0 +1,158 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EndpointTopicIndex.hpp
+ */
+
+#ifndef _RTPS_BUILTIN_DISCOVERY_ENDPOINT_ENDPOINTTOPICINDEX_HPP_
+#define _RTPS_BUILTIN_DISCOVERY_ENDPOINT_ENDPOINTTOPICINDEX_HPP_
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/common/Guid.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Index of endpoints by the name of their topic.
+ *
+ * Each endpoint is identified by its GUID and stores a value of type T, which is returned when looking for the
+ * endpoints of a topic.
+ * Pairing an endpoint then costs in proportion to the endpoints on its topic, instead of all the known endpoints.
+ * It is not thread safe, so the owner is responsible of protecting it.
+ */
+template<typename T>
+class EndpointTopicIndex
+{
+public:
+
+    using entry_type = std::pair<GUID_t, T>;
+
+    /**
+     * Add an endpoint to the index.
+     * When the endpoint was already in the index, its topic and value are updated.
+     *
+     * @param guid GUID of the endpoint.
+     * @param topic_name Name of the topic of the endpoint.
+     * @param value Value to store for the endpoint.
+     */
+    void add(
+            const GUID_t& guid,
+            const std::string& topic_name,
+            const T& value)
+    {
+        auto topic_it = topics_.find(guid);
+        if (topic_it != topics_.end())
+        {
+            if (topic_it->second == topic_name)
+            {
+                for (entry_type& entry : endpoints_[topic_name])
+                {
+                    if (entry.first == guid)
+                    {
+                        entry.second = value;
+                        break;
+                    }
+                }
+                return;
+            }
+
+            remove(guid);
+        }
+
+        topics_.emplace(guid, topic_name);
+        endpoints_[topic_name].emplace_back(guid, value);
+    }
+
+    /**
+     * Remove an endpoint from the index.
+     *
+     * @param guid GUID of the endpoint.
+     * @return true when the endpoint was in the index.
+     */
+    bool remove(
+            const GUID_t& guid)
+    {
+        auto topic_it = topics_.find(guid);
+        if (topic_it == topics_.end())
+        {
+            return false;
+        }
+
+        auto endpoints_it = endpoints_.find(topic_it->second);
+        if (endpoints_it != endpoints_.end())
+        {
+            std::vector<entry_type>& entries = endpoints_it->second;
+            for (auto it = entries.begin(); it != entries.end(); ++it)
+            {
+                if (it->first == guid)
+                {
+                    // Order is not relevant, so the last entry takes the place of the removed one.
+                    *it = entries.back();
+                    entries.pop_back();
+                    break;
+                }
+            }
+
+            if (entries.empty())
+            {
+                endpoints_.erase(endpoints_it);
+            }
+        }
+
+        topics_.erase(topic_it);
+        return true;
+    }
+
+    /**
+     * Get the endpoints of a topic.
+     *
+     * @param topic_name Name of the topic.
+     * @return Pointer to the entries of the topic, or nullptr when there are no endpoints on it.
+     * It is only valid until the index is modified.
+     */
+    const std::vector<entry_type>* find(
+            const std::string& topic_name) const
+    {
+        auto it = endpoints_.find(topic_name);
+        return it == endpoints_.end() ? nullptr : &it->second;
+    }
+
+    //! Number of endpoints in the index.
+    size_t size() const
+    {
+        return topics_.size();
+    }
+
+private:
+
+    //! Topic name of each endpoint in the index.
+    std::map<GUID_t, std::string> topics_;
+
+    //! Endpoints of each topic.
+    std::unordered_map<std::string, std::vector<entry_type>> endpoints_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // _RTPS_BUILTIN_DISCOVERY_ENDPOINT_ENDPOINTTOPICINDEX_HPP_
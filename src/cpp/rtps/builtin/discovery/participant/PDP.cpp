@@ -677,6 +677,7 @@ bool PDP::removeReaderProxyData(
             if (rit != pit->m_readers->end())
             {
                 ReaderProxyData* pR = rit->second;
+                mp_EDP->unindex_reader_proxy(reader_guid);
                 mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid);
 
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
@@ -721,6 +722,7 @@ bool PDP::removeWriterProxyData(
             if (wit != pit->m_writers->end())
             {
                 WriterProxyData* pW = wit->second;
+                mp_EDP->unindex_writer_proxy(writer_guid);
                 mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid, false);
 
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
@@ -815,6 +817,8 @@ ReaderProxyData* PDP::addReaderProxyData(
                     return nullptr;
                 }
 
+                mp_EDP->index_reader_proxy(*ret_val);
+
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
                 if (listener)
                 {
@@ -865,6 +869,8 @@ ReaderProxyData* PDP::addReaderProxyData(
                 return nullptr;
             }
 
+            mp_EDP->index_reader_proxy(*ret_val);
+
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
             if (listener)
             {
@@ -912,6 +918,8 @@ WriterProxyData* PDP::addWriterProxyData(
                     return nullptr;
                 }
 
+                mp_EDP->index_writer_proxy(*ret_val);
+
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
                 if (listener)
                 {
@@ -961,6 +969,8 @@ WriterProxyData* PDP::addWriterProxyData(
                 return nullptr;
             }
 
+            mp_EDP->index_writer_proxy(*ret_val);
+
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
             if (listener)
             {
@@ -1139,6 +1149,19 @@ bool PDP::remove_remote_participant(
         {
             pdata = *pit;
             participant_proxies_.erase(pit);
+
+            // Its endpoints cannot be matched from now on
+            if (mp_EDP != nullptr)
+            {
+                for (auto& reader : *pdata->m_readers)
+                {
+                    mp_EDP->unindex_reader_proxy(GUID_t(pdata->m_guid.guidPrefix, reader.first));
+                }
+                for (auto& writer : *pdata->m_writers)
+                {
+                    mp_EDP->unindex_writer_proxy(GUID_t(pdata->m_guid.guidPrefix, writer.first));
+                }
+            }
             break;
         }
     }
@@ -596,6 +596,15 @@ protected:
             ParticipantProxyData* pdata,
             bool& should_be_ignored);
 
+    /**
+     * Check whether the initial announcements of the local participant are still being sent.
+     * @return true while there are initial announcements pending.
+     */
+    bool initial_announcements_pending() const
+    {
+        return initial_announcements_.count > 0;
+    }
+
 #ifdef FASTDDS_STATISTICS
 
     std::atomic<const fastdds::statistics::rtps::IProxyObserver*> proxy_observer_;
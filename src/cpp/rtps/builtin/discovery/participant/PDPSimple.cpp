@@ -18,26 +18,35 @@
  */
 #include <rtps/builtin/discovery/participant/PDPSimple.h>
 
+#include <algorithm>
 #include <mutex>
 
+#include <fastdds/dds/core/policy/ParameterTypes.hpp>
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/builtin/data/NetworkConfiguration.hpp>
 #include <fastdds/rtps/builtin/data/ParticipantProxyData.h>
 #include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
 #include <fastdds/rtps/participant/RTPSParticipantListener.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/reader/StatelessReader.h>
 #include <fastdds/rtps/resources/TimedEvent.h>
+#include <fastdds/rtps/writer/LocatorSelectorSender.hpp>
 #include <fastdds/rtps/writer/StatelessWriter.h>
 
 #include <fastdds/builtin/type_lookup_service/TypeLookupManager.hpp>
+#include <fastdds/core/policy/ParameterList.hpp>
+#include <fastdds/core/policy/ParameterSerializer.hpp>
 #include <fastdds/utils/IPLocator.h>
 #include <rtps/builtin/BuiltinProtocols.h>
 #include <rtps/builtin/discovery/endpoint/EDPSimple.h>
 #include <rtps/builtin/discovery/endpoint/EDPStatic.h>
+#include <rtps/builtin/discovery/participant/DirectMessageSender.hpp>
+#include <rtps/builtin/discovery/participant/DS/FakeWriter.hpp>
 #include <rtps/builtin/discovery/participant/DS/PDPSecurityInitiatorListener.hpp>
 #include <rtps/builtin/discovery/participant/PDPListener.h>
 #include <rtps/builtin/discovery/participant/simple/SimplePDPEndpoints.hpp>
@@ -104,6 +113,9 @@ void PDPSimple::initializeParticipantProxyData(
 {
     PDP::initializeParticipantProxyData(participant_data);
 
+    // Processing compact announcements and requests of full DATA(p) does not depend on sending them
+    participant_data->compact_announcements(true);
+
     if (getRTPSParticipant()->getAttributes().builtin.discovery_config.
                     use_SIMPLE_EndpointDiscoveryProtocol)
     {
@@ -153,6 +165,17 @@ bool PDPSimple::init(
         return false;
     }
 
+    const std::string* compact = PropertyPolicyHelper::find_property(
+        part->getAttributes().properties, "fastdds.compact_participant_announcements");
+    compact_announcements_ = (nullptr != compact) && ("true" == *compact);
+#if HAVE_SECURITY
+    if (compact_announcements_ && part->is_secure())
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PDP, "Compact participant announcements are not supported on secure participants");
+        compact_announcements_ = false;
+    }
+#endif // HAVE_SECURITY
+
     //INIT EDP
     if (m_discovery.discovery_config.use_STATIC_EndpointDiscoveryProtocol)
     {
@@ -284,9 +307,231 @@ void PDPSimple::announceParticipantState(
 
         if (!(dispose || new_change))
         {
-            endpoints->writer.writer_->unsent_changes_reset();
+            if (compact_announcements_ && !initial_announcements_pending() &&
+                    !full_announcement_requested_.exchange(false) && compact_announcements_understood())
+            {
+                send_unsequenced_data(fastdds::dds::PID_COMPACT_PARTICIPANT_ANNOUNCEMENT,
+                        mp_RTPSParticipant->getGuid(), nullptr);
+            }
+            else
+            {
+                endpoints->writer.writer_->unsent_changes_reset();
+            }
+        }
+    }
+}
+
+bool PDPSimple::compact_announcements_understood()
+{
+    std::lock_guard<std::recursive_mutex> guard(*getMutex());
+    const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
+    return std::all_of(participant_proxies_.begin(), participant_proxies_.end(),
+                   [&local_prefix](const ParticipantProxyData* pdata)
+                   {
+                       return local_prefix == pdata->m_guid.guidPrefix || pdata->compact_announcements();
+                   });
+}
+
+void PDPSimple::send_unsequenced_data(
+        fastdds::dds::ParameterId_t pid,
+        const GUID_t& guid,
+        LocatorList_t* locators)
+{
+    auto endpoints = dynamic_cast<fastdds::rtps::SimplePDPEndpoints*>(builtin_endpoints_.get());
+    StatelessWriter& writer = *(endpoints->writer.writer_);
+    WriterHistory& history = *(endpoints->writer.history_);
+
+    if (nullptr != locators)
+    {
+        std::vector<GUID_t> remote_readers;
+        remote_readers.emplace_back(guid.guidPrefix, c_EntityId_SPDPReader);
+        DirectMessageSender sender(mp_RTPSParticipant, &remote_readers, locators);
+
+        std::lock_guard<RecursiveTimedMutex> guard(writer.getMutex());
+        send_unsequenced_data(writer, history, pid, guid, sender);
+        return;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> guard(writer.getMutex());
+
+    LocatorSelectorSender& locator_selector = writer.get_general_locator_selector();
+    std::lock_guard<LocatorSelectorSender> locator_selector_guard(locator_selector);
+    locator_selector.locator_selector.reset(true);
+    if (locator_selector.locator_selector.state_has_changed())
+    {
+        mp_RTPSParticipant->network_factory().select_locators(locator_selector.locator_selector);
+    }
+
+    send_unsequenced_data(writer, history, pid, guid, locator_selector);
+}
+
+void PDPSimple::send_unsequenced_data(
+        StatelessWriter& writer,
+        WriterHistory& history,
+        fastdds::dds::ParameterId_t pid,
+        const GUID_t& guid,
+        RTPSMessageSenderInterface& sender)
+{
+    // The parameter identifying the message, and PID_SENTINEL
+    uint32_t cdr_size = 4 + (4 + PARAMETER_GUID_LENGTH) + 4;
+
+    ParameterSampleIdentity_t announced(fastdds::dds::PID_RELATED_SAMPLE_IDENTITY, PARAMETER_SAMPLEIDENTITY_LENGTH);
+    if (fastdds::dds::PID_COMPACT_PARTICIPANT_ANNOUNCEMENT == pid)
+    {
+        CacheChange_t* last_change = nullptr;
+        if (!history.get_max_change(&last_change))
+        {
+            return;
+        }
+
+        // The identity of the announced DATA(p)
+        announced.sample_id.writer_guid(writer.getGuid());
+        announced.sample_id.sequence_number(last_change->sequenceNumber);
+        cdr_size += 4 + PARAMETER_SAMPLEIDENTITY_LENGTH;
+    }
+
+    // Sent from a writer entity which is never matched and has its own sequence numbers. Readers unable to process
+    // them reject them as coming from an unknown writer, without recording any sequence number of the PDP writer.
+    fastdds::rtps::FakeWriter unsequenced_writer(mp_RTPSParticipant, c_EntityId_SPDPUnsequencedWriter);
+
+    CacheChange_t change;
+    change.kind = ALIVE;
+    change.writerGUID = unsequenced_writer.getGuid();
+    change.sequenceNumber = ++unsequenced_sequence_number_;
+    change.serializedPayload.reserve(cdr_size);
+
+    CDRMessage_t aux_msg(change.serializedPayload);
+#if __BIG_ENDIAN__
+    change.serializedPayload.encapsulation = (uint16_t)PL_CDR_BE;
+    aux_msg.msg_endian = BIGEND;
+#else
+    change.serializedPayload.encapsulation = (uint16_t)PL_CDR_LE;
+    aux_msg.msg_endian =  LITTLEEND;
+#endif // if __BIG_ENDIAN__
+
+    ParameterGuid_t p(pid, PARAMETER_GUID_LENGTH, guid);
+    if (!fastdds::dds::ParameterList::writeEncapsulationToCDRMsg(&aux_msg) ||
+            !fastdds::dds::ParameterSerializer<ParameterGuid_t>::add_to_cdr_message(p, &aux_msg) ||
+            (fastdds::dds::PID_COMPACT_PARTICIPANT_ANNOUNCEMENT == pid &&
+            !fastdds::dds::ParameterSerializer<ParameterSampleIdentity_t>::add_to_cdr_message(announced, &aux_msg)) ||
+            !fastdds::dds::ParameterSerializer<Parameter_t>::add_parameter_sentinel(&aux_msg))
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PDP, "Cannot serialize unsequenced DATA(p).");
+        return;
+    }
+    change.serializedPayload.length = aux_msg.length;
+
+    try
+    {
+        RTPSMessageGroup group(mp_RTPSParticipant, &unsequenced_writer, &sender);
+        if (!group.add_data(change, false))
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PDP, "Error sending unsequenced DATA(p).");
+        }
+    }
+    catch (const RTPSMessageGroup::timeout&)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PDP, "Max blocking time reached");
+    }
+}
+
+bool PDPSimple::process_unsequenced_data(
+        CacheChange_t& change)
+{
+    // Custom PIDs are only understood when coming from Fast DDS, and the sequenced DATA(p) are never parsed here
+    if ((c_VendorId_eProsima != change.vendor_id && c_VendorId_Unknown != change.vendor_id) ||
+            c_EntityId_SPDPUnsequencedWriter != change.writerGUID.entityId)
+    {
+        return false;
+    }
+
+    fastdds::dds::ParameterId_t kind = fastdds::dds::PID_SENTINEL;
+    GUID_t guid;
+    SampleIdentity announced = SampleIdentity::unknown();
+    auto param_process = [&kind, &guid, &announced](CDRMessage_t* msg, const ParameterId_t& pid, uint16_t plength)
+            {
+                if (fastdds::dds::PID_SENTINEL == kind)
+                {
+                    if (fastdds::dds::PID_COMPACT_PARTICIPANT_ANNOUNCEMENT != pid &&
+                            fastdds::dds::PID_PARTICIPANT_DATA_REQUEST != pid)
+                    {
+                        return false;
+                    }
+
+                    kind = pid;
+                    ParameterGuid_t p(pid, plength);
+                    if (!fastdds::dds::ParameterSerializer<ParameterGuid_t>::read_from_cdr_message(p, msg, plength))
+                    {
+                        return false;
+                    }
+                    guid = p.guid;
+                }
+                else if (fastdds::dds::PID_RELATED_SAMPLE_IDENTITY == pid)
+                {
+                    ParameterSampleIdentity_t p(pid, plength);
+                    if (!fastdds::dds::ParameterSerializer<ParameterSampleIdentity_t>::read_from_cdr_message(p, msg,
+                            plength))
+                    {
+                        return false;
+                    }
+                    announced = p.sample_id;
+                }
+                return true;
+            };
+
+    CDRMessage_t msg(change.serializedPayload);
+    uint32_t qos_size = 0;
+    bool valid = fastdds::dds::ParameterList::readParameterListfromCDRMsg(msg, param_process, true, qos_size);
+
+    const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
+    if (!valid || local_prefix == change.writerGUID.guidPrefix)
+    {
+        return true;
+    }
+
+    if (fastdds::dds::PID_PARTICIPANT_DATA_REQUEST == kind)
+    {
+        if (local_prefix == guid.guidPrefix)
+        {
+            // Requests received during an announcement period are answered by its next announcement
+            full_announcement_requested_ = true;
+        }
+        return true;
+    }
+
+    if (change.writerGUID.guidPrefix != guid.guidPrefix ||
+            mp_RTPSParticipant->is_participant_ignored(guid.guidPrefix))
+    {
+        return true;
+    }
+
+    LocatorList_t locators;
+    bool is_known = false;
+    {
+        std::lock_guard<std::recursive_mutex> guard(*getMutex());
+        ParticipantProxyData* pdata = get_participant_proxy_data(guid.guidPrefix);
+        if (nullptr != pdata)
+        {
+            if (pdata->m_sample_identity == announced)
+            {
+                // Data is up to date. Liveliness has already been asserted on message reception.
+                return true;
+            }
+
+            is_known = true;
+            const auto& pdata_locators = pdata->metatraffic_locators.unicast.empty() ?
+                    pdata->metatraffic_locators.multicast : pdata->metatraffic_locators.unicast;
+            for (const Locator_t& locator : pdata_locators)
+            {
+                locators.push_back(locator);
+            }
         }
     }
+
+    // Requests to unknown participants go to every destination of the PDP writer
+    EPROSIMA_LOG_INFO(RTPS_PDP, "Requesting full DATA(p) from participant " << guid);
+    send_unsequenced_data(fastdds::dds::PID_PARTICIPANT_DATA_REQUEST, guid, is_known ? &locators : nullptr);
+    return true;
 }
 
 bool PDPSimple::createPDPEndpoints()
@@ -356,6 +601,12 @@ bool PDPSimple::create_dcps_participant_endpoints()
         reader.reader_ = dynamic_cast<StatelessReader*>(rtps_reader);
         assert(nullptr != reader.reader_);
 
+        // Compact announcements and requests of full DATA(p) do not follow the sequence of DATA(p) of the writer
+        reader.reader_->set_unsequenced_sample_processor([this](CacheChange_t& change)
+                {
+                    return process_unsequenced_data(change);
+                });
+
 #if HAVE_SECURITY
         mp_RTPSParticipant->set_endpoint_rtps_protection_supports(rtps_reader, false);
 #endif // if HAVE_SECURITY
@@ -21,14 +21,20 @@
 #define _FASTDDS_RTPS_BUILTIN_DISCOVERY_PARTICIPANT_PDPSIMPLE_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <atomic>
+
+#include <fastdds/dds/core/policy/ParameterTypes.hpp>
+
 #include <rtps/builtin/discovery/participant/PDP.h>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class RTPSMessageSenderInterface;
 class StatelessWriter;
 class StatelessReader;
+class WriterHistory;
 
 /**
  * Class PDPSimple that implements the SimpleRTPSParticipantDiscoveryProtocol as defined in the RTPS specification.
@@ -149,6 +155,55 @@ private:
             const ParticipantProxyData& pdata,
             bool notify_secure_endpoints);
 
+    /**
+     * Check whether all the known remote participants understand compact announcements.
+     * Participants which have not been discovered yet are not checked: they drop the compact announcements, as they
+     * come from a writer they do not trust, and once their own DATA(p) is received the announcements are full again.
+     * @return true when all of them advertised it on their DATA(p).
+     */
+    bool compact_announcements_understood();
+
+    /**
+     * Send a DATA(p) which is not part of the sequence of DATA(p) of the PDP writer: a compact announcement of the
+     * local participant, or a request of the full DATA(p) of a remote participant.
+     * @param pid PID_COMPACT_PARTICIPANT_ANNOUNCEMENT or PID_PARTICIPANT_DATA_REQUEST.
+     * @param guid GUID of the announced or the requested participant.
+     * @param locators Metatraffic locators of the requested participant, or nullptr to send the message to the
+     * destinations of the PDP writer.
+     */
+    void send_unsequenced_data(
+            fastdds::dds::ParameterId_t pid,
+            const GUID_t& guid,
+            LocatorList_t* locators);
+
+    /**
+     * Send a DATA(p) which is not part of the sequence of DATA(p) of the PDP writer.
+     * It is sent from the unsequenced writer entity, with a sequence number of its own. Its payload is a parameter
+     * carrying a GUID, followed on compact announcements by the sample identity of the last DATA(p) in the history
+     * of the PDP writer.
+     * @param writer PDP writer, with its mutex taken.
+     * @param history History of the PDP writer.
+     * @param pid PID_COMPACT_PARTICIPANT_ANNOUNCEMENT or PID_PARTICIPANT_DATA_REQUEST.
+     * @param guid GUID of the announced or the requested participant.
+     * @param sender Destinations of the message.
+     */
+    void send_unsequenced_data(
+            StatelessWriter& writer,
+            WriterHistory& history,
+            fastdds::dds::ParameterId_t pid,
+            const GUID_t& guid,
+            RTPSMessageSenderInterface& sender);
+
+    /**
+     * Process a DATA(p) received by the PDP reader before its sequence number is checked.
+     * When it is a compact announcement of a participant whose data is unknown or outdated, its full DATA(p) is
+     * requested right away, instead of waiting for the next announcement of the local participant.
+     * @param change Change received by the PDP reader.
+     * @return true if the change is a compact announcement or a request of full DATA(p).
+     */
+    bool process_unsequenced_data(
+            CacheChange_t& change);
+
 #if HAVE_SECURITY
     bool create_dcps_participant_secure_endpoints();
 
@@ -161,6 +216,15 @@ private:
             const ReaderProxyData& remote_reader_data) override;
 #endif // HAVE_SECURITY
 
+    //! Whether periodic announcements which do not change the participant data are sent in compact form.
+    bool compact_announcements_ = false;
+
+    //! Whether a remote participant requested the full DATA(p) of the local participant.
+    std::atomic<bool> full_announcement_requested_{false};
+
+    //! Last sequence number sent from the unsequenced writer entity. Protected by the mutex of the PDP writer.
+    SequenceNumber_t unsequenced_sequence_number_;
+
 };
 
 } /* namespace rtps */
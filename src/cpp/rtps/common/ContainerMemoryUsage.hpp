@@ -0,0 +1,68 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file ContainerMemoryUsage.hpp
+ */
+
+#ifndef RTPS_COMMON_CONTAINERMEMORYUSAGE_HPP
+#define RTPS_COMMON_CONTAINERMEMORYUSAGE_HPP
+
+#include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Get the memory held by the elements of a vector-like collection.
+ *
+ * @param [in] collection  The collection to account.
+ *
+ * @return Memory used by the elements in the collection, and by the capacity it keeps allocated.
+ */
+template<typename CollectionType>
+fastdds::rtps::MemoryUsage get_container_memory_usage(
+        const CollectionType& collection)
+{
+    fastdds::rtps::MemoryUsage usage;
+    usage.live_bytes = collection.size() * sizeof(typename CollectionType::value_type);
+    usage.reserved_bytes = collection.capacity() * sizeof(typename CollectionType::value_type);
+    return usage;
+}
+
+/**
+ * Get the memory held by the locator lists of a LocatorSelectorEntry.
+ *
+ * @param [in] entry  The entry to account.
+ *
+ * @return Memory used by the locators of the entry and their selection state.
+ */
+inline fastdds::rtps::MemoryUsage get_locator_selector_entry_memory_usage(
+        const LocatorSelectorEntry& entry)
+{
+    fastdds::rtps::MemoryUsage usage = get_container_memory_usage(entry.unicast);
+    usage += get_container_memory_usage(entry.multicast);
+    usage += get_container_memory_usage(entry.state.unicast);
+    usage += get_container_memory_usage(entry.state.multicast);
+    return usage;
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_COMMON_CONTAINERMEMORYUSAGE_HPP
@@ -0,0 +1,271 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SampleBatch.hpp
+ */
+
+#ifndef RTPS_COMMON_SAMPLEBATCH_HPP_
+#define RTPS_COMMON_SAMPLEBATCH_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastdds/rtps/common/Time_t.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace detail {
+
+/*!
+ * Layout of a serialized payload carrying several samples of the same writer.
+ *
+ * A batch starts with a 4 bytes header whose encapsulation identifier is out of the range assigned by the
+ * specification, followed by the number of samples it contains. Each sample is then stored as its length, the
+ * instance handle, the source timestamp and the serialized sample, padded to a multiple of 4 bytes.
+ * All integers are little endian.
+ *
+ * A batch with N samples is sent on a single change with sequence number S, and covers the sequence numbers
+ * from S to S + N - 1.
+ *
+ * Writers sending batches and readers able to unbatch them announce it with PID_SAMPLE_BATCH. Batches are only
+ * sent to readers which announced it, and only payloads from writers which announced it are decoded as batches.
+ * A user sample starting like a batch is always sent inside one.
+ */
+struct SampleBatch
+{
+    //! Encapsulation identifier of a batch payload.
+    static constexpr octet encapsulation_id_high = 0x80;
+    static constexpr octet encapsulation_id_low = 0x01;
+
+    //! Encapsulation header plus number of samples.
+    static constexpr uint32_t header_size = 8;
+
+    //! Length, instance handle and source timestamp.
+    static constexpr uint32_t entry_header_size = 4 + 16 + 8;
+
+    //! Space used by a sample of the given size, including the entry header and the padding.
+    static uint32_t entry_size(
+            uint32_t sample_length)
+    {
+        return entry_header_size + ((sample_length + 3u) & ~3u);
+    }
+
+    static bool is_batch(
+            const SerializedPayload_t& payload)
+    {
+        return payload.data != nullptr && header_size <= payload.length &&
+               encapsulation_id_high == payload.data[0] && encapsulation_id_low == payload.data[1];
+    }
+
+    //! Number of samples in a batch payload.
+    static uint32_t sample_count(
+            const SerializedPayload_t& payload)
+    {
+        return is_batch(payload) ? read_uint32(&payload.data[4]) : 0;
+    }
+
+    //! Number of sequence numbers covered by a change.
+    static uint32_t sequence_number_span(
+            const CacheChange_t& change)
+    {
+        uint32_t count = sample_count(change.serializedPayload);
+        return 0 < count ? count : 1;
+    }
+
+    static void write_uint32(
+            octet* dst,
+            uint32_t value)
+    {
+        dst[0] = static_cast<octet>(value);
+        dst[1] = static_cast<octet>(value >> 8);
+        dst[2] = static_cast<octet>(value >> 16);
+        dst[3] = static_cast<octet>(value >> 24);
+    }
+
+    static uint32_t read_uint32(
+            const octet* src)
+    {
+        return static_cast<uint32_t>(src[0]) | (static_cast<uint32_t>(src[1]) << 8) |
+               (static_cast<uint32_t>(src[2]) << 16) | (static_cast<uint32_t>(src[3]) << 24);
+    }
+
+};
+
+/*!
+ * Accumulates serialized samples into a batch.
+ */
+class SampleBatchBuilder
+{
+public:
+
+    SampleBatchBuilder()
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        buffer_.assign(SampleBatch::header_size, 0);
+        buffer_[0] = SampleBatch::encapsulation_id_high;
+        buffer_[1] = SampleBatch::encapsulation_id_low;
+        count_ = 0;
+    }
+
+    bool empty() const
+    {
+        return 0 == count_;
+    }
+
+    uint32_t count() const
+    {
+        return count_;
+    }
+
+    //! Current size of the batch payload.
+    uint32_t size() const
+    {
+        return static_cast<uint32_t>(buffer_.size());
+    }
+
+    //! Size the batch payload would have after adding a sample of the given size.
+    uint32_t size_with(
+            uint32_t sample_length) const
+    {
+        return size() + SampleBatch::entry_size(sample_length);
+    }
+
+    void add(
+            const SerializedPayload_t& sample,
+            const InstanceHandle_t& handle,
+            const Time_t& source_timestamp)
+    {
+        size_t pos = buffer_.size();
+        buffer_.resize(pos + SampleBatch::entry_size(sample.length), 0);
+        octet* dst = &buffer_[pos];
+
+        SampleBatch::write_uint32(dst, sample.length);
+        if (handle.isDefined())
+        {
+            const octet* key = handle.value;
+            memcpy(&dst[4], key, 16);
+        }
+        SampleBatch::write_uint32(&dst[20], static_cast<uint32_t>(source_timestamp.seconds()));
+        SampleBatch::write_uint32(&dst[24], source_timestamp.fraction());
+        if (0 < sample.length)
+        {
+            memcpy(&dst[SampleBatch::entry_header_size], sample.data, sample.length);
+        }
+
+        ++count_;
+        SampleBatch::write_uint32(&buffer_[4], count_);
+    }
+
+    //! Copies the batch into a payload with enough space.
+    void copy_to(
+            SerializedPayload_t& payload) const
+    {
+        memcpy(payload.data, buffer_.data(), buffer_.size());
+        payload.length = size();
+        payload.encapsulation = CDR_LE;
+        payload.pos = 0;
+    }
+
+private:
+
+    std::vector<octet> buffer_;
+
+    uint32_t count_ = 0;
+};
+
+/*!
+ * Iterates the samples of a batch, giving a non-owning view of each of them.
+ */
+class SampleBatchReader
+{
+public:
+
+    explicit SampleBatchReader(
+            const SerializedPayload_t& batch)
+        : batch_(batch)
+        , remaining_(SampleBatch::sample_count(batch))
+        , pos_(SampleBatch::header_size)
+    {
+    }
+
+    /*!
+     * Fills the next sample.
+     * @param [out] sample Payload pointing to the data inside the batch. The caller should reset its data pointer
+     * before destroying it.
+     * @param [out] handle Instance handle of the sample. Unchanged if the sample has no key.
+     * @param [out] source_timestamp Source timestamp of the sample.
+     * @return false when there are no more samples or the batch is malformed.
+     */
+    bool next(
+            SerializedPayload_t& sample,
+            InstanceHandle_t& handle,
+            Time_t& source_timestamp)
+    {
+        if (0 == remaining_ || batch_.length < pos_ + SampleBatch::entry_header_size)
+        {
+            return false;
+        }
+
+        const octet* src = &batch_.data[pos_];
+        uint32_t length = SampleBatch::read_uint32(src);
+        if (batch_.length - pos_ - SampleBatch::entry_header_size < length)
+        {
+            return false;
+        }
+
+        static const octet no_key[16] = {};
+        if (0 != memcmp(&src[4], no_key, 16))
+        {
+            octet* key = handle.value;
+            memcpy(key, &src[4], 16);
+        }
+        source_timestamp.seconds(static_cast<int32_t>(SampleBatch::read_uint32(&src[20])));
+        source_timestamp.fraction(SampleBatch::read_uint32(&src[24]));
+
+        sample.data = const_cast<octet*>(&src[SampleBatch::entry_header_size]);
+        sample.length = length;
+        sample.max_size = length;
+        sample.pos = 0;
+        sample.encapsulation = 2 <= length && 0 != (sample.data[1] & 0x01) ? CDR_LE : CDR_BE;
+
+        pos_ += SampleBatch::entry_size(length);
+        --remaining_;
+        return true;
+    }
+
+private:
+
+    const SerializedPayload_t& batch_;
+
+    uint32_t remaining_ = 0;
+
+    uint32_t pos_ = 0;
+};
+
+} // namespace detail
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // RTPS_COMMON_SAMPLEBATCH_HPP_
@@ -0,0 +1,239 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _RTPS_FLOWCONTROL_AIMDCONGESTIONCONTROL_HPP_
+#define _RTPS_FLOWCONTROL_AIMDCONGESTIONCONTROL_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/flowcontrol/FlowControllerCongestionControl.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Per-destination sending windows adjusted with additive increase and multiplicative decrease.
+ *
+ * Each window limits the bytes sent to a destination on every period. Windows are refilled lazily when a new period
+ * starts. Multiplicative decrease is applied at most once per period, as several ACKNACKs usually report the same
+ * loss event. Additive increase is only applied while the window is actually being used, so ACKNACKs answering the
+ * heartbeats of an idle writer do not inflate it.
+ */
+class AIMDCongestionControl
+{
+public:
+
+    AIMDCongestionControl(
+            const FlowControllerCongestionControl& config,
+            uint64_t period_ms)
+        : config_(config)
+        , period_(std::chrono::milliseconds(0 < period_ms ? period_ms : 1))
+        , period_start_(std::chrono::steady_clock::now())
+    {
+        if (config_.enabled)
+        {
+            config_.min_window = (std::max)(config_.min_window, 1u);
+            if (0 != config_.max_window)
+            {
+                config_.min_window = (std::min)(config_.min_window, config_.max_window);
+            }
+            config_.initial_window = bound(config_.initial_window);
+            if (!(0.0 < config_.multiplicative_decrease && 1.0 > config_.multiplicative_decrease))
+            {
+                config_.multiplicative_decrease = 0.5;
+            }
+        }
+    }
+
+    bool enabled() const
+    {
+        return config_.enabled;
+    }
+
+    /*!
+     * Charges bytes to the window of a destination in the current period.
+     *
+     * A destination which has not used any byte in the current period is always allowed, so samples bigger than
+     * the window still progress.
+     *
+     * @param destination GUID of the remote reader.
+     * @param bytes Number of bytes about to be sent.
+     * @return true if the bytes can be sent. false if the window of the destination is exhausted.
+     */
+    bool try_reserve(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        refresh_period_nts();
+        DestinationWindow& dst = find_or_create_nts(destination);
+
+        if (0 != dst.used && static_cast<uint64_t>(dst.used) + bytes > dst.window)
+        {
+            return false;
+        }
+
+        dst.used += bytes;
+        return true;
+    }
+
+    /*!
+     * Gives back bytes charged with try_reserve() which were not finally sent.
+     *
+     * @param destination GUID of the remote reader.
+     * @param bytes Number of bytes to give back.
+     */
+    void refund(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        refresh_period_nts();
+        auto it = windows_.find(destination);
+        if (windows_.end() != it)
+        {
+            it->second.used -= (std::min)(it->second.used, bytes);
+        }
+    }
+
+    /*!
+     * Adjusts the window of a destination with the feedback of an ACKNACK.
+     *
+     * @param destination GUID of the remote reader.
+     * @param lost_samples Number of samples requested again by the ACKNACK.
+     */
+    void on_feedback(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t lost_samples)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        refresh_period_nts();
+        DestinationWindow& dst = find_or_create_nts(destination);
+
+        if (0 < lost_samples)
+        {
+            if (!dst.decreased)
+            {
+                dst.window = bound(static_cast<uint32_t>(dst.window * config_.multiplicative_decrease));
+                dst.decreased = true;
+            }
+        }
+        else if (is_window_used(dst))
+        {
+            // Saturate instead of wrapping around when there is no maximum window.
+            uint64_t window = static_cast<uint64_t>(dst.window) + config_.additive_increase;
+            dst.window = bound(static_cast<uint32_t>((std::min)(window,
+                    static_cast<uint64_t>((std::numeric_limits<uint32_t>::max)()))));
+        }
+    }
+
+    void remove(
+            const fastrtps::rtps::GUID_t& destination)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        windows_.erase(destination);
+    }
+
+    //! Returns the current window of a destination, in bytes per period.
+    uint32_t window(
+            const fastrtps::rtps::GUID_t& destination) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = windows_.find(destination);
+        return windows_.end() != it ? it->second.window : config_.initial_window;
+    }
+
+    //! Returns the time point when the windows will be refilled.
+    std::chrono::steady_clock::time_point next_period() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return period_start_ + period_;
+    }
+
+private:
+
+    struct DestinationWindow
+    {
+        uint32_t window = 0;
+        uint32_t used = 0;
+        //! Bytes used in the previous period.
+        uint32_t last_used = 0;
+        bool decreased = false;
+    };
+
+    //! A window is considered in use when at least half of it was consumed in the current or the previous period.
+    static bool is_window_used(
+            const DestinationWindow& dst)
+    {
+        return (std::max)(dst.used, dst.last_used) >= dst.window / 2;
+    }
+
+    uint32_t bound(
+            uint32_t window) const
+    {
+        window = (std::max)(window, config_.min_window);
+        return 0 != config_.max_window ? (std::min)(window, config_.max_window) : window;
+    }
+
+    void refresh_period_nts()
+    {
+        auto now = std::chrono::steady_clock::now();
+
+        if (now - period_start_ >= period_)
+        {
+            bool consecutive = now - period_start_ < 2 * period_;
+            period_start_ = now;
+            for (auto& dst : windows_)
+            {
+                dst.second.last_used = consecutive ? dst.second.used : 0;
+                dst.second.used = 0;
+                dst.second.decreased = false;
+            }
+        }
+    }
+
+    DestinationWindow& find_or_create_nts(
+            const fastrtps::rtps::GUID_t& destination)
+    {
+        auto ret = windows_.emplace(destination, DestinationWindow());
+        if (ret.second)
+        {
+            ret.first->second.window = config_.initial_window;
+        }
+        return ret.first->second;
+    }
+
+    FlowControllerCongestionControl config_;
+
+    std::chrono::steady_clock::duration period_;
+
+    std::chrono::steady_clock::time_point period_start_;
+
+    std::map<fastrtps::rtps::GUID_t, DestinationWindow> windows_;
+
+    mutable std::mutex mutex_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _RTPS_FLOWCONTROL_AIMDCONGESTIONCONTROL_HPP_
@@ -2,6 +2,10 @@
 #define _RTPS_FLOWCONTROL_FLOWCONTROLLER_HPP_
 
 #include <chrono>
+#include <cstdint>
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/flowcontrol/FlowControllerStatistics.hpp>
 
 namespace eprosima {
 
@@ -95,6 +99,150 @@ public:
      * @return Maximum number of bytes of a RTPS message.
      */
     virtual uint32_t get_max_payload() = 0;
+
+    /*!
+     * Opens a batch of new samples of a writer.
+     * While the batch is open, the samples delivered synchronously by add_new_sample() are packed into the same
+     * RTPS messages, which are sent by end_batch().
+     * Flow controllers without synchronous delivery ignore the batch.
+     *
+     * @param writer Pointer to the writer adding the samples. Cannot be nullptr.
+     * @param max_blocking_time Maximum time the batch has to complete the task.
+     * @pre The writer's mutex must be kept locked until end_batch() is called.
+     */
+    virtual void begin_batch(
+            fastrtps::rtps::RTPSWriter* writer,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+    {
+        static_cast<void>(writer);
+        static_cast<void>(max_blocking_time);
+    }
+
+    /*!
+     * Closes the batch opened with begin_batch(), sending the pending RTPS messages.
+     *
+     * @param writer Pointer to the writer which opened the batch. Cannot be nullptr.
+     */
+    virtual void end_batch(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        static_cast<void>(writer);
+    }
+
+    /*!
+     * Charges bytes to the congestion window of a remote reader.
+     * Flow controllers without congestion control always accept the bytes.
+     *
+     * @param destination GUID of the remote reader the bytes are going to be sent to.
+     * @param bytes Number of bytes about to be sent.
+     * @return true if the bytes can be sent now. false if they have to be deferred to a later period.
+     */
+    virtual bool try_reserve_destination_bytes(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t bytes)
+    {
+        static_cast<void>(destination);
+        static_cast<void>(bytes);
+        return true;
+    }
+
+    /*!
+     * Takes bytes from the rate limit of a remote participant.
+     * Flow controllers without destination rate limit always accept the bytes.
+     *
+     * @param writer Pointer to the writer sending the bytes. Cannot be nullptr.
+     * @param destination Prefix of the GUID of the remote participant the bytes are going to be sent to.
+     * @param bytes Number of bytes about to be sent.
+     * @return true if the bytes can be sent now. false if they have to be deferred.
+     */
+    virtual bool try_reserve_participant_bytes(
+            fastrtps::rtps::RTPSWriter* writer,
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            uint32_t bytes)
+    {
+        static_cast<void>(writer);
+        static_cast<void>(destination);
+        static_cast<void>(bytes);
+        return true;
+    }
+
+    /*!
+     * Gives back bytes charged with try_reserve_destination_bytes() which were not finally sent.
+     *
+     * @param destination GUID of the remote reader the bytes were charged to.
+     * @param bytes Number of bytes to give back.
+     */
+    virtual void refund_destination_bytes(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t bytes)
+    {
+        static_cast<void>(destination);
+        static_cast<void>(bytes);
+    }
+
+    /*!
+     * Gives back bytes taken with try_reserve_participant_bytes() which were not finally sent.
+     *
+     * @param destination Prefix of the GUID of the remote participant the bytes were taken from.
+     * @param bytes Number of bytes to give back.
+     */
+    virtual void refund_participant_bytes(
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            uint32_t bytes)
+    {
+        static_cast<void>(destination);
+        static_cast<void>(bytes);
+    }
+
+    /*!
+     * Tells whether the bytes sent to each remote participant are limited, so writers can skip charging them.
+     *
+     * @return true if try_reserve_participant_bytes() may refuse bytes.
+     */
+    virtual bool is_participant_rate_limited() const
+    {
+        return false;
+    }
+
+    /*!
+     * Notifies the reception of an ACKNACK from a remote reader, so its congestion window can be adjusted.
+     *
+     * @param destination GUID of the remote reader which sent the ACKNACK.
+     * @param lost_samples Number of samples requested again by the ACKNACK.
+     */
+    virtual void notify_destination_feedback(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t lost_samples)
+    {
+        static_cast<void>(destination);
+        static_cast<void>(lost_samples);
+    }
+
+    /*!
+     * Forgets the congestion state of a remote reader, and the rate limit state of its participant when it has no
+     * pending effect.
+     *
+     * @param destination GUID of the remote reader.
+     */
+    virtual void remove_destination(
+            const fastrtps::rtps::GUID_t& destination)
+    {
+        static_cast<void>(destination);
+    }
+
+    /*!
+     * Gets the counters of the scheduler.
+     * Only flow controllers using the earliest deadline first scheduler keep them.
+     *
+     * @param statistics Filled with the counters of the scheduler.
+     * @return true if the flow controller keeps counters, false otherwise.
+     */
+    virtual bool get_statistics(
+            FlowControllerStatistics& statistics)
+    {
+        static_cast<void>(statistics);
+        return false;
+    }
 };
 
 } // namespace rtps
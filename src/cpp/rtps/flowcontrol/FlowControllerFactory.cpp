@@ -1,5 +1,6 @@
 #include "FlowControllerFactory.hpp"
 #include "FlowControllerImpl.hpp"
+#include "FlowControllerPool.hpp"
 
 #include <fastdds/dds/log/Log.hpp>
 
@@ -55,6 +56,24 @@ void FlowControllerFactory::init(
 #endif // ifndef FASTDDS_STATISTICS
 }
 
+template<typename SampleScheduling>
+FlowController* FlowControllerFactory::create_async_flow_controller(
+        const FlowControllerDescriptor& flow_controller_descr)
+{
+    const ThreadSettings& sender_thread_settings = flow_controller_descr.sender_thread;
+
+    if (1 < flow_controller_descr.num_sender_threads)
+    {
+        FlowController* ret = new FlowControllerPool<FlowControllerAsyncPublishMode, SampleScheduling>(participant_,
+                        &flow_controller_descr, async_controller_index_, sender_thread_settings);
+        async_controller_index_ += flow_controller_descr.num_sender_threads;
+        return ret;
+    }
+
+    return new FlowControllerImpl<FlowControllerAsyncPublishMode, SampleScheduling>(participant_,
+                   &flow_controller_descr, async_controller_index_++, sender_thread_settings);
+}
+
 void FlowControllerFactory::register_flow_controller (
         const FlowControllerDescriptor& flow_controller_descr)
 {
@@ -69,6 +88,14 @@ void FlowControllerFactory::register_flow_controller (
 
     if (0 < flow_controller_descr.max_bytes_per_period)
     {
+        if (1 < flow_controller_descr.num_sender_threads)
+        {
+            // The bandwidth of a period is accounted by a single sender thread.
+            EPROSIMA_LOG_WARNING(RTPS_PARTICIPANT,
+                    "FlowController " << flow_controller_descr.name << " limits its bandwidth, so it will use a single"
+                                      << " sender thread instead of " << flow_controller_descr.num_sender_threads);
+        }
+
         switch (flow_controller_descr.scheduler)
         {
             case FlowControllerSchedulerPolicy::FIFO:
@@ -103,6 +130,14 @@ void FlowControllerFactory::register_flow_controller (
                                 FlowControllerPriorityWithReservationSchedule>(participant_,
                                 &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
                 break;
+            case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                                FlowControllerEarliestDeadlineFirstSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
             default:
                 assert(false);
         }
@@ -115,33 +150,31 @@ void FlowControllerFactory::register_flow_controller (
                 flow_controllers_.insert(decltype(flow_controllers_)::value_type(
                             flow_controller_descr.name,
                             std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                FlowControllerFifoSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                create_async_flow_controller<FlowControllerFifoSchedule>(flow_controller_descr))));
                 break;
             case FlowControllerSchedulerPolicy::ROUND_ROBIN:
                 flow_controllers_.insert(decltype(flow_controllers_)::value_type(
                             flow_controller_descr.name,
                             std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                FlowControllerRoundRobinSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                create_async_flow_controller<FlowControllerRoundRobinSchedule>(flow_controller_descr))));
                 break;
             case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
                 flow_controllers_.insert(decltype(flow_controllers_)::value_type(
                             flow_controller_descr.name,
                             std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                FlowControllerHighPrioritySchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                create_async_flow_controller<FlowControllerHighPrioritySchedule>(flow_controller_descr))));
                 break;
             case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
                 flow_controllers_.insert(decltype(flow_controllers_)::value_type(
                             flow_controller_descr.name,
                             std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                FlowControllerPriorityWithReservationSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                create_async_flow_controller<FlowControllerPriorityWithReservationSchedule>(flow_controller_descr))));
+                break;
+            case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                create_async_flow_controller<FlowControllerEarliestDeadlineFirstSchedule>(flow_controller_descr))));
                 break;
             default:
                 assert(false);
@@ -210,6 +243,14 @@ FlowController* FlowControllerFactory::retrieve_flow_controller(
     return returned_flow;
 }
 
+bool FlowControllerFactory::get_flow_controller_statistics(
+        const std::string& flow_controller_name,
+        FlowControllerStatistics& statistics) const
+{
+    auto it = flow_controllers_.find(flow_controller_name);
+    return flow_controllers_.end() != it && it->second->get_statistics(statistics);
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
@@ -59,8 +59,30 @@ public:
             const std::string& flow_controller_name,
             const fastrtps::rtps::WriterAttributes& writer_attributes);
 
+    /*!
+     * Get the counters of a registered FlowController.
+     *
+     * @param flow_controller_name Name of the interested FlowController.
+     * @param statistics Filled with the counters of the FlowController.
+     * @return true if the FlowController is registered and keeps counters, false otherwise.
+     */
+    bool get_flow_controller_statistics(
+            const std::string& flow_controller_name,
+            FlowControllerStatistics& statistics) const;
+
 private:
 
+    /*!
+     * Creates an asynchronous flow controller without bandwidth limitation, with as many sender threads as requested
+     * by the descriptor.
+     *
+     * @param flow_controller_descr Descriptor of the flow controller.
+     * @return Pointer to the new FlowController.
+     */
+    template<typename SampleScheduling>
+    FlowController* create_async_flow_controller(
+            const FlowControllerDescriptor& flow_controller_descr);
+
     fastrtps::rtps::RTPSParticipantImpl* participant_ = nullptr;
 
     //! Stores the created flow controllers.
@@ -1,14 +1,21 @@
 #ifndef _RTPS_FLOWCONTROL_FLOWCONTROLLERIMPL_HPP_
 #define _RTPS_FLOWCONTROL_FLOWCONTROLLERIMPL_HPP_
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
+#include "AIMDCongestionControl.hpp"
 #include "FlowController.hpp"
+#include "TokenBucketRateLimiter.hpp"
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerStatistics.hpp>
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastdds/utils/TimedConditionVariable.hpp>
@@ -92,7 +99,16 @@ struct FlowQueue
         old_ones_.add_list(old_interested_);
     }
 
-private:
+    /*!
+     * Returns a parked change to the front of the queue, so it is the next one to be sent.
+     * The change should be still marked as linked.
+     */
+    void add_parked_sample(
+            fastrtps::rtps::CacheChange_t* change) noexcept
+    {
+        // This function should be called with mutex_ locked, because the queue is changed.
+        new_ones_.add_linked_change_front(change);
+    }
 
     struct ListInfo
     {
@@ -144,6 +160,36 @@ private:
             }
         }
 
+        //! Links at the end of the list a change already marked as linked.
+        void add_linked_change(
+                fastrtps::rtps::CacheChange_t* change) noexcept
+        {
+            change->writer_info.previous = tail.writer_info.previous;
+            change->writer_info.previous->writer_info.next = change;
+            tail.writer_info.previous = change;
+            change->writer_info.next = &tail;
+        }
+
+        //! Links at the beginning of the list a change already marked as linked.
+        void add_linked_change_front(
+                fastrtps::rtps::CacheChange_t* change) noexcept
+        {
+            change->writer_info.next = head.writer_info.next;
+            change->writer_info.next->writer_info.previous = change;
+            head.writer_info.next = change;
+            change->writer_info.previous = &head;
+        }
+
+        //! Unlinks a change from the list it belongs to, but keeps it marked as linked.
+        static void unlink_change(
+                fastrtps::rtps::CacheChange_t* change) noexcept
+        {
+            change->writer_info.previous->writer_info.next = change->writer_info.next;
+            change->writer_info.next->writer_info.previous = change->writer_info.previous;
+            change->writer_info.previous = nullptr;
+            change->writer_info.next = nullptr;
+        }
+
         void add_list(
                 ListInfo& list) noexcept
         {
@@ -165,6 +211,8 @@ private:
         fastrtps::rtps::CacheChange_t tail;
     };
 
+private:
+
     //! List of interested new changes to be included.
     //! Should be protected with changes_interested_mutex.
     ListInfo new_interested_;
@@ -201,8 +249,13 @@ struct FlowControllerAsyncPublishMode
 {
     FlowControllerAsyncPublishMode(
             fastrtps::rtps::RTPSParticipantImpl* participant,
-            const FlowControllerDescriptor*)
+            const FlowControllerDescriptor* descriptor)
         : group(participant, true)
+        , congestion_control(std::make_shared<AIMDCongestionControl>(
+                nullptr != descriptor ? descriptor->congestion_control : FlowControllerCongestionControl(),
+                nullptr != descriptor ? descriptor->period_ms : 100))
+        , destination_rate_limit(std::make_shared<TokenBucketRateLimiter>(
+                nullptr != descriptor ? descriptor->destination_rate_limit : FlowControllerDestinationRateLimit()))
     {
     }
 
@@ -225,21 +278,42 @@ struct FlowControllerAsyncPublishMode
         return true;
     }
 
+    /*!
+     * Wait until there is a new change added (notified by other thread). When the sending windows of the congestion
+     * control or the buckets of the destinations were exhausted, wait at most until they are refilled.
+     */
     bool wait(
             std::unique_lock<fastrtps::TimedMutex>& lock)
     {
-        cv.wait(lock);
+        if (congestion_wait_)
+        {
+            congestion_wait_ = false;
+            std::chrono::steady_clock::time_point until = destination_rate_limit->next_available(destination_rate_limit_waiter);
+            if (congestion_control->enabled())
+            {
+                until = (std::min)(until, congestion_control->next_period());
+            }
+            cv.wait_until(lock, until);
+        }
+        else
+        {
+            cv.wait(lock);
+        }
         return false;
     }
 
     bool force_wait() const
     {
-        return false;
+        return congestion_wait_;
     }
 
     void process_deliver_retcode(
-            const fastrtps::rtps::DeliveryRetCode&)
+            const fastrtps::rtps::DeliveryRetCode& ret_value)
     {
+        if (fastrtps::rtps::DeliveryRetCode::EXCEEDED_DESTINATION_LIMIT == ret_value)
+        {
+            congestion_wait_ = true;
+        }
     }
 
     eprosima::thread thread;
@@ -255,6 +329,20 @@ struct FlowControllerAsyncPublishMode
 
     //! Used to warning async thread a writer wants to remove a sample.
     std::atomic<uint32_t> writers_interested_in_remove = {0};
+
+    //! Sending windows of the remote readers. Shared by the lanes of a FlowControllerPool.
+    std::shared_ptr<AIMDCongestionControl> congestion_control;
+
+    //! Token buckets of the remote participants. Shared by the lanes of a FlowControllerPool.
+    std::shared_ptr<TokenBucketRateLimiter> destination_rate_limit;
+
+    //! Wake-up time of the sender thread for the token buckets which refused bytes to its writers.
+    TokenBucketRateLimiter::Waiter destination_rate_limit_waiter;
+
+protected:
+
+    //! Set when the only pending samples are the ones whose destinations exhausted their sending windows or buckets.
+    bool congestion_wait_ = false;
 };
 
 //! Sends new samples synchronously. Old samples are sent asynchronously */
@@ -343,12 +431,15 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
             group.reset_current_bytes_processed();
         }
 
+        // Samples held back by their destinations are tried again at least once per period.
+        congestion_wait_ = false;
+
         return reset_limit;
     }
 
     bool force_wait() const
     {
-        return force_wait_;
+        return force_wait_ || congestion_wait_;
     }
 
     void process_deliver_retcode(
@@ -358,6 +449,10 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
         {
             force_wait_ = true;
         }
+        else
+        {
+            FlowControllerAsyncPublishMode::process_deliver_retcode(ret_value);
+        }
     }
 
     int32_t max_bytes_per_period = 0;
@@ -406,6 +501,13 @@ struct FlowControllerFifoSchedule
         queue_.add_old_sample(change);
     }
 
+    void add_parked_sample(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        queue_.add_parked_sample(change);
+    }
+
     /*!
      * Returns the first sample in the queue.
      * Default behaviour.
@@ -542,6 +644,15 @@ struct FlowControllerRoundRobinSchedule
         std::get<1>(*it).add_old_sample(change);
     }
 
+    void add_parked_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        std::get<1>(*it).add_parked_sample(change);
+    }
+
     fastrtps::rtps::CacheChange_t* get_next_change_nts()
     {
         fastrtps::rtps::CacheChange_t* ret_change = nullptr;
@@ -663,6 +774,13 @@ struct FlowControllerHighPrioritySchedule
         find_queue(writer).add_old_sample(change);
     }
 
+    void add_parked_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        find_queue(writer).add_parked_sample(change);
+    }
+
     fastrtps::rtps::CacheChange_t* get_next_change_nts()
     {
         fastrtps::rtps::CacheChange_t* ret_change = nullptr;
@@ -830,6 +948,16 @@ struct FlowControllerPriorityWithReservationSchedule
         std::get<0>(it->second).add_old_sample(change);
     }
 
+    void add_parked_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        // Find writer queue..
+        auto it = writers_queue_.find(writer);
+        assert(it != writers_queue_.end());
+        std::get<0>(it->second).add_parked_sample(change);
+    }
+
     fastrtps::rtps::CacheChange_t* get_next_change_nts()
     {
         fastrtps::rtps::CacheChange_t* highest_priority = nullptr;
@@ -920,6 +1048,277 @@ private:
     uint32_t size_being_processed_ = 0;
 };
 
+//! Earliest deadline first scheduling
+struct FlowControllerEarliestDeadlineFirstSchedule
+{
+    //! Value of an infinite deadline or lifespan.
+    static constexpr int64_t infinite_ns = (std::numeric_limits<int64_t>::max)();
+
+    void register_writer(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        assert(nullptr != writer);
+        assert(writers_queue_.end() == find(writer));
+
+        WriterQueue writer_queue;
+        writer_queue.writer = writer;
+        writer_queue.deadline_ns = get_duration_property(writer, "fastdds.sfc.deadline_ns");
+        writer_queue.lifespan_ns = get_duration_property(writer, "fastdds.sfc.lifespan_ns");
+        writers_queue_.push_back(std::move(writer_queue));
+    }
+
+    void unregister_writer(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        if (writer == writer_being_processed_)
+        {
+            writer_being_processed_ = nullptr;
+        }
+        writers_queue_.erase(it);
+    }
+
+    void work_done()
+    {
+        if (nullptr != writer_being_processed_)
+        {
+            ++statistics_.samples_sent;
+
+            if (infinite_ns != deadline_being_processed_)
+            {
+                fastrtps::rtps::Time_t now;
+                fastrtps::rtps::Time_t::now(now);
+                int64_t slack = deadline_being_processed_ - now.to_ns();
+
+                if (0 > slack)
+                {
+                    ++statistics_.deadline_misses;
+                }
+                ++statistics_.samples_with_deadline;
+                statistics_.min_deadline_slack_ns = (std::min)(statistics_.min_deadline_slack_ns, slack);
+                statistics_.total_deadline_slack_ns += slack;
+            }
+
+            writer_being_processed_ = nullptr;
+        }
+    }
+
+    void add_new_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        it->queue.add_new_sample(change);
+    }
+
+    void add_old_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        it->queue.add_old_sample(change);
+    }
+
+    void add_parked_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        it->queue.add_parked_sample(change);
+    }
+
+    /*!
+     * Returns the sample with the earliest deadline among the first ones of each writer.
+     * Samples of a writer are queued in order of source timestamp, so the first one is the one with the earliest
+     * deadline. Samples whose lifespan has already expired are removed from the queue and never sent.
+     * Samples without deadline are returned after all the others, in order of source timestamp.
+     *
+     * @return Pointer to next change to be sent. nullptr implies there is no sample to be sent.
+     */
+    fastrtps::rtps::CacheChange_t* get_next_change_nts()
+    {
+        fastrtps::rtps::CacheChange_t* ret_change = nullptr;
+        int64_t ret_deadline = infinite_ns;
+        int64_t ret_timestamp = infinite_ns;
+        writer_being_processed_ = nullptr;
+
+        if (0 < writers_queue_.size())
+        {
+            fastrtps::rtps::Time_t now;
+            fastrtps::rtps::Time_t::now(now);
+            int64_t now_ns = now.to_ns();
+
+            for (auto& writer_queue : writers_queue_)
+            {
+                fastrtps::rtps::CacheChange_t* change = writer_queue.queue.get_next_change();
+
+                while (nullptr != change && is_expired(writer_queue, change, now_ns))
+                {
+                    drop_change(change);
+                    ++statistics_.samples_dropped_before_send;
+                    change = writer_queue.queue.get_next_change();
+                }
+
+                if (nullptr != change)
+                {
+                    int64_t timestamp = change->sourceTimestamp.to_ns();
+                    int64_t deadline = deadline_of(writer_queue, timestamp);
+
+                    if (nullptr == ret_change || deadline < ret_deadline ||
+                            (deadline == ret_deadline && timestamp < ret_timestamp))
+                    {
+                        ret_change = change;
+                        ret_deadline = deadline;
+                        ret_timestamp = timestamp;
+                        writer_being_processed_ = writer_queue.writer;
+                    }
+                }
+            }
+        }
+
+        deadline_being_processed_ = ret_deadline;
+        return ret_change;
+    }
+
+    void add_interested_changes_to_queue_nts()
+    {
+        // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
+        for (auto& writer_queue : writers_queue_)
+        {
+            writer_queue.queue.add_interested_changes_to_queue();
+        }
+    }
+
+    void set_bandwith_limitation(
+            uint32_t) const
+    {
+    }
+
+    void trigger_bandwidth_limit_reset() const
+    {
+    }
+
+    /*!
+     * Returns the counters of the scheduler.
+     * Should be called with mutex_ locked.
+     */
+    const FlowControllerStatistics& get_statistics() const
+    {
+        return statistics_;
+    }
+
+private:
+
+    struct WriterQueue
+    {
+        fastrtps::rtps::RTPSWriter* writer = nullptr;
+
+        FlowQueue queue;
+
+        //! Relative deadline of the samples of the writer.
+        int64_t deadline_ns = infinite_ns;
+
+        //! Lifespan of the samples of the writer.
+        int64_t lifespan_ns = infinite_ns;
+    };
+
+    using container = std::vector<WriterQueue>;
+    using iterator = container::iterator;
+
+    /*!
+     * Reads a duration in nanoseconds from a property of the writer.
+     *
+     * @return The duration, or infinite_ns if the property is not set or is not valid.
+     */
+    static int64_t get_duration_property(
+            fastrtps::rtps::RTPSWriter* writer,
+            const std::string& property_name)
+    {
+        int64_t duration = infinite_ns;
+        auto property = fastrtps::rtps::PropertyPolicyHelper::find_property(
+            writer->getAttributes().properties, property_name);
+
+        if (nullptr != property)
+        {
+            char* ptr = nullptr;
+            long long value = strtoll(property->c_str(), &ptr, 10);
+
+            if (property->c_str() != ptr)     // A valid integer was read.
+            {
+                if (0 < value)
+                {
+                    duration = static_cast<int64_t>(value);
+                }
+                else
+                {
+                    EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                            "Wrong value for " << property_name << " property. It should be positive. Set to infinite");
+                }
+            }
+            else
+            {
+                EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                        "Not numerical value for " << property_name << " property. Set to infinite");
+            }
+        }
+
+        return duration;
+    }
+
+    //! The deadline of a sample is the earliest of the deadline period and the lifespan since its source timestamp.
+    static int64_t deadline_of(
+            const WriterQueue& writer_queue,
+            int64_t timestamp)
+    {
+        int64_t relative = (std::min)(writer_queue.deadline_ns, writer_queue.lifespan_ns);
+        return infinite_ns == relative || infinite_ns - relative < timestamp ? infinite_ns : timestamp + relative;
+    }
+
+    static bool is_expired(
+            const WriterQueue& writer_queue,
+            const fastrtps::rtps::CacheChange_t* change,
+            int64_t now_ns)
+    {
+        return infinite_ns != writer_queue.lifespan_ns &&
+               now_ns - change->sourceTimestamp.to_ns() >= writer_queue.lifespan_ns;
+    }
+
+    //! Removes the sample from the queue. The writer removes it from its history when its lifespan expires.
+    static void drop_change(
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        fastrtps::rtps::CacheChange_t* previous = change->writer_info.previous;
+        fastrtps::rtps::CacheChange_t* next = change->writer_info.next;
+        previous->writer_info.next = next;
+        next->writer_info.previous = previous;
+        change->writer_info.previous = nullptr;
+        change->writer_info.next = nullptr;
+        change->writer_info.is_linked.store(false);
+    }
+
+    iterator find(
+            const fastrtps::rtps::RTPSWriter* writer)
+    {
+        return std::find_if(writers_queue_.begin(), writers_queue_.end(),
+                       [writer](const WriterQueue& writer_queue)
+                       {
+                           return writer == writer_queue.writer;
+                       });
+    }
+
+    container writers_queue_;
+
+    fastrtps::rtps::RTPSWriter* writer_being_processed_ = nullptr;
+
+    int64_t deadline_being_processed_ = infinite_ns;
+
+    FlowControllerStatistics statistics_;
+};
+
 template<typename PublishMode, typename SampleScheduling>
 class FlowControllerImpl : public FlowController
 {
@@ -1049,8 +1448,108 @@ public:
         return get_max_payload_impl();
     }
 
+    void begin_batch(
+            fastrtps::rtps::RTPSWriter* writer,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        assert(nullptr != writer);
+        begin_batch_impl(writer, max_blocking_time);
+    }
+
+    void end_batch(
+            fastrtps::rtps::RTPSWriter* writer) override
+    {
+        assert(nullptr != writer);
+        end_batch_impl(writer);
+    }
+
+    bool try_reserve_destination_bytes(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t bytes) override
+    {
+        return try_reserve_destination_bytes_impl(destination, bytes);
+    }
+
+    void notify_destination_feedback(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t lost_samples) override
+    {
+        notify_destination_feedback_impl(destination, lost_samples);
+    }
+
+    bool try_reserve_participant_bytes(
+            fastrtps::rtps::RTPSWriter*,
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            uint32_t bytes) override
+    {
+        return try_reserve_participant_bytes_impl(destination, bytes);
+    }
+
+    void refund_destination_bytes(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t bytes) override
+    {
+        refund_destination_bytes_impl(destination, bytes);
+    }
+
+    void refund_participant_bytes(
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            uint32_t bytes) override
+    {
+        refund_participant_bytes_impl(destination, bytes);
+    }
+
+    bool is_participant_rate_limited() const override
+    {
+        return is_participant_rate_limited_impl();
+    }
+
+    void remove_destination(
+            const fastrtps::rtps::GUID_t& destination) override
+    {
+        remove_destination_impl(destination);
+    }
+
+    bool get_statistics(
+            FlowControllerStatistics& statistics) override
+    {
+        return get_statistics_impl(statistics);
+    }
+
+    /*!
+     * Makes this flow controller use the congestion windows and destination buckets of another one, so both account
+     * together the bytes sent to each destination.
+     * Should be called before registering any writer.
+     *
+     * @param other Flow controller whose destination limits are shared.
+     */
+    void share_destination_limits(
+            const FlowControllerImpl& other)
+    {
+        async_mode.congestion_control = other.async_mode.congestion_control;
+        async_mode.destination_rate_limit = other.async_mode.destination_rate_limit;
+    }
+
 private:
 
+    template<typename Scheduler = scheduler>
+    typename std::enable_if<std::is_same<FlowControllerEarliestDeadlineFirstSchedule, Scheduler>::value, bool>::type
+    get_statistics_impl(
+            FlowControllerStatistics& statistics)
+    {
+        std::unique_lock<fastrtps::TimedMutex> lock(mutex_);
+        statistics = sched.get_statistics();
+        return true;
+    }
+
+    template<typename Scheduler = scheduler>
+    typename std::enable_if<!std::is_same<FlowControllerEarliestDeadlineFirstSchedule, Scheduler>::value, bool>::type
+    get_statistics_impl(
+            FlowControllerStatistics&)
+    {
+        return false;
+    }
+
     /*!
      * Initialize asynchronous thread.
      */
@@ -1175,6 +1674,21 @@ private:
         bool ret_value = false;
         // This call should be made with writer's mutex locked.
         fastrtps::rtps::LocatorSelectorSender& locator_selector = writer->get_general_locator_selector();
+
+        // When the writer has a batch open, the locator selector is already locked and the sample is added to the
+        // batch's message group.
+        fastrtps::rtps::RTPSMessageGroup* batch_group = find_batch_group(writer);
+        if (nullptr != batch_group)
+        {
+            ret_value = true;
+            if (fastrtps::rtps::DeliveryRetCode::DELIVERED !=
+                    writer->deliver_sample_nts(change, *batch_group, locator_selector, max_blocking_time))
+            {
+                ret_value =  enqueue_new_sample_impl(writer, change, max_blocking_time);
+            }
+            return ret_value;
+        }
+
 #if HAVE_STRICT_REALTIME
         std::unique_lock<fastrtps::rtps::LocatorSelectorSender> lock(locator_selector, std::defer_lock);
         if (lock.try_lock_until(max_blocking_time))
@@ -1383,6 +1897,15 @@ private:
             fastrtps::rtps::RTPSWriter* current_writer = nullptr;
             while (nullptr != change_to_process)
             {
+                // Samples of a parked writer keep their order and wait until the end of this round.
+                if (is_writer_parked_nts(change_to_process->writerGUID))
+                {
+                    FlowQueue::ListInfo::unlink_change(change_to_process);
+                    parked_changes_.add_linked_change(change_to_process);
+                    change_to_process = sched.get_next_change_nts();
+                    continue;
+                }
+
                 // Fast check if next change will enter.
                 if (!async_mode.fast_check_is_there_slot_for_change(change_to_process))
                 {
@@ -1421,7 +1944,15 @@ private:
                     change_to_process, async_mode.group, locator_selector,
                     std::chrono::steady_clock::now() + std::chrono::hours(24));
 
-                if (fastrtps::rtps::DeliveryRetCode::DELIVERED != ret_delivery)
+                if (fastrtps::rtps::DeliveryRetCode::EXCEEDED_DESTINATION_LIMIT == ret_delivery)
+                {
+                    // The destinations of the writer cannot receive more data by now. Park the writer and keep
+                    // serving the others.
+                    change_to_process->writer_info.is_linked.store(true);
+                    parked_changes_.add_linked_change(change_to_process);
+                    parked_writers_.push_back(change_to_process->writerGUID);
+                }
+                else if (fastrtps::rtps::DeliveryRetCode::DELIVERED != ret_delivery)
                 {
                     // If delivery fails, put the change again in the queue.
                     change_to_process->writer_info.is_linked.store(true);
@@ -1441,7 +1972,10 @@ private:
                 locator_selector.unlock();
                 current_writer->getMutex().unlock();
 
-                sched.work_done();
+                if (fastrtps::rtps::DeliveryRetCode::DELIVERED == ret_delivery)
+                {
+                    sched.work_done();
+                }
 
                 if (0 != async_mode.writers_interested_in_remove)
                 {
@@ -1458,10 +1992,45 @@ private:
                 change_to_process = sched.get_next_change_nts();
             }
 
+            if (!parked_changes_.is_empty())
+            {
+                if (nullptr == change_to_process)
+                {
+                    // Only the samples of parked writers are left. Wait for their destinations to be refilled.
+                    async_mode.process_deliver_retcode(fastrtps::rtps::DeliveryRetCode::EXCEEDED_DESTINATION_LIMIT);
+                }
+
+                unpark_writers_nts();
+            }
+
             async_mode.group.sender(nullptr, nullptr);
         }
     }
 
+    bool is_writer_parked_nts(
+            const fastrtps::rtps::GUID_t& writer_guid) const
+    {
+        return parked_writers_.end() != std::find(parked_writers_.begin(), parked_writers_.end(), writer_guid);
+    }
+
+    /*!
+     * Returns the parked samples to the front of the queues of their writers, in the same order they had.
+     * Should be called with mutex_ locked.
+     */
+    void unpark_writers_nts()
+    {
+        while (!parked_changes_.is_empty())
+        {
+            fastrtps::rtps::CacheChange_t* change = parked_changes_.tail.writer_info.previous;
+            FlowQueue::ListInfo::unlink_change(change);
+            auto writer_it = writers_.find(change->writerGUID);
+            assert(writers_.end() != writer_it);
+            sched.add_parked_sample(writer_it->second, change);
+        }
+
+        parked_writers_.clear();
+    }
+
     template<typename PubMode = PublishMode>
     typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
     get_max_payload_impl()
@@ -1476,6 +2045,251 @@ private:
         return (std::numeric_limits<uint32_t>::max)();
     }
 
+    /*!
+     * Opens a batch for a writer using synchronous delivery.
+     * The general locator selector of the writer is kept locked while the batch is open, so all the samples added
+     * by the writer are packed into the same RTPSMessageGroup.
+     * If the locator selector cannot be locked in time, no batch is opened and samples are sent one by one.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_base_of<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    begin_batch_impl(
+            fastrtps::rtps::RTPSWriter* writer,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+    {
+        fastrtps::rtps::LocatorSelectorSender& locator_selector = writer->get_general_locator_selector();
+        SyncDeliveryBatch batch;
+#if HAVE_STRICT_REALTIME
+        batch.lock = std::unique_lock<fastrtps::rtps::LocatorSelectorSender>(locator_selector, std::defer_lock);
+        if (!batch.lock.try_lock_until(max_blocking_time))
+        {
+            return;
+        }
+#else
+        batch.lock = std::unique_lock<fastrtps::rtps::LocatorSelectorSender>(locator_selector);
+#endif // if HAVE_STRICT_REALTIME
+
+        try
+        {
+            batch.group.reset(new fastrtps::rtps::RTPSMessageGroup(participant_, writer, &locator_selector,
+                    max_blocking_time));
+        }
+        catch (fastrtps::rtps::RTPSMessageGroup::timeout&)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(batches_mutex_);
+        auto ret = batches_.emplace(writer, std::move(batch));
+        (void)ret;
+        assert(ret.second);
+        open_batches_.fetch_add(1, std::memory_order_release);
+    }
+
+    /*! This function is used when PublishMode doesn't deliver synchronously.
+     *  In this case samples are always packed by the asynchronous thread.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_base_of<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    begin_batch_impl(
+            fastrtps::rtps::RTPSWriter*,
+            const std::chrono::time_point<std::chrono::steady_clock>&)
+    {
+        // Do nothing.
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_base_of<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    end_batch_impl(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        SyncDeliveryBatch batch;
+
+        {
+            std::lock_guard<std::mutex> lock(batches_mutex_);
+            auto it = batches_.find(writer);
+            if (batches_.end() == it)
+            {
+                return;
+            }
+            batch = std::move(it->second);
+            batches_.erase(it);
+            open_batches_.fetch_sub(1, std::memory_order_release);
+        }
+
+        // Send the pending messages before releasing the locator selector.
+        batch.group.reset();
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_base_of<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    end_batch_impl(
+            fastrtps::rtps::RTPSWriter*)
+    {
+        // Do nothing.
+    }
+
+    /*!
+     * Returns the message group of the batch opened by a writer, or nullptr when the writer has no open batch.
+     */
+    fastrtps::rtps::RTPSMessageGroup* find_batch_group(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        if (0 == open_batches_.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(batches_mutex_);
+        auto it = batches_.find(writer);
+        return batches_.end() != it ? it->second.group.get() : nullptr;
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
+    try_reserve_destination_bytes_impl(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t bytes)
+    {
+        return !async_mode.congestion_control->enabled() ||
+               async_mode.congestion_control->try_reserve(destination, bytes);
+    }
+
+    /*! This function is used when PublishMode = FlowControllerPureSyncPublishMode.
+     *  In this case there is no congestion control.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
+    constexpr try_reserve_destination_bytes_impl(
+            const fastrtps::rtps::GUID_t&,
+            uint32_t) const
+    {
+        return true;
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
+    try_reserve_participant_bytes_impl(
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            uint32_t bytes)
+    {
+        return !async_mode.destination_rate_limit->enabled() ||
+               async_mode.destination_rate_limit->try_consume(destination, bytes,
+                       async_mode.destination_rate_limit_waiter);
+    }
+
+    /*! This function is used when PublishMode = FlowControllerPureSyncPublishMode.
+     *  In this case there is no rate limit.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
+    constexpr try_reserve_participant_bytes_impl(
+            const fastrtps::rtps::GuidPrefix_t&,
+            uint32_t) const
+    {
+        return true;
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    refund_destination_bytes_impl(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t bytes)
+    {
+        if (async_mode.congestion_control->enabled())
+        {
+            async_mode.congestion_control->refund(destination, bytes);
+        }
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    refund_destination_bytes_impl(
+            const fastrtps::rtps::GUID_t&,
+            uint32_t)
+    {
+        // Do nothing.
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    refund_participant_bytes_impl(
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            uint32_t bytes)
+    {
+        if (async_mode.destination_rate_limit->enabled())
+        {
+            async_mode.destination_rate_limit->refund(destination, bytes);
+        }
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    refund_participant_bytes_impl(
+            const fastrtps::rtps::GuidPrefix_t&,
+            uint32_t)
+    {
+        // Do nothing.
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
+    is_participant_rate_limited_impl() const
+    {
+        return async_mode.destination_rate_limit->enabled();
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
+    constexpr is_participant_rate_limited_impl() const
+    {
+        return false;
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    notify_destination_feedback_impl(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t lost_samples)
+    {
+        if (async_mode.congestion_control->enabled())
+        {
+            async_mode.congestion_control->on_feedback(destination, lost_samples);
+        }
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    notify_destination_feedback_impl(
+            const fastrtps::rtps::GUID_t&,
+            uint32_t)
+    {
+        // Do nothing.
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    remove_destination_impl(
+            const fastrtps::rtps::GUID_t& destination)
+    {
+        if (async_mode.congestion_control->enabled())
+        {
+            async_mode.congestion_control->remove(destination);
+        }
+        if (async_mode.destination_rate_limit->enabled())
+        {
+            async_mode.destination_rate_limit->release(destination.guidPrefix);
+        }
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    remove_destination_impl(
+            const fastrtps::rtps::GUID_t&)
+    {
+        // Do nothing.
+    }
+
     fastrtps::TimedMutex mutex_;
 
     fastrtps::rtps::RTPSParticipantImpl* participant_ = nullptr;
@@ -1492,6 +2306,29 @@ private:
 
     //! Thread settings for the sender thread
     ThreadSettings thread_settings_;
+
+    //! Writers whose destinations exhausted their sending windows or buckets in the current round.
+    std::vector<fastrtps::rtps::GUID_t> parked_writers_;
+
+    //! Samples of the parked writers, kept linked so they can be removed while the round is running.
+    FlowQueue::ListInfo parked_changes_;
+
+    //! Batch of samples opened by a writer with begin_batch().
+    struct SyncDeliveryBatch
+    {
+        // Declared before the group, so the group is flushed before the locator selector is unlocked.
+        std::unique_lock<fastrtps::rtps::LocatorSelectorSender> lock;
+
+        std::unique_ptr<fastrtps::rtps::RTPSMessageGroup> group;
+    };
+
+    //! Open batches, indexed by writer.
+    std::unordered_map<fastrtps::rtps::RTPSWriter*, SyncDeliveryBatch> batches_;
+
+    std::mutex batches_mutex_;
+
+    //! Number of open batches. Avoids locking batches_mutex_ when no batch is open.
+    std::atomic<uint32_t> open_batches_ {0};
 };
 
 } // namespace rtps
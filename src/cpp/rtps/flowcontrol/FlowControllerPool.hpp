@@ -0,0 +1,211 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _RTPS_FLOWCONTROL_FLOWCONTROLLERPOOL_HPP_
+#define _RTPS_FLOWCONTROL_FLOWCONTROLLERPOOL_HPP_
+
+#include <cassert>
+#include <memory>
+#include <vector>
+
+#include "FlowControllerImpl.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Asynchronous flow controller with several sender threads.
+ *
+ * It is composed of lanes, each one a FlowControllerImpl with its own scheduler and sender thread.
+ * A writer is always managed by the same lane, selected from its entity key, so its samples are sent in order by a
+ * single thread while the samples of writers in other lanes are sent concurrently.
+ * All the lanes share the congestion windows and the rate limits of the destinations.
+ */
+template<typename PublishMode, typename SampleScheduling>
+class FlowControllerPool : public FlowController
+{
+    using lane_type = FlowControllerImpl<PublishMode, SampleScheduling>;
+
+public:
+
+    /*!
+     * @param participant Participant owning the flow controller.
+     * @param descriptor Descriptor of the flow controller. Its num_sender_threads defines the number of lanes.
+     * @param async_index Index of the first lane. The following lanes use consecutive indexes.
+     * @param thread_settings Settings of the sender threads.
+     */
+    FlowControllerPool(
+            fastrtps::rtps::RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor,
+            uint32_t async_index,
+            ThreadSettings thread_settings)
+    {
+        uint32_t num_lanes = (nullptr != descriptor && 1 < descriptor->num_sender_threads) ?
+                descriptor->num_sender_threads : 1;
+        lanes_.reserve(num_lanes);
+
+        for (uint32_t i = 0; i < num_lanes; ++i)
+        {
+            lanes_.emplace_back(new lane_type(participant, descriptor, async_index + i, thread_settings));
+            if (0 < i)
+            {
+                lanes_[i]->share_destination_limits(*lanes_[0]);
+            }
+        }
+    }
+
+    virtual ~FlowControllerPool() noexcept
+    {
+    }
+
+    //! Returns the number of lanes, which is the number of sender threads.
+    size_t num_lanes() const
+    {
+        return lanes_.size();
+    }
+
+    void init() override
+    {
+        for (auto& lane : lanes_)
+        {
+            lane->init();
+        }
+    }
+
+    void register_writer(
+            fastrtps::rtps::RTPSWriter* writer) override
+    {
+        lane_of(writer->getGuid()).register_writer(writer);
+    }
+
+    void unregister_writer(
+            fastrtps::rtps::RTPSWriter* writer) override
+    {
+        lane_of(writer->getGuid()).unregister_writer(writer);
+    }
+
+    bool add_new_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        return lane_of(writer->getGuid()).add_new_sample(writer, change, max_blocking_time);
+    }
+
+    bool add_old_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change) override
+    {
+        return lane_of(writer->getGuid()).add_old_sample(writer, change);
+    }
+
+    bool remove_change(
+            fastrtps::rtps::CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        assert(nullptr != change);
+        return lane_of(change->writerGUID).remove_change(change, max_blocking_time);
+    }
+
+    uint32_t get_max_payload() override
+    {
+        return lanes_[0]->get_max_payload();
+    }
+
+    void begin_batch(
+            fastrtps::rtps::RTPSWriter* writer,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        assert(nullptr != writer);
+        lane_of(writer->getGuid()).begin_batch(writer, max_blocking_time);
+    }
+
+    void end_batch(
+            fastrtps::rtps::RTPSWriter* writer) override
+    {
+        assert(nullptr != writer);
+        lane_of(writer->getGuid()).end_batch(writer);
+    }
+
+    // The destination limits are shared by all the lanes, so any of them can be used.
+
+    bool try_reserve_destination_bytes(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t bytes) override
+    {
+        return lanes_[0]->try_reserve_destination_bytes(destination, bytes);
+    }
+
+    bool try_reserve_participant_bytes(
+            fastrtps::rtps::RTPSWriter* writer,
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            uint32_t bytes) override
+    {
+        // The lane of the writer is the one to be woken up when the bucket is refilled.
+        assert(nullptr != writer);
+        return lane_of(writer->getGuid()).try_reserve_participant_bytes(writer, destination, bytes);
+    }
+
+    void refund_destination_bytes(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t bytes) override
+    {
+        lanes_[0]->refund_destination_bytes(destination, bytes);
+    }
+
+    void refund_participant_bytes(
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            uint32_t bytes) override
+    {
+        lanes_[0]->refund_participant_bytes(destination, bytes);
+    }
+
+    bool is_participant_rate_limited() const override
+    {
+        return lanes_[0]->is_participant_rate_limited();
+    }
+
+    void notify_destination_feedback(
+            const fastrtps::rtps::GUID_t& destination,
+            uint32_t lost_samples) override
+    {
+        lanes_[0]->notify_destination_feedback(destination, lost_samples);
+    }
+
+    void remove_destination(
+            const fastrtps::rtps::GUID_t& destination) override
+    {
+        lanes_[0]->remove_destination(destination);
+    }
+
+private:
+
+    //! Returns the lane managing the samples of a writer.
+    lane_type& lane_of(
+            const fastrtps::rtps::GUID_t& writer_guid)
+    {
+        const fastrtps::rtps::octet* key = writer_guid.entityId.value;
+        uint32_t entity_key = (static_cast<uint32_t>(key[0]) << 16) | (static_cast<uint32_t>(key[1]) << 8) | key[2];
+        return *lanes_[entity_key % lanes_.size()];
+    }
+
+    std::vector<std::unique_ptr<lane_type>> lanes_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _RTPS_FLOWCONTROL_FLOWCONTROLLERPOOL_HPP_
@@ -0,0 +1,219 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _RTPS_FLOWCONTROL_TOKENBUCKETRATELIMITER_HPP_
+#define _RTPS_FLOWCONTROL_TOKENBUCKETRATELIMITER_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerDestinationRateLimit.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Token buckets limiting the bytes sent to each remote participant.
+ *
+ * Buckets are refilled lazily when they are used. A bucket which was never used, or which has been removed, is
+ * equivalent to a full one, so only buckets holding less than burst_bytes need to be kept.
+ */
+class TokenBucketRateLimiter
+{
+public:
+
+    using clock = std::chrono::steady_clock;
+
+    /*!
+     * Wake-up time of a consumer of the buckets, such as a sender thread.
+     * Each consumer keeps its own, so a bucket refusing bytes only wakes up the consumer it refused.
+     * It is guarded by the mutex of the limiter.
+     */
+    struct Waiter
+    {
+        clock::time_point next_available = clock::time_point::max();
+    };
+
+    explicit TokenBucketRateLimiter(
+            const FlowControllerDestinationRateLimit& config)
+        : config_(config)
+    {
+        if (enabled())
+        {
+            config_.burst_bytes = (std::max)(config_.burst_bytes, 1u);
+        }
+    }
+
+    bool enabled() const
+    {
+        return 0 != config_.bytes_per_second;
+    }
+
+    /*!
+     * Takes bytes from the bucket of a remote participant.
+     *
+     * A full bucket always accepts the bytes, so samples bigger than the bucket still progress. The bucket then
+     * stays in debt until it is refilled.
+     *
+     * @param destination Prefix of the GUID of the remote participant.
+     * @param bytes Number of bytes about to be sent.
+     * @param waiter Consumer taking the bytes. When they are refused, it remembers when the bucket will accept them.
+     * @return true if the bytes can be sent. false if the bucket does not hold enough bytes.
+     */
+    bool try_consume(
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            uint32_t bytes,
+            Waiter& waiter)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        clock::time_point now = clock::now();
+        Bucket& bucket = find_or_create_nts(destination, now);
+        refill_nts(bucket, now);
+
+        if (bucket.tokens < bytes && bucket.tokens < config_.burst_bytes)
+        {
+            // Remember when this bucket will be able to accept the bytes.
+            double missing = (std::min)(static_cast<double>(bytes), static_cast<double>(config_.burst_bytes)) -
+                    bucket.tokens;
+            clock::time_point available = now + std::chrono::duration_cast<clock::duration>(
+                std::chrono::duration<double>(missing / config_.bytes_per_second));
+            waiter.next_available = (std::min)(waiter.next_available, available);
+            return false;
+        }
+
+        bucket.tokens -= bytes;
+        return true;
+    }
+
+    /*!
+     * Gives back bytes taken with try_consume() which were not finally sent.
+     *
+     * @param destination Prefix of the GUID of the remote participant.
+     * @param bytes Number of bytes to give back.
+     */
+    void refund(
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            uint32_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = buckets_.find(destination);
+        if (buckets_.end() != it)
+        {
+            refill_nts(it->second, clock::now());
+            it->second.tokens = (std::min)(static_cast<double>(config_.burst_bytes), it->second.tokens + bytes);
+        }
+    }
+
+    /*!
+     * Forgets the bucket of a remote participant if it is full, as it would be recreated with the same state.
+     *
+     * @param destination Prefix of the GUID of the remote participant.
+     */
+    void release(
+            const fastrtps::rtps::GuidPrefix_t& destination)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = buckets_.find(destination);
+        if (buckets_.end() != it)
+        {
+            refill_nts(it->second, clock::now());
+            if (config_.burst_bytes <= it->second.tokens)
+            {
+                buckets_.erase(it);
+            }
+        }
+    }
+
+    //! Returns the bytes currently held by the bucket of a remote participant.
+    double tokens(
+            const fastrtps::rtps::GuidPrefix_t& destination)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = buckets_.find(destination);
+        if (buckets_.end() == it)
+        {
+            return config_.burst_bytes;
+        }
+        refill_nts(it->second, clock::now());
+        return it->second.tokens;
+    }
+
+    /*!
+     * Returns the earliest time point when a bucket which refused bytes to a consumer will be able to accept them,
+     * and forgets it.
+     *
+     * @param waiter Consumer the bytes were refused to.
+     * @return The time point, or clock::time_point::max() if no bucket refused bytes to the consumer since the last
+     * call.
+     */
+    clock::time_point next_available(
+            Waiter& waiter)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        clock::time_point ret = waiter.next_available;
+        waiter.next_available = clock::time_point::max();
+        return ret;
+    }
+
+private:
+
+    struct Bucket
+    {
+        double tokens = 0;
+        clock::time_point last_refill;
+    };
+
+    Bucket& find_or_create_nts(
+            const fastrtps::rtps::GuidPrefix_t& destination,
+            clock::time_point now)
+    {
+        auto ret = buckets_.emplace(destination, Bucket());
+        if (ret.second)
+        {
+            ret.first->second.tokens = config_.burst_bytes;
+            ret.first->second.last_refill = now;
+        }
+        return ret.first->second;
+    }
+
+    void refill_nts(
+            Bucket& bucket,
+            clock::time_point now)
+    {
+        if (now > bucket.last_refill)
+        {
+            double elapsed = std::chrono::duration<double>(now - bucket.last_refill).count();
+            bucket.tokens = (std::min)(static_cast<double>(config_.burst_bytes),
+                            bucket.tokens + elapsed * config_.bytes_per_second);
+            bucket.last_refill = now;
+        }
+    }
+
+    FlowControllerDestinationRateLimit config_;
+
+    std::map<fastrtps::rtps::GuidPrefix_t, Bucket> buckets_;
+
+    std::mutex mutex_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _RTPS_FLOWCONTROL_TOKENBUCKETRATELIMITER_HPP_
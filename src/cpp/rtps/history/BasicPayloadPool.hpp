@@ -94,6 +94,8 @@ private:
             case DYNAMIC_RESERVE_MEMORY_MODE:
                 return std::make_shared<detail::Impl<DYNAMIC_RESERVE_MEMORY_MODE>>();
             case DYNAMIC_REUSABLE_MEMORY_MODE:
+            // Payloads are owned by each change, so there are no free payloads to classify by size
+            case DYNAMIC_SIZE_CLASS_MEMORY_MODE:
                 return std::make_shared<detail::Impl<DYNAMIC_REUSABLE_MEMORY_MODE>>();
         }
 
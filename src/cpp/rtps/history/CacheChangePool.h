@@ -20,6 +20,7 @@
 #define RTPS_HISTORY_CACHECHANGEPOOL_H_
 
 #include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/history/IChangePool.h>
 #include <fastdds/rtps/resources/ResourceManagement.h>
 
@@ -89,6 +90,15 @@ public:
         return free_caches_.size();
     }
 
+    //!Get the memory held by the changes of the pool.
+    fastdds::rtps::MemoryUsage get_memory_usage() const
+    {
+        fastdds::rtps::MemoryUsage usage;
+        usage.reserved_bytes = all_caches_.size() * change_size();
+        usage.live_bytes = (all_caches_.size() - free_caches_.size()) * change_size();
+        return usage;
+    }
+
 protected:
 
     /**
@@ -110,6 +120,12 @@ protected:
         delete change;
     }
 
+    //! Size of the objects returned by create_change.
+    virtual size_t change_size() const
+    {
+        return sizeof(CacheChange_t);
+    }
+
 private:
 
     uint32_t current_pool_size_ = 0;
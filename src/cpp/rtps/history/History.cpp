@@ -240,6 +240,14 @@ History::const_iterator History::get_change_nts(
     return returned_value;
 }
 
+fastdds::rtps::MemoryUsage History::get_memory_usage_nts() const
+{
+    fastdds::rtps::MemoryUsage usage;
+    usage.live_bytes = m_changes.size() * sizeof(CacheChange_t*);
+    usage.reserved_bytes = m_changes.capacity() * sizeof(CacheChange_t*);
+    return usage;
+}
+
 bool History::get_earliest_change(
         CacheChange_t** change)
 {
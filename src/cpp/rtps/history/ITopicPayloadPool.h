@@ -19,6 +19,7 @@
 #ifndef RTPS_HISTORY_ITOPICPAYLOADPOOL_HPP
 #define RTPS_HISTORY_ITOPICPAYLOADPOOL_HPP
 
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <rtps/history/PoolConfig.h>
 
@@ -86,6 +87,11 @@ public:
      */
     virtual size_t payload_pool_available_size() const = 0;
 
+    /**
+     * @brief Get the memory held by the payloads of the pool.
+     */
+    virtual fastdds::rtps::MemoryUsage get_memory_usage() const = 0;
+
 };
 
 }  // namespace rtps
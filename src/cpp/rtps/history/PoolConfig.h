@@ -28,11 +28,26 @@ namespace rtps {
 
 struct BasicPoolConfig
 {
+    BasicPoolConfig() = default;
+
+    constexpr BasicPoolConfig(
+            MemoryManagementPolicy_t policy,
+            uint32_t payload_size,
+            int32_t node = -1) noexcept
+        : memory_policy(policy)
+        , payload_initial_size(payload_size)
+        , numa_node(node)
+    {
+    }
+
     //! Memory management policy.
     MemoryManagementPolicy_t memory_policy;
 
     //! Payload size when preallocating data.
     uint32_t payload_initial_size;
+
+    //! NUMA node where payloads are placed. Negative values leave the placement to the OS.
+    int32_t numa_node = -1;
 };
 
 struct PoolConfig : public BasicPoolConfig
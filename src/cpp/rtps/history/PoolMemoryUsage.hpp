@@ -0,0 +1,65 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PoolMemoryUsage.hpp
+ */
+
+#ifndef RTPS_HISTORY_POOLMEMORYUSAGE_HPP
+#define RTPS_HISTORY_POOLMEMORYUSAGE_HPP
+
+#include <memory>
+
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+#include <fastdds/rtps/history/IChangePool.h>
+#include <fastdds/rtps/history/IPayloadPool.h>
+
+#include <rtps/history/CacheChangePool.h>
+#include <rtps/history/ITopicPayloadPool.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Fill the pool related fields of the memory usage of an endpoint.
+ * Only the pools created by Fast DDS are accounted. Pools provided by the user are left at zero.
+ *
+ * @param [in]  change_pool   Pool of changes of the endpoint.
+ * @param [in]  payload_pool  Pool of payloads of the endpoint.
+ * @param [out] usage         Memory usage of the endpoint.
+ */
+inline void get_pools_memory_usage(
+        const std::shared_ptr<IChangePool>& change_pool,
+        const std::shared_ptr<IPayloadPool>& payload_pool,
+        fastdds::rtps::EndpointMemoryUsage& usage)
+{
+    const CacheChangePool* changes = dynamic_cast<const CacheChangePool*>(change_pool.get());
+    if (nullptr != changes)
+    {
+        usage.change_pool = changes->get_memory_usage();
+    }
+
+    const ITopicPayloadPool* payloads = dynamic_cast<const ITopicPayloadPool*>(payload_pool.get());
+    if (nullptr != payloads)
+    {
+        usage.payload_pool = payloads->get_memory_usage();
+    }
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_HISTORY_POOLMEMORYUSAGE_HPP
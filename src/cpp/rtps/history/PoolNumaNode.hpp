@@ -0,0 +1,83 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PoolNumaNode.hpp
+ */
+
+#ifndef RTPS_HISTORY_POOLNUMANODE_HPP
+#define RTPS_HISTORY_POOLNUMANODE_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Name of the endpoint property selecting the NUMA node of the payload pool.
+static constexpr const char* pool_numa_node_property = "fastdds.memory.numa_node";
+
+/**
+ * Get the NUMA node where the payloads of an endpoint should be placed.
+ *
+ * The node is configured with the @c fastdds.memory.numa_node property:
+ * @li A node number places the payloads on that node.
+ * @li @c consumer places them on the node of the first processor in the affinity of the thread consuming the
+ *     payloads. When that thread has no affinity, the node of the calling thread is used.
+ *
+ * @param [in] properties       Properties of the endpoint.
+ * @param [in] consumer_thread  Settings of the thread that will consume the payloads.
+ *
+ * @return The NUMA node, or -1 to leave the placement to the OS.
+ */
+inline int32_t get_pool_numa_node(
+        const PropertyPolicy& properties,
+        const fastdds::rtps::ThreadSettings& consumer_thread)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(properties, pool_numa_node_property);
+    if (nullptr == property)
+    {
+        return -1;
+    }
+
+    if ("consumer" == *property)
+    {
+        int32_t node = get_numa_node_of_affinity(consumer_thread.affinity);
+        return 0 <= node ? node : get_numa_node_of_current_thread();
+    }
+
+    char* ptr = nullptr;
+    long value = strtol(property->c_str(), &ptr, 10);
+    if (property->c_str() == ptr || '\0' != *ptr || 0 > value || 63 < value)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_HISTORY, "Not valid value for " << pool_numa_node_property << " property");
+        return -1;
+    }
+
+    return static_cast<int32_t>(value);
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_HISTORY_POOLNUMANODE_HPP
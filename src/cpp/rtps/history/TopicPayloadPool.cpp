@@ -23,6 +23,7 @@
 #include "./TopicPayloadPool_impl/PreallocatedWithRealloc.hpp"
 #include "./TopicPayloadPool_impl/Dynamic.hpp"
 #include "./TopicPayloadPool_impl/DynamicReusable.hpp"
+#include "./TopicPayloadPool_impl/DynamicSizeClass.hpp"
 
 #include <memory>
 
@@ -66,6 +67,7 @@ bool TopicPayloadPool::do_get_payload(
     // Resize if needed
     if (resizeable && size > payload->data_size())
     {
+        size_t previous_size = payload->allocated_size();
         if (!payload->resize(size))
         {
             // Failed to resize, but we can still keep it for later.
@@ -78,8 +80,17 @@ bool TopicPayloadPool::do_get_payload(
             cache_change.payload_owner(nullptr);
             return false;
         }
+
+        reserved_bytes_.fetch_add(payload->allocated_size() - previous_size, std::memory_order_relaxed);
+
+        // realloc may have moved the payload to memory of another node
+        if (0 <= numa_node_)
+        {
+            payload->bind_to_numa_node(numa_node_);
+        }
     }
 
+    live_bytes_.fetch_add(payload->allocated_size(), std::memory_order_relaxed);
     lock.unlock();
     payload->reference();
     cache_change.serializedPayload.data = payload->data();
@@ -140,6 +151,7 @@ bool TopicPayloadPool::release_payload(
     {
         std::lock_guard<std::mutex> lock(mutex_);
         PayloadNode* payload = all_payloads_.at(PayloadNode::data_index(cache_change.serializedPayload.data));
+        live_bytes_.fetch_sub(payload->allocated_size(), std::memory_order_relaxed);
         free_payloads_.push_back(payload);
     }
 
@@ -189,10 +201,16 @@ TopicPayloadPool::PayloadNode* TopicPayloadPool::allocate(
 TopicPayloadPool::PayloadNode* TopicPayloadPool::do_allocate(
         uint32_t size)
 {
-    PayloadNode* payload = new (std::nothrow) PayloadNode(size);
+    PayloadNode* payload = new (std::nothrow) PayloadNode(size, numa_alignment_);
 
     if (payload != nullptr)
     {
+        if (0 <= numa_node_)
+        {
+            payload->bind_to_numa_node(numa_node_);
+        }
+
+        reserved_bytes_.fetch_add(payload->allocated_size(), std::memory_order_relaxed);
         payload->data_index(static_cast<uint32_t>(all_payloads_.size()));
         all_payloads_.push_back(payload);
     }
@@ -273,6 +291,7 @@ bool TopicPayloadPool::shrink (
         all_payloads_.at(payload->data_index()) = all_payloads_.back();
         all_payloads_.back()->data_index(payload->data_index());
         all_payloads_.pop_back();
+        reserved_bytes_.fetch_sub(payload->allocated_size(), std::memory_order_relaxed);
         delete payload;
     }
 
@@ -287,7 +306,7 @@ std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
         return nullptr;
     }
 
-    ITopicPayloadPool* ret_val = nullptr;
+    TopicPayloadPool* ret_val = nullptr;
 
     switch (config.memory_policy)
     {
@@ -303,6 +322,17 @@ std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
         case DYNAMIC_REUSABLE_MEMORY_MODE:
             ret_val = new DynamicReusableTopicPayloadPool();
             break;
+        case DYNAMIC_SIZE_CLASS_MEMORY_MODE:
+            ret_val = new DynamicSizeClassTopicPayloadPool();
+            break;
+    }
+
+    if (nullptr != ret_val)
+    {
+        ret_val->numa_node_ = config.numa_node;
+
+        // Payloads are only bound when they cover whole pages
+        ret_val->numa_alignment_ = 0 <= config.numa_node ? get_numa_binding_granularity() : 0;
     }
 
     return std::unique_ptr<ITopicPayloadPool>(ret_val);
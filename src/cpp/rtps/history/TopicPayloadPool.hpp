@@ -19,12 +19,14 @@
 #ifndef RTPS_HISTORY_TOPICPAYLOADPOOL_HPP
 #define RTPS_HISTORY_TOPICPAYLOADPOOL_HPP
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <fastdds/rtps/resources/ResourceManagement.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <rtps/history/PoolConfig.h>
 #include <rtps/history/ITopicPayloadPool.h>
+#include <utils/threading.hpp>
 
 #include <atomic>
 #include <cstddef>
@@ -127,6 +129,14 @@ public:
         return free_payloads_.size();
     }
 
+    fastdds::rtps::MemoryUsage get_memory_usage() const override
+    {
+        fastdds::rtps::MemoryUsage usage;
+        usage.live_bytes = live_bytes_.load(std::memory_order_relaxed);
+        usage.reserved_bytes = reserved_bytes_.load(std::memory_order_relaxed);
+        return usage;
+    }
+
     static std::unique_ptr<ITopicPayloadPool> get(
             const BasicPoolConfig& config);
 
@@ -136,10 +146,21 @@ protected:
     {
     public:
 
+        /**
+         * @param size       Size of the payload data.
+         * @param alignment  When not 0, the node is placed on whole blocks of this size, so it can be bound to a
+         *                   NUMA node.
+         */
         explicit PayloadNode(
-                uint32_t size)
+                uint32_t size,
+                size_t alignment = 0)
+            : alignment_(alignment)
         {
-            if (!size)
+            if (0 != alignment_)
+            {
+                buffer = allocate_aligned(size + data_offset);
+            }
+            else if (!size)
             {
                 //! At least, we need this to allocate space for a NodeInfo.
                 //! In order to be able to place-construct later
@@ -163,7 +184,7 @@ protected:
         ~PayloadNode()
         {
             info().~NodeInfo();
-            free(buffer);
+            free(0 != alignment_ ? raw_buffer_ : buffer);
         }
 
         bool resize (
@@ -171,6 +192,24 @@ protected:
         {
             assert(size > data_size());
 
+            if (0 != alignment_)
+            {
+                // realloc does not keep the alignment
+                octet* old_buffer = buffer;
+                octet* old_raw_buffer = raw_buffer_;
+                buffer = allocate_aligned(size + data_offset);
+                if (!buffer)
+                {
+                    buffer = old_buffer;
+                    raw_buffer_ = old_raw_buffer;
+                    return false;
+                }
+                memcpy(buffer, old_buffer, allocated_size(old_buffer + data_offset));
+                free(old_raw_buffer);
+                data_size(size);
+                return true;
+            }
+
             octet* old_buffer = buffer;
             buffer = (octet*)realloc(buffer, size + data_offset);
             if (!buffer)
@@ -183,6 +222,31 @@ protected:
             return true;
         }
 
+        //! Bytes allocated for the payload, including its metadata.
+        size_t allocated_size() const
+        {
+            return data_offset + data_size();
+        }
+
+        static size_t allocated_size(
+                octet* data)
+        {
+            return data_offset + data_size(data);
+        }
+
+        void bind_to_numa_node(
+                int32_t numa_node)
+        {
+            if (0 != alignment_)
+            {
+                bind_memory_to_numa_node(buffer, aligned_size(allocated_size()), numa_node);
+            }
+            else
+            {
+                bind_memory_to_numa_node(buffer + data_offset, data_size(), numa_node);
+            }
+        }
+
         uint32_t data_size() const
         {
             return info().data_size;
@@ -256,6 +320,32 @@ protected:
 
         octet* buffer = nullptr;
 
+        //! Allocated block holding an aligned buffer.
+        octet* raw_buffer_ = nullptr;
+
+        //! Alignment of the buffer, 0 when it is not aligned.
+        size_t alignment_ = 0;
+
+        size_t aligned_size(
+                size_t size) const
+        {
+            return (size + alignment_ - 1) & ~(alignment_ - 1);
+        }
+
+        //! Allocate a zeroed buffer on whole aligned blocks, keeping the allocated block on raw_buffer_.
+        octet* allocate_aligned(
+                size_t size)
+        {
+            raw_buffer_ = (octet*)calloc(aligned_size(size) + alignment_, sizeof(octet));
+            if (nullptr == raw_buffer_)
+            {
+                return nullptr;
+            }
+
+            uintptr_t address = reinterpret_cast<uintptr_t>(raw_buffer_);
+            return reinterpret_cast<octet*>(aligned_size(address));
+        }
+
         // Payload data comes after the metadata
         static constexpr size_t data_offset = offsetof(NodeInfo, data);
 
@@ -360,6 +450,12 @@ protected:
 
     std::mutex mutex_;
 
+    int32_t numa_node_ = -1;  //< NUMA node where payloads are placed, -1 to leave it to the OS
+    size_t numa_alignment_ = 0;  //< Alignment of the payloads bound to a NUMA node, 0 when they are not bound
+
+    std::atomic<uint64_t> live_bytes_{0};      //< Bytes of the payloads given to a change
+    std::atomic<uint64_t> reserved_bytes_{0};  //< Bytes of all the payloads
+
 };
 
 
@@ -19,6 +19,7 @@
 #ifndef RTPS_HISTORY_TOPICPAYLOADPOOLREGISTRY_IMPL_TOPICPAYLOADPOOLREGISTRY_HPP
 #define RTPS_HISTORY_TOPICPAYLOADPOOLREGISTRY_IMPL_TOPICPAYLOADPOOLREGISTRY_HPP
 
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -53,19 +54,24 @@ public:
         auto it = pool_map_.find(topic_name);
         if (it == pool_map_.end())
         {
-            it = pool_map_.emplace(topic_name, TopicPayloadPoolRegistryEntry()).first;
+            it = pool_map_.emplace(topic_name, NumaNodeEntries()).first;
         }
 
+        // Each NUMA node has its own set of pools, so payloads are not shared between nodes
+        TopicPayloadPoolRegistryEntry& entry = it->second[config.numa_node < 0 ? -1 : config.numa_node];
+
         switch (config.memory_policy)
         {
             case PREALLOCATED_MEMORY_MODE:
-                return do_get(it->second.pool_for_preallocated, topic_name, config);
+                return do_get(entry.pool_for_preallocated, topic_name, config);
             case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
-                return do_get(it->second.pool_for_preallocated_realloc, topic_name, config);
+                return do_get(entry.pool_for_preallocated_realloc, topic_name, config);
             case DYNAMIC_RESERVE_MEMORY_MODE:
-                return do_get(it->second.pool_for_dynamic, topic_name, config);
+                return do_get(entry.pool_for_dynamic, topic_name, config);
             case DYNAMIC_REUSABLE_MEMORY_MODE:
-                return do_get(it->second.pool_for_dynamic_reusable, topic_name, config);
+                return do_get(entry.pool_for_dynamic_reusable, topic_name, config);
+            case DYNAMIC_SIZE_CLASS_MEMORY_MODE:
+                return do_get(entry.pool_for_dynamic_size_class, topic_name, config);
         }
 
         return nullptr;
@@ -88,8 +94,10 @@ private:
         return ptr.lock();
     }
 
+    using NumaNodeEntries = std::map<int32_t, TopicPayloadPoolRegistryEntry>;
+
     std::mutex mutex_;
-    std::unordered_map<std::string, TopicPayloadPoolRegistryEntry> pool_map_;
+    std::unordered_map<std::string, NumaNodeEntries> pool_map_;
 
 };
 
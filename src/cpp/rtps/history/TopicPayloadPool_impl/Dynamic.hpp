@@ -52,6 +52,8 @@ public:
                 all_payloads_.back()->data_index(data_index);
                 all_payloads_.pop_back();
                 lock.unlock();
+                live_bytes_.fetch_sub(payload->allocated_size(), std::memory_order_relaxed);
+                reserved_bytes_.fetch_sub(payload->allocated_size(), std::memory_order_relaxed);
 
                 // Now delete the data
                 delete(payload);
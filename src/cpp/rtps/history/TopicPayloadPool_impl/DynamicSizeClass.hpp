@@ -0,0 +1,199 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DynamicSizeClass.hpp
+ */
+
+#ifndef RTPS_HISTORY_TOPICPAYLOADPOOLIMPL_DYNAMIC_SIZE_CLASS_HPP
+#define RTPS_HISTORY_TOPICPAYLOADPOOLIMPL_DYNAMIC_SIZE_CLASS_HPP
+
+#include <rtps/history/TopicPayloadPool.hpp>
+
+#include <array>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Payloads are allocated with the power of two size closest to the requested size, and each size class keeps
+ * its own list of free payloads.
+ * A released payload is only reused for samples of its own size class, so a few large samples do not bloat the
+ * payloads used by the small ones.
+ * When the pool reaches its maximum size, a free payload of another size class is freed to make room.
+ */
+class DynamicSizeClassTopicPayloadPool : public TopicPayloadPool
+{
+public:
+
+    //! Payloads have at least 2^min_size_class_bits bytes.
+    static constexpr uint32_t min_size_class_bits = 6;
+
+    //! Size classes from 2^min_size_class_bits to 2^31 bytes. Larger requests use the last class.
+    static constexpr uint32_t num_size_classes = 32 - min_size_class_bits;
+
+    bool get_payload(
+            uint32_t size,
+            CacheChange_t& cache_change) override
+    {
+        uint32_t size_class = get_size_class(size);
+        PayloadNode* payload = nullptr;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        std::vector<PayloadNode*>& free_list = free_by_size_class_[size_class];
+        if (!free_list.empty() && size <= free_list.back()->data_size())
+        {
+            payload = free_list.back();
+            free_list.pop_back();
+            --free_payloads_count_;
+        }
+        else
+        {
+            if (all_payloads_.size() >= max_pool_size_)
+            {
+                destroy_free_payload();
+            }
+
+            payload = allocate(std::max(size, get_size_class_size(size_class)));
+            if (payload == nullptr)
+            {
+                lock.unlock();
+                cache_change.serializedPayload.data = nullptr;
+                cache_change.serializedPayload.max_size = 0;
+                cache_change.payload_owner(nullptr);
+                return false;
+            }
+        }
+        live_bytes_.fetch_add(payload->allocated_size(), std::memory_order_relaxed);
+        lock.unlock();
+
+        payload->reference();
+        cache_change.serializedPayload.data = payload->data();
+        cache_change.serializedPayload.max_size = payload->data_size();
+        cache_change.payload_owner(this);
+
+        return true;
+    }
+
+    bool release_payload(
+            CacheChange_t& cache_change) override
+    {
+        assert(cache_change.payload_owner() == this);
+
+        if (PayloadNode::dereference(cache_change.serializedPayload.data))
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            PayloadNode* payload = all_payloads_.at(PayloadNode::data_index(cache_change.serializedPayload.data));
+            live_bytes_.fetch_sub(payload->allocated_size(), std::memory_order_relaxed);
+            free_by_size_class_[get_size_class(payload->data_size())].push_back(payload);
+            ++free_payloads_count_;
+        }
+
+        cache_change.serializedPayload.length = 0;
+        cache_change.serializedPayload.pos = 0;
+        cache_change.serializedPayload.max_size = 0;
+        cache_change.serializedPayload.data = nullptr;
+        cache_change.payload_owner(nullptr);
+        return true;
+    }
+
+    bool release_history(
+            const PoolConfig& config,
+            bool /*is_reader*/) override
+    {
+        assert(config.memory_policy == memory_policy());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        update_maximum_size(config, false);
+
+        while (max_pool_size_ < all_payloads_.size() && destroy_free_payload())
+        {
+        }
+
+        return true;
+    }
+
+    size_t payload_pool_available_size() const override
+    {
+        return free_payloads_count_;
+    }
+
+    //! Size class used for payloads of the given size.
+    static uint32_t get_size_class(
+            uint32_t size)
+    {
+        uint32_t bits = min_size_class_bits;
+        while (bits < 31 && (1u << bits) < size)
+        {
+            ++bits;
+        }
+        return bits - min_size_class_bits;
+    }
+
+    //! Size of the payloads on a size class.
+    static uint32_t get_size_class_size(
+            uint32_t size_class)
+    {
+        return 1u << (size_class + min_size_class_bits);
+    }
+
+protected:
+
+    MemoryManagementPolicy_t memory_policy() const override
+    {
+        return DYNAMIC_SIZE_CLASS_MEMORY_MODE;
+    }
+
+private:
+
+    using TopicPayloadPool::get_payload;
+
+    /**
+     * Frees one of the free payloads, starting from the largest size class.
+     *
+     * @return false if there were no free payloads.
+     */
+    bool destroy_free_payload()
+    {
+        for (auto it = free_by_size_class_.rbegin(); it != free_by_size_class_.rend(); ++it)
+        {
+            if (!it->empty())
+            {
+                PayloadNode* payload = it->back();
+                it->pop_back();
+                --free_payloads_count_;
+
+                all_payloads_.at(payload->data_index()) = all_payloads_.back();
+                all_payloads_.back()->data_index(payload->data_index());
+                all_payloads_.pop_back();
+                reserved_bytes_.fetch_sub(payload->allocated_size(), std::memory_order_relaxed);
+                delete payload;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::array<std::vector<PayloadNode*>, num_size_classes> free_by_size_class_;
+
+    size_t free_payloads_count_ = 0;
+};
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_HISTORY_TOPICPAYLOADPOOLIMPL_DYNAMIC_SIZE_CLASS_HPP
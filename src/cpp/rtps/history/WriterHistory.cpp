@@ -61,6 +61,34 @@ bool WriterHistory::add_change(
 bool WriterHistory::prepare_and_add_change(
         CacheChange_t* a_change,
         WriteParams& wparams)
+{
+    if (m_isHistoryFull)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_WRITER_HISTORY, "History full for writer " << a_change->writerGUID);
+        return false;
+    }
+
+    if (!prepare_change(a_change, wparams))
+    {
+        return false;
+    }
+
+    m_changes.push_back(a_change);
+
+    if (static_cast<int32_t>(m_changes.size()) == m_att.maximumReservedCaches)
+    {
+        m_isHistoryFull = true;
+    }
+
+    EPROSIMA_LOG_INFO(RTPS_WRITER_HISTORY,
+            "Change " << a_change->sequenceNumber << " added with " << a_change->serializedPayload.length << " bytes");
+
+    return true;
+}
+
+bool WriterHistory::prepare_change(
+        CacheChange_t* a_change,
+        WriteParams& wparams)
 {
     if (a_change->writerGUID != mp_writer->getGuid())
     {
@@ -78,12 +106,6 @@ bool WriterHistory::prepare_and_add_change(
         return false;
     }
 
-    if (m_isHistoryFull)
-    {
-        EPROSIMA_LOG_WARNING(RTPS_WRITER_HISTORY, "History full for writer " << a_change->writerGUID);
-        return false;
-    }
-
     ++m_lastCacheChangeSeqNum;
     a_change->sequenceNumber = m_lastCacheChangeSeqNum;
     if (wparams.source_timestamp().seconds() < 0)
@@ -103,16 +125,6 @@ bool WriterHistory::prepare_and_add_change(
     wparams.related_sample_identity(wparams.sample_identity());
     set_fragments(a_change);
 
-    m_changes.push_back(a_change);
-
-    if (static_cast<int32_t>(m_changes.size()) == m_att.maximumReservedCaches)
-    {
-        m_isHistoryFull = true;
-    }
-
-    EPROSIMA_LOG_INFO(RTPS_WRITER_HISTORY,
-            "Change " << a_change->sequenceNumber << " added with " << a_change->serializedPayload.length << " bytes");
-
     return true;
 }
 
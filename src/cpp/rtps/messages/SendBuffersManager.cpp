@@ -55,6 +55,7 @@ void SendBuffersManager::init(
 #else
         advance *= 2;
 #endif // if HAVE_SECURITY
+        buffer_size_ = advance;
         size_t data_size = advance * (pool_.capacity() - n_created_);
         common_buffer_.assign(data_size, 0);
 
@@ -120,6 +121,15 @@ void SendBuffersManager::return_buffer(
     available_cv_.notify_one();
 }
 
+fastdds::rtps::MemoryUsage SendBuffersManager::get_memory_usage()
+{
+    std::lock_guard<TimedMutex> guard(mutex_);
+    fastdds::rtps::MemoryUsage usage;
+    usage.reserved_bytes = n_created_ * buffer_size_;
+    usage.live_bytes = (n_created_ - pool_.size()) * buffer_size_;
+    return usage;
+}
+
 void SendBuffersManager::add_one_buffer(
         const RTPSParticipantImpl* participant)
 {
@@ -128,6 +138,14 @@ void SendBuffersManager::add_one_buffer(
         participant->is_secure(),
 #endif // if HAVE_SECURITY
         participant->getMaxMessageSize(), participant->getGuid().guidPrefix);
+    if (0 == buffer_size_)
+    {
+#if HAVE_SECURITY
+        buffer_size_ = participant->getMaxMessageSize() * (participant->is_secure() ? 3u : 2u);
+#else
+        buffer_size_ = participant->getMaxMessageSize() * 2u;
+#endif // if HAVE_SECURITY
+    }
     pool_.emplace_back(new_item);
     ++n_created_;
 }
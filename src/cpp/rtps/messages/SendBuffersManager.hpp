@@ -22,6 +22,7 @@
 
 #include "RTPSMessageGroup_t.hpp"
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/utils/TimedMutex.hpp>
 #include <fastdds/utils/TimedConditionVariable.hpp>
 
@@ -82,6 +83,13 @@ public:
     void return_buffer(
             std::unique_ptr <RTPSMessageGroup_t>&& buffer);
 
+    /**
+     * Get the memory held by the buffers of the pool.
+     * Buffers taken from the pool are reported as live.
+     * @return Memory used by the send buffers.
+     */
+    fastdds::rtps::MemoryUsage get_memory_usage();
+
 private:
 
     void add_one_buffer(
@@ -95,6 +103,8 @@ private:
     std::vector<octet> common_buffer_;
     //!Creation counter
     std::size_t n_created_ = 0;
+    //!Bytes used by the data of each buffer
+    std::size_t buffer_size_ = 0;
     //!Whether we allow n_created_ to grow beyond the pool_ capacity.
     bool allow_growing_ = true;
     //!To wait for a buffer to be returned to the pool.
@@ -20,6 +20,7 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/LocatorList.hpp>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
 #include <fastdds/rtps/transport/TransportDescriptorInterface.h>
 #include <fastdds/utils/IPFinder.h>
 #include <fastdds/utils/IPLocator.h>
@@ -557,6 +558,21 @@ std::vector<TransportNetmaskFilterInfo> NetworkFactory::netmask_filter_info() co
     return ret;
 }
 
+uint64_t NetworkFactory::shared_memory_segments_size() const
+{
+    uint64_t ret = 0;
+    for (auto& transport : mRegisteredTransports)
+    {
+        auto shm_descriptor =
+                dynamic_cast<fastdds::rtps::SharedMemTransportDescriptor*>(transport->get_configuration());
+        if (nullptr != shm_descriptor)
+        {
+            ret += shm_descriptor->segment_size();
+        }
+    }
+    return ret;
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
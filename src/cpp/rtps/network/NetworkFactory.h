@@ -320,6 +320,11 @@ public:
      */
     std::vector<fastdds::rtps::TransportNetmaskFilterInfo> netmask_filter_info() const;
 
+    /**
+     * Returns the size of the shared memory segments of the registered transports.
+     */
+    uint64_t shared_memory_segments_size() const;
+
     /**
      * Calculate well-known ports.
      */
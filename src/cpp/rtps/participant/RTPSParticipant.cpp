@@ -140,6 +140,12 @@ ResourceEvent& RTPSParticipant::get_resource_event() const
     return mp_impl->getEventResource();
 }
 
+ResourceEvent& RTPSParticipant::get_resource_event(
+        const GUID_t& entity_guid) const
+{
+    return mp_impl->getEventResource(entity_guid);
+}
+
 WLP* RTPSParticipant::wlp() const
 {
     return mp_impl->wlp();
@@ -196,6 +202,18 @@ std::vector<fastdds::rtps::TransportNetmaskFilterInfo> RTPSParticipant::get_netm
     return mp_impl->get_netmask_filter_info();
 }
 
+fastdds::rtps::MemoryUsage RTPSParticipant::get_transport_memory_usage() const
+{
+    return mp_impl->get_transport_memory_usage();
+}
+
+bool RTPSParticipant::get_flow_controller_statistics(
+        const std::string& flow_controller_name,
+        fastdds::rtps::FlowControllerStatistics& statistics) const
+{
+    return mp_impl->get_flow_controller_statistics(flow_controller_name, statistics);
+}
+
 #if HAVE_SECURITY
 
 bool RTPSParticipant::is_security_enabled_for_writer(
@@ -436,6 +436,18 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     const fastdds::rtps::ThreadSettings& thr_config = m_att.timed_events_thread;
     mp_event_thr.init_thread(thr_config, "dds.ev.%u", id_for_thread);
 
+    // Additional event threads where the events of user entities are distributed
+    for (uint32_t i = 1; i < m_att.timed_events_threads; ++i)
+    {
+        entity_event_thrs_.emplace_back(new ResourceEvent());
+        entity_event_thrs_.back()->init_thread(thr_config, "dds.ev.%u.%u", id_for_thread, i);
+    }
+
+    if (HeartbeatScheduler::enabled_by_properties(m_att.properties))
+    {
+        heartbeat_scheduler_.reset(new HeartbeatScheduler(this, mp_event_thr));
+    }
+
     if (!networkFactoryHasRegisteredTransports())
     {
         return;
@@ -709,6 +721,10 @@ void RTPSParticipantImpl::disable()
     // Disabling event thread also disables participant announcement, so there is no need to call
     // stopRTPSParticipantAnnouncement()
     mp_event_thr.stop_thread();
+    for (auto& event_thr : entity_event_thrs_)
+    {
+        event_thr->stop_thread();
+    }
 
     // Disable Retries on Transports
     m_network_Factory.Shutdown();
@@ -2529,10 +2545,10 @@ IPersistenceService* RTPSParticipantImpl::get_persistence_service(
 {
     IPersistenceService* ret_val;
 
-    ret_val = PersistenceFactory::create_persistence_service(param.properties);
+    ret_val = PersistenceFactory::create_persistence_service(param.properties, m_att.persistence_thread);
     return ret_val != nullptr ?
            ret_val :
-           PersistenceFactory::create_persistence_service(m_att.properties);
+           PersistenceFactory::create_persistence_service(m_att.properties, m_att.persistence_thread);
 }
 
 bool RTPSParticipantImpl::get_persistence_service(
@@ -2905,6 +2921,24 @@ std::vector<fastdds::rtps::TransportNetmaskFilterInfo> RTPSParticipantImpl::get_
     return m_network_Factory.netmask_filter_info();
 }
 
+fastdds::rtps::MemoryUsage RTPSParticipantImpl::get_transport_memory_usage()
+{
+    fastdds::rtps::MemoryUsage usage = send_buffers_->get_memory_usage();
+
+    uint64_t reception_bytes = m_network_Factory.shared_memory_segments_size();
+    {
+        std::lock_guard<std::mutex> guard(m_receiverResourcelistMutex);
+        for (const ReceiverControlBlock& block : m_receiverResourcelist)
+        {
+            reception_bytes += block.Receiver->max_message_size();
+        }
+    }
+    usage.live_bytes += reception_bytes;
+    usage.reserved_bytes += reception_bytes;
+
+    return usage;
+}
+
 #ifdef FASTDDS_STATISTICS
 
 bool RTPSParticipantImpl::register_in_writer(
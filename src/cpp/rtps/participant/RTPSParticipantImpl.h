@@ -25,9 +25,11 @@
 #include <cstdio>
 #include <cstdlib>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <sys/types.h>
+#include <vector>
 
 #if defined(_WIN32)
 #include <process.h>
@@ -52,6 +54,7 @@
 #include <rtps/messages/SendBuffersManager.hpp>
 #include <rtps/network/NetworkFactory.h>
 #include <rtps/network/ReceiverResource.h>
+#include <rtps/writer/HeartbeatScheduler.hpp>
 #include <statistics/rtps/monitor-service/interfaces/IConnectionsObserver.hpp>
 #include <statistics/rtps/monitor-service/interfaces/IConnectionsQueryable.hpp>
 #include <statistics/rtps/StatisticsBase.hpp>
@@ -272,6 +275,39 @@ public:
         return mp_event_thr;
     }
 
+    /**
+     * Get the event resource running the timed events owned by an entity.
+     * Events of user entities are distributed among the event threads configured with
+     * RTPSParticipantAttributes::timed_events_threads, always running all the events of an entity on the same
+     * thread.
+     * Events of builtin entities run on the main event thread.
+     *
+     * @param entity_guid GUID of the entity owning the events.
+     */
+    ResourceEvent& getEventResource(
+            const GUID_t& entity_guid)
+    {
+        if (entity_event_thrs_.empty() || entity_guid.is_builtin())
+        {
+            return mp_event_thr;
+        }
+
+        const octet* key = entity_guid.entityId.value;
+        uint32_t index = ((key[0] << 16) | (key[1] << 8) | key[2]) % (entity_event_thrs_.size() + 1);
+        return 0 == index ? mp_event_thr : *entity_event_thrs_[index - 1];
+    }
+
+    /**
+     * Get the scheduler sending the periodic heartbeats of the user writers together.
+     *
+     * @return Pointer to the scheduler, or nullptr when it is not enabled with the fastdds.heartbeat_coalescing
+     * property.
+     */
+    HeartbeatScheduler* heartbeat_scheduler()
+    {
+        return heartbeat_scheduler_.get();
+    }
+
     /**
      * Send a message to several locations
      * @param msg Message to send.
@@ -561,6 +597,10 @@ private:
     GUID_t m_persistence_guid;
     //! Event Resource
     ResourceEvent mp_event_thr;
+    //! Additional event resources for the events of user entities
+    std::vector<std::unique_ptr<ResourceEvent>> entity_event_thrs_;
+    //! Scheduler of the periodic heartbeats of the user writers, when they are coalesced
+    std::unique_ptr<HeartbeatScheduler> heartbeat_scheduler_;
     //! BuiltinProtocols of this RTPSParticipant
     BuiltinProtocols* mp_builtinProtocols;
     //!Id counter to correctly assign the ids to writers and readers.
@@ -1123,6 +1163,27 @@ public:
      */
     std::vector<fastdds::rtps::TransportNetmaskFilterInfo> get_netmask_filter_info() const;
 
+    /**
+     * @brief Returns the memory held by the send and receive buffers of the registered transports.
+     *
+     * @return Memory used by the transport buffers, including the shared memory segments.
+     */
+    fastdds::rtps::MemoryUsage get_transport_memory_usage();
+
+    /**
+     * @brief Get the counters of a flow controller of this participant.
+     *
+     * @param flow_controller_name Name of the flow controller.
+     * @param [out] statistics Counters of the flow controller.
+     * @return true if the flow controller exists and keeps counters, false otherwise.
+     */
+    bool get_flow_controller_statistics(
+            const std::string& flow_controller_name,
+            fastdds::rtps::FlowControllerStatistics& statistics) const
+    {
+        return flow_controller_factory_.get_flow_controller_statistics(flow_controller_name, statistics);
+    }
+
     template <EndpointKind_t kind, octet no_key, octet with_key>
     static bool preprocess_endpoint_attributes(
             const EntityId_t& entity_id,
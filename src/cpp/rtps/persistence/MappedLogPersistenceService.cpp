@@ -0,0 +1,1024 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MappedLogPersistenceService.cpp
+ *
+ */
+
+#include <rtps/persistence/MappedLogPersistenceService.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif // ifdef __linux__
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/history/WriterHistory.h>
+
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+namespace {
+
+constexpr uint32_t segment_magic = 0x4C534446; // "FDSL"
+constexpr uint32_t record_magic = 0x52534446;  // "FDSR"
+constexpr uint32_t log_version = 1;
+
+struct SegmentHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t index;
+};
+
+enum RecordKind : uint32_t
+{
+    ADD_WRITER_CHANGE = 1,
+    REMOVE_WRITER_CHANGE = 2,
+    //! Last sequence number of a writer, kept when the record of its last change is compacted away.
+    WRITER_LAST_SEQ = 3,
+    READER_SEQ = 4
+};
+
+/**
+ * Header of each record. The payload of a change, if any, follows it.
+ * The magic is written last, so a record being written when the process crashes is ignored on recovery.
+ */
+struct RecordHeader
+{
+    uint32_t magic;
+    uint32_t kind;
+    //! Size of the record, including header, payload and padding.
+    uint32_t size;
+    uint32_t payload_length;
+    uint64_t seq_num;
+    //! GUID of the related sample identity of a change, or GUID of the writer for READER_SEQ.
+    octet guid[16];
+    uint64_t related_seq_num;
+    int64_t source_timestamp;
+    octet instance[16];
+};
+
+static_assert(0 == sizeof(RecordHeader) % 8, "Records should be 8 bytes aligned");
+
+uint32_t record_size(
+        uint32_t payload_length)
+{
+    return (static_cast<uint32_t>(sizeof(RecordHeader)) + payload_length + 7u) & ~7u;
+}
+
+void guid_to_raw(
+        const GUID_t& guid,
+        octet* raw)
+{
+    memcpy(raw, guid.guidPrefix.value, GuidPrefix_t::size);
+    memcpy(raw + GuidPrefix_t::size, guid.entityId.value, EntityId_t::size);
+}
+
+GUID_t raw_to_guid(
+        const octet* raw)
+{
+    GUID_t guid;
+    memcpy(guid.guidPrefix.value, raw, GuidPrefix_t::size);
+    memcpy(guid.entityId.value, raw + GuidPrefix_t::size, EntityId_t::size);
+    return guid;
+}
+
+bool file_exists(
+        const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    return file.good();
+}
+
+} // namespace
+
+class MappedLogPersistenceService::Log
+{
+public:
+
+    struct Segment
+    {
+        uint64_t index = 0;
+        std::string filename;
+        boost::interprocess::mapped_region region;
+        uint32_t size = 0;
+        //! Bytes used, including the segment header.
+        uint32_t used = 0;
+        //! Bytes of the records still referenced by the index.
+        uint32_t live = 0;
+
+        octet* data()
+        {
+            return static_cast<octet*>(region.get_address());
+        }
+
+    };
+
+    struct Location
+    {
+        Segment* segment;
+        uint32_t offset;
+    };
+
+    /**
+     * Record removing a change.
+     * It is kept alive while the removed change may still be on the log, so the change is not recovered again.
+     */
+    struct Removal
+    {
+        Location location;
+        //! Lowest index of the segments which may hold the removed change.
+        uint64_t first_change_index;
+        //! Highest index of the segments which may hold the removed change.
+        uint64_t last_change_index;
+    };
+
+    Log(
+            const std::string& base_name,
+            uint32_t segment_size,
+            bool sync_writes)
+        : base_name_(base_name)
+        , segment_size_(segment_size)
+        , sync_writes_(sync_writes)
+    {
+    }
+
+    ~Log()
+    {
+        if (sync_writes_)
+        {
+            return;
+        }
+
+        // Leave the data on disk when the service is closed, even if each record was not synced.
+        for (std::unique_ptr<Segment>& segment : segments_)
+        {
+            segment->region.flush(0, segment->used, false);
+        }
+    }
+
+    /**
+     * Map the segments of the log and build the index from their records.
+     * @return false if a segment could not be mapped or is corrupted.
+     */
+    bool open()
+    {
+        // The head holds the index of the first segment and the index following the last one. Segments between
+        // them may be missing, as any segment can be compacted.
+        uint64_t first_index = 0;
+        std::ifstream head(base_name_ + ".head");
+        if (!(head >> first_index))
+        {
+            first_index = 0;
+        }
+        if (!(head >> next_index_))
+        {
+            // Without the end index, the segments are expected to be contiguous.
+            next_index_ = first_index;
+            while (file_exists(segment_filename(next_index_)))
+            {
+                ++next_index_;
+            }
+        }
+
+        for (uint64_t index = first_index; index < next_index_; ++index)
+        {
+            std::string filename = segment_filename(index);
+            if (!file_exists(filename))
+            {
+                continue;
+            }
+
+            segments_.emplace_back(new Segment());
+            Segment* segment = segments_.back().get();
+            segment->index = index;
+            segment->filename = filename;
+
+            if (!map_segment(*segment))
+            {
+                return false;
+            }
+
+            const SegmentHeader* header = reinterpret_cast<const SegmentHeader*>(segment->data());
+            if (segment->size < sizeof(SegmentHeader) || segment_magic != header->magic ||
+                    log_version != header->version || segment->index != header->index)
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Corrupted persistence log segment " << segment->filename);
+                return false;
+            }
+
+            uint32_t offset = sizeof(SegmentHeader);
+            while (sizeof(RecordHeader) <= segment->size - offset)
+            {
+                const RecordHeader* record = reinterpret_cast<const RecordHeader*>(segment->data() + offset);
+                if (record_magic != record->magic || record_size(record->payload_length) != record->size ||
+                        record->size > segment->size - offset)
+                {
+                    break;
+                }
+
+                apply(*record, {segment, offset});
+                offset += record->size;
+            }
+            segment->used = offset;
+        }
+
+        return true;
+    }
+
+    /**
+     * Append a record to the log and update the index with it.
+     *
+     * @param [in,out] header   Header of the record. Its magic and size are filled by this method.
+     * @param [in]     payload  Payload of the record, with header.payload_length bytes.
+     *
+     * @return false if the record could not be stored.
+     */
+    bool append(
+            RecordHeader& header,
+            const octet* payload)
+    {
+        Location location;
+        if (!write(header, payload, location))
+        {
+            return false;
+        }
+        apply(header, location);
+        return true;
+    }
+
+    const RecordHeader& record(
+            const Location& location) const
+    {
+        return *reinterpret_cast<const RecordHeader*>(location.segment->data() + location.offset);
+    }
+
+    const octet* payload(
+            const Location& location) const
+    {
+        return location.segment->data() + location.offset + sizeof(RecordHeader);
+    }
+
+    //! Whether some segment has less than half of its records alive.
+    bool needs_compaction() const
+    {
+        return nullptr != compaction_victim();
+    }
+
+    /**
+     * Copy the live records of the segments with the lowest ratio of live records to the end of the log, and
+     * delete those segments.
+     */
+    void compact()
+    {
+        Segment* victim = nullptr;
+        while (nullptr != (victim = compaction_victim()))
+        {
+            std::vector<std::pair<Location*, Location>> moved;
+            bool copied = true;
+
+            for (auto it = changes.begin(); copied && it != changes.end(); ++it)
+            {
+                copied = victim != it->second.segment || move_record(it->second, moved);
+            }
+            for (auto it = reader_states.begin(); copied && it != reader_states.end(); ++it)
+            {
+                copied = victim != it->second.segment || move_record(it->second, moved);
+            }
+            for (auto it = removals.begin(); copied && it != removals.end(); ++it)
+            {
+                // A removal is no longer needed when the change it removes is on the victim as well.
+                copied = victim != it->location.segment ||
+                        (victim->index == it->first_change_index && victim->index == it->last_change_index) ||
+                        move_record(it->location, moved);
+            }
+
+            if (copied && 0 < last_seq_num)
+            {
+                RecordHeader header{};
+                header.kind = WRITER_LAST_SEQ;
+                header.seq_num = last_seq_num;
+                Location location;
+                copied = write(header, nullptr, location);
+            }
+
+            if (!copied)
+            {
+                // Leave the log as it was, so no record is duplicated.
+                undo_moves(moved);
+                return;
+            }
+
+            auto victim_it = std::find_if(segments_.begin(), segments_.end(),
+                            [victim](const std::unique_ptr<Segment>& segment)
+                            {
+                                return victim == segment.get();
+                            });
+            std::unique_ptr<Segment> victim_ptr = std::move(*victim_it);
+            segments_.erase(victim_it);
+
+            // The head is moved before deleting the segment, so a crash in between only leaves an orphan file.
+            if (!write_head(next_index_))
+            {
+                return;
+            }
+            std::remove(victim->filename.c_str());
+
+            release_removals_of(*victim);
+        }
+    }
+
+    std::mutex mutex;
+
+    //! Changes of a writer, by sequence number.
+    std::map<uint64_t, Location> changes;
+
+    //! Sequence numbers stored by a reader, by writer GUID.
+    std::map<GUID_t, Location> reader_states;
+
+    //! Removal records still needed.
+    std::vector<Removal> removals;
+
+    //! Last sequence number of a writer, 0 if none was ever stored.
+    uint64_t last_seq_num = 0;
+
+private:
+
+    std::string segment_filename(
+            uint64_t index) const
+    {
+        return base_name_ + "." + std::to_string(index) + ".log";
+    }
+
+    bool map_segment(
+            Segment& segment)
+    {
+        try
+        {
+            boost::interprocess::file_mapping mapping(segment.filename.c_str(), boost::interprocess::read_write);
+            boost::interprocess::mapped_region region(mapping, boost::interprocess::read_write);
+            segment.region.swap(region);
+            segment.size = static_cast<uint32_t>(segment.region.get_size());
+        }
+        catch (const boost::interprocess::interprocess_exception& e)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Could not map persistence log segment " << segment.filename
+                                                                                          << ": " << e.what());
+            return false;
+        }
+        return true;
+    }
+
+    //! Segment with the lowest ratio of live records, if it is below one half. The last segment is never chosen.
+    Segment* compaction_victim() const
+    {
+        Segment* victim = nullptr;
+        for (size_t i = 0; i + 1 < segments_.size(); ++i)
+        {
+            Segment* segment = segments_[i].get();
+            if (segment->live < (segment->used / 2) &&
+                    (nullptr == victim ||
+                    static_cast<uint64_t>(segment->live) * victim->used <
+                    static_cast<uint64_t>(victim->live) * segment->used))
+            {
+                victim = segment;
+            }
+        }
+        return victim;
+    }
+
+    /**
+     * Store the range of segments of the log.
+     * @param first_index  Index of the first segment, used when the log has no segments.
+     */
+    bool write_head(
+            uint64_t first_index)
+    {
+        if (!segments_.empty())
+        {
+            first_index = segments_.front()->index;
+        }
+        std::ofstream head(base_name_ + ".head", std::ios::trunc);
+        head << first_index << " " << next_index_;
+        head.flush();
+        if (!head)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Could not write head of persistence log " << base_name_);
+            return false;
+        }
+        return true;
+    }
+
+    bool allocate_file(
+            const std::string& filename,
+            uint32_t size)
+    {
+#ifdef __linux__
+        int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (-1 == fd)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Could not create persistence log segment " << filename);
+            return false;
+        }
+
+        int ret = posix_fallocate(fd, 0, static_cast<off_t>(size));
+        ::close(fd);
+        if (0 != ret)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Could not allocate " << size << " bytes for persistence log segment "
+                                                                       << filename << ": " << strerror(ret));
+            return false;
+        }
+#else
+        // Writing the zeros ensures the space is taken on the file systems which would leave a hole.
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        std::vector<char> zeros((std::min)(size, 64u * 1024u), '\0');
+        for (uint32_t written = 0; file && written < size; written += static_cast<uint32_t>(zeros.size()))
+        {
+            file.write(zeros.data(), (std::min)(static_cast<uint32_t>(zeros.size()), size - written));
+        }
+        file.flush();
+        if (!file)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Could not allocate " << size << " bytes for persistence log segment "
+                                                                       << filename);
+            return false;
+        }
+#endif // ifdef __linux__
+        return true;
+    }
+
+    Segment* create_segment(
+            uint32_t record_size)
+    {
+        uint32_t size = (std::max)(segment_size_, static_cast<uint32_t>(sizeof(SegmentHeader)) + record_size);
+        std::unique_ptr<Segment> segment(new Segment());
+        segment->index = next_index_;
+        segment->filename = segment_filename(next_index_);
+
+        // The head covers the new segment before it is created, so it is found on recovery.
+        ++next_index_;
+        if (!write_head(segment->index))
+        {
+            return nullptr;
+        }
+
+        // The whole segment is allocated now, as writing to a hole of the mapping on a full disk raises SIGBUS.
+        if (!allocate_file(segment->filename, size) || !map_segment(*segment))
+        {
+            std::remove(segment->filename.c_str());
+            return nullptr;
+        }
+
+        SegmentHeader* header = reinterpret_cast<SegmentHeader*>(segment->data());
+        header->magic = segment_magic;
+        header->version = log_version;
+        header->index = segment->index;
+        segment->used = sizeof(SegmentHeader);
+
+        segments_.push_back(std::move(segment));
+        return segments_.back().get();
+    }
+
+    bool write(
+            RecordHeader& header,
+            const octet* payload,
+            Location& location)
+    {
+        header.size = record_size(header.payload_length);
+
+        Segment* segment = segments_.empty() ? nullptr : segments_.back().get();
+        if (nullptr == segment || segment->size - segment->used < header.size)
+        {
+            segment = create_segment(header.size);
+            if (nullptr == segment)
+            {
+                return false;
+            }
+        }
+
+        octet* dst = segment->data() + segment->used;
+        if (0 < header.payload_length)
+        {
+            memcpy(dst + sizeof(RecordHeader), payload, header.payload_length);
+        }
+        header.magic = 0;
+        memcpy(dst, &header, sizeof(RecordHeader));
+        std::atomic_thread_fence(std::memory_order_release);
+        header.magic = record_magic;
+        reinterpret_cast<RecordHeader*>(dst)->magic = record_magic;
+
+        if (sync_writes_)
+        {
+            segment->region.flush(segment->used, header.size, false);
+        }
+
+        location = {segment, segment->used};
+        segment->used += header.size;
+        return true;
+    }
+
+    void release(
+            const Location& location)
+    {
+        location.segment->live -= record(location).size;
+    }
+
+    void apply(
+            const RecordHeader& header,
+            const Location& location)
+    {
+        switch (header.kind)
+        {
+            case ADD_WRITER_CHANGE:
+            {
+                auto it = changes.find(header.seq_num);
+                if (changes.end() != it)
+                {
+                    // Copy left by a compaction interrupted before deleting its segment.
+                    auto stale_it = stale_changes_.emplace(header.seq_num, it->second.segment->index).first;
+                    stale_it->second = (std::min)(stale_it->second, it->second.segment->index);
+                    release(it->second);
+                    it->second = location;
+                }
+                else
+                {
+                    changes.emplace(header.seq_num, location);
+                }
+                location.segment->live += header.size;
+                last_seq_num = (std::max)(last_seq_num, header.seq_num);
+                break;
+            }
+
+            case REMOVE_WRITER_CHANGE:
+            {
+                auto it = changes.find(header.seq_num);
+                if (changes.end() != it)
+                {
+                    Removal removal{location, it->second.segment->index, it->second.segment->index};
+                    auto stale_it = stale_changes_.find(header.seq_num);
+                    if (stale_changes_.end() != stale_it)
+                    {
+                        removal.first_change_index = (std::min)(removal.first_change_index, stale_it->second);
+                        stale_changes_.erase(stale_it);
+                    }
+                    removals.push_back(removal);
+                    location.segment->live += header.size;
+
+                    release(it->second);
+                    changes.erase(it);
+                }
+                break;
+            }
+
+            case WRITER_LAST_SEQ:
+                last_seq_num = (std::max)(last_seq_num, header.seq_num);
+                break;
+
+            case READER_SEQ:
+            {
+                GUID_t writer_guid = raw_to_guid(header.guid);
+                auto it = reader_states.find(writer_guid);
+                if (reader_states.end() != it)
+                {
+                    release(it->second);
+                    it->second = location;
+                }
+                else
+                {
+                    reader_states.emplace(writer_guid, location);
+                }
+                location.segment->live += header.size;
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    /**
+     * Copy a live record to the end of the log.
+     *
+     * @param [in,out] location  Location of the record, updated to its new location.
+     * @param [in,out] moved     Records moved, with their previous location, so the move can be undone.
+     *
+     * @return false if the record could not be copied.
+     */
+    bool move_record(
+            Location& location,
+            std::vector<std::pair<Location*, Location>>& moved)
+    {
+        RecordHeader header = record(location);
+        Location new_location;
+        if (!write(header, payload(location), new_location))
+        {
+            return false;
+        }
+        moved.emplace_back(&location, location);
+        release(location);
+        location = new_location;
+        location.segment->live += header.size;
+        return true;
+    }
+
+    //! Invalidate the copies made by move_record, and point the index back to the original records.
+    void undo_moves(
+            std::vector<std::pair<Location*, Location>>& moved)
+    {
+        for (auto it = moved.rbegin(); it != moved.rend(); ++it)
+        {
+            Location& location = *it->first;
+            uint32_t size = record(location).size;
+            RecordHeader* copy = reinterpret_cast<RecordHeader*>(location.segment->data() + location.offset);
+            copy->magic = 0;
+            if (sync_writes_)
+            {
+                location.segment->region.flush(location.offset, sizeof(RecordHeader), false);
+            }
+            location.segment->live -= size;
+            location.segment->used = location.offset;
+
+            location = it->second;
+            location.segment->live += size;
+        }
+    }
+
+    //! Drop the removal records which are no longer needed once a segment has been deleted.
+    void release_removals_of(
+            const Segment& deleted)
+    {
+        auto holds_change = [this](const Removal& removal)
+                {
+                    auto it = std::lower_bound(segments_.begin(), segments_.end(), removal.first_change_index,
+                                    [](const std::unique_ptr<Segment>& segment, uint64_t index)
+                                    {
+                                        return segment->index < index;
+                                    });
+                    return segments_.end() != it && (*it)->index <= removal.last_change_index;
+                };
+
+        removals.erase(std::remove_if(removals.begin(), removals.end(), [&](const Removal& removal)
+                {
+                    if (&deleted == removal.location.segment)
+                    {
+                        return true;
+                    }
+                    if (removal.first_change_index <= deleted.index && deleted.index <= removal.last_change_index &&
+                            !holds_change(removal))
+                    {
+                        release(removal.location);
+                        return true;
+                    }
+                    return false;
+                }), removals.end());
+    }
+
+    std::string base_name_;
+    uint32_t segment_size_;
+    bool sync_writes_;
+    uint64_t next_index_ = 0;
+    //! Segments of the log, ordered by index.
+    std::deque<std::unique_ptr<Segment>> segments_;
+    //! Lowest index of the segments holding a stale copy of a change, by sequence number.
+    std::map<uint64_t, uint64_t> stale_changes_;
+};
+
+MappedLogPersistenceService::MappedLogPersistenceService(
+        const std::string& filename,
+        uint32_t segment_size,
+        bool sync_writes,
+        const fastdds::rtps::ThreadSettings& thread_settings)
+    : filename_(filename)
+    , segment_size_(segment_size)
+    , sync_writes_(sync_writes)
+{
+    compaction_thread_ = create_thread([this]()
+                    {
+                        run_compaction();
+                    }, thread_settings, "dds.persist");
+}
+
+MappedLogPersistenceService::~MappedLogPersistenceService()
+{
+    {
+        std::lock_guard<std::mutex> guard(compaction_mutex_);
+        running_ = false;
+    }
+    compaction_cv_.notify_all();
+    compaction_thread_.join();
+}
+
+MappedLogPersistenceService::Log* MappedLogPersistenceService::get_log(
+        const std::string& guid)
+{
+    std::lock_guard<std::mutex> guard(logs_mutex_);
+    auto it = logs_.find(guid);
+    if (logs_.end() != it)
+    {
+        return it->second.get();
+    }
+
+    // GUIDs are written as "xx.xx...|xx.xx", so only the separator needs replacing to get a valid file name
+    std::string base_name = guid;
+    std::replace_if(base_name.begin(), base_name.end(), [](char c)
+            {
+                return !isalnum(static_cast<unsigned char>(c)) && '.' != c && '_' != c && '-' != c;
+            }, '_');
+    base_name = filename_ + "." + base_name;
+
+    std::unique_ptr<Log> log(new Log(base_name, segment_size_, sync_writes_));
+    if (!log->open())
+    {
+        return nullptr;
+    }
+    Log* ret = log.get();
+    logs_.emplace(guid, std::move(log));
+    return ret;
+}
+
+void MappedLogPersistenceService::request_compaction()
+{
+    {
+        std::lock_guard<std::mutex> guard(compaction_mutex_);
+        compaction_requested_ = true;
+    }
+    compaction_cv_.notify_one();
+}
+
+void MappedLogPersistenceService::run_compaction()
+{
+    std::unique_lock<std::mutex> lock(compaction_mutex_);
+    while (true)
+    {
+        compaction_cv_.wait(lock, [this]()
+                {
+                    return !running_ || compaction_requested_;
+                });
+        if (!running_)
+        {
+            break;
+        }
+        compaction_requested_ = false;
+        lock.unlock();
+
+        std::vector<Log*> logs;
+        {
+            std::lock_guard<std::mutex> guard(logs_mutex_);
+            for (auto& entry : logs_)
+            {
+                logs.push_back(entry.second.get());
+            }
+        }
+
+        for (Log* log : logs)
+        {
+            std::lock_guard<std::mutex> guard(log->mutex);
+            log->compact();
+        }
+
+        lock.lock();
+    }
+}
+
+bool MappedLogPersistenceService::load_writer_from_storage(
+        const std::string& persistence_guid,
+        const GUID_t& writer_guid,
+        WriterHistory* history,
+        const std::shared_ptr<IChangePool>& change_pool,
+        const std::shared_ptr<IPayloadPool>& payload_pool,
+        SequenceNumber_t& next_sequence)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
+
+    Log* log = get_log(persistence_guid);
+    if (nullptr == log)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(log->mutex);
+    std::vector<CacheChange_t*>& changes = get_changes(history);
+
+    for (const auto& entry : log->changes)
+    {
+        const RecordHeader& record = log->record(entry.second);
+        CacheChange_t* change = nullptr;
+
+        if (!change_pool->reserve_cache(change))
+        {
+            continue;
+        }
+
+        if (!payload_pool->get_payload(record.payload_length, *change))
+        {
+            change_pool->release_cache(change);
+            continue;
+        }
+
+        change->kind = ALIVE;
+        change->writerGUID = writer_guid;
+        memcpy(change->instanceHandle.value, record.instance, sizeof(record.instance));
+        change->sequenceNumber = SequenceNumber_t(record.seq_num);
+        change->serializedPayload.length = record.payload_length;
+        if (0 < record.payload_length)
+        {
+            memcpy(change->serializedPayload.data, log->payload(entry.second), record.payload_length);
+        }
+        change->writer_info.previous = nullptr;
+        change->writer_info.next = nullptr;
+        change->writer_info.num_sent_submessages = 0;
+        change->vendor_id = c_VendorId_eProsima;
+
+        auto& si = change->write_params.related_sample_identity();
+        si.writer_guid(raw_to_guid(record.guid));
+        si.sequence_number(SequenceNumber_t(record.related_seq_num));
+
+        change->sourceTimestamp.from_ns(record.source_timestamp);
+
+        set_fragments(history, change);
+
+        changes.push_back(change);
+    }
+
+    if (0 < log->last_seq_num)
+    {
+        next_sequence = SequenceNumber_t(log->last_seq_num);
+    }
+
+    return true;
+}
+
+bool MappedLogPersistenceService::add_writer_change_to_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
+
+    Log* log = get_log(persistence_guid);
+    if (nullptr == log)
+    {
+        return false;
+    }
+
+    RecordHeader header{};
+    header.kind = ADD_WRITER_CHANGE;
+    header.payload_length = change.serializedPayload.length;
+    header.seq_num = change.sequenceNumber.to64long();
+    const SampleIdentity& si = change.write_params.related_sample_identity();
+    guid_to_raw(si.writer_guid(), header.guid);
+    header.related_seq_num = si.sequence_number().to64long();
+    header.source_timestamp = change.sourceTimestamp.to_ns();
+    memcpy(header.instance, change.instanceHandle.value, sizeof(header.instance));
+
+    bool compaction_needed = false;
+    {
+        std::lock_guard<std::mutex> guard(log->mutex);
+        if (log->changes.end() != log->changes.find(header.seq_num))
+        {
+            // Same behavior as a primary key violation on other services
+            return false;
+        }
+        if (!log->append(header, change.serializedPayload.data))
+        {
+            return false;
+        }
+        compaction_needed = log->needs_compaction();
+    }
+
+    if (compaction_needed)
+    {
+        request_compaction();
+    }
+    return true;
+}
+
+bool MappedLogPersistenceService::remove_writer_change_from_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
+
+    Log* log = get_log(persistence_guid);
+    if (nullptr == log)
+    {
+        return false;
+    }
+
+    RecordHeader header{};
+    header.kind = REMOVE_WRITER_CHANGE;
+    header.seq_num = change.sequenceNumber.to64long();
+
+    bool compaction_needed = false;
+    {
+        std::lock_guard<std::mutex> guard(log->mutex);
+        if (log->changes.end() == log->changes.find(header.seq_num))
+        {
+            // Nothing to remove
+            return true;
+        }
+        if (!log->append(header, nullptr))
+        {
+            return false;
+        }
+        compaction_needed = log->needs_compaction();
+    }
+
+    if (compaction_needed)
+    {
+        request_compaction();
+    }
+    return true;
+}
+
+bool MappedLogPersistenceService::load_reader_from_storage(
+        const std::string& reader_guid,
+        foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t>& seq_map)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
+
+    Log* log = get_log(reader_guid);
+    if (nullptr == log)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(log->mutex);
+    for (const auto& entry : log->reader_states)
+    {
+        seq_map[entry.first] = SequenceNumber_t(log->record(entry.second).seq_num);
+    }
+
+    return true;
+}
+
+bool MappedLogPersistenceService::update_writer_seq_on_storage(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
+
+    Log* log = get_log(reader_guid);
+    if (nullptr == log)
+    {
+        return false;
+    }
+
+    RecordHeader header{};
+    header.kind = READER_SEQ;
+    header.seq_num = seq_number.to64long();
+    guid_to_raw(writer_guid, header.guid);
+
+    bool compaction_needed = false;
+    {
+        std::lock_guard<std::mutex> guard(log->mutex);
+        if (!log->append(header, nullptr))
+        {
+            return false;
+        }
+        compaction_needed = log->needs_compaction();
+    }
+
+    if (compaction_needed)
+    {
+        request_compaction();
+    }
+    return true;
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
@@ -0,0 +1,141 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MappedLogPersistenceService.h
+ */
+
+#ifndef MAPPEDLOGPERSISTENCESERVICE_H_
+#define MAPPEDLOGPERSISTENCESERVICE_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+#include <rtps/persistence/PersistenceService.h>
+
+#include <utils/thread.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Persistence service implementation over memory-mapped append-only log files.
+ *
+ * Each writer and reader stored has its own log, made of segments named `<filename>.<guid>.<n>.log`, and a
+ * `<filename>.<guid>.head` file with the number of its first segment and the one following its last segment.
+ * Every operation appends a record to the last segment of the log with a single copy into the mapped file, and an
+ * in-memory index from sequence number (or writer GUID, for readers) to record locates the live data.
+ * When a segment is full a new one is created, and a background thread compacts the segments whose records are mostly
+ * removed or superseded, starting with the one with the lowest ratio of live records. The live records are copied to
+ * the end of the log and the segment is deleted.
+ *
+ * Records survive a crash of the process once appended. When sync_writes is enabled, each record is also flushed
+ * to disk before returning, so they survive a crash of the system.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+class MappedLogPersistenceService : public IPersistenceService
+{
+public:
+
+    //! Default size of the segments of a log.
+    static constexpr uint32_t default_segment_size = 8u * 1024u * 1024u;
+
+    //! Minimum size of the segments of a log.
+    static constexpr uint32_t min_segment_size = 4u * 1024u;
+
+    /**
+     * @param filename      Prefix of the files of the logs.
+     * @param segment_size  Size of the segments of the logs, not lower than min_segment_size.
+     *                      Larger records get a segment of their own.
+     * @param sync_writes   Whether each record is flushed to disk before returning.
+     * @param thread_settings  Settings of the compaction thread.
+     */
+    MappedLogPersistenceService(
+            const std::string& filename,
+            uint32_t segment_size,
+            bool sync_writes,
+            const fastdds::rtps::ThreadSettings& thread_settings);
+
+    virtual ~MappedLogPersistenceService() override;
+
+    bool load_writer_from_storage(
+            const std::string& persistence_guid,
+            const GUID_t& writer_guid,
+            WriterHistory* history,
+            const std::shared_ptr<IChangePool>& change_pool,
+            const std::shared_ptr<IPayloadPool>& payload_pool,
+            SequenceNumber_t& next_sequence) final;
+
+    bool add_writer_change_to_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    bool remove_writer_change_from_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    bool load_reader_from_storage(
+            const std::string& reader_guid,
+            foonathan::memory::map<GUID_t, SequenceNumber_t, map_allocator_t>& seq_map) final;
+
+    bool update_writer_seq_on_storage(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number) final;
+
+private:
+
+    class Log;
+
+    /**
+     * Get the log of a writer or reader, opening it and recovering its index the first time.
+     * @return The log, or nullptr if it could not be opened.
+     */
+    Log* get_log(
+            const std::string& guid);
+
+    //! Wake up the compaction thread.
+    void request_compaction();
+
+    void run_compaction();
+
+    std::string filename_;
+
+    uint32_t segment_size_;
+
+    bool sync_writes_;
+
+    //! Protects logs_.
+    std::mutex logs_mutex_;
+    std::map<std::string, std::unique_ptr<Log>> logs_;
+
+    std::mutex compaction_mutex_;
+    std::condition_variable compaction_cv_;
+    bool compaction_requested_ = false;
+    bool running_ = true;
+    eprosima::thread compaction_thread_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* MAPPEDLOGPERSISTENCESERVICE_H_ */
@@ -18,11 +18,16 @@
  */
 
 #include <rtps/persistence/PersistenceService.h>
+#include <rtps/persistence/MappedLogPersistenceService.h>
 
 #if HAVE_SQLITE3
 #include <rtps/persistence/SQLite3PersistenceService.h>
 #endif // if HAVE_SQLITE3
 
+#include <cstdint>
+#include <cstdlib>
+
+#include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/history/WriterHistory.h>
 
@@ -30,6 +35,35 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+static void get_uint_property(
+        const PropertyPolicy& property_policy,
+        const char* name,
+        uint32_t& value)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(property_policy, name);
+    if (property != nullptr)
+    {
+        char* end = nullptr;
+        unsigned long parsed = strtoul(property->c_str(), &end, 10);
+        if (property->c_str() == end || '\0' != *end || parsed > UINT32_MAX)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Not valid value for " << name << " property");
+        }
+        else
+        {
+            value = static_cast<uint32_t>(parsed);
+        }
+    }
+}
+
+static bool get_bool_property(
+        const PropertyPolicy& property_policy,
+        const char* name)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(property_policy, name);
+    return property != nullptr && ((property->compare("TRUE") == 0) || (property->compare("true") == 0));
+}
+
 std::vector<CacheChange_t*>& IPersistenceService::get_changes(
         WriterHistory* history)
 {
@@ -44,13 +78,30 @@ void IPersistenceService::set_fragments(
 }
 
 IPersistenceService* PersistenceFactory::create_persistence_service(
-        const PropertyPolicy& property_policy)
+        const PropertyPolicy& property_policy,
+        const fastdds::rtps::ThreadSettings& thread_settings)
 {
     IPersistenceService* ret_val = nullptr;
     const std::string* plugin_property = PropertyPolicyHelper::find_property(property_policy, "dds.persistence.plugin");
 
     if (plugin_property != nullptr)
     {
+        if (plugin_property->compare("builtin.MAPPED_LOG") == 0)
+        {
+            const std::string* filename_property = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.mapped_log.filename");
+            std::string filename = (filename_property == nullptr) ? "persistence_log" : *filename_property;
+            uint32_t segment_size = MappedLogPersistenceService::default_segment_size;
+            get_uint_property(property_policy, "dds.persistence.mapped_log.segment_size", segment_size);
+            bool sync_writes = get_bool_property(property_policy, "dds.persistence.mapped_log.sync_writes");
+            if (segment_size < MappedLogPersistenceService::min_segment_size)
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Not valid value for dds.persistence.mapped_log.segment_size "
+                        "property. It should be at least " << MappedLogPersistenceService::min_segment_size);
+                return nullptr;
+            }
+            ret_val = new MappedLogPersistenceService(filename, segment_size, sync_writes, thread_settings);
+        }
 #if HAVE_SQLITE3
         if (plugin_property->compare("builtin.SQLITE3") == 0)
         {
@@ -72,7 +123,24 @@ IPersistenceService* PersistenceFactory::create_persistence_service(
             {
                 update_schema = true;
             }
-            ret_val = create_SQLite3_persistence_service(filename, update_schema);
+
+            SQLite3GroupCommitSettings group_commit;
+            group_commit.enabled = get_bool_property(property_policy, "dds.persistence.sqlite3.group_commit");
+            get_uint_property(property_policy, "dds.persistence.sqlite3.group_commit.max_delay_ms",
+                    group_commit.max_delay_ms);
+            get_uint_property(property_policy, "dds.persistence.sqlite3.group_commit.max_batch_size",
+                    group_commit.max_batch_size);
+            get_uint_property(property_policy, "dds.persistence.sqlite3.group_commit.max_queued_operations",
+                    group_commit.max_queued_operations);
+            if (0 == group_commit.max_queued_operations)
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Not valid value for "
+                        "dds.persistence.sqlite3.group_commit.max_queued_operations property. It should be at least 1");
+                return nullptr;
+            }
+            group_commit.thread = thread_settings;
+
+            ret_val = create_SQLite3_persistence_service(filename, update_schema, group_commit);
         }
 #endif // if HAVE_SQLITE3
     }
@@ -22,6 +22,7 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/history/IChangePool.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 
@@ -129,10 +130,12 @@ public:
     /**
      * Create a persistence service implementation
      * @param property_policy PropertyPolicy where the persistence configuration will be searched
+     * @param thread_settings Settings of the background thread of the persistence service, if it has one
      * @return A pointer to a persistence service implementation. nullptr when policy does not contain the necessary properties or if persistence service could not be created
      */
     static IPersistenceService* create_persistence_service(
-            const PropertyPolicy& property_policy);
+            const PropertyPolicy& property_policy,
+            const fastdds::rtps::ThreadSettings& thread_settings = fastdds::rtps::ThreadSettings());
 };
 
 
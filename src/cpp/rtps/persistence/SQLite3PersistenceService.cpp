@@ -20,10 +20,13 @@
 #include <rtps/persistence/SQLite3PersistenceService.h>
 #include <rtps/persistence/SQLite3PersistenceServiceStatements.h>
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/history/WriterHistory.h>
 
 #include <rtps/persistence/sqlite3.h>
+#include <utils/threading.hpp>
 
+#include <chrono>
 #include <sstream>
 
 namespace eprosima {
@@ -183,15 +186,26 @@ static void finalize_statement(
 
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema)
+        bool update_schema,
+        const SQLite3GroupCommitSettings& group_commit)
 {
     sqlite3* db = open_or_create_database(filename, update_schema);
-    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db);
+    if (db != NULL && group_commit.enabled)
+    {
+        // Readers of the database are not blocked by the commits, and each commit only appends to the log.
+        if (sqlite3_exec(db, "PRAGMA journal_mode=WAL;", 0, 0, 0) != SQLITE_OK)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Could not enable WAL journal mode on database " << filename);
+        }
+    }
+    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db, group_commit);
 }
 
 SQLite3PersistenceService::SQLite3PersistenceService(
-        sqlite3* db)
+        sqlite3* db,
+        const SQLite3GroupCommitSettings& group_commit)
     : db_(db)
+    , group_commit_(group_commit)
     , load_writer_stmt_(NULL)
     , add_writer_change_stmt_(NULL)
     , remove_writer_change_stmt_(NULL)
@@ -221,10 +235,35 @@ SQLite3PersistenceService::SQLite3PersistenceService(
             SQLITE_PREPARE_PERSISTENT, &load_reader_stmt_, NULL);
     sqlite3_prepare_v3(db_, "INSERT OR REPLACE INTO readers VALUES(?,?,?,?);", -1, SQLITE_PREPARE_PERSISTENT,
             &update_reader_stmt_, NULL);
+
+    if (group_commit_.enabled)
+    {
+        running_ = true;
+        commit_thread_ = create_thread([this]()
+                        {
+                            run_group_commit();
+                        }, group_commit_.thread, "dds.persist");
+    }
 }
 
 SQLite3PersistenceService::~SQLite3PersistenceService()
 {
+    if (commit_thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> guard(queue_mutex_);
+            running_ = false;
+        }
+        queue_cv_.notify_all();
+        queue_space_cv_.notify_all();
+        commit_thread_.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(db_mutex_);
+        commit_pending_nts();
+    }
+
     // Finalize writer statements
     finalize_statement(load_writer_stmt_);
     finalize_statement(add_writer_change_stmt_);
@@ -265,6 +304,9 @@ bool SQLite3PersistenceService::load_writer_from_storage(
 {
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
 
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    commit_pending_nts();
+
     if (load_writer_stmt_ != NULL)
     {
         sqlite3_reset(load_writer_stmt_);
@@ -349,44 +391,73 @@ bool SQLite3PersistenceService::add_writer_change_to_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
 
+    // related sample identity
+    std::ostringstream os;
+    auto& si = change.write_params.related_sample_identity();
+    os << si.writer_guid();
+
+    if (group_commit_.enabled)
+    {
+        PendingOperation operation;
+        operation.kind = PendingOperation::ADD_WRITER_CHANGE;
+        operation.guid = persistence_guid;
+        operation.seq_num = change.sequenceNumber.to64long();
+        operation.instance = change.instanceHandle;
+        operation.payload.assign(change.serializedPayload.data,
+                change.serializedPayload.data + change.serializedPayload.length);
+        operation.related_guid = os.str();
+        operation.related_seq_num = si.sequence_number().to64long();
+        operation.source_timestamp = change.sourceTimestamp.to_ns();
+        enqueue(std::move(operation));
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    return store_writer_change(persistence_guid, change.sequenceNumber.to64long(), change.instanceHandle,
+                   change.serializedPayload.data, change.serializedPayload.length, os.str(),
+                   si.sequence_number().to64long(), change.sourceTimestamp.to_ns());
+}
+
+bool SQLite3PersistenceService::store_writer_change(
+        const std::string& persistence_guid,
+        int64_t seq_num,
+        const InstanceHandle_t& instance,
+        const octet* payload,
+        uint32_t payload_length,
+        const std::string& related_guid,
+        int64_t related_seq_num,
+        int64_t source_timestamp)
+{
     if (add_writer_change_stmt_ != NULL)
     {
         //First add the last seq number, it is needed for the foreign key on writers_histories
         sqlite3_reset(update_writer_last_seq_num_stmt_);
         sqlite3_bind_text(update_writer_last_seq_num_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(update_writer_last_seq_num_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(update_writer_last_seq_num_stmt_, 2, seq_num);
 
         if (sqlite3_step(update_writer_last_seq_num_stmt_) == SQLITE_DONE)
         {
             sqlite3_reset(add_writer_change_stmt_);
             sqlite3_bind_text(add_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_int64(add_writer_change_stmt_, 2, change.sequenceNumber.to64long());
-            if (change.instanceHandle.isDefined())
+            sqlite3_bind_int64(add_writer_change_stmt_, 2, seq_num);
+            if (instance.isDefined())
             {
-                sqlite3_bind_blob(add_writer_change_stmt_, 3, change.instanceHandle.value, 16, SQLITE_STATIC);
+                sqlite3_bind_blob(add_writer_change_stmt_, 3, instance.value, 16, SQLITE_STATIC);
             }
             else
             {
                 sqlite3_bind_zeroblob(add_writer_change_stmt_, 3, 16);
             }
-            sqlite3_bind_blob(add_writer_change_stmt_, 4, change.serializedPayload.data,
-                    change.serializedPayload.length, SQLITE_STATIC);
-
-            // related sample identity
-            std::ostringstream os;
-            auto& si = change.write_params.related_sample_identity();
-            os << si.writer_guid();
+            sqlite3_bind_blob(add_writer_change_stmt_, 4, payload, payload_length, SQLITE_STATIC);
 
-            // IMPORTANT: this element must survive until the call (sqlite3_step) has been fulfilled.
+            // IMPORTANT: bound strings must survive until the call (sqlite3_step) has been fulfilled.
             // Another way would be to use SQLITE_TRANSIENT instead of static, forcing an internal copy,
-            // but this way a copy is saved (with cost of taking care that this string should survive)
-            std::string guids = os.str();
-
-            sqlite3_bind_text(add_writer_change_stmt_, 5, guids.c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_int64(add_writer_change_stmt_, 6, si.sequence_number().to64long());
+            // but this way a copy is saved (with cost of taking care that the string should survive)
+            sqlite3_bind_text(add_writer_change_stmt_, 5, related_guid.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_int64(add_writer_change_stmt_, 6, related_seq_num);
 
             // source time stamp
-            sqlite3_bind_int64(add_writer_change_stmt_, 7, change.sourceTimestamp.to_ns());
+            sqlite3_bind_int64(add_writer_change_stmt_, 7, source_timestamp);
 
             return sqlite3_step(add_writer_change_stmt_) == SQLITE_DONE;
         }
@@ -407,11 +478,29 @@ bool SQLite3PersistenceService::remove_writer_change_from_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
 
+    if (group_commit_.enabled)
+    {
+        PendingOperation operation;
+        operation.kind = PendingOperation::REMOVE_WRITER_CHANGE;
+        operation.guid = persistence_guid;
+        operation.seq_num = change.sequenceNumber.to64long();
+        enqueue(std::move(operation));
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    return delete_writer_change(persistence_guid, change.sequenceNumber.to64long());
+}
+
+bool SQLite3PersistenceService::delete_writer_change(
+        const std::string& persistence_guid,
+        int64_t seq_num)
+{
     if (remove_writer_change_stmt_ != NULL)
     {
         sqlite3_reset(remove_writer_change_stmt_);
         sqlite3_bind_text(remove_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(remove_writer_change_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(remove_writer_change_stmt_, 2, seq_num);
         return sqlite3_step(remove_writer_change_stmt_) == SQLITE_DONE;
     }
 
@@ -429,6 +518,9 @@ bool SQLite3PersistenceService::load_reader_from_storage(
 {
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
 
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    commit_pending_nts();
+
     if (load_reader_stmt_ != NULL)
     {
         sqlite3_reset(load_reader_stmt_);
@@ -463,19 +555,149 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
 
+    if (group_commit_.enabled)
+    {
+        PendingOperation operation;
+        operation.kind = PendingOperation::UPDATE_READER_SEQ;
+        operation.guid = reader_guid;
+        operation.writer_guid = writer_guid;
+        operation.seq_num = seq_number.to64long();
+        enqueue(std::move(operation));
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    return store_reader_seq(reader_guid, writer_guid, seq_number.to64long());
+}
+
+bool SQLite3PersistenceService::store_reader_seq(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        int64_t seq_num)
+{
     if (update_reader_stmt_ != NULL)
     {
         sqlite3_reset(update_reader_stmt_);
         sqlite3_bind_text(update_reader_stmt_, 1, reader_guid.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_blob(update_reader_stmt_, 2, writer_guid.guidPrefix.value, GuidPrefix_t::size, SQLITE_STATIC);
         sqlite3_bind_blob(update_reader_stmt_, 3, writer_guid.entityId.value, EntityId_t::size, SQLITE_STATIC);
-        sqlite3_bind_int64(update_reader_stmt_, 4, seq_number.to64long());
+        sqlite3_bind_int64(update_reader_stmt_, 4, seq_num);
         return sqlite3_step(update_reader_stmt_) == SQLITE_DONE;
     }
 
     return false;
 }
 
+void SQLite3PersistenceService::enqueue(
+        PendingOperation&& operation)
+{
+    bool wake_up = false;
+    {
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        if (pending_.size() >= group_commit_.max_queued_operations)
+        {
+            // Commit now and wait until the queued operations are taken, instead of growing the queue without limit.
+            queue_cv_.notify_one();
+            queue_space_cv_.wait(lock, [this]()
+                    {
+                        return !running_ || pending_.size() < group_commit_.max_queued_operations;
+                    });
+        }
+
+        pending_.push_back(std::move(operation));
+        // The commit thread is waiting either for the first operation of a batch, or for the batch to be full.
+        wake_up = 1u == pending_.size() || pending_.size() >= group_commit_.max_batch_size ||
+                pending_.size() >= group_commit_.max_queued_operations;
+    }
+
+    if (wake_up)
+    {
+        queue_cv_.notify_one();
+    }
+}
+
+void SQLite3PersistenceService::commit_pending_nts()
+{
+    // Taking the operations while holding db_mutex_ keeps them in the order they were queued, even when a load
+    // commits them from another thread.
+    std::vector<PendingOperation> operations;
+    {
+        std::lock_guard<std::mutex> guard(queue_mutex_);
+        operations.swap(pending_);
+    }
+    queue_space_cv_.notify_all();
+
+    if (operations.empty())
+    {
+        return;
+    }
+
+    if (sqlite3_exec(db_, "BEGIN TRANSACTION;", 0, 0, 0) != SQLITE_OK)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Could not begin transaction: " << sqlite3_errmsg(db_));
+        return;
+    }
+
+    for (const PendingOperation& operation : operations)
+    {
+        bool ret = false;
+        switch (operation.kind)
+        {
+            case PendingOperation::ADD_WRITER_CHANGE:
+                ret = store_writer_change(operation.guid, operation.seq_num, operation.instance,
+                                operation.payload.data(), static_cast<uint32_t>(operation.payload.size()),
+                                operation.related_guid, operation.related_seq_num, operation.source_timestamp);
+                break;
+            case PendingOperation::REMOVE_WRITER_CHANGE:
+                ret = delete_writer_change(operation.guid, operation.seq_num);
+                break;
+            case PendingOperation::UPDATE_READER_SEQ:
+                ret = store_reader_seq(operation.guid, operation.writer_guid, operation.seq_num);
+                break;
+        }
+
+        if (!ret)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Operation on " << operation.guid << " for seq "
+                                                                   << operation.seq_num << " failed: " <<
+                    sqlite3_errmsg(db_));
+        }
+    }
+
+    if (sqlite3_exec(db_, "COMMIT TRANSACTION;", 0, 0, 0) != SQLITE_OK)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Could not commit " << operations.size() << " operations: "
+                                                                 << sqlite3_errmsg(db_));
+        sqlite3_exec(db_, "ROLLBACK TRANSACTION;", 0, 0, 0);
+    }
+}
+
+void SQLite3PersistenceService::run_group_commit()
+{
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    while (running_)
+    {
+        queue_cv_.wait(lock, [this]()
+                {
+                    return !running_ || !pending_.empty();
+                });
+
+        // Let the batch grow until the durability bound expires or it reaches its maximum size.
+        queue_cv_.wait_for(lock, std::chrono::milliseconds(group_commit_.max_delay_ms), [this]()
+                {
+                    return !running_ || pending_.size() >= group_commit_.max_batch_size ||
+                    pending_.size() >= group_commit_.max_queued_operations;
+                });
+
+        lock.unlock();
+        {
+            std::lock_guard<std::mutex> guard(db_mutex_);
+            commit_pending_nts();
+        }
+        lock.lock();
+    }
+}
+
 bool SQLite3PersistenceServiceSchemaV3::database_create_temporary_defaults_table(
         sqlite3* db)
 {
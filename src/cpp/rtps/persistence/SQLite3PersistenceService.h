@@ -19,24 +19,63 @@
 #ifndef SQLITE3PERSISTENCESERVICE_H_
 #define SQLITE3PERSISTENCESERVICE_H_
 
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
 #include <rtps/persistence/PersistenceService.h>
 #include <rtps/persistence/sqlite3.h>
 
+#include <utils/thread.hpp>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/**
+ * Configuration of the group commit mode of the SQLite3 persistence service.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+struct SQLite3GroupCommitSettings
+{
+    //! Whether operations are queued and committed from a background thread.
+    bool enabled = false;
+
+    //! Maximum time, in milliseconds, an operation may wait before being committed to disk.
+    uint32_t max_delay_ms = 10;
+
+    //! Number of queued operations that triggers a commit without waiting for max_delay_ms.
+    uint32_t max_batch_size = 1024;
+
+    //! Maximum number of queued operations. Operations queued beyond it block until the queue is committed.
+    uint32_t max_queued_operations = 65536;
+
+    //! Settings of the thread committing the queued operations.
+    fastdds::rtps::ThreadSettings thread;
+};
+
 /**
  * Create a new SQLite3 implementation of persistence service
  * @ingroup RTPS_PERSISTENCE_MODULE
  */
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema);
+        bool update_schema,
+        const SQLite3GroupCommitSettings& group_commit = SQLite3GroupCommitSettings());
 
 
 /**
  * Persistence service implementation over SQLite3
+ *
+ * By default each operation is its own transaction. When group commit is enabled, operations are queued and a
+ * background thread commits all the operations queued during a window on a single transaction, with the database
+ * on WAL journal mode. In that mode operations on writer histories and reader states return true once queued, and
+ * errors are only logged. The queue is bounded: once it holds max_queued_operations, the caller is blocked until
+ * the commit thread takes the queued operations. Loading from storage always commits the queued operations first.
  * @ingroup RTPS_PERSISTENCE_MODULE
  */
 class SQLite3PersistenceService : public IPersistenceService
@@ -44,7 +83,8 @@ class SQLite3PersistenceService : public IPersistenceService
 public:
 
     SQLite3PersistenceService(
-            sqlite3* db);
+            sqlite3* db,
+            const SQLite3GroupCommitSettings& group_commit = SQLite3GroupCommitSettings());
     virtual ~SQLite3PersistenceService() override;
 
     /**
@@ -101,8 +141,74 @@ public:
 
 private:
 
+    //! Operation waiting to be committed on group commit mode.
+    struct PendingOperation
+    {
+        enum Kind
+        {
+            ADD_WRITER_CHANGE,
+            REMOVE_WRITER_CHANGE,
+            UPDATE_READER_SEQ
+        };
+
+        Kind kind;
+
+        //! Persistence GUID of the writer, or GUID of the reader.
+        std::string guid;
+
+        GUID_t writer_guid;
+        int64_t seq_num = 0;
+        InstanceHandle_t instance;
+        std::vector<octet> payload;
+        std::string related_guid;
+        int64_t related_seq_num = 0;
+        int64_t source_timestamp = 0;
+    };
+
+    bool store_writer_change(
+            const std::string& persistence_guid,
+            int64_t seq_num,
+            const InstanceHandle_t& instance,
+            const octet* payload,
+            uint32_t payload_length,
+            const std::string& related_guid,
+            int64_t related_seq_num,
+            int64_t source_timestamp);
+
+    bool delete_writer_change(
+            const std::string& persistence_guid,
+            int64_t seq_num);
+
+    bool store_reader_seq(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            int64_t seq_num);
+
+    //! Queue an operation, waking up the commit thread if the batch is full, and blocking while the queue is full.
+    void enqueue(
+            PendingOperation&& operation);
+
+    //! Commit all the queued operations on a single transaction. db_mutex_ must be held.
+    void commit_pending_nts();
+
+    void run_group_commit();
+
     sqlite3* db_;
 
+    SQLite3GroupCommitSettings group_commit_;
+
+    //! Protects the database and the prepared statements.
+    std::mutex db_mutex_;
+
+    //! Protects the queue of pending operations.
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    //! Notified when the queued operations are taken to be committed.
+    std::condition_variable queue_space_cv_;
+    std::vector<PendingOperation> pending_;
+    bool running_ = false;
+    eprosima::thread commit_thread_;
+
     sqlite3_stmt* load_writer_stmt_;
     sqlite3_stmt* add_writer_change_stmt_;
     sqlite3_stmt* remove_writer_change_stmt_;
@@ -23,7 +23,9 @@
 
 #include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
+#include <rtps/history/PoolMemoryUsage.hpp>
 
+#include <rtps/common/SampleBatch.hpp>
 #include <rtps/DataSharing/DataSharingListener.hpp>
 
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -33,6 +35,8 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/reader/StatefulReader.h>
+#include <fastdds/rtps/reader/StatelessReader.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/rtps/reader/ReaderListener.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
@@ -394,6 +398,28 @@ uint64_t RTPSReader::get_unread_count(
     return ret_val;
 }
 
+void RTPSReader::get_memory_usage(
+        fastdds::rtps::EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    usage.guid = m_guid;
+    get_pools_memory_usage(change_pool_, payload_pool_, usage);
+    if (nullptr != mp_history)
+    {
+        usage.history = mp_history->get_memory_usage_nts();
+    }
+
+    usage.proxies = fastdds::rtps::MemoryUsage();
+    if (const StatefulReader* stateful = dynamic_cast<const StatefulReader*>(this))
+    {
+        stateful->get_matched_writers_memory_usage_nts(usage.proxies);
+    }
+    else if (const StatelessReader* stateless = dynamic_cast<const StatelessReader*>(this))
+    {
+        stateless->get_matched_writers_memory_usage_nts(usage.proxies);
+    }
+}
+
 bool RTPSReader::is_datasharing_compatible_with(
         const WriterProxyData& wdata)
 {
@@ -416,6 +442,44 @@ bool RTPSReader::is_datasharing_compatible_with(
     return false;
 }
 
+bool RTPSReader::process_data_batch_msg(
+        CacheChange_t* batch,
+        const std::function<bool(CacheChange_t*)>& process_sample)
+{
+    bool ret_val = false;
+    detail::SampleBatchReader batch_reader(batch->serializedPayload);
+    SequenceNumber_t sequence_number = batch->sequenceNumber;
+
+    CacheChange_t sample;
+    sample.kind = batch->kind;
+    sample.writerGUID = batch->writerGUID;
+    sample.vendor_id = batch->vendor_id;
+    sample.reader_info.receptionTimestamp = batch->reader_info.receptionTimestamp;
+
+    while (batch_reader.next(sample.serializedPayload, sample.instanceHandle, sample.sourceTimestamp))
+    {
+        sample.sequenceNumber = sequence_number++;
+
+        // A sample looking like a batch is a user sample the writer had to send inside a batch
+        ret_val |= process_sample(&sample);
+
+        // The payload pool may have taken a reference on the copied payload
+        IPayloadPool* payload_pool = sample.payload_owner();
+        if (payload_pool)
+        {
+            payload_pool->release_payload(sample);
+        }
+
+        sample.instanceHandle.clear();
+    }
+
+    // The payload points to the batch, avoid it to be freed
+    sample.serializedPayload.data = nullptr;
+    sample.serializedPayload.length = 0;
+
+    return ret_val;
+}
+
 bool RTPSReader::is_sample_valid(
         const void* data,
         const GUID_t& writer,
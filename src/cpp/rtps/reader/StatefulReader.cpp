@@ -22,14 +22,18 @@
 #include <thread>
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
 #include <fastdds/rtps/reader/ReaderListener.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
+#include <utils/TimeConversion.hpp>
 
 #include <rtps/builtin/BuiltinProtocols.h>
 #include <rtps/builtin/liveliness/WLP.h>
+#include <rtps/common/ContainerMemoryUsage.hpp>
+#include <rtps/common/SampleBatch.hpp>
 #include <rtps/DataSharing/DataSharingListener.hpp>
 #include <rtps/DataSharing/ReaderPool.hpp>
 #include <rtps/history/HistoryAttributesExtension.hpp>
@@ -185,6 +189,10 @@ void StatefulReader::init(
         const ReaderAttributes& att)
 {
     const RTPSParticipantAttributes& part_att = pimpl->getRTPSParticipantAttributes();
+    // Repairs are sent by the writers after their NACK response delay.
+    rtt_adaptive_timing_ = RTTAdaptiveTiming::from_properties(att.endpoint.properties,
+                    fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(times_.heartbeatResponseDelay),
+                    fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(WriterTimes().nackResponseDelay));
     for (size_t n = 0; n < att.matched_writers_allocation.initial; ++n)
     {
         matched_writers_pool_.push_back(new WriterProxy(this, part_att.allocation.locators, proxy_changes_config_));
@@ -479,6 +487,25 @@ bool StatefulReader::matched_writer_is_matched(
     return false;
 }
 
+void StatefulReader::get_matched_writers_memory_usage_nts(
+        fastdds::rtps::MemoryUsage& usage) const
+{
+    auto add_proxies = [&usage](const ResourceLimitedVector<WriterProxy*>& proxies, bool in_use)
+            {
+                usage += get_container_memory_usage(proxies);
+                for (const WriterProxy* proxy : proxies)
+                {
+                    fastdds::rtps::MemoryUsage proxy_usage = proxy->get_memory_usage();
+                    proxy_usage.live_bytes = in_use ? proxy_usage.live_bytes + sizeof(WriterProxy) : 0;
+                    proxy_usage.reserved_bytes += sizeof(WriterProxy);
+                    usage += proxy_usage;
+                }
+            };
+
+    add_proxies(matched_writers_, true);
+    add_proxies(matched_writers_pool_, false);
+}
+
 bool StatefulReader::matched_writer_lookup(
         const GUID_t& writerGUID,
         WriterProxy** WP)
@@ -547,10 +574,33 @@ void StatefulReader::assert_writer_liveliness(
 bool StatefulReader::processDataMsg(
         CacheChange_t* change)
 {
-    WriterProxy* pWP = nullptr;
-
     assert(change);
 
+    // Only the writers announcing it send batches, other payloads may start like a batch
+    if (detail::SampleBatch::is_batch(change->serializedPayload) && writer_sends_sample_batches(change->writerGUID))
+    {
+        return process_data_batch_msg(change, [this](CacheChange_t* sample)
+                       {
+                           return process_data_sample_msg(sample);
+                       });
+    }
+
+    return process_data_sample_msg(change);
+}
+
+bool StatefulReader::writer_sends_sample_batches(
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    WriterProxy* wp = nullptr;
+    return is_alive_ && findWriterProxy(writer_guid, &wp) && wp->sends_sample_batches();
+}
+
+bool StatefulReader::process_data_sample_msg(
+        CacheChange_t* change)
+{
+    WriterProxy* pWP = nullptr;
+
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
     if (!is_alive_)
     {
@@ -681,6 +731,18 @@ bool StatefulReader::processDataFragMsg(
     // TODO: see if we need manage framework fragmented DATA message
     if (acceptMsgFrom(incomingChange->writerGUID, &pWP) && pWP)
     {
+        // A reassembled batch is replaced by its samples, which are processed once the lock has been released
+        auto process_batch_lambda = [&lock, this](CacheChange_t* batch)
+                {
+                    process_data_batch_msg(batch, [this](CacheChange_t* sample)
+                            {
+                                return process_data_sample_msg(sample);
+                            });
+                    lock.lock();
+                    releaseCache(batch);
+                };
+        std::unique_ptr<CacheChange_t, decltype(process_batch_lambda)> reassembled_batch{ nullptr, process_batch_lambda };
+
         // Always assert liveliness on scope exit
         auto assert_liveliness_lambda = [&lock, this, incomingChange](void*)
                 {
@@ -760,8 +822,15 @@ bool StatefulReader::processDataFragMsg(
                 }
             }
 
+            if (work_change != nullptr && work_change->is_fully_assembled() && pWP->sends_sample_batches() &&
+                    detail::SampleBatch::is_batch(work_change->serializedPayload))
+            {
+                // Keep the batch, as its samples are taken from it
+                mp_history->remove_change(mp_history->find_change(work_change), false);
+                reassembled_batch.reset(work_change);
+            }
             // If change has been fully reassembled, mark as received and add notify user
-            if (work_change != nullptr && work_change->is_fully_assembled())
+            else if (work_change != nullptr && work_change->is_fully_assembled())
             {
                 fastdds::dds::SampleRejectedStatusKind rejection_reason;
                 if (mp_history->completed_change(work_change, changes_up_to, rejection_reason))
@@ -1139,6 +1208,17 @@ bool StatefulReader::change_received(
         if (a_change->is_fully_assembled())
         {
             ret = prox->received_change_set(a_change->sequenceNumber);
+
+            if (ret && rtt_adaptive_timing_.enabled &&
+                    prox->requested_change_received(a_change->sequenceNumber, std::chrono::steady_clock::now(),
+                    rtt_adaptive_timing_.remote_response_delay()))
+            {
+                // Wait for reordered changes during the variation of the round-trip time before requesting them.
+                std::chrono::duration<long double, std::milli> response_delay(
+                    rtt_adaptive_timing_.bound(prox->rtt_estimator().rttvar()));
+                prox->update_heartbeat_response_interval(Duration_t(response_delay.count() / 1000.0L));
+                on_round_trip_time(prox->guid(), prox->rtt_estimator().srtt());
+            }
         }
         else
         {
@@ -1284,7 +1364,7 @@ void StatefulReader::remove_changes_from(
 
 ResourceEvent& StatefulReader::getEventResource() const
 {
-    return mp_RTPSParticipant->getEventResource();
+    return mp_RTPSParticipant->getEventResource(m_guid);
 }
 
 bool StatefulReader::nextUntakenCache(
@@ -1417,6 +1497,22 @@ bool StatefulReader::updateTimes(
     return true;
 }
 
+bool StatefulReader::get_round_trip_time(
+        const GUID_t& writer_guid,
+        Duration_t& rtt) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    WriterProxy* writer = nullptr;
+    if (findWriterProxy(writer_guid, &writer) && writer->rtt_estimator().has_estimation())
+    {
+        rtt = Duration_t(std::chrono::duration<long double>(writer->rtt_estimator().srtt()).count());
+        return true;
+    }
+
+    return false;
+}
+
 bool StatefulReader::isInCleanState()
 {
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
@@ -1565,7 +1661,7 @@ void StatefulReader::send_acknack(
 }
 
 void StatefulReader::send_acknack(
-        const WriterProxy* writer,
+        WriterProxy* writer,
         RTPSMessageSenderInterface* sender,
         bool heartbeat_was_final)
 {
@@ -1632,6 +1728,11 @@ void StatefulReader::send_acknack(
 
             bool final = sns.empty();
             group.add_acknack(sns, acknack_count_, final);
+
+            if (rtt_adaptive_timing_.enabled && !final)
+            {
+                writer->acknack_sent(sns.min(), std::chrono::steady_clock::now());
+            }
         }
     }
     catch (const RTPSMessageGroup::timeout&)
@@ -30,6 +30,8 @@
 
 #include <rtps/builtin/BuiltinProtocols.h>
 #include <rtps/builtin/liveliness/WLP.h>
+#include <rtps/common/ContainerMemoryUsage.hpp>
+#include <rtps/common/SampleBatch.hpp>
 #include <rtps/DataSharing/DataSharingListener.hpp>
 #include <rtps/DataSharing/ReaderPool.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -115,6 +117,7 @@ bool StatelessReader::matched_writer_add(
                         writer.guid, wdata.m_qos.m_ownershipStrength.value);
                 }
                 writer.ownership_strength = wdata.m_qos.m_ownershipStrength.value;
+                writer.sends_sample_batches = wdata.sample_batches();
 
                 if (nullptr != listener)
                 {
@@ -146,6 +149,7 @@ bool StatelessReader::matched_writer_add(
         info.has_manual_topic_liveliness = (MANUAL_BY_TOPIC_LIVELINESS_QOS == wdata.m_qos.m_liveliness.kind);
         info.is_datasharing = is_datasharing;
         info.ownership_strength = wdata.m_qos.m_ownershipStrength.value;
+        info.sends_sample_batches = wdata.sample_batches();
 
         if (is_datasharing)
         {
@@ -305,6 +309,12 @@ bool StatelessReader::matched_writer_is_matched(
     return false;
 }
 
+void StatelessReader::get_matched_writers_memory_usage_nts(
+        fastdds::rtps::MemoryUsage& usage) const
+{
+    usage += get_container_memory_usage(matched_writers_);
+}
+
 bool StatelessReader::change_received(
         CacheChange_t* change)
 {
@@ -553,8 +563,46 @@ bool StatelessReader::processDataMsg(
 {
     assert(change);
 
+    // Only the writers announcing it send batches, other payloads may start like a batch
+    if (detail::SampleBatch::is_batch(change->serializedPayload) && writer_sends_sample_batches(change->writerGUID))
+    {
+        return process_data_batch_msg(change, [this](CacheChange_t* sample)
+                       {
+                           return process_data_sample_msg(sample);
+                       });
+    }
+
+    return process_data_sample_msg(change);
+}
+
+bool StatelessReader::writer_sends_sample_batches(
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    return std::any_of(matched_writers_.begin(), matched_writers_.end(),
+                   [&writer_guid](const RemoteWriterInfo_t& writer)
+                   {
+                       return (writer.guid == writer_guid) && writer.sends_sample_batches;
+                   });
+}
+
+bool StatelessReader::process_data_sample_msg(
+        CacheChange_t* change)
+{
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
 
+    // Unsequenced samples come from writers which are never matched
+    if (unsequenced_sample_processor_ && ALIVE == change->kind)
+    {
+        lock.unlock();
+        bool consumed = unsequenced_sample_processor_(*change);
+        lock.lock();
+        if (consumed)
+        {
+            return true;
+        }
+    }
+
     if (acceptMsgFrom(change->writerGUID, change->kind))
     {
         // Always assert liveliness on scope exit
@@ -672,6 +720,19 @@ bool StatelessReader::processDataFragMsg(
     {
         if (writer.guid == writer_guid)
         {
+            // A reassembled batch is replaced by its samples, which are processed once the lock has been released
+            auto process_batch_lambda = [&lock, this](CacheChange_t* batch)
+                    {
+                        process_data_batch_msg(batch, [this](CacheChange_t* sample)
+                                {
+                                    return process_data_sample_msg(sample);
+                                });
+                        lock.lock();
+                        releaseCache(batch);
+                    };
+            std::unique_ptr<CacheChange_t, decltype(process_batch_lambda)> reassembled_batch{ nullptr,
+                                                                                              process_batch_lambda };
+
             // Always assert liveliness on scope exit
             auto assert_liveliness_lambda = [&lock, this, &writer_guid](void*)
                     {
@@ -792,8 +853,14 @@ bool StatelessReader::processDataFragMsg(
 
                 writer.fragmented_change = work_change;
 
+                if (change_completed != nullptr && writer.sends_sample_batches &&
+                        detail::SampleBatch::is_batch(change_completed->serializedPayload))
+                {
+                    // The samples are filtered and received one by one
+                    reassembled_batch.reset(change_completed);
+                }
                 // If the change was completed, process it.
-                if (change_completed != nullptr)
+                else if (change_completed != nullptr)
                 {
                     // Temporarilly assign the inline qos while evaluating the data filter
                     change_completed->inline_qos = incomingChange->inline_qos;
@@ -897,6 +964,13 @@ void StatelessReader::assert_writer_liveliness(
     }
 }
 
+void StatelessReader::set_unsequenced_sample_processor(
+        std::function<bool(CacheChange_t&)> processor)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    unsequenced_sample_processor_ = std::move(processor);
+}
+
 bool StatelessReader::writer_has_manual_liveliness(
         const GUID_t& guid)
 {
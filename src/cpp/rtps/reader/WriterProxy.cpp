@@ -28,6 +28,7 @@
 
 #include "rtps/RTPSDomainImpl.hpp"
 #include "utils/collections/node_size_helpers.hpp"
+#include <rtps/common/ContainerMemoryUsage.hpp>
 #include <rtps/network/utils/external_locators.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -87,6 +88,7 @@ WriterProxy::WriterProxy(
     , liveliness_kind_(AUTOMATIC_LIVELINESS_QOS)
     , locators_entry_(loc_alloc.max_unicast_locators, loc_alloc.max_multicast_locators)
     , is_datasharing_writer_(false)
+    , sends_sample_batches_(false)
     , received_at_least_one_heartbeat_(false)
     , state_(StateCode::STOPPED)
 {
@@ -138,6 +140,7 @@ void WriterProxy::start(
     is_on_same_process_ = RTPSDomainImpl::should_intraprocess_between(reader_->getGuid(), attributes.guid());
     ownership_strength_ = attributes.m_qos.m_ownershipStrength.value;
     liveliness_kind_ = attributes.m_qos.m_liveliness.kind;
+    sends_sample_batches_ = attributes.sample_batches();
     locators_entry_.unicast = attributes.remote_locators().unicast;
     locators_entry_.multicast = attributes.remote_locators().multicast;
     filter_remote_locators(locators_entry_,
@@ -160,6 +163,7 @@ void WriterProxy::update(
 
     assert(is_alive_);
     ownership_strength_ = attributes.m_qos.m_ownershipStrength.value;
+    sends_sample_batches_ = attributes.sample_batches();
     locators_entry_.unicast = attributes.remote_locators().unicast;
     locators_entry_.multicast = attributes.remote_locators().multicast;
     filter_remote_locators(locators_entry_,
@@ -197,6 +201,8 @@ void WriterProxy::clear()
     guid_prefix_as_vector_.clear();
     changes_received_.clear();
     is_on_same_process_ = false;
+    rtt_estimator_.reset();
+    rtt_probe_seq_ = SequenceNumber_t::unknown();
     loaded_from_storage(SequenceNumber_t());
 }
 
@@ -613,6 +619,21 @@ bool WriterProxy::process_heartbeat(
     return false;
 }
 
+fastdds::rtps::MemoryUsage WriterProxy::get_memory_usage() const
+{
+    fastdds::rtps::MemoryUsage usage = get_locator_selector_entry_memory_usage(locators_entry_);
+    usage += get_container_memory_usage(guid_as_vector_);
+    usage += get_container_memory_usage(guid_prefix_as_vector_);
+
+    // Nodes of the received changes come from a pool, which keeps the released ones for later reuse
+    fastdds::rtps::MemoryUsage changes;
+    changes.live_bytes = changes_received_.size() * set_helper::node_size;
+    changes.reserved_bytes = changes.live_bytes + changes_pool_.capacity_left();
+    usage += changes;
+
+    return usage;
+}
+
 void WriterProxy::update_heartbeat_response_interval(
         const Duration_t& interval)
 {
@@ -29,6 +29,8 @@
 #include <fastdds/utils/collections/ResourceLimitedVector.hpp>
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
 #include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+#include <fastdds/rtps/common/RoundTripTimeEstimator.hpp>
 
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
@@ -269,6 +271,50 @@ public:
     void update_heartbeat_response_interval(
             const Duration_t& interval);
 
+    /**
+     * Notify that an ACKNACK requesting missing changes has been sent to the writer.
+     * @param first_requested Sequence number of the first requested change.
+     * @param now Time point when the ACKNACK was sent.
+     */
+    void acknack_sent(
+            const SequenceNumber_t& first_requested,
+            const std::chrono::steady_clock::time_point& now)
+    {
+        rtt_probe_seq_ = first_requested;
+        rtt_estimator_.request_sent(now);
+    }
+
+    /**
+     * Notify that a change has been received, so the round-trip time estimation is updated if it was the first
+     * change requested on the last ACKNACK.
+     * @param seq_num Sequence number of the received change.
+     * @param now Time point when the change was received.
+     * @param response_delay Time the writer waits before answering an ACKNACK.
+     * @return true when the round-trip time estimation has been updated, false otherwise.
+     */
+    bool requested_change_received(
+            const SequenceNumber_t& seq_num,
+            const std::chrono::steady_clock::time_point& now,
+            std::chrono::nanoseconds response_delay)
+    {
+        return (seq_num == rtt_probe_seq_) && rtt_estimator_.response_received(now, response_delay);
+    }
+
+    /**
+     * Get the estimation of the round-trip time to the writer.
+     * @return the round-trip time estimator of this proxy.
+     */
+    const RoundTripTimeEstimator& rtt_estimator() const
+    {
+        return rtt_estimator_;
+    }
+
+    /**
+     * Get the memory held by the containers of this proxy.
+     * @return Memory used by the changes received from the writer and by its locators.
+     */
+    fastdds::rtps::MemoryUsage get_memory_usage() const;
+
     /**
      * Check if the destinations managed by this sender interface have changed.
      *
@@ -331,6 +377,14 @@ public:
         return is_datasharing_writer_;
     }
 
+    /**
+     * @return Whether the writer has announced it sends changes carrying a batch of samples.
+     */
+    bool sends_sample_batches() const
+    {
+        return sends_sample_batches_;
+    }
+
     /*
      * Do nothing.
      * This object always is protected by reader's mutex.
@@ -413,10 +467,16 @@ private:
     LocatorSelectorEntry locators_entry_;
     //! Is the writer datasharing
     bool is_datasharing_writer_;
+    //! Taken from proxy data
+    bool sends_sample_batches_;
     //! Wether at least one heartbeat was recevied.
     bool received_at_least_one_heartbeat_;
     //! Current state of this Writer Proxy
     std::atomic<StateCode> state_;
+    //! Round-trip time estimation, measured from ACKNACK to the reception of the first requested change.
+    RoundTripTimeEstimator rtt_estimator_;
+    //! First change requested on the last ACKNACK.
+    SequenceNumber_t rtt_probe_seq_;
 
     using ChangeIterator = decltype(changes_received_)::iterator;
 
@@ -16,12 +16,14 @@
  * @file ResourceEvent.cpp
  */
 
+#include <algorithm>
 #include <cassert>
 
 #include <fastdds/rtps/resources/ResourceEvent.h>
 #include <fastdds/dds/log/Log.hpp>
 
 #include "TimedEventImpl.h"
+#include "TimingWheel.hpp"
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
 
@@ -29,15 +31,9 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-static bool event_compare(
-        TimedEventImpl* lhs,
-        TimedEventImpl* rhs)
-{
-    return lhs->next_trigger_time() < rhs->next_trigger_time();
-}
-
 ResourceEvent::ResourceEvent()
-    : thread_(new eprosima::thread())
+    : active_timers_(new TimingWheel())
+    , thread_(new eprosima::thread())
 {
 }
 
@@ -93,32 +89,28 @@ void ResourceEvent::unregister_timer(
     }
 
     bool should_notify = false;
-    std::vector<TimedEventImpl*>::iterator it;
 
     // Remove from pending
-    it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
-    if (it != pending_timers_.end())
+    if (event->hook_.pending)
     {
-        pending_timers_.erase(it);
+        pending_timers_.erase(std::find(pending_timers_.begin(), pending_timers_.end(), event));
+        event->hook_.pending = false;
         should_notify = true;
     }
 
     // Remove from active
-    it = std::find(active_timers_.begin(), active_timers_.end(), event);
-    if (it != active_timers_.end())
+    if (active_timers_->contains(event))
     {
-        active_timers_.erase(it);
-
-        if (is_service_thread)
-        {
-            //! Warn the do_timer_actions loop to skip checking the rest of active_timers
-            //! in this iteration to prevent iterator invalidation
-            skip_checking_active_timers_.store(true);
-        }
-
+        active_timers_->remove(event);
         should_notify = true;
     }
 
+    if (is_service_thread)
+    {
+        //! The do_timer_actions loop may be triggering the event, so it should skip it.
+        std::replace(expired_timers_.begin(), expired_timers_.end(), event, static_cast<TimedEventImpl*>(nullptr));
+    }
+
     // Decrement counter of created timers
     --timers_count_;
 
@@ -164,8 +156,9 @@ void ResourceEvent::notify(
 bool ResourceEvent::register_timer_nts(
         TimedEventImpl* event)
 {
-    if (std::find(pending_timers_.begin(), pending_timers_.end(), event) == pending_timers_.end())
+    if (!event->hook_.pending)
     {
+        event->hook_.pending = true;
         pending_timers_.push_back(event);
         return true;
     }
@@ -201,9 +194,9 @@ void ResourceEvent::event_service()
 
         // Wait for the first timer to be triggered
         std::chrono::steady_clock::time_point next_trigger =
-                active_timers_.empty() ?
+                active_timers_->empty() ?
                 current_time_ + std::chrono::seconds(1) :
-                active_timers_[0]->next_trigger_time();
+                active_timers_->next_expiration();
 
         auto current_time = std::chrono::steady_clock::now();
         if (current_time > next_trigger)
@@ -226,11 +219,6 @@ void ResourceEvent::event_service()
     cv_manipulation_.notify_all();
 }
 
-void ResourceEvent::sort_timers()
-{
-    std::sort(active_timers_.begin(), active_timers_.end(), event_compare);
-}
-
 void ResourceEvent::update_current_time()
 {
     current_time_ = std::chrono::steady_clock::now();
@@ -241,72 +229,44 @@ void ResourceEvent::do_timer_actions()
     std::chrono::steady_clock::time_point cancel_time =
             current_time_ + std::chrono::hours(24);
 
-    bool did_something = false;
-
     // Process pending orders
     {
         std::lock_guard<TimedMutex> lock(mutex_);
         for (TimedEventImpl* tp : pending_timers_)
         {
+            tp->hook_.pending = false;
+
             // Remove item from active timers
-            auto current_pos = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-            current_pos = std::find(current_pos, active_timers_.end(), tp);
-            if (current_pos != active_timers_.end())
-            {
-                active_timers_.erase(current_pos);
-            }
+            active_timers_->remove(tp);
 
             // Update timer info
             if (tp->update(current_time_, cancel_time))
             {
                 // Timer has to be activated: add to active timers
-                std::vector<TimedEventImpl*>::iterator low_bound;
-
-                // Insert on correct position
-                low_bound = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-                active_timers_.emplace(low_bound, tp);
+                active_timers_->insert(tp);
             }
         }
         pending_timers_.clear();
     }
 
     // Trigger active timers
-    skip_checking_active_timers_.store(false);
-    for (TimedEventImpl* tp : active_timers_)
+    active_timers_->advance(current_time_, expired_timers_);
+    for (size_t i = 0; i < expired_timers_.size(); ++i)
     {
-        if (tp->next_trigger_time() <= current_time_)
+        // Events unregistered by a previous callback are set to nullptr
+        TimedEventImpl* tp = expired_timers_[i];
+        if (nullptr != tp)
         {
-            did_something = true;
             tp->trigger(current_time_, cancel_time);
 
-            //! skip this iteration as active_timers has been manipulated
-            if (skip_checking_active_timers_.load())
+            // Keep the timer active if it was restarted by its callback
+            if (nullptr != expired_timers_[i] && tp->next_trigger_time() < cancel_time)
             {
-                break;
+                active_timers_->insert(tp);
             }
         }
-        else
-        {
-            break;
-        }
-    }
-
-    // If an action was made, keep active_timers_ sorted
-    if (did_something)
-    {
-        sort_timers();
-        active_timers_.erase(
-            std::lower_bound(active_timers_.begin(), active_timers_.end(), nullptr,
-            [cancel_time](
-                TimedEventImpl* a,
-                TimedEventImpl* b)
-            {
-                (void)b;
-                return a->next_trigger_time() < cancel_time;
-            }),
-            active_timers_.end()
-            );
     }
+    expired_timers_.clear();
 }
 
 void ResourceEvent::init_thread(
@@ -326,6 +286,24 @@ void ResourceEvent::init_thread(
                     }, thread_cfg, name_fmt, thread_id);
 }
 
+void ResourceEvent::init_thread(
+        const fastdds::rtps::ThreadSettings& thread_cfg,
+        const char* name_fmt,
+        uint32_t thread_id,
+        uint32_t thread_index)
+{
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    allow_vector_manipulation_ = false;
+    stop_.store(false);
+    resize_collections();
+
+    *thread_ = eprosima::create_thread([this]()
+                    {
+                        event_service();
+                    }, thread_cfg, name_fmt, thread_id, thread_index);
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
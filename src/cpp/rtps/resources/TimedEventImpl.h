@@ -26,7 +26,9 @@
 #include <fastdds/rtps/resources/TimedEvent.h>
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
+#include <limits>
 
 namespace eprosima {
 namespace fastrtps {
@@ -39,6 +41,9 @@ namespace rtps {
  */
 class TimedEventImpl
 {
+    friend class ResourceEvent;
+    friend class TimingWheel;
+
     using Callback = std::function<bool ()>;
 
 public:
@@ -156,6 +161,22 @@ private:
 
     //! Current state of this event
     std::atomic<StateCode> state_;
+
+    //! Position of this event on the collections of its ResourceEvent.
+    struct ResourceEventHook
+    {
+        //! Neighbours on the slot of the timing wheel.
+        TimedEventImpl* prev = nullptr;
+        TimedEventImpl* next = nullptr;
+
+        //! Slot of the timing wheel, or no_slot when the event is not on it.
+        uint32_t slot = std::numeric_limits<uint32_t>::max();
+
+        //! Whether the event is on the collection of events pending update action.
+        bool pending = false;
+    };
+
+    ResourceEventHook hook_;
 };
 
 } // namespace rtps
@@ -0,0 +1,363 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimingWheel.hpp
+ */
+
+#ifndef _RTPS_RESOURCES_TIMINGWHEEL_HPP_
+#define _RTPS_RESOURCES_TIMINGWHEEL_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "TimedEventImpl.h"
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Hierarchical timing wheel holding the active events of a ResourceEvent.
+ *
+ * Time is divided in ticks of one millisecond. The wheel has num_levels levels of slots_per_level slots, each slot
+ * of level n covering slots_per_level^n ticks, and every event is linked on the slot of the lowest level covering
+ * its trigger time. When the current tick enters the range of a slot of a higher level, its events are moved down
+ * to the lower levels. Inserting and removing an event are O(1) operations, since the events are linked through
+ * their hook.
+ *
+ * Events are returned at their exact trigger time, not at the beginning of their tick.
+ * This class is not thread safe, and is only used from the thread of the ResourceEvent, or with its mutex taken
+ * while that thread is waiting.
+ */
+class TimingWheel
+{
+public:
+
+    using Clock = std::chrono::steady_clock;
+
+    //! Duration of a tick.
+    using Tick = std::chrono::milliseconds;
+
+    static constexpr uint32_t bits_per_level = 8;
+    static constexpr uint32_t slots_per_level = 1u << bits_per_level;
+    static constexpr uint32_t num_levels = 4;
+
+    //! Value of the slot of an event that is not on the wheel.
+    static constexpr uint32_t no_slot = std::numeric_limits<uint32_t>::max();
+
+    explicit TimingWheel(
+            Clock::time_point origin = Clock::now())
+        : origin_(origin)
+    {
+        slots_.fill(nullptr);
+        level0_bits_.fill(0);
+        level_sizes_.fill(0);
+    }
+
+    bool empty() const
+    {
+        return 0 == size_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool contains(
+            const TimedEventImpl* event) const
+    {
+        return no_slot != event->hook_.slot;
+    }
+
+    /**
+     * Add an event to the wheel, using its current next_trigger_time().
+     * The event should not be on the wheel.
+     */
+    void insert(
+            TimedEventImpl* event)
+    {
+        assert(!contains(event));
+        link(event, slot_for(std::max(tick_of(event->next_trigger_time()), current_tick_)));
+        ++size_;
+    }
+
+    /**
+     * Remove an event from the wheel. Nothing is done if the event is not on it.
+     */
+    void remove(
+            TimedEventImpl* event)
+    {
+        if (contains(event))
+        {
+            unlink(event);
+            --size_;
+        }
+    }
+
+    /**
+     * Move the wheel up to a time, removing the events to be triggered at or before it.
+     *
+     * @param [in]     now      Current time.
+     * @param [in,out] expired  The events removed are added at the end, in ascending order of trigger time.
+     */
+    void advance(
+            Clock::time_point now,
+            std::vector<TimedEventImpl*>& expired)
+    {
+        size_t first_expired = expired.size();
+        uint64_t now_tick = tick_of(now);
+
+        while (!empty())
+        {
+            // All the events of ticks already passed are due, but only part of those of the current tick may be.
+            bool whole_slot = current_tick_ < now_tick;
+            uint32_t slot = static_cast<uint32_t>(current_tick_) & level_mask;
+            TimedEventImpl* event = slots_[slot];
+            while (nullptr != event)
+            {
+                TimedEventImpl* next = event->hook_.next;
+                if (whole_slot || event->next_trigger_time() <= now)
+                {
+                    unlink(event);
+                    --size_;
+                    expired.push_back(event);
+                }
+                event = next;
+            }
+
+            if (!whole_slot)
+            {
+                break;
+            }
+
+            // Skip the ticks until the events of the higher levels are moved down if there is nothing on the lowest
+            // level.
+            current_tick_ = 0 == level_sizes_[0] ? std::min(next_cascade_tick(), now_tick) : current_tick_ + 1;
+            cascade();
+        }
+
+        if (empty() && current_tick_ < now_tick)
+        {
+            current_tick_ = now_tick;
+        }
+
+        std::sort(expired.begin() + first_expired, expired.end(),
+                [](TimedEventImpl* lhs, TimedEventImpl* rhs)
+                {
+                    return lhs->next_trigger_time() < rhs->next_trigger_time();
+                });
+    }
+
+    /**
+     * Get the time at which the wheel should be advanced next.
+     * It is the trigger time of the first event, or the time at which the events on the higher levels are moved
+     * down if it is before.
+     *
+     * @return The time to advance the wheel, or Clock::time_point::max() if it is empty.
+     */
+    Clock::time_point next_expiration() const
+    {
+        Clock::time_point next = Clock::time_point::max();
+
+        if (0 < level_sizes_[0])
+        {
+            uint32_t start = static_cast<uint32_t>(current_tick_) & level_mask;
+            for (uint32_t n = 0; n < slots_per_level;)
+            {
+                uint32_t pos = (start + n) & level_mask;
+                uint64_t word = level0_bits_[pos >> 6] >> (pos & 63);
+                if (0 != word)
+                {
+                    while (0 == (word & 1))
+                    {
+                        word >>= 1;
+                        ++pos;
+                    }
+
+                    for (TimedEventImpl* event = slots_[pos]; nullptr != event; event = event->hook_.next)
+                    {
+                        next = std::min(next, event->next_trigger_time());
+                    }
+                    break;
+                }
+                n += 64 - (pos & 63);
+            }
+        }
+
+        if (level_sizes_[0] < size_)
+        {
+            next = std::min(next, time_of(next_cascade_tick()));
+        }
+
+        return next;
+    }
+
+private:
+
+    static constexpr uint32_t level_mask = slots_per_level - 1;
+
+    uint64_t tick_of(
+            Clock::time_point time) const
+    {
+        if (time <= origin_)
+        {
+            return 0;
+        }
+        return static_cast<uint64_t>(std::chrono::duration_cast<Tick>(time - origin_).count());
+    }
+
+    Clock::time_point time_of(
+            uint64_t tick) const
+    {
+        return origin_ + std::chrono::duration_cast<Clock::duration>(Tick(tick));
+    }
+
+    //! Next tick at which events of the lowest non-empty level above the first one are moved down.
+    uint64_t next_cascade_tick() const
+    {
+        uint32_t level = 1;
+        while (level + 1 < num_levels && 0 == level_sizes_[level])
+        {
+            ++level;
+        }
+        uint64_t round_mask = (uint64_t(1) << (bits_per_level * level)) - 1;
+        return (current_tick_ | round_mask) + 1;
+    }
+
+    //! Index on slots_ of the slot for a tick not before the current one.
+    uint32_t slot_for(
+            uint64_t tick) const
+    {
+        // Events beyond the last level are kept on its last slot, and placed again when it is cascaded.
+        constexpr uint64_t max_delta = (uint64_t(1) << (bits_per_level * num_levels)) - 1;
+        uint64_t delta = tick - current_tick_;
+        if (delta > max_delta)
+        {
+            tick = current_tick_ + max_delta;
+            delta = max_delta;
+        }
+
+        uint32_t level = 0;
+        while (delta >= (uint64_t(1) << (bits_per_level * (level + 1))))
+        {
+            ++level;
+        }
+
+        return level * slots_per_level +
+               (static_cast<uint32_t>(tick >> (bits_per_level * level)) & level_mask);
+    }
+
+    void link(
+            TimedEventImpl* event,
+            uint32_t slot)
+    {
+        TimedEventImpl*& head = slots_[slot];
+        event->hook_.slot = slot;
+        event->hook_.prev = nullptr;
+        event->hook_.next = head;
+        if (nullptr != head)
+        {
+            head->hook_.prev = event;
+        }
+        head = event;
+
+        ++level_sizes_[slot / slots_per_level];
+        if (slot < slots_per_level)
+        {
+            level0_bits_[slot >> 6] |= uint64_t(1) << (slot & 63);
+        }
+    }
+
+    void unlink(
+            TimedEventImpl* event)
+    {
+        uint32_t slot = event->hook_.slot;
+        if (nullptr != event->hook_.prev)
+        {
+            event->hook_.prev->hook_.next = event->hook_.next;
+        }
+        else
+        {
+            slots_[slot] = event->hook_.next;
+        }
+        if (nullptr != event->hook_.next)
+        {
+            event->hook_.next->hook_.prev = event->hook_.prev;
+        }
+        event->hook_.prev = nullptr;
+        event->hook_.next = nullptr;
+        event->hook_.slot = no_slot;
+
+        --level_sizes_[slot / slots_per_level];
+        if (slot < slots_per_level && nullptr == slots_[slot])
+        {
+            level0_bits_[slot >> 6] &= ~(uint64_t(1) << (slot & 63));
+        }
+    }
+
+    //! Move down the events of the higher level slots whose range starts at the current tick.
+    void cascade()
+    {
+        for (uint32_t level = 1; level < num_levels; ++level)
+        {
+            uint32_t shift = bits_per_level * level;
+            if (0 != (current_tick_ & ((uint64_t(1) << shift) - 1)))
+            {
+                break;
+            }
+
+            uint32_t slot = level * slots_per_level + (static_cast<uint32_t>(current_tick_ >> shift) & level_mask);
+            TimedEventImpl* event = slots_[slot];
+            slots_[slot] = nullptr;
+            while (nullptr != event)
+            {
+                TimedEventImpl* next = event->hook_.next;
+                --level_sizes_[level];
+                link(event, slot_for(std::max(tick_of(event->next_trigger_time()), current_tick_)));
+                event = next;
+            }
+        }
+    }
+
+    //! Time of the beginning of tick 0.
+    Clock::time_point origin_;
+
+    //! All the events of the ticks before this one have been returned.
+    uint64_t current_tick_ = 0;
+
+    //! Heads of the lists of events on each slot, level after level.
+    std::array<TimedEventImpl*, num_levels * slots_per_level> slots_;
+
+    //! Non-empty slots of the lowest level.
+    std::array<uint64_t, slots_per_level / 64> level0_bits_;
+
+    //! Number of events on each level.
+    std::array<size_t, num_levels> level_sizes_;
+
+    size_t size_ = 0;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif //_RTPS_RESOURCES_TIMINGWHEEL_HPP_
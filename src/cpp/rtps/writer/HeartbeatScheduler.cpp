@@ -0,0 +1,275 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HeartbeatScheduler.cpp
+ */
+
+#include <rtps/writer/HeartbeatScheduler.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+#include <fastdds/rtps/writer/StatefulWriter.h>
+
+#include <rtps/builtin/discovery/participant/DirectMessageSender.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+HeartbeatScheduler::HeartbeatScheduler(
+        RTPSParticipantImpl* participant,
+        ResourceEvent& service)
+    : participant_(participant)
+{
+    event_ = new TimedEvent(service, [this]() -> bool
+                    {
+                        return on_tick();
+                    }, 0);
+}
+
+HeartbeatScheduler::~HeartbeatScheduler()
+{
+    assert(writers_.empty());
+    delete event_;
+}
+
+bool HeartbeatScheduler::enabled_by_properties(
+        const PropertyPolicy& properties)
+{
+    const std::string* value = PropertyPolicyHelper::find_property(properties, "fastdds.heartbeat_coalescing");
+    return nullptr != value && "true" == *value;
+}
+
+void HeartbeatScheduler::register_writer(
+        StatefulWriter* writer)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    WriterEntry entry;
+    entry.writer = writer;
+    writers_.push_back(entry);
+
+    double period = writer->periodic_hb_event_->getIntervalMilliSec();
+    if (1 == writers_.size() || period < period_ms_)
+    {
+        period_ms_ = period;
+        event_->update_interval_millisec(period);
+    }
+}
+
+void HeartbeatScheduler::unregister_writer(
+        StatefulWriter* writer)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    writers_.erase(std::remove_if(writers_.begin(), writers_.end(), [writer](const WriterEntry& entry)
+            {
+                return writer == entry.writer;
+            }), writers_.end());
+
+    // The tick cannot take the writer anymore, but may be accessing it.
+    writers_released_.wait(lock, [this, writer]()
+            {
+                return writers_in_use_.end() ==
+                std::find(writers_in_use_.begin(), writers_in_use_.end(), writer);
+            });
+}
+
+void HeartbeatScheduler::activate(
+        StatefulWriter* writer)
+{
+    writer->coalesced_heartbeat_pending_ = true;
+    // Only starts the timer when it is not running, so it is cheap to call on every new sample.
+    // When called while the timer is being processed, the timer is started again after the processing.
+    event_->restart_timer();
+}
+
+void HeartbeatScheduler::deactivate(
+        StatefulWriter* writer)
+{
+    writer->coalesced_heartbeat_pending_ = false;
+}
+
+HeartbeatScheduler::Statistics HeartbeatScheduler::get_statistics() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return statistics_;
+}
+
+bool HeartbeatScheduler::on_tick()
+{
+    std::vector<StatefulWriter*> due_writers;
+    bool pending = false;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        // Writers due before the next tick are served in this one.
+        std::chrono::steady_clock::duration tolerance =
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double, std::milli>(period_ms_ / 2));
+        double min_period = (std::numeric_limits<double>::max)();
+
+        for (WriterEntry& entry : writers_)
+        {
+            StatefulWriter* writer = entry.writer;
+            double period = writer->periodic_hb_event_->getIntervalMilliSec();
+            min_period = (std::min)(min_period, period);
+
+            if (!writer->coalesced_heartbeat_pending_)
+            {
+                // Heartbeats will start on the next tick after the writer is activated again.
+                entry.next_due = std::chrono::steady_clock::time_point();
+                continue;
+            }
+
+            if (now + tolerance < entry.next_due)
+            {
+                pending = true;
+                continue;
+            }
+
+            entry.next_due = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double, std::milli>(period));
+            due_writers.push_back(writer);
+        }
+
+        if (!writers_.empty() && min_period != period_ms_)
+        {
+            period_ms_ = min_period;
+            event_->update_interval_millisec(min_period);
+        }
+    }
+
+    // The mutex of the scheduler is not held while accessing the writers, so writers can be registered and
+    // unregistered meanwhile.
+    std::map<GuidPrefix_t, Destination> destinations;
+    std::vector<StatefulWriter*> in_use;
+    for (StatefulWriter* writer : due_writers)
+    {
+        in_use.assign(1, writer);
+        if (!acquire(in_use))
+        {
+            continue;
+        }
+
+        writer->prepare_coalesced_heartbeat([&destinations, writer](
+                    const GUID_t& reader,
+                    const LocatorSelectorEntry& locators)
+                {
+                    Destination& destination = destinations[reader.guidPrefix];
+                    destination.readers.push_back(reader);
+
+                    const ResourceLimitedVector<Locator_t>& reader_locators =
+                    locators.unicast.empty() ? locators.multicast : locators.unicast;
+                    for (const Locator_t& locator : reader_locators)
+                    {
+                        destination.locators.push_back(locator);
+                    }
+
+                    if (destination.writers.empty() || writer != destination.writers.back())
+                    {
+                        destination.writers.push_back(writer);
+                    }
+                });
+
+        pending = pending || writer->coalesced_heartbeat_pending_;
+        release();
+    }
+
+    if (!destinations.empty())
+    {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            ++statistics_.ticks;
+        }
+
+        for (auto& destination : destinations)
+        {
+            send_to(destination.second);
+        }
+    }
+
+    return pending;
+}
+
+void HeartbeatScheduler::send_to(
+        Destination& destination)
+{
+    // Writers unregistered since the heartbeats were prepared are skipped.
+    if (!acquire(destination.writers))
+    {
+        return;
+    }
+
+    DirectMessageSender sender(participant_, &destination.readers, &destination.locators);
+
+    try
+    {
+        // The endpoint of the group is set to each writer before adding its heartbeat. All the writers remain in use
+        // until the message is sent on the destruction of the group.
+        RTPSMessageGroup group(participant_, destination.writers.front(), &sender);
+        for (StatefulWriter* writer : destination.writers)
+        {
+            std::lock_guard<RecursiveTimedMutex> guard(writer->getMutex());
+            group.endpoint(writer);
+            writer->add_coalesced_heartbeat_nts(group);
+        }
+    }
+    catch (const RTPSMessageGroup::timeout&)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_WRITER, "Max blocking time reached");
+    }
+
+    release();
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    statistics_.heartbeats += destination.writers.size();
+    ++statistics_.messages;
+}
+
+bool HeartbeatScheduler::acquire(
+        std::vector<StatefulWriter*>& writers)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    writers.erase(std::remove_if(writers.begin(), writers.end(), [this](StatefulWriter* writer)
+            {
+                return writers_.end() == std::find_if(writers_.begin(), writers_.end(),
+                [writer](const WriterEntry& entry)
+                {
+                    return writer == entry.writer;
+                });
+            }), writers.end());
+    writers_in_use_ = writers;
+    return !writers_in_use_.empty();
+}
+
+void HeartbeatScheduler::release()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        writers_in_use_.clear();
+    }
+    writers_released_.notify_all();
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
@@ -0,0 +1,187 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HeartbeatScheduler.hpp
+ */
+
+#ifndef _RTPS_WRITER_HEARTBEATSCHEDULER_HPP_
+#define _RTPS_WRITER_HEARTBEATSCHEDULER_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/LocatorList.hpp>
+
+#ifndef TEST_FRIENDS
+#define TEST_FRIENDS
+#endif // TEST_FRIENDS
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class ResourceEvent;
+class RTPSParticipantImpl;
+class StatefulWriter;
+class TimedEvent;
+
+/**
+ * Sends the periodic heartbeats of the reliable writers of a participant from a single timer.
+ *
+ * On each tick, the heartbeats of all the registered writers which are due are grouped by remote participant, and
+ * the ones directed to the same participant are sent in the same RTPS message. With W writers due whose readers are
+ * on P remote participants, a tick sends P messages instead of the W x P sent by the per-writer timers.
+ * The timer is running only while some registered writer has unacknowledged changes, and its period is the shortest
+ * heartbeat period of the registered writers.
+ *
+ * It is enabled with the participant property fastdds.heartbeat_coalescing set to "true".
+ */
+class HeartbeatScheduler
+{
+    TEST_FRIENDS
+
+public:
+
+    //! Counters of the heartbeats sent by the scheduler.
+    struct Statistics
+    {
+        //! Number of ticks which sent heartbeats.
+        uint64_t ticks = 0;
+        //! Number of heartbeats added to the messages, one per writer and remote participant.
+        uint64_t heartbeats = 0;
+        //! Number of groups of heartbeats sent, one per remote participant and tick.
+        uint64_t messages = 0;
+    };
+
+    HeartbeatScheduler(
+            RTPSParticipantImpl* participant,
+            ResourceEvent& service);
+
+    ~HeartbeatScheduler();
+
+    /**
+     * Check whether the heartbeat scheduler is enabled by the properties of a participant.
+     *
+     * @param properties Properties of the participant.
+     * @return true when the fastdds.heartbeat_coalescing property is set to "true".
+     */
+    static bool enabled_by_properties(
+            const PropertyPolicy& properties);
+
+    /**
+     * Make the scheduler responsible of the periodic heartbeats of a writer.
+     *
+     * @param writer Writer to register.
+     */
+    void register_writer(
+            StatefulWriter* writer);
+
+    /**
+     * Stop sending the periodic heartbeats of a writer.
+     * When this method returns, the scheduler is not accessing the writer.
+     * It only waits for a tick which is currently accessing this writer, and must not be called with the mutex of the
+     * writer taken.
+     *
+     * @param writer Writer to unregister.
+     */
+    void unregister_writer(
+            StatefulWriter* writer);
+
+    /**
+     * Request periodic heartbeats for a registered writer, which will be sent on the next tick.
+     * It can be called with the mutex of the writer taken.
+     *
+     * @param writer Writer requesting periodic heartbeats.
+     */
+    void activate(
+            StatefulWriter* writer);
+
+    /**
+     * Stop the periodic heartbeats of a registered writer until it is activated again.
+     * It can be called with the mutex of the writer taken.
+     *
+     * @param writer Writer not requiring periodic heartbeats.
+     */
+    void deactivate(
+            StatefulWriter* writer);
+
+    //! Get the counters of the heartbeats sent.
+    Statistics get_statistics() const;
+
+private:
+
+    struct WriterEntry
+    {
+        StatefulWriter* writer = nullptr;
+        std::chrono::steady_clock::time_point next_due;
+    };
+
+    //! Heartbeats directed to the same remote participant in a tick.
+    struct Destination
+    {
+        std::vector<GUID_t> readers;
+        LocatorList_t locators;
+        std::vector<StatefulWriter*> writers;
+    };
+
+    bool on_tick();
+
+    void send_to(
+            Destination& destination);
+
+    /**
+     * Mark writers as being accessed by the tick, so they are not destroyed meanwhile.
+     *
+     * @param writers Writers to access. The ones already unregistered are removed from the collection.
+     * @return true when some of the writers is still registered.
+     */
+    bool acquire(
+            std::vector<StatefulWriter*>& writers);
+
+    //! Finish accessing the writers marked by acquire().
+    void release();
+
+    RTPSParticipantImpl* participant_;
+
+    //! Protects the collection of writers, the writers in use and the statistics. Not held while accessing writers.
+    mutable std::mutex mutex_;
+
+    //! Notified when the tick finishes accessing some writers.
+    std::condition_variable writers_released_;
+
+    std::vector<WriterEntry> writers_;
+
+    //! Writers being accessed by the tick, which cannot be unregistered until released.
+    std::vector<StatefulWriter*> writers_in_use_;
+
+    //! Current period of the timer, in milliseconds.
+    double period_ms_ = 0;
+
+    Statistics statistics_;
+
+    TimedEvent* event_ = nullptr;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // _RTPS_WRITER_HEARTBEATSCHEDULER_HPP_
@@ -21,8 +21,10 @@
 
 #include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
+#include <rtps/history/PoolMemoryUsage.hpp>
 
 #include <rtps/DataSharing/DataSharingNotifier.hpp>
+#include <rtps/common/SampleBatch.hpp>
 #include <rtps/DataSharing/WriterPool.hpp>
 
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -30,6 +32,8 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/StatefulWriter.h>
+#include <fastdds/rtps/writer/StatelessWriter.h>
 
 #include <fastdds/rtps/history/WriterHistory.h>
 
@@ -265,7 +269,8 @@ SequenceNumber_t RTPSWriter::get_seq_num_max()
     CacheChange_t* change;
     if (mp_history->get_max_change(&change) && change != nullptr)
     {
-        return change->sequenceNumber;
+        // A batch covers several sequence numbers
+        return change->sequenceNumber + (sequence_number_span(*change) - 1);
     }
     else
     {
@@ -400,6 +405,19 @@ bool RTPSWriter::is_datasharing_compatible() const
     return (m_att.data_sharing_configuration().kind() != OFF);
 }
 
+bool RTPSWriter::is_sample_batch(
+        const CacheChange_t& change) const
+{
+    // Payloads of other writers may start like a batch
+    return sample_batches_ && detail::SampleBatch::is_batch(change.serializedPayload);
+}
+
+uint32_t RTPSWriter::sequence_number_span(
+        const CacheChange_t& change) const
+{
+    return is_sample_batch(change) ? detail::SampleBatch::sequence_number_span(change) : 1u;
+}
+
 bool RTPSWriter::is_datasharing_compatible_with(
         const ReaderProxyData& rdata) const
 {
@@ -432,6 +450,39 @@ bool RTPSWriter::is_pool_initialized() const
     return true;
 }
 
+void RTPSWriter::get_memory_usage(
+        fastdds::rtps::EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    usage.guid = m_guid;
+    get_pools_memory_usage(change_pool_, payload_pool_, usage);
+    if (nullptr != mp_history)
+    {
+        usage.history = mp_history->get_memory_usage_nts();
+    }
+
+    usage.proxies = fastdds::rtps::MemoryUsage();
+    if (const StatefulWriter* stateful = dynamic_cast<const StatefulWriter*>(this))
+    {
+        stateful->get_matched_readers_memory_usage_nts(usage.proxies);
+    }
+    else if (const StatelessWriter* stateless = dynamic_cast<const StatelessWriter*>(this))
+    {
+        stateless->get_matched_readers_memory_usage_nts(usage.proxies);
+    }
+}
+
+void RTPSWriter::begin_sample_batch(
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    flow_controller_->begin_batch(this, max_blocking_time);
+}
+
+void RTPSWriter::end_sample_batch()
+{
+    flow_controller_->end_batch(this);
+}
+
 bool RTPSWriter::send_nts(
         CDRMessage_t* message,
         const LocatorSelectorSender& locator_selector,
@@ -24,6 +24,7 @@
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 
+#include <rtps/common/ContainerMemoryUsage.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/DataSharing/DataSharingListener.hpp>
 #include <rtps/DataSharing/DataSharingNotifier.hpp>
@@ -217,6 +218,15 @@ bool ReaderLocator::is_datasharing_reader() const
     return datasharing_notifier_ && datasharing_notifier_->is_enabled();
 }
 
+fastdds::rtps::MemoryUsage ReaderLocator::get_memory_usage() const
+{
+    fastdds::rtps::MemoryUsage usage = get_locator_selector_entry_memory_usage(general_locator_info_);
+    usage += get_locator_selector_entry_memory_usage(async_locator_info_);
+    usage += get_container_memory_usage(guid_prefix_as_vector_);
+    usage += get_container_memory_usage(guid_as_vector_);
+    return usage;
+}
+
 void ReaderLocator::datasharing_notify()
 {
     RTPSReader* reader = nullptr;
@@ -26,6 +26,7 @@
 #include <utils/TimeConversion.hpp>
 #include <fastdds/rtps/common/LocatorListComparisons.hpp>
 
+#include <rtps/common/ContainerMemoryUsage.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/history/HistoryAttributesExtension.hpp>
 
@@ -63,7 +64,7 @@ ReaderProxy::ReaderProxy(
     auto participant = writer_->getRTPSParticipant();
     if (nullptr != participant)
     {
-        nack_supression_event_ = new TimedEvent(participant->getEventResource(),
+        nack_supression_event_ = new TimedEvent(participant->getEventResource(writer_->getGuid()),
                         [&]() -> bool
                         {
                             writer_->perform_nack_supression(guid());
@@ -71,7 +72,7 @@ ReaderProxy::ReaderProxy(
                         },
                         fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(times.nackSupressionDuration));
 
-        initial_heartbeat_event_ = new TimedEvent(participant->getEventResource(),
+        initial_heartbeat_event_ = new TimedEvent(participant->getEventResource(writer_->getGuid()),
                         [&]() -> bool
                         {
                             writer_->intraprocess_heartbeat(this);
@@ -85,6 +86,12 @@ ReaderProxy::ReaderProxy(
 bool ReaderProxy::rtps_is_relevant(
         CacheChange_t* change) const
 {
+    // A batch is never sent to a reader which has not announced it is able to unbatch it
+    if (!locator_info_.accepts_sample_batches() && writer_->is_sample_batch(*change))
+    {
+        return false;
+    }
+
     auto filter = writer_->reader_data_filter();
     if (nullptr != filter)
     {
@@ -121,6 +128,7 @@ void ReaderProxy::start(
         reader_attributes.remote_locators().multicast,
         reader_attributes.m_expectsInlineQos,
         is_datasharing);
+    locator_info_.accepts_sample_batches(reader_attributes.sample_batches());
 
     is_active_ = true;
     durability_kind_ = reader_attributes.m_qos.m_durability.durabilityKind();
@@ -159,6 +167,7 @@ bool ReaderProxy::update(
         reader_attributes.remote_locators().unicast,
         reader_attributes.remote_locators().multicast,
         reader_attributes.m_expectsInlineQos);
+    locator_info_.accepts_sample_batches(reader_attributes.sample_batches());
 
     return true;
 }
@@ -173,6 +182,7 @@ void ReaderProxy::stop()
     next_expected_acknack_count_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
+    rtt_estimator_.reset();
 }
 
 void ReaderProxy::disable_timers()
@@ -187,6 +197,13 @@ void ReaderProxy::disable_timers()
     }
 }
 
+fastdds::rtps::MemoryUsage ReaderProxy::get_memory_usage() const
+{
+    fastdds::rtps::MemoryUsage usage = get_container_memory_usage(changes_for_reader_);
+    usage += locator_info_.get_memory_usage();
+    return usage;
+}
+
 void ReaderProxy::update_nack_supression_interval(
         const Duration_t& interval)
 {
@@ -306,11 +323,13 @@ bool ReaderProxy::change_is_unsent(
         if (is_reliable_ && !chit->has_been_delivered())
         {
             need_reactivate_periodic_heartbeat |= true;
-            SequenceNumber_t prev =
-                    (changes_for_reader_.begin() != chit ?
-                    std::prev(chit)->getSequenceNumber() :
-                    changes_low_mark_
-                    ) + 1;
+            SequenceNumber_t prev = changes_low_mark_ + 1;
+            if (changes_for_reader_.begin() != chit)
+            {
+                const ChangeForReader_t& prev_change = *std::prev(chit);
+                prev = prev_change.getSequenceNumber() +
+                        writer_->sequence_number_span(*prev_change.getChange());
+            }
 
             if (prev != chit->getSequenceNumber())
             {
@@ -435,7 +454,24 @@ bool ReaderProxy::requested_changes_set(
                     }
                     else if ((sit >= min_seq_in_history) && (sit > changes_low_mark_))
                     {
-                        gap_builder.add(sit);
+                        // The sequence number may be covered by a previous batch
+                        ChangeIterator batch_it = find_change(sit, false);
+                        if (changes_for_reader_.begin() != batch_it &&
+                                sit < std::prev(batch_it)->getSequenceNumber() +
+                                writer_->sequence_number_span(*std::prev(batch_it)->getChange()))
+                        {
+                            --batch_it;
+                            if (UNACKNOWLEDGED == batch_it->getStatus())
+                            {
+                                batch_it->setStatus(REQUESTED);
+                                batch_it->markAllFragmentsAsUnsent();
+                                isSomeoneWasSetRequested = true;
+                            }
+                        }
+                        else
+                        {
+                            gap_builder.add(sit);
+                        }
                     }
                 });
     }
@@ -448,6 +484,48 @@ bool ReaderProxy::requested_changes_set(
     return isSomeoneWasSetRequested;
 }
 
+void ReaderProxy::requested_changes_get(
+        std::vector<SequenceNumber_t>& seq_nums) const
+{
+    for (const ChangeForReader_t& change : changes_for_reader_)
+    {
+        if (REQUESTED == change.getStatus())
+        {
+            seq_nums.push_back(change.getSequenceNumber());
+        }
+    }
+}
+
+uint32_t ReaderProxy::requested_changes_merge(
+        const std::vector<SequenceNumber_t>& seq_nums)
+{
+    uint32_t merged = 0;
+
+    // Both collections are sorted, so they can be walked in parallel.
+    ChangeIterator chit = changes_for_reader_.begin();
+    for (const SequenceNumber_t& seq_num : seq_nums)
+    {
+        while (chit != changes_for_reader_.end() && chit->getSequenceNumber() < seq_num)
+        {
+            ++chit;
+        }
+
+        if (chit == changes_for_reader_.end())
+        {
+            break;
+        }
+
+        if (chit->getSequenceNumber() == seq_num && UNACKNOWLEDGED == chit->getStatus())
+        {
+            chit->setStatus(REQUESTED);
+            chit->markAllFragmentsAsUnsent();
+            ++merged;
+        }
+    }
+
+    return merged;
+}
+
 bool ReaderProxy::process_initial_acknack(
         const std::function<void(ChangeForReader_t& change)>& func)
 {
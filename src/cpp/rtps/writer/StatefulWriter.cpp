@@ -17,11 +17,14 @@
  *
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <mutex>
 #include <stdexcept>
 #include <vector>
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/history/WriterHistory.h>
@@ -39,6 +42,7 @@
 
 #include <rtps/builtin/BuiltinProtocols.h>
 #include <rtps/builtin/liveliness/WLP.h>
+#include <rtps/common/ContainerMemoryUsage.hpp>
 #include <rtps/DataSharing/DataSharingNotifier.hpp>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <rtps/DataSharing/WriterPool.hpp>
@@ -48,6 +52,7 @@
 #include <rtps/network/utils/external_locators.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/RTPSDomainImpl.hpp>
+#include <rtps/writer/HeartbeatScheduler.hpp>
 
 #ifdef FASTDDS_STATISTICS
 #include <statistics/types/monitorservice_types.hpp>
@@ -163,6 +168,24 @@ static bool for_matched_readers(
     return for_matched_readers(reader_vector_3, fun);
 }
 
+/**
+ * Checks whether two locator selector entries have at least one multicast locator in common.
+ */
+static bool share_multicast_locator(
+        const LocatorSelectorEntry* entry_1,
+        const LocatorSelectorEntry* entry_2)
+{
+    for (const Locator_t& locator : entry_1->multicast)
+    {
+        if (std::find(entry_2->multicast.begin(), entry_2->multicast.end(), locator) != entry_2->multicast.end())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 using namespace std::chrono;
 
 StatefulWriter::StatefulWriter(
@@ -279,27 +302,66 @@ void StatefulWriter::init(
     auto push_mode = PropertyPolicyHelper::find_property(att.endpoint.properties, "fastdds.push_mode");
     m_pushMode = !((nullptr != push_mode) && ("false" == *push_mode));
 
+    // ACKNACKs are sent by the readers after their heartbeat response delay.
+    rtt_adaptive_timing_ = RTTAdaptiveTiming::from_properties(att.endpoint.properties,
+                    fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod),
+                    fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(ReaderTimes().heartbeatResponseDelay));
+
+    auto nack_aggregation = PropertyPolicyHelper::find_property(att.endpoint.properties,
+                    "fastdds.nack_aggregation_window");
+    if (nullptr != nack_aggregation)
+    {
+        char* ptr = nullptr;
+        long window = strtol(nack_aggregation->c_str(), &ptr, 10);
+
+        if (nack_aggregation->c_str() == ptr || '\0' != *ptr || 0 > window || 60000 < window)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                    "Not valid value for fastdds.nack_aggregation_window property. NACK aggregation disabled");
+        }
+        else
+        {
+            nack_aggregation_window_ms_ = static_cast<double>(window);
+        }
+    }
+
     periodic_hb_event_ = new TimedEvent(
-        pimpl->getEventResource(),
+        pimpl->getEventResource(m_guid),
         [&]() -> bool
         {
             return send_periodic_heartbeat();
         },
         fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
 
+    // The periodic heartbeats of user writers may be sent by the participant, together with those of other writers.
+    if (!m_guid.is_builtin())
+    {
+        heartbeat_scheduler_ = pimpl->heartbeat_scheduler();
+#if HAVE_SECURITY
+        if (pimpl->is_secure())
+        {
+            heartbeat_scheduler_ = nullptr;
+        }
+#endif // if HAVE_SECURITY
+        if (nullptr != heartbeat_scheduler_)
+        {
+            heartbeat_scheduler_->register_writer(this);
+        }
+    }
+
     nack_response_event_ = new TimedEvent(
-        pimpl->getEventResource(),
+        pimpl->getEventResource(m_guid),
         [&]() -> bool
         {
             perform_nack_response();
             return false;
         },
-        fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(m_times.nackResponseDelay));
+        nack_response_interval_ms(m_times));
 
     if (disable_positive_acks_)
     {
         ack_event_ = new TimedEvent(
-            pimpl->getEventResource(),
+            pimpl->getEventResource(m_guid),
             [&]() -> bool
             {
                 return ack_timer_expired();
@@ -317,6 +379,12 @@ StatefulWriter::~StatefulWriter()
 {
     EPROSIMA_LOG_INFO(RTPS_WRITER, "StatefulWriter destructor");
 
+    if (nullptr != heartbeat_scheduler_)
+    {
+        heartbeat_scheduler_->unregister_writer(this);
+        heartbeat_scheduler_ = nullptr;
+    }
+
     // Disable timed events, because their callbacks use cache changes
     if (disable_positive_acks_)
     {
@@ -452,7 +520,7 @@ void StatefulWriter::unsent_change_added_to_history(
         }
         else
         {
-            periodic_hb_event_->restart_timer(max_blocking_time);
+            restart_periodic_heartbeat(max_blocking_time);
         }
     }
     else
@@ -614,6 +682,18 @@ void StatefulWriter::send_heartbeat_to_all_readers()
             add_gaps_for_holes_in_history_(group);
 
             send_heartbeat_nts_(locator_selector_general_.all_remote_readers.size(), group, disable_positive_acks_);
+
+            if (rtt_adaptive_timing_.enabled && !disable_positive_acks_)
+            {
+                auto now = std::chrono::steady_clock::now();
+                for (ReaderProxy* reader : matched_remote_readers_)
+                {
+                    if (reader->is_reliable())
+                    {
+                        reader->heartbeat_sent(now);
+                    }
+                }
+            }
         }
     }
 }
@@ -690,12 +770,54 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
     uint32_t n_fragments = change->getFragmentCount();
     FragmentNumber_t min_unsent_fragment = 0;
     bool need_reactivate_periodic_heartbeat = false;
+    bool deferred_by_congestion = false;
+    bool sent_to_some_reader = false;
+    uint32_t bytes_per_submessage = (0 < n_fragments) ? change->getFragmentSize() : change->serializedPayload.length;
+    std::vector<LocatorSelectorEntry*> charged_multicast_entries;
+    // Readers whose bytes were reserved in the current round and not sent yet.
+    std::vector<ReaderProxy*> charged_readers;
+
+    auto try_reserve_bytes = [this, bytes_per_submessage](const ReaderProxy* reader)
+            {
+                if (reader->is_reliable() &&
+                        !flow_controller_->try_reserve_destination_bytes(reader->guid(), bytes_per_submessage))
+                {
+                    return false;
+                }
+
+                if (!flow_controller_->try_reserve_participant_bytes(this, reader->guid().guidPrefix,
+                        bytes_per_submessage))
+                {
+                    if (reader->is_reliable())
+                    {
+                        flow_controller_->refund_destination_bytes(reader->guid(), bytes_per_submessage);
+                    }
+                    return false;
+                }
+
+                return true;
+            };
+
+    auto refund_charged_readers = [this, bytes_per_submessage, &charged_readers]()
+            {
+                for (ReaderProxy* reader : charged_readers)
+                {
+                    if (reader->is_reliable())
+                    {
+                        flow_controller_->refund_destination_bytes(reader->guid(), bytes_per_submessage);
+                    }
+                    flow_controller_->refund_participant_bytes(reader->guid().guidPrefix, bytes_per_submessage);
+                }
+                charged_readers.clear();
+            };
 
     while (DeliveryRetCode::DELIVERED == ret_code &&
             min_unsent_fragment != n_fragments + 1)
     {
         SequenceNumber_t gap_seq_for_all = SequenceNumber_t::unknown();
         locator_selector.locator_selector.reset(false);
+        charged_multicast_entries.clear();
+        charged_readers.clear();
         auto first_relevant_reader = matched_remote_readers_.begin();
         bool inline_qos = false;
         bool should_be_sent = false;
@@ -710,13 +832,46 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
                     need_reactivate_periodic_heartbeat) &&
                     (0 == n_fragments || min_unsent_fragment >= next_unsent_frag))
             {
-                if (min_unsent_fragment > next_unsent_frag)
+                // A reader needing an earlier fragment discards the readers selected so far.
+                bool restarts_selection = min_unsent_fragment > next_unsent_frag;
+
+                // A reader listening on a multicast locator of an already charged reader gets the same datagram,
+                // so it is not charged again.
+                LocatorSelectorEntry* reader_entry = (*remote_reader)->general_locator_selector_entry();
+                bool shares_charged_datagram = !restarts_selection && !m_separateSendingEnabled &&
+                        std::any_of(charged_multicast_entries.begin(), charged_multicast_entries.end(),
+                                [reader_entry](const LocatorSelectorEntry* entry)
+                                {
+                                    return share_multicast_locator(entry, reader_entry);
+                                });
+
+                // Leave the change unsent for readers whose congestion window or participant rate are exhausted.
+                if (!shares_charged_datagram && !try_reserve_bytes(*remote_reader))
+                {
+                    deferred_by_congestion = true;
+                    (*remote_reader)->active(false);
+                    continue;
+                }
+
+                if (restarts_selection)
                 {
+                    // The readers selected so far will not be sent anything in this round.
+                    refund_charged_readers();
+                    charged_multicast_entries.clear();
                     locator_selector.locator_selector.reset(false);
                     first_relevant_reader = remote_reader;
                     min_unsent_fragment = next_unsent_frag;
                 }
 
+                if (!shares_charged_datagram)
+                {
+                    charged_readers.push_back(*remote_reader);
+                    if (!reader_entry->multicast.empty())
+                    {
+                        charged_multicast_entries.push_back(reader_entry);
+                    }
+                }
+
                 (*remote_reader)->active(true);
                 locator_selector.locator_selector.enable((*remote_reader)->guid());
                 should_be_sent = true;
@@ -776,6 +931,8 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
             group.add_gap(gap_seq_for_all, SequenceNumberSet_t(change->sequenceNumber));
         }
 
+        sent_to_some_reader |= should_be_sent;
+
         try
         {
             if (should_be_sent)
@@ -792,6 +949,7 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
                             {
                                 if (group.add_data_frag(*change, min_unsent_fragment, inline_qos))
                                 {
+                                    charged_readers.clear();
                                     for (auto remote_reader = first_relevant_reader;
                                             remote_reader != matched_remote_readers_.end();
                                             ++remote_reader)
@@ -832,6 +990,7 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
                         {
                             if (group.add_data(*change, inline_qos))
                             {
+                                charged_readers.clear();
                                 for (auto remote_reader = first_relevant_reader;
                                         remote_reader != matched_remote_readers_.end();
                                         ++remote_reader)
@@ -878,6 +1037,8 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
                                 {
                                     if (group.add_data_frag(*change, min_unsent_fragment, inline_qos))
                                     {
+                                        charged_readers.erase(std::remove(charged_readers.begin(),
+                                                charged_readers.end(), *remote_reader), charged_readers.end());
                                         bool allFragmentsSent = false;
                                         (*remote_reader)->mark_fragment_as_sent_for_change(
                                             change->sequenceNumber,
@@ -910,6 +1071,8 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
                             {
                                 if (group.add_data(*change, (*remote_reader)->expects_inline_qos()))
                                 {
+                                    charged_readers.erase(std::remove(charged_readers.begin(),
+                                            charged_readers.end(), *remote_reader), charged_readers.end());
                                     if (!(*remote_reader)->is_reliable())
                                     {
                                         (*remote_reader)->acked_changes_set(change->sequenceNumber + 1);
@@ -949,6 +1112,9 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
             ret_code = DeliveryRetCode::EXCEEDED_LIMIT;
         }
 
+        // Give back the bytes reserved for the readers which were not sent anything.
+        refund_charged_readers();
+
         if (disable_positive_acks_ && last_sequence_number_ == SequenceNumber_t())
         {
             last_sequence_number_ = change->sequenceNumber;
@@ -970,9 +1136,22 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
 
     }
 
+    if (deferred_by_congestion && DeliveryRetCode::DELIVERED == ret_code)
+    {
+        if (sent_to_some_reader)
+        {
+            // Schedule the change again for the readers that were left behind.
+            flow_controller_->add_old_sample(this, change);
+        }
+        else
+        {
+            ret_code = DeliveryRetCode::EXCEEDED_DESTINATION_LIMIT;
+        }
+    }
+
     if (need_reactivate_periodic_heartbeat)
     {
-        periodic_hb_event_->restart_timer(max_blocking_time);
+        restart_periodic_heartbeat(max_blocking_time);
     }
 
     return ret_code;
@@ -1212,7 +1391,7 @@ bool StatefulWriter::matched_reader_add(
 
                 // Always activate heartbeat period. We need a confirmation of the reader.
                 // The state has to be updated.
-                periodic_hb_event_->restart_timer(std::chrono::steady_clock::now() + std::chrono::hours(24));
+                restart_periodic_heartbeat(std::chrono::steady_clock::now() + std::chrono::hours(24));
             }
             catch (const RTPSMessageGroup::timeout&)
             {
@@ -1308,6 +1487,7 @@ bool StatefulWriter::matched_reader_remove(
                 EPROSIMA_LOG_INFO(RTPS_WRITER, "Reader Proxy removed: " << reader_guid);
                 rproxy = std::move(*it);
                 it = matched_remote_readers_.erase(it);
+                flow_controller_->remove_destination(reader_guid);
                 break;
             }
         }
@@ -1321,6 +1501,10 @@ bool StatefulWriter::matched_reader_remove(
     if (getMatchedReadersSize() == 0)
     {
         periodic_hb_event_->cancel_timer();
+        if (nullptr != heartbeat_scheduler_)
+        {
+            heartbeat_scheduler_->deactivate(this);
+        }
     }
 
     if (rproxy != nullptr)
@@ -1368,6 +1552,27 @@ bool StatefulWriter::matched_reader_is_matched(
                    );
 }
 
+void StatefulWriter::get_matched_readers_memory_usage_nts(
+        fastdds::rtps::MemoryUsage& usage) const
+{
+    auto add_proxies = [&usage](const ResourceLimitedVector<ReaderProxy*>& proxies, bool in_use)
+            {
+                usage += get_container_memory_usage(proxies);
+                for (const ReaderProxy* proxy : proxies)
+                {
+                    fastdds::rtps::MemoryUsage proxy_usage = proxy->get_memory_usage();
+                    proxy_usage.live_bytes = in_use ? proxy_usage.live_bytes + sizeof(ReaderProxy) : 0;
+                    proxy_usage.reserved_bytes += sizeof(ReaderProxy);
+                    usage += proxy_usage;
+                }
+            };
+
+    add_proxies(matched_remote_readers_, true);
+    add_proxies(matched_local_readers_, true);
+    add_proxies(matched_datasharing_readers_, true);
+    add_proxies(matched_readers_pool_, false);
+}
+
 bool StatefulWriter::matched_reader_lookup(
         GUID_t& readerGuid,
         ReaderProxy** RP)
@@ -1694,7 +1899,7 @@ void StatefulWriter::updateTimes(
     {
         if (nack_response_event_ != nullptr)
         {
-            nack_response_event_->update_interval(times.nackResponseDelay);
+            nack_response_event_->update_interval_millisec(nack_response_interval_ms(times));
         }
     }
     if (m_times.nackSupressionDuration != times.nackSupressionDuration)
@@ -1805,6 +2010,111 @@ bool StatefulWriter::send_periodic_heartbeat(
     return unacked_changes;
 }
 
+void StatefulWriter::restart_periodic_heartbeat()
+{
+    if (nullptr != heartbeat_scheduler_)
+    {
+        heartbeat_scheduler_->activate(this);
+    }
+    else
+    {
+        periodic_hb_event_->restart_timer();
+    }
+}
+
+void StatefulWriter::restart_periodic_heartbeat(
+        const std::chrono::steady_clock::time_point& max_blocking_time)
+{
+    if (nullptr != heartbeat_scheduler_)
+    {
+        heartbeat_scheduler_->activate(this);
+    }
+    else
+    {
+        periodic_hb_event_->restart_timer(max_blocking_time);
+    }
+}
+
+void StatefulWriter::prepare_coalesced_heartbeat(
+        const std::function<void(const GUID_t&, const LocatorSelectorEntry&)>& add_remote_reader)
+{
+    std::lock_guard<RecursiveTimedMutex> guardW(mp_mutex);
+
+    SequenceNumber_t first_seq_to_check_acknowledge = get_seq_num_min();
+    if (SequenceNumber_t::unknown() == first_seq_to_check_acknowledge)
+    {
+        first_seq_to_check_acknowledge = mp_history->next_sequence_number() - 1;
+    }
+
+    bool unacked_changes = for_matched_readers(matched_local_readers_, matched_datasharing_readers_,
+                    matched_remote_readers_,
+                    [first_seq_to_check_acknowledge](ReaderProxy* reader)
+                    {
+                        return reader->has_unacknowledged(first_seq_to_check_acknowledge);
+                    }
+                    );
+
+    if (!unacked_changes)
+    {
+        // Taken with the mutex, so a writer activating the heartbeats again is not missed.
+        coalesced_heartbeat_pending_ = false;
+        return;
+    }
+
+    for (ReaderProxy* reader : matched_local_readers_)
+    {
+        intraprocess_heartbeat(reader);
+    }
+
+    for (ReaderProxy* reader : matched_datasharing_readers_)
+    {
+        reader->datasharing_notify();
+    }
+
+    if (there_are_remote_readers_)
+    {
+        // The same heartbeat is sent to all the remote participants.
+        incrementHBCount();
+
+        auto now = std::chrono::steady_clock::now();
+        for (ReaderProxy* reader : matched_remote_readers_)
+        {
+            if (reader->is_reliable())
+            {
+                add_remote_reader(reader->guid(), *reader->general_locator_selector_entry());
+
+                if (rtt_adaptive_timing_.enabled && !disable_positive_acks_)
+                {
+                    reader->heartbeat_sent(now);
+                }
+            }
+        }
+    }
+}
+
+void StatefulWriter::add_coalesced_heartbeat_nts(
+        RTPSMessageGroup& group)
+{
+    SequenceNumber_t firstSeq = get_seq_num_min();
+    SequenceNumber_t lastSeq = get_seq_num_max();
+
+    if (firstSeq == c_SequenceNumber_Unknown || lastSeq == c_SequenceNumber_Unknown)
+    {
+        firstSeq = next_sequence_number();
+        lastSeq = firstSeq - 1;
+    }
+    else
+    {
+        add_gaps_for_holes_in_history_(group);
+    }
+
+    group.add_heartbeat(firstSeq, lastSeq, m_heartbeatCount, disable_positive_acks_, false);
+    currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_);
+
+    EPROSIMA_LOG_INFO(RTPS_WRITER,
+            getGuid().entityId << " Sending coalesced Heartbeat (" << firstSeq << " - " << lastSeq << ")" );
+}
+
 void StatefulWriter::send_heartbeat_to_nts(
         ReaderProxy& remoteReaderProxy,
         bool liveliness,
@@ -1844,6 +2154,11 @@ void StatefulWriter::send_heartbeat_to_nts(
                 }
 
                 send_heartbeat_nts_(1u, group, disable_positive_acks_, liveliness);
+
+                if (rtt_adaptive_timing_.enabled && !disable_positive_acks_ && !liveliness)
+                {
+                    remoteReaderProxy.heartbeat_sent(std::chrono::steady_clock::now());
+                }
             }
             catch (const RTPSMessageGroup::timeout&)
             {
@@ -1923,10 +2238,104 @@ void StatefulWriter::send_heartbeat_piggyback_nts_(
     }
 }
 
+double StatefulWriter::nack_response_interval_ms(
+        const WriterTimes& times) const
+{
+    double nack_response_delay_ms = fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(times.nackResponseDelay);
+    return (std::max)(nack_response_delay_ms, nack_aggregation_window_ms_);
+}
+
+void StatefulWriter::merge_multicast_nack_requests_nts()
+{
+    for (ReaderProxy* requester : matched_remote_readers_)
+    {
+        LocatorSelectorEntry* requester_entry = requester->general_locator_selector_entry();
+        if (!requester->is_reliable() || requester_entry->multicast.empty())
+        {
+            continue;
+        }
+
+        nack_aggregation_requested_.clear();
+        requester->requested_changes_get(nack_aggregation_requested_);
+        if (nack_aggregation_requested_.empty())
+        {
+            continue;
+        }
+
+        // Readers listening on the same multicast locator will receive the repair anyway. Marking their
+        // unacknowledged changes as requested makes the repair be sent once to the multicast locator, and their
+        // own ACKNACKs for those changes will be suppressed while the repair is underway.
+        for (ReaderProxy* reader : matched_remote_readers_)
+        {
+            if (reader != requester && reader->is_reliable() &&
+                    share_multicast_locator(requester_entry, reader->general_locator_selector_entry()))
+            {
+                reader->requested_changes_merge(nack_aggregation_requested_);
+            }
+        }
+    }
+}
+
+void StatefulWriter::on_reader_rtt_updated_nts(
+        ReaderProxy* reader)
+{
+    // NACKs received less than a round-trip time after sending a change were sent before receiving it.
+    std::chrono::duration<long double, std::milli> suppression(reader->rtt_estimator().srtt());
+    suppression = (std::min)(suppression, decltype(suppression)(rtt_adaptive_timing_.max_ms));
+    reader->update_nack_supression_interval(Duration_t(suppression.count() / 1000.0L));
+
+    // The periodic heartbeat is shared by all readers, so it follows the slowest one.
+    std::chrono::nanoseconds max_timeout = std::chrono::nanoseconds::zero();
+    for (ReaderProxy* remote_reader : matched_remote_readers_)
+    {
+        const RoundTripTimeEstimator& rtt = remote_reader->rtt_estimator();
+        if (rtt.has_estimation())
+        {
+            max_timeout = (std::max)(max_timeout, rtt.retransmission_timeout());
+        }
+    }
+
+    double period_ms = rtt_adaptive_timing_.bound(max_timeout);
+    if (period_ms != periodic_hb_event_->getIntervalMilliSec())
+    {
+        periodic_hb_event_->update_interval_millisec(period_ms);
+    }
+
+    on_round_trip_time(reader->guid(), reader->rtt_estimator().srtt());
+}
+
+bool StatefulWriter::get_round_trip_time(
+        const GUID_t& reader_guid,
+        Duration_t& rtt) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    for (const ReaderProxy* reader : matched_remote_readers_)
+    {
+        if (reader->guid() == reader_guid)
+        {
+            const RoundTripTimeEstimator& estimator = reader->rtt_estimator();
+            if (estimator.has_estimation())
+            {
+                rtt = Duration_t(std::chrono::duration<long double>(estimator.srtt()).count());
+                return true;
+            }
+            return false;
+        }
+    }
+
+    return false;
+}
+
 void StatefulWriter::perform_nack_response()
 {
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
 
+    if (0 < nack_aggregation_window_ms_)
+    {
+        merge_multicast_nack_requests_nts();
+    }
+
     uint32_t changes_to_resend = 0;
     for (ReaderProxy* reader : matched_remote_readers_)
     {
@@ -1956,7 +2365,7 @@ void StatefulWriter::perform_nack_supression(
                 if (reader->guid() == reader_guid)
                 {
                     reader->perform_nack_supression();
-                    periodic_hb_event_->restart_timer();
+                    restart_periodic_heartbeat();
                     return true;
                 }
                 return false;
@@ -1988,10 +2397,27 @@ bool StatefulWriter::process_acknack(
                         {
                             if (remote_reader->check_and_set_acknack_count(ack_count))
                             {
+                                if (rtt_adaptive_timing_.enabled && remote_reader->is_remote_and_reliable() &&
+                                        remote_reader->acknack_received(std::chrono::steady_clock::now(),
+                                        rtt_adaptive_timing_.remote_response_delay()))
+                                {
+                                    on_reader_rtt_updated_nts(remote_reader);
+                                }
+
                                 // Sequence numbers before Base are set as Acknowledged.
                                 remote_reader->acked_changes_set(sn_set.base());
                                 if (sn_set.base() > SequenceNumber_t(0, 0))
                                 {
+                                    if (remote_reader->is_remote_and_reliable())
+                                    {
+                                        uint32_t lost_samples = 0;
+                                        sn_set.for_each([&lost_samples](const SequenceNumber_t&)
+                                                {
+                                                    ++lost_samples;
+                                                });
+                                        flow_controller_->notify_destination_feedback(reader_guid, lost_samples);
+                                    }
+
                                     // Prepare GAP for requested  samples that are not in history or are irrelevants.
                                     RTPSMessageGroup group(mp_RTPSParticipant, this, remote_reader->message_sender());
                                     RTPSGapBuilder gap_builder(group);
@@ -2002,7 +2428,7 @@ bool StatefulWriter::process_acknack(
                                     }
                                     else if (!final_flag)
                                     {
-                                        periodic_hb_event_->restart_timer();
+                                        restart_periodic_heartbeat();
                                     }
 
                                     gap_builder.flush();
@@ -2020,7 +2446,7 @@ bool StatefulWriter::process_acknack(
                                         {
                                             // Send heartbeat if requested
                                             send_heartbeat_to_nts(*remote_reader, false, true);
-                                            periodic_hb_event_->restart_timer();
+                                            restart_periodic_heartbeat();
                                         }
                                     }
 
@@ -2299,16 +2725,16 @@ void StatefulWriter::add_gaps_for_holes_in_history_(
         RTPSGapBuilder gaps(group);
         // There are holes in the history.
         History::const_iterator cit = mp_history->changesBegin();
-        SequenceNumber_t prev = (*cit)->sequenceNumber + 1;
+        SequenceNumber_t prev = (*cit)->sequenceNumber + sequence_number_span(**cit);
         ++cit;
         while (cit != mp_history->changesEnd())
         {
-            while (prev != (*cit)->sequenceNumber)
+            while (prev < (*cit)->sequenceNumber)
             {
                 gaps.add(prev);
                 ++prev;
             }
-            ++prev;
+            prev = (*cit)->sequenceNumber + sequence_number_span(**cit);
             ++cit;
         }
         gaps.flush();
@@ -32,6 +32,7 @@
 #include "../flowcontrol/FlowController.hpp"
 #include <rtps/builtin/BuiltinProtocols.h>
 #include <rtps/builtin/liveliness/WLP.h>
+#include <rtps/common/ContainerMemoryUsage.hpp>
 #include <rtps/DataSharing/DataSharingNotifier.hpp>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <rtps/DataSharing/WriterPool.hpp>
@@ -293,7 +294,7 @@ bool StatelessWriter::datasharing_delivery(
     EPROSIMA_LOG_INFO(RTPS_WRITER, "Notifying readers of cache change with SN " << change->sequenceNumber);
     for (std::unique_ptr<ReaderLocator>& reader : matched_datasharing_readers_)
     {
-        if (!reader_data_filter_ || reader_data_filter_->is_relevant(*change, reader->remote_guid()))
+        if (is_relevant_for(*change, *reader))
         {
             reader->datasharing_notify();
         }
@@ -347,8 +348,7 @@ bool StatelessWriter::intraprocess_delivery(
 {
     RTPSReader* reader = reader_locator.local_reader();
 
-    if (reader &&
-            (!reader_data_filter_ || reader_data_filter_->is_relevant(*change, reader_locator.remote_guid())))
+    if (reader && is_relevant_for(*change, reader_locator))
     {
         if (change->write_params.related_sample_identity() != SampleIdentity::unknown())
         {
@@ -360,6 +360,65 @@ bool StatelessWriter::intraprocess_delivery(
     return false;
 }
 
+bool StatelessWriter::is_relevant_for(
+        const CacheChange_t& change,
+        const ReaderLocator& reader_locator) const
+{
+    // A batch is never sent to a reader which has not announced it is able to unbatch it
+    if (!reader_locator.accepts_sample_batches() && is_sample_batch(change))
+    {
+        return false;
+    }
+
+    return !reader_data_filter_ || reader_data_filter_->is_relevant(change, reader_locator.remote_guid());
+}
+
+bool StatelessWriter::try_reserve_participants_bytes(
+        const CacheChange_t& change,
+        uint32_t bytes)
+{
+    charged_participants_.clear();
+
+    if (!flow_controller_->is_participant_rate_limited())
+    {
+        return true;
+    }
+
+    for (std::unique_ptr<ReaderLocator>& it : matched_remote_readers_)
+    {
+        const GuidPrefix_t& participant = it->remote_guid().guidPrefix;
+
+        // Readers of the same participant are sent the same datagram, unless each one is sent its own.
+        if (c_GuidPrefix_Unknown == participant || !is_relevant_for(change, *it) ||
+                (!m_separateSendingEnabled &&
+                charged_participants_.end() !=
+                std::find(charged_participants_.begin(), charged_participants_.end(), participant)))
+        {
+            continue;
+        }
+
+        if (!flow_controller_->try_reserve_participant_bytes(this, participant, bytes))
+        {
+            refund_participants_bytes(bytes);
+            return false;
+        }
+
+        charged_participants_.push_back(participant);
+    }
+
+    return true;
+}
+
+void StatelessWriter::refund_participants_bytes(
+        uint32_t bytes)
+{
+    for (const GuidPrefix_t& participant : charged_participants_)
+    {
+        flow_controller_->refund_participant_bytes(participant, bytes);
+    }
+    charged_participants_.clear();
+}
+
 bool StatelessWriter::change_removed_by_history(
         CacheChange_t* change,
         const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
@@ -475,6 +534,7 @@ bool StatelessWriter::matched_reader_add(
                 if (reader.remote_guid() == data.guid())
                 {
                     EPROSIMA_LOG_WARNING(RTPS_WRITER, "Attempting to add existing reader, updating information.");
+                    reader.accepts_sample_batches(data.sample_batches());
                     if (reader.update(data.remote_locators().unicast,
                     data.remote_locators().multicast,
                     data.m_expectsInlineQos))
@@ -542,6 +602,7 @@ bool StatelessWriter::matched_reader_add(
             data.remote_locators().multicast,
             data.m_expectsInlineQos,
             is_datasharing_compatible_with(data));
+    new_reader->accepts_sample_batches(data.sample_batches());
     filter_remote_locators(*new_reader->general_locator_selector_entry(),
             m_att.external_unicast_locators, m_att.ignore_non_matching_locators);
 
@@ -699,6 +760,28 @@ bool StatelessWriter::matched_reader_is_matched(
                    );
 }
 
+void StatelessWriter::get_matched_readers_memory_usage_nts(
+        fastdds::rtps::MemoryUsage& usage) const
+{
+    auto add_locators = [&usage](const ResourceLimitedVector<std::unique_ptr<ReaderLocator>>& locators,
+            bool in_use)
+            {
+                usage += get_container_memory_usage(locators);
+                for (const std::unique_ptr<ReaderLocator>& locator : locators)
+                {
+                    fastdds::rtps::MemoryUsage locator_usage = locator->get_memory_usage();
+                    locator_usage.live_bytes = in_use ? locator_usage.live_bytes + sizeof(ReaderLocator) : 0;
+                    locator_usage.reserved_bytes += sizeof(ReaderLocator);
+                    usage += locator_usage;
+                }
+            };
+
+    add_locators(matched_remote_readers_, true);
+    add_locators(matched_local_readers_, true);
+    add_locators(matched_datasharing_readers_, true);
+    add_locators(matched_readers_pool_, false);
+}
+
 void StatelessWriter::unsent_changes_reset()
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
@@ -751,10 +834,12 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
                 });
     }
 
+    uint32_t n_fragments = cache_change->getFragmentCount();
+    uint32_t bytes_per_submessage =
+            (0 < n_fragments) ? cache_change->getFragmentSize() : cache_change->serializedPayload.length;
+
     try
     {
-        uint32_t n_fragments = cache_change->getFragmentCount();
-
         if (m_separateSendingEnabled)
         {
             if (0 < n_fragments)
@@ -762,10 +847,16 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
                 for (FragmentNumber_t frag = current_fragment_sent_ + 1;
                         DeliveryRetCode::DELIVERED == ret_code && frag <= n_fragments; ++frag)
                 {
+                    // Best-effort readers keep no state of their own, so the fragment waits for all of them.
+                    if (!try_reserve_participants_bytes(*cache_change, bytes_per_submessage))
+                    {
+                        ret_code = DeliveryRetCode::EXCEEDED_DESTINATION_LIMIT;
+                        break;
+                    }
+
                     for (std::unique_ptr<ReaderLocator>& it : matched_remote_readers_)
                     {
-                        if ((nullptr == reader_data_filter_) ||
-                                reader_data_filter_->is_relevant(*cache_change, it->remote_guid()))
+                        if (is_relevant_for(*cache_change, *it))
                         {
                             group.sender(this, &*it);
                             size_t num_locators = it->locators_size();
@@ -786,16 +877,20 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
 
                     if (DeliveryRetCode::DELIVERED == ret_code)
                     {
+                        charged_participants_.clear();
                         current_fragment_sent_ = frag;
                     }
                 }
             }
+            else if (!try_reserve_participants_bytes(*cache_change, bytes_per_submessage))
+            {
+                ret_code = DeliveryRetCode::EXCEEDED_DESTINATION_LIMIT;
+            }
             else
             {
                 for (std::unique_ptr<ReaderLocator>& it : matched_remote_readers_)
                 {
-                    if ((nullptr == reader_data_filter_) ||
-                            reader_data_filter_->is_relevant(*cache_change, it->remote_guid()))
+                    if (is_relevant_for(*cache_change, *it))
                     {
                         group.sender(this, &*it);
                         size_t num_locators = it->locators_size();
@@ -811,16 +906,21 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
                         }
                     }
                 }
+
+                if (DeliveryRetCode::DELIVERED == ret_code)
+                {
+                    charged_participants_.clear();
+                }
             }
         }
         else
         {
-            if (nullptr != reader_data_filter_)
+            if (nullptr != reader_data_filter_ || is_sample_batch(*cache_change))
             {
                 locator_selector.locator_selector.reset(false);
                 for (std::unique_ptr<ReaderLocator>& it : matched_remote_readers_)
                 {
-                    if (reader_data_filter_->is_relevant(*cache_change, it->remote_guid()))
+                    if (is_relevant_for(*cache_change, *it))
                     {
                         locator_selector.locator_selector.enable(it->remote_guid());
                     }
@@ -848,8 +948,13 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
                     for (FragmentNumber_t frag = current_fragment_sent_ + 1;
                             DeliveryRetCode::DELIVERED == ret_code && frag <= n_fragments; ++frag)
                     {
-                        if (group.add_data_frag(*cache_change, frag, is_inline_qos_expected_))
+                        if (!try_reserve_participants_bytes(*cache_change, bytes_per_submessage))
+                        {
+                            ret_code = DeliveryRetCode::EXCEEDED_DESTINATION_LIMIT;
+                        }
+                        else if (group.add_data_frag(*cache_change, frag, is_inline_qos_expected_))
                         {
+                            charged_participants_.clear();
                             current_fragment_sent_ = frag;
                             add_statistics_sent_submessage(cache_change, num_locators);
                         }
@@ -861,10 +966,15 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
                         }
                     }
                 }
+                else if (!try_reserve_participants_bytes(*cache_change, bytes_per_submessage))
+                {
+                    ret_code = DeliveryRetCode::EXCEEDED_DESTINATION_LIMIT;
+                }
                 else
                 {
                     if (group.add_data(*cache_change, is_inline_qos_expected_))
                     {
+                        charged_participants_.clear();
                         add_statistics_sent_submessage(cache_change, num_locators);
                     }
                     else
@@ -895,6 +1005,9 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
         ret_code = DeliveryRetCode::EXCEEDED_LIMIT;
     }
 
+    // Give back the bytes reserved for a submessage which was not sent.
+    refund_participants_bytes(bytes_per_submessage);
+
     group.sender(this, &locator_selector);
 
     if (DeliveryRetCode::DELIVERED == ret_code &&
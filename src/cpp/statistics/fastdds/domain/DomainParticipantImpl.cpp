@@ -18,6 +18,7 @@
 
 #include <statistics/fastdds/domain/DomainParticipantImpl.hpp>
 
+#include <cstdlib>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -44,6 +45,7 @@
 #include <statistics/fastdds/publisher/PublisherImpl.hpp>
 #include <statistics/fastdds/subscriber/SubscriberImpl.hpp>
 #include <statistics/rtps/GuidUtils.hpp>
+#include <statistics/rtps/StatisticsBase.hpp>
 #include <statistics/types/types.hpp>
 #include <statistics/types/typesPubSubTypes.h>
 #include <utils/SystemInfo.hpp>
@@ -77,8 +79,14 @@ constexpr const char* EDP_PACKETS_TOPIC_ALIAS = "EDP_PACKETS_TOPIC";
 constexpr const char* DISCOVERY_TOPIC_ALIAS = "DISCOVERY_TOPIC";
 constexpr const char* SAMPLE_DATAS_TOPIC_ALIAS = "SAMPLE_DATAS_TOPIC";
 constexpr const char* PHYSICAL_DATA_TOPIC_ALIAS = "PHYSICAL_DATA_TOPIC";
+constexpr const char* ROUND_TRIP_TIME_TOPIC_ALIAS = "ROUND_TRIP_TIME_TOPIC";
+constexpr const char* MEMORY_USAGE_TOPIC_ALIAS = "MEMORY_USAGE_TOPIC";
 constexpr const char* MONITOR_SERVICE_TOPIC_ALIAS = "MONITOR_SERVICE_TOPIC";
 
+//! Participant property setting the period of the memory usage reports.
+constexpr const char* memory_usage_period_property = "fastdds.statistics.memory_usage_period_ms";
+constexpr double default_memory_usage_period_ms = 1000.0;
+
 static constexpr uint32_t participant_statistics_mask =
         EventKind::RTPS_SENT | EventKind::RTPS_LOST | EventKind::NETWORK_LATENCY |
         EventKind::EDP_PACKETS | EventKind::PDP_PACKETS |
@@ -109,7 +117,9 @@ static const ValidEntry valid_entries[] =
     {EDP_PACKETS_TOPIC_ALIAS,             EDP_PACKETS_TOPIC,             EventKind::EDP_PACKETS},
     {DISCOVERY_TOPIC_ALIAS,               DISCOVERY_TOPIC,               EventKind::DISCOVERED_ENTITY},
     {SAMPLE_DATAS_TOPIC_ALIAS,            SAMPLE_DATAS_TOPIC,            EventKind::SAMPLE_DATAS},
-    {PHYSICAL_DATA_TOPIC_ALIAS,           PHYSICAL_DATA_TOPIC,           EventKind::PHYSICAL_DATA}
+    {PHYSICAL_DATA_TOPIC_ALIAS,           PHYSICAL_DATA_TOPIC,           EventKind::PHYSICAL_DATA},
+    {ROUND_TRIP_TIME_TOPIC_ALIAS,         ROUND_TRIP_TIME_TOPIC,         EventKind::ROUND_TRIP_TIME},
+    {MEMORY_USAGE_TOPIC_ALIAS,            MEMORY_USAGE_TOPIC,            EventKind::MEMORY_USAGE}
 };
 
 ReturnCode_t DomainParticipantImpl::enable_statistics_datawriter(
@@ -171,6 +181,11 @@ ReturnCode_t DomainParticipantImpl::enable_statistics_datawriter(
             {
                 statistics_listener_->set_datawriter(event_kind, data_writer);
                 rtps_participant_->set_enabled_statistics_writers_mask(statistics_listener_->enabled_writers_mask());
+
+                if (MEMORY_USAGE_TOPIC == use_topic_name)
+                {
+                    start_memory_usage_reports();
+                }
             }
         }
         return efd::RETCODE_OK;
@@ -227,6 +242,12 @@ ReturnCode_t DomainParticipantImpl::disable_statistics_datawriter(
     efd::DataWriter* writer = builtin_publisher_->lookup_datawriter(use_topic_name);
     if (nullptr != writer)
     {
+        // Wait for an ongoing report before the DataWriter is removed
+        if (MEMORY_USAGE_TOPIC == use_topic_name)
+        {
+            memory_usage_event_.reset();
+        }
+
         // Avoid calling DataWriter from listener callback
         statistics_listener_->set_datawriter(event_kind, nullptr);
         rtps_participant_->set_enabled_statistics_writers_mask(statistics_listener_->enabled_writers_mask());
@@ -237,6 +258,10 @@ ReturnCode_t DomainParticipantImpl::disable_statistics_datawriter(
             // Restore writer on listener before returning the error
             statistics_listener_->set_datawriter(event_kind, writer);
             rtps_participant_->set_enabled_statistics_writers_mask(statistics_listener_->enabled_writers_mask());
+            if (MEMORY_USAGE_TOPIC == use_topic_name)
+            {
+                start_memory_usage_reports();
+            }
             ret = efd::RETCODE_ERROR;
         }
 
@@ -278,6 +303,9 @@ ReturnCode_t DomainParticipantImpl::enable()
 
 void DomainParticipantImpl::disable()
 {
+    // Reports run on the event thread of the RTPS participant
+    memory_usage_event_.reset();
+
     if (nullptr != rtps_participant_)
     {
         rtps_participant_->remove_statistics_listener(statistics_listener_, participant_statistics_mask);
@@ -483,6 +511,68 @@ void DomainParticipantImpl::delete_statistics_builtin_entities()
     }
 }
 
+void DomainParticipantImpl::start_memory_usage_reports()
+{
+    double period_ms = default_memory_usage_period_ms;
+    const std::string* property = fastrtps::rtps::PropertyPolicyHelper::find_property(
+        qos_.properties(), memory_usage_period_property);
+    if (nullptr != property)
+    {
+        char* end = nullptr;
+        double value = std::strtod(property->c_str(), &end);
+        if (property->c_str() != end && '\0' == *end && 0 < value)
+        {
+            period_ms = value;
+        }
+        else
+        {
+            EPROSIMA_LOG_ERROR(STATISTICS_DOMAIN_PARTICIPANT, "Not valid value for " << memory_usage_period_property
+                                                                                    << " property. Using "
+                                                                                    << period_ms << " ms");
+        }
+    }
+
+    memory_usage_event_.reset(new fastrtps::rtps::TimedEvent(rtps_participant_->get_resource_event(),
+            [this]()
+            {
+                publish_memory_usage();
+                return true;
+            }, period_ms));
+    memory_usage_event_->restart_timer();
+}
+
+void DomainParticipantImpl::publish_memory_usage()
+{
+    fastdds::rtps::ParticipantMemoryUsage usage;
+    if (efd::RETCODE_OK != get_memory_usage(usage))
+    {
+        return;
+    }
+
+    auto notify = [this](const fastrtps::rtps::GUID_t& entity_guid, const fastdds::rtps::MemoryUsage& memory)
+            {
+                EntityCount notification;
+                notification.guid(to_statistics_type(entity_guid));
+                notification.count(memory.reserved_bytes);
+
+                Data data;
+                // note that the setter sets RESENT_DATAS by default
+                data.entity_count(std::move(notification));
+                data._d(EventKind::MEMORY_USAGE);
+                statistics_listener_->on_statistics_data(data);
+            };
+
+    notify(guid(), usage.transport_buffers);
+    for (const fastdds::rtps::EndpointMemoryUsage& writer : usage.writers)
+    {
+        notify(writer.guid, writer.total());
+    }
+    for (const fastdds::rtps::EndpointMemoryUsage& reader : usage.readers)
+    {
+        notify(reader.guid, reader.total());
+    }
+}
+
 bool DomainParticipantImpl::is_statistics_topic_name(
         const std::string& topic_name) noexcept
 {
@@ -520,7 +610,7 @@ bool DomainParticipantImpl::register_statistics_type_and_topic(
         const std::string& topic_name) noexcept
 {
     bool return_code = false;
-    if (HISTORY_LATENCY_TOPIC == topic_name)
+    if (HISTORY_LATENCY_TOPIC == topic_name || ROUND_TRIP_TIME_TOPIC == topic_name)
     {
         efd::TypeSupport history_latency_type(new WriterReaderDataPubSubType);
         return_code = find_or_create_topic_and_type(topic, topic_name, history_latency_type);
@@ -542,7 +632,8 @@ bool DomainParticipantImpl::register_statistics_type_and_topic(
     }
     else if (RESENT_DATAS_TOPIC == topic_name || HEARTBEAT_COUNT_TOPIC == topic_name ||
             ACKNACK_COUNT_TOPIC == topic_name || NACKFRAG_COUNT_TOPIC == topic_name || GAP_COUNT_TOPIC == topic_name ||
-            DATA_COUNT_TOPIC == topic_name || PDP_PACKETS_TOPIC == topic_name || EDP_PACKETS_TOPIC == topic_name)
+            DATA_COUNT_TOPIC == topic_name || PDP_PACKETS_TOPIC == topic_name || EDP_PACKETS_TOPIC == topic_name ||
+            MEMORY_USAGE_TOPIC == topic_name)
     {
         efd::TypeSupport count_type(new EntityCountPubSubType);
         return_code = find_or_create_topic_and_type(topic, topic_name, count_type);
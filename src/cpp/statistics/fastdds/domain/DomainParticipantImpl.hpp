@@ -23,6 +23,7 @@
 
 #ifdef FASTDDS_STATISTICS
 
+#include <memory>
 #include <string>
 
 #include <fastdds/dds/core/ReturnCode.hpp>
@@ -35,6 +36,7 @@
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/topic/TopicDescription.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/resources/TimedEvent.h>
 
 #include <fastdds/domain/DomainParticipantImpl.hpp>
 
@@ -283,6 +285,17 @@ protected:
     bool delete_topic_and_type(
             const std::string& topic_name) noexcept;
 
+    /**
+     * Auxiliary method to start the periodic reports of the memory held by the entities of this participant.
+     * The period is taken from the @c fastdds.statistics.memory_usage_period_ms property.
+     */
+    void start_memory_usage_reports();
+
+    /**
+     * Auxiliary method to report the memory held by each DataWriter and DataReader, and by the transport buffers.
+     */
+    void publish_memory_usage();
+
     /**
      * @brief Implementation of the IStatusQueryable interface.
      */
@@ -294,6 +307,7 @@ protected:
     PublisherImpl* builtin_publisher_impl_ = nullptr;
     std::shared_ptr<DomainParticipantStatisticsListener> statistics_listener_;
     std::atomic<const rtps::IStatusObserver*> status_observer_{nullptr};
+    std::unique_ptr<fastrtps::rtps::TimedEvent> memory_usage_event_;
 
     friend class efd::DomainParticipantFactory;
 };
@@ -69,6 +69,7 @@ void DomainParticipantStatisticsListener::on_statistics_data(
         switch (data_kind)
         {
             case EventKind::HISTORY2HISTORY_LATENCY:
+            case EventKind::ROUND_TRIP_TIME:
                 data_sample = &statistics_data.writer_reader_data();
                 break;
 
@@ -94,6 +95,7 @@ void DomainParticipantStatisticsListener::on_statistics_data(
             case EventKind::DATA_COUNT:
             case EventKind::PDP_PACKETS:
             case EventKind::EDP_PACKETS:
+            case EventKind::MEMORY_USAGE:
                 data_sample = &statistics_data.entity_count();
                 break;
 
@@ -179,6 +179,32 @@ void StatisticsReaderImpl::on_subscribe_throughput(
     }
 }
 
+void StatisticsReaderImpl::on_round_trip_time(
+        const fastrtps::rtps::GUID_t& writer_guid,
+        std::chrono::nanoseconds rtt)
+{
+    if (!are_statistics_writers_enabled(EventKind::ROUND_TRIP_TIME))
+    {
+        return;
+    }
+
+    WriterReaderData notification;
+    notification.writer_guid(to_statistics_type(writer_guid));
+    notification.reader_guid(to_statistics_type(get_guid()));
+    notification.data(static_cast<float>(rtt.count()));
+
+    // Perform the callback
+    Data data;
+    // note that the setter sets HISTORY2HISTORY_LATENCY by default
+    data.writer_reader_data(notification);
+    data._d(EventKind::ROUND_TRIP_TIME);
+
+    for_each_listener([&data](const std::shared_ptr<IListener>& listener)
+            {
+                listener->on_statistics_data(data);
+            });
+}
+
 }  // namespace statistics
 }  // namespace fastdds
 }  // namespace eprosima
@@ -2944,6 +2944,8 @@ const uint32_t EDP_PACKETS = 0x2000;
 const uint32_t DISCOVERED_ENTITY = 0x4000;
 const uint32_t SAMPLE_DATAS = 0x8000;
 const uint32_t PHYSICAL_DATA = 0x10000;
+const uint32_t ROUND_TRIP_TIME = 0x20000;
+const uint32_t MEMORY_USAGE = 0x40000;
 
 } // namespace EventKind
 /*!
@@ -3235,6 +3237,7 @@ public:
         switch (__d)
         {
                         case EventKind::HISTORY2HISTORY_LATENCY:
+                        case EventKind::ROUND_TRIP_TIME:
                             if (0x00000001 == selected_member_)
                             {
                                 valid_discriminator = true;
@@ -3272,6 +3275,7 @@ public:
                         case EventKind::DATA_COUNT:
                         case EventKind::PDP_PACKETS:
                         case EventKind::EDP_PACKETS:
+                        case EventKind::MEMORY_USAGE:
                             if (0x00000005 == selected_member_)
                             {
                                 valid_discriminator = true;
@@ -1465,6 +1465,7 @@ eProsima_user_DllExport size_t calculate_serialized_size(
     switch (data._d())
     {
                 case EventKind::HISTORY2HISTORY_LATENCY:
+                case EventKind::ROUND_TRIP_TIME:
                     calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(1),
                                 data.writer_reader_data(), current_alignment);
                     break;
@@ -1494,6 +1495,7 @@ eProsima_user_DllExport size_t calculate_serialized_size(
                 case EventKind::DATA_COUNT:
                 case EventKind::PDP_PACKETS:
                 case EventKind::EDP_PACKETS:
+                case EventKind::MEMORY_USAGE:
                     calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(5),
                                 data.entity_count(), current_alignment);
                     break;
@@ -1541,6 +1543,7 @@ eProsima_user_DllExport void serialize(
     switch (data._d())
     {
                 case EventKind::HISTORY2HISTORY_LATENCY:
+                case EventKind::ROUND_TRIP_TIME:
                     scdr << eprosima::fastcdr::MemberId(1) << data.writer_reader_data();
                     break;
 
@@ -1566,6 +1569,7 @@ eProsima_user_DllExport void serialize(
                 case EventKind::DATA_COUNT:
                 case EventKind::PDP_PACKETS:
                 case EventKind::EDP_PACKETS:
+                case EventKind::MEMORY_USAGE:
                     scdr << eprosima::fastcdr::MemberId(5) << data.entity_count();
                     break;
 
@@ -1609,6 +1613,7 @@ eProsima_user_DllExport void deserialize(
                     switch (discriminator)
                     {
                                                 case EventKind::HISTORY2HISTORY_LATENCY:
+                                                case EventKind::ROUND_TRIP_TIME:
                                                     {
                                                         eprosima::fastdds::statistics::WriterReaderData writer_reader_data_value;
                                                         data.writer_reader_data(std::move(writer_reader_data_value));
@@ -1650,6 +1655,7 @@ eProsima_user_DllExport void deserialize(
                                                 case EventKind::DATA_COUNT:
                                                 case EventKind::PDP_PACKETS:
                                                 case EventKind::EDP_PACKETS:
+                                                case EventKind::MEMORY_USAGE:
                                                     {
                                                         eprosima::fastdds::statistics::EntityCount entity_count_value;
                                                         data.entity_count(std::move(entity_count_value));
@@ -1691,6 +1697,7 @@ eProsima_user_DllExport void deserialize(
                     switch (data._d())
                     {
                                                 case EventKind::HISTORY2HISTORY_LATENCY:
+                                                case EventKind::ROUND_TRIP_TIME:
                                                     dcdr >> data.writer_reader_data();
                                                     break;
 
@@ -1716,6 +1723,7 @@ eProsima_user_DllExport void deserialize(
                                                 case EventKind::DATA_COUNT:
                                                 case EventKind::PDP_PACKETS:
                                                 case EventKind::EDP_PACKETS:
+                                                case EventKind::MEMORY_USAGE:
                                                     dcdr >> data.entity_count();
                                                     break;
 
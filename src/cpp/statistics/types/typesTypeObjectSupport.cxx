@@ -11357,6 +11357,7 @@ void register_eprosima_fastdds_statistics_Data_type_identifier()
                     false, false);
             UnionCaseLabelSeq label_seq_writer_reader_data;
             TypeObjectUtils::add_union_case_label(label_seq_writer_reader_data, static_cast<int32_t>(EventKind::HISTORY2HISTORY_LATENCY));
+            TypeObjectUtils::add_union_case_label(label_seq_writer_reader_data, static_cast<int32_t>(EventKind::ROUND_TRIP_TIME));
             CommonUnionMember common_writer_reader_data;
             MemberId member_id_writer_reader_data = 0x00000001;
             if (EK_COMPLETE == type_ids_Data.type_identifier1()._d() || TK_NONE == type_ids_Data.type_identifier2()._d() ||
@@ -14955,6 +14956,7 @@ void register_eprosima_fastdds_statistics_Data_type_identifier()
             TypeObjectUtils::add_union_case_label(label_seq_entity_count, static_cast<int32_t>(EventKind::DATA_COUNT));
             TypeObjectUtils::add_union_case_label(label_seq_entity_count, static_cast<int32_t>(EventKind::PDP_PACKETS));
             TypeObjectUtils::add_union_case_label(label_seq_entity_count, static_cast<int32_t>(EventKind::EDP_PACKETS));
+            TypeObjectUtils::add_union_case_label(label_seq_entity_count, static_cast<int32_t>(EventKind::MEMORY_USAGE));
             CommonUnionMember common_entity_count;
             MemberId member_id_entity_count = 0x00000005;
             if (EK_COMPLETE == type_ids_Data.type_identifier1()._d() || TK_NONE == type_ids_Data.type_identifier2()._d() ||
@@ -0,0 +1,561 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstanceHandleMap.hpp
+ *
+ */
+
+#ifndef FASTDDS_UTILS_COLLECTIONS_INSTANCEHANDLEMAP_HPP_
+#define FASTDDS_UTILS_COLLECTIONS_INSTANCEHANDLEMAP_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+
+namespace eprosima {
+namespace fastdds {
+
+/**
+ * An unordered map indexed by instance handle.
+ *
+ * Lookups use an open addressing table with linear probing, keyed on a hash of the 16 bytes of the handle.
+ * Elements are stored on a pool of nodes which are never moved nor freed until the map is destroyed, so:
+ * - Iterators and references to elements are only invalidated when the element is erased.
+ * - Erasing an element returns its node to the pool, where it will be reused by a later insertion.
+ *
+ * Iteration order is unspecified.
+ *
+ * @tparam _Ty Mapped type.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <typename _Ty>
+class InstanceHandleMap
+{
+    struct Node;
+
+public:
+
+    using key_type = fastrtps::rtps::InstanceHandle_t;
+    using mapped_type = _Ty;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    template<bool IsConst>
+    class iterator_base
+    {
+        friend class InstanceHandleMap;
+
+        using nodes_type = typename std::conditional<IsConst, const std::deque<Node>, std::deque<Node>>::type;
+
+    public:
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = InstanceHandleMap::value_type;
+        using difference_type = InstanceHandleMap::difference_type;
+        using pointer = typename std::conditional<IsConst, const value_type*, value_type*>::type;
+        using reference = typename std::conditional<IsConst, const value_type&, value_type&>::type;
+
+        iterator_base() = default;
+
+        //! Conversion from iterator to const_iterator
+        template<bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type>
+        iterator_base(
+                const iterator_base<WasConst>& other)
+            : nodes_(other.nodes_)
+            , index_(other.index_)
+        {
+        }
+
+        reference operator *() const
+        {
+            return (*nodes_)[index_].value();
+        }
+
+        pointer operator ->() const
+        {
+            return &(*nodes_)[index_].value();
+        }
+
+        iterator_base& operator ++()
+        {
+            ++index_;
+            skip_free();
+            return *this;
+        }
+
+        iterator_base operator ++(
+                int)
+        {
+            iterator_base ret = *this;
+            ++*this;
+            return ret;
+        }
+
+        bool operator ==(
+                const iterator_base& other) const
+        {
+            return index_ == other.index_;
+        }
+
+        bool operator !=(
+                const iterator_base& other) const
+        {
+            return index_ != other.index_;
+        }
+
+    private:
+
+        template<bool> friend class iterator_base;
+
+        iterator_base(
+                nodes_type* nodes,
+                size_type index)
+            : nodes_(nodes)
+            , index_(index)
+        {
+        }
+
+        void skip_free()
+        {
+            while (index_ < nodes_->size() && !(*nodes_)[index_].in_use)
+            {
+                ++index_;
+            }
+        }
+
+        nodes_type* nodes_ = nullptr;
+
+        size_type index_ = 0;
+    };
+
+    using iterator = iterator_base<false>;
+    using const_iterator = iterator_base<true>;
+
+    InstanceHandleMap() = default;
+
+    InstanceHandleMap(
+            const InstanceHandleMap&) = delete;
+
+    InstanceHandleMap& operator =(
+            const InstanceHandleMap&) = delete;
+
+    iterator begin()
+    {
+        iterator it(&nodes_, 0);
+        it.skip_free();
+        return it;
+    }
+
+    const_iterator begin() const
+    {
+        const_iterator it(&nodes_, 0);
+        it.skip_free();
+        return it;
+    }
+
+    iterator end()
+    {
+        return iterator(&nodes_, nodes_.size());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(&nodes_, nodes_.size());
+    }
+
+    bool empty() const
+    {
+        return 0 == size_;
+    }
+
+    size_type size() const
+    {
+        return size_;
+    }
+
+    //! Number of elements that can be held without allocating memory.
+    size_type capacity() const
+    {
+        return (std::min)(nodes_.size(), slots_.size() / 4 * 3);
+    }
+
+    //! Bytes used by the nodes holding elements.
+    size_type used_bytes() const
+    {
+        return size_ * sizeof(Node);
+    }
+
+    //! Bytes allocated for the lookup table and the pool of nodes.
+    size_type allocated_bytes() const
+    {
+        return slots_.capacity() * sizeof(Slot) + nodes_.size() * sizeof(Node) +
+               free_nodes_.capacity() * sizeof(uint32_t);
+    }
+
+    /**
+     * Allocates the lookup table and the pool of nodes for a number of elements, so no memory is allocated until
+     * that number of elements is exceeded.
+     *
+     * @param count Number of elements to preallocate.
+     */
+    void reserve(
+            size_type count)
+    {
+        size_type slots = min_slots;
+        while (slots / 4 * 3 < count)
+        {
+            slots *= 2;
+        }
+        if (slots > slots_.size())
+        {
+            rehash(slots);
+        }
+
+        while (nodes_.size() < count)
+        {
+            free_nodes_.push_back(static_cast<uint32_t>(nodes_.size()));
+            nodes_.emplace_back();
+        }
+    }
+
+    iterator find(
+            const key_type& key)
+    {
+        return iterator(&nodes_, find_node(key));
+    }
+
+    const_iterator find(
+            const key_type& key) const
+    {
+        return const_iterator(&nodes_, find_node(key));
+    }
+
+    size_type count(
+            const key_type& key) const
+    {
+        return nodes_.size() != find_node(key) ? 1 : 0;
+    }
+
+    /**
+     * Inserts an element constructed in place with the given arguments, if the key does not already exist.
+     *
+     * @return A pair with an iterator to the element with the given key, and whether it was inserted.
+     */
+    template<typename ... _Args>
+    std::pair<iterator, bool> emplace(
+            const key_type& key,
+            _Args&&... args)
+    {
+        uint32_t hash = hash_of(key);
+        size_type index = find_node(key, hash);
+        if (nodes_.size() != index)
+        {
+            return { iterator(&nodes_, index), false };
+        }
+
+        if ((size_ + 1) * 4 > slots_.size() * 3)
+        {
+            rehash((std::max)(min_slots, slots_.size() * 2));
+        }
+
+        uint32_t node_index = 0;
+        if (free_nodes_.empty())
+        {
+            node_index = static_cast<uint32_t>(nodes_.size());
+            nodes_.emplace_back();
+        }
+        else
+        {
+            node_index = free_nodes_.back();
+            free_nodes_.pop_back();
+        }
+
+        Node& node = nodes_[node_index];
+        ::new (static_cast<void*>(node.storage)) value_type(std::piecewise_construct,
+        std::forward_as_tuple(key), std::forward_as_tuple(std::forward<_Args>(args)...));
+        node.in_use = true;
+
+        insert_slot({node_index, hash});
+        ++size_;
+
+        return { iterator(&nodes_, node_index), true };
+    }
+
+    mapped_type& operator [](
+            const key_type& key)
+    {
+        return emplace(key).first->second;
+    }
+
+    /**
+     * Erases an element.
+     *
+     * @param pos Iterator to the element to erase.
+     * @return Iterator following the erased element.
+     */
+    iterator erase(
+            const_iterator pos)
+    {
+        size_type index = pos.index_;
+        erase_node(static_cast<uint32_t>(index));
+
+        iterator ret(&nodes_, index + 1);
+        ret.skip_free();
+        return ret;
+    }
+
+    iterator erase(
+            iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    size_type erase(
+            const key_type& key)
+    {
+        size_type index = find_node(key);
+        if (nodes_.size() == index)
+        {
+            return 0;
+        }
+
+        erase_node(static_cast<uint32_t>(index));
+        return 1;
+    }
+
+    //! Erases all the elements. Memory is kept for later insertions.
+    void clear()
+    {
+        for (size_type i = 0; i < nodes_.size(); ++i)
+        {
+            if (nodes_[i].in_use)
+            {
+                nodes_[i].destroy();
+                free_nodes_.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        for (Slot& slot : slots_)
+        {
+            slot.node = invalid_node;
+        }
+        size_ = 0;
+    }
+
+private:
+
+    static constexpr uint32_t invalid_node = (std::numeric_limits<uint32_t>::max)();
+
+    static constexpr size_type min_slots = 16;
+
+    struct Node
+    {
+        Node() = default;
+
+        Node(
+                const Node&) = delete;
+
+        Node& operator =(
+                const Node&) = delete;
+
+        ~Node()
+        {
+            if (in_use)
+            {
+                destroy();
+            }
+        }
+
+        value_type& value()
+        {
+            return *reinterpret_cast<value_type*>(storage);
+        }
+
+        const value_type& value() const
+        {
+            return *reinterpret_cast<const value_type*>(storage);
+        }
+
+        void destroy()
+        {
+            value().~value_type();
+            in_use = false;
+        }
+
+        alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+        bool in_use = false;
+    };
+
+    struct Slot
+    {
+        uint32_t node;
+        uint32_t hash;
+    };
+
+    static uint32_t hash_of(
+            const key_type& key)
+    {
+        const fastrtps::rtps::octet* bytes = key.value;
+        uint64_t low = 0;
+        uint64_t high = 0;
+        memcpy(&low, bytes, sizeof(low));
+        memcpy(&high, bytes + sizeof(low), sizeof(high));
+
+        // Serialized keys shorter than 16 bytes are padded with zeros, so every byte should affect all the bits.
+        uint64_t hash = mix(low ^ mix(high + 0x9E3779B97F4A7C15ull));
+        return static_cast<uint32_t>(hash ^ (hash >> 32));
+    }
+
+    static uint64_t mix(
+            uint64_t value)
+    {
+        value ^= value >> 30;
+        value *= 0xBF58476D1CE4E5B9ull;
+        value ^= value >> 27;
+        value *= 0x94D049BB133111EBull;
+        value ^= value >> 31;
+        return value;
+    }
+
+    size_type find_node(
+            const key_type& key) const
+    {
+        return find_node(key, hash_of(key));
+    }
+
+    size_type find_node(
+            const key_type& key,
+            uint32_t hash) const
+    {
+        if (slots_.empty())
+        {
+            return nodes_.size();
+        }
+
+        size_type mask = slots_.size() - 1;
+        for (size_type pos = hash & mask;; pos = (pos + 1) & mask)
+        {
+            const Slot& slot = slots_[pos];
+            if (invalid_node == slot.node)
+            {
+                return nodes_.size();
+            }
+            if (hash == slot.hash && key == nodes_[slot.node].value().first)
+            {
+                return slot.node;
+            }
+        }
+    }
+
+    size_type find_slot(
+            uint32_t node_index) const
+    {
+        size_type mask = slots_.size() - 1;
+        size_type pos = hash_of(nodes_[node_index].value().first) & mask;
+        while (node_index != slots_[pos].node)
+        {
+            pos = (pos + 1) & mask;
+        }
+        return pos;
+    }
+
+    void insert_slot(
+            const Slot& slot)
+    {
+        size_type mask = slots_.size() - 1;
+        size_type pos = slot.hash & mask;
+        while (invalid_node != slots_[pos].node)
+        {
+            pos = (pos + 1) & mask;
+        }
+        slots_[pos] = slot;
+    }
+
+    void erase_node(
+            uint32_t node_index)
+    {
+        // Backward shift deletion, so no tombstones are needed.
+        size_type mask = slots_.size() - 1;
+        size_type hole = find_slot(node_index);
+        size_type pos = hole;
+        while (true)
+        {
+            pos = (pos + 1) & mask;
+            if (invalid_node == slots_[pos].node)
+            {
+                break;
+            }
+
+            // Move the entry to the hole unless its home position lies cyclically in (hole, pos].
+            size_type home = slots_[pos].hash & mask;
+            bool stays = (hole < pos) ? (hole < home && home <= pos) : (hole < home || home <= pos);
+            if (!stays)
+            {
+                slots_[hole] = slots_[pos];
+                hole = pos;
+            }
+        }
+        slots_[hole].node = invalid_node;
+
+        nodes_[node_index].destroy();
+        free_nodes_.push_back(node_index);
+        --size_;
+    }
+
+    void rehash(
+            size_type slot_count)
+    {
+        std::vector<Slot> old_slots(slot_count, Slot{invalid_node, 0});
+        old_slots.swap(slots_);
+        for (const Slot& slot : old_slots)
+        {
+            if (invalid_node != slot.node)
+            {
+                insert_slot(slot);
+            }
+        }
+    }
+
+    //! Lookup table. Its size is always a power of two.
+    std::vector<Slot> slots_;
+
+    //! Pool of nodes. A deque is used so nodes are not moved when it grows.
+    std::deque<Node> nodes_;
+
+    //! Indexes of the nodes not in use.
+    std::vector<uint32_t> free_nodes_;
+
+    size_type size_ = 0;
+};
+
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif /* FASTDDS_UTILS_COLLECTIONS_INSTANCEHANDLEMAP_HPP_ */
@@ -0,0 +1,91 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file sorted_vector_find.hpp
+ */
+
+#ifndef SRC_CPP_UTILS_COLLECTIONS_SORTED_VECTOR_FIND_HPP_
+#define SRC_CPP_UTILS_COLLECTIONS_SORTED_VECTOR_FIND_HPP_
+
+#include <algorithm>
+#include <iterator>
+
+namespace eprosima {
+namespace utilities {
+namespace collections {
+
+/**
+ * @brief Find an item in a sorted vector-like collection.
+ *
+ * The first and last elements are checked in constant time, as they are the usual targets of removals on a
+ * history. Otherwise a binary search is performed, falling back to a linear search when the predicate does not
+ * define a strict weak ordering for the elements of the collection.
+ *
+ * @tparam CollectionType     Type of the collection to search.
+ * @tparam ValueType          Type of the item to find.
+ * @tparam LessThanPredicate  Predicate that performs CollectionType::value_type < ValueType comparison.
+ * @tparam MatchPredicate     Predicate that checks whether a CollectionType::value_type matches the item.
+ *
+ * @param[in] collection  The collection to search.
+ * @param[in] item        The item to find.
+ * @param[in] pred        The predicate to use for comparisons.
+ * @param[in] matches     The predicate to use for identifying the item.
+ *
+ * @return An iterator to the element matching the item, or collection.end() if it is not found.
+ */
+template<
+    typename CollectionType,
+    typename ValueType,
+    typename LessThanPredicate,
+    typename MatchPredicate>
+typename CollectionType::const_iterator sorted_vector_find(
+        const CollectionType& collection,
+        const ValueType& item,
+        const LessThanPredicate& pred,
+        const MatchPredicate& matches)
+{
+    if (collection.empty())
+    {
+        return collection.end();
+    }
+
+    if (matches(collection.front(), item))
+    {
+        return collection.begin();
+    }
+
+    if (matches(collection.back(), item))
+    {
+        return std::prev(collection.end());
+    }
+
+    auto it = std::lower_bound(collection.begin(), collection.end(), item, pred);
+    if (it != collection.end() && matches(*it, item))
+    {
+        return it;
+    }
+
+    return std::find_if(collection.begin(), collection.end(), [&item, &matches](
+                       const typename CollectionType::value_type& element)
+                   {
+                       return matches(element, item);
+                   });
+}
+
+} // namespace collections
+} // namespace utilities
+} // namespace eprosima
+
+#endif // SRC_CPP_UTILS_COLLECTIONS_SORTED_VECTOR_FIND_HPP_
@@ -16,6 +16,8 @@
 #define UTILS__THREADING_HPP_
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 
 #include "./thread.hpp"
 
@@ -82,6 +84,47 @@ void apply_thread_settings_to_current_thread(
         const char* thread_name,
         const fastdds::rtps::ThreadSettings& settings);
 
+/**
+ * @brief Get the NUMA node of the processor running the thread calling this function.
+ *
+ * @return The NUMA node, or -1 if it could not be determined on this platform.
+ */
+int32_t get_numa_node_of_current_thread();
+
+/**
+ * @brief Get the NUMA node of the first processor on an affinity mask.
+ *
+ * @param[in]  affinity_mask  Affinity mask, as in @ref fastdds::rtps::ThreadSettings::affinity.
+ *
+ * @return The NUMA node, or -1 if the mask is empty or it could not be determined on this platform.
+ */
+int32_t get_numa_node_of_affinity(
+        uint64_t affinity_mask);
+
+/**
+ * @brief Ask the OS to place a memory range on a NUMA node.
+ *
+ * Only the pages fully contained in the range are affected, see @ref get_numa_binding_granularity.
+ * The node is a preference, so memory is still allocated elsewhere when the node runs out of it.
+ *
+ * @param[in]  address    Start of the memory range.
+ * @param[in]  size       Size of the memory range.
+ * @param[in]  numa_node  NUMA node where the memory should be placed.
+ *
+ * @return true if the policy was applied, false if it failed or is not supported on this platform.
+ */
+bool bind_memory_to_numa_node(
+        void* address,
+        size_t size,
+        int32_t numa_node);
+
+/**
+ * @brief Get the alignment and size granularity of the ranges bound by @ref bind_memory_to_numa_node.
+ *
+ * @return The size of a memory page, or 0 if binding memory is not supported on this platform.
+ */
+size_t get_numa_binding_granularity();
+
 /**
  * @brief Create and start a thread with custom settings and name.
  *
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <array>
+#include <cerrno>
 #include <cstdio>
 #include <cstring>
 #include <limits>
@@ -22,6 +23,12 @@
 #include <sys/sysinfo.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <sys/syscall.h>
+#endif // ifdef __linux__
 
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
@@ -205,4 +212,114 @@ void apply_thread_settings_to_current_thread(
     configure_current_thread_affinity(thread_name, settings.affinity);
 }
 
+int32_t get_numa_node_of_current_thread()
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned int cpu = 0;
+    unsigned int node = 0;
+    if (0 == syscall(SYS_getcpu, &cpu, &node, nullptr))
+    {
+        return static_cast<int32_t>(node);
+    }
+#endif // if defined(__linux__) && defined(SYS_getcpu)
+    return -1;
+}
+
+int32_t get_numa_node_of_affinity(
+        uint64_t affinity_mask)
+{
+#ifdef __linux__
+    if (0 == affinity_mask)
+    {
+        return -1;
+    }
+
+    uint32_t cpu = 0;
+    while (0 == (affinity_mask & 1))
+    {
+        affinity_mask >>= 1;
+        ++cpu;
+    }
+
+    // The sysfs directory of a CPU has a nodeN entry for the node it belongs to
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u", cpu);
+    DIR* dir = opendir(path);
+    if (nullptr == dir)
+    {
+        return -1;
+    }
+
+    int32_t node = -1;
+    while (struct dirent* entry = readdir(dir))
+    {
+        unsigned int value = 0;
+        char extra = 0;
+        if (1 == sscanf(entry->d_name, "node%u%c", &value, &extra))
+        {
+            node = static_cast<int32_t>(value);
+            break;
+        }
+    }
+    closedir(dir);
+    return node;
+#else
+    static_cast<void>(affinity_mask);
+    return -1;
+#endif // ifdef __linux__
+}
+
+bool bind_memory_to_numa_node(
+        void* address,
+        size_t size,
+        int32_t numa_node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    // Values from linux/mempolicy.h, which may not be installed
+    constexpr int mpol_preferred = 1;
+    constexpr unsigned int mpol_mf_move = 1u << 1;
+
+    if (numa_node < 0 || 64 <= numa_node || nullptr == address)
+    {
+        return false;
+    }
+
+    // mbind needs a page aligned range
+    uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(address) + page_size - 1) & ~(page_size - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(address) + size) & ~(page_size - 1);
+    if (end <= begin)
+    {
+        EPROSIMA_LOG_WARNING(SYSTEM, "Memory range of " << size << " bytes does not contain a whole page. "
+                "It is not bound to NUMA node " << numa_node);
+        return false;
+    }
+
+    unsigned long node_mask = 1ul << numa_node;
+    long result = syscall(SYS_mbind, begin, end - begin, mpol_preferred, &node_mask,
+                    sizeof(node_mask) * 8 + 1, mpol_mf_move);
+    if (0 != result)
+    {
+        EPROSIMA_LOG_WARNING(SYSTEM, "Problem to bind memory to NUMA node " << numa_node << ". Error '" << strerror(
+                    errno) << "'");
+        return false;
+    }
+    return true;
+#else
+    static_cast<void>(address);
+    static_cast<void>(size);
+    static_cast<void>(numa_node);
+    return false;
+#endif // if defined(__linux__) && defined(SYS_mbind)
+}
+
+size_t get_numa_binding_granularity()
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif // if defined(__linux__) && defined(SYS_mbind)
+}
+
 }  // namespace eprosima
@@ -99,4 +99,28 @@ void apply_thread_settings_to_current_thread(
     configure_current_thread_affinity(thread_name, settings.affinity);
 }
 
+int32_t get_numa_node_of_current_thread()
+{
+    return -1;
+}
+
+int32_t get_numa_node_of_affinity(
+        uint64_t /* affinity_mask */)
+{
+    return -1;
+}
+
+bool bind_memory_to_numa_node(
+        void* /* address */,
+        size_t /* size */,
+        int32_t /* numa_node */)
+{
+    return false;
+}
+
+size_t get_numa_binding_granularity()
+{
+    return 0;
+}
+
 }  // namespace eprosima
@@ -14,6 +14,8 @@
 
 
 #include <atomic>
+#include <cstring>
+#include <limits>
 #include <thread>
 
 #ifndef _WIN32
@@ -605,6 +607,112 @@ TEST(Discovery, ParticipantLivelinessAssertion)
     thread.join();
 }
 
+TEST(Discovery, CompactParticipantAnnouncements)
+{
+    PubSubReader<HelloWorldPubSubType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldPubSubType> writer(TEST_TOPIC_NAME);
+
+    std::atomic<uint32_t> full_size{0};
+    std::atomic<uint32_t> compact_size{0};
+
+    auto test_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    test_transport->sub_messages_filter_ = [&](CDRMessage_t& msg) -> bool
+            {
+                // Submessage header (4), extra flags and octets to inline QoS (4) and reader id (4)
+                if (DATA == msg.buffer[msg.pos] && msg.pos + 16 <= msg.length)
+                {
+                    std::atomic<uint32_t>* max_size = nullptr;
+                    if (0 == memcmp(&msg.buffer[msg.pos + 12], c_EntityId_SPDPWriter.value, 4))
+                    {
+                        max_size = &full_size;
+                    }
+                    else if (0 == memcmp(&msg.buffer[msg.pos + 12], c_EntityId_SPDPUnsequencedWriter.value, 4))
+                    {
+                        max_size = &compact_size;
+                    }
+
+                    if (nullptr != max_size)
+                    {
+                        bool little_endian = 0 != (msg.buffer[msg.pos + 1] & 0x01);
+                        uint32_t size = little_endian ?
+                                (msg.buffer[msg.pos + 2] | (msg.buffer[msg.pos + 3] << 8)) :
+                                ((msg.buffer[msg.pos + 2] << 8) | msg.buffer[msg.pos + 3]);
+                        uint32_t current = *max_size;
+                        if (size > current)
+                        {
+                            max_size->compare_exchange_strong(current, size);
+                        }
+                    }
+                }
+                return false;
+            };
+
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.compact_participant_announcements", "true");
+
+    reader.disable_builtin_transport().add_user_transport_to_pparams(test_transport).
+            property_policy(properties).lease_duration({ 0, 800000000 }, { 0, 200000000 }).
+            reliability(eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.disable_builtin_transport().add_user_transport_to_pparams(test_transport).
+            property_policy(properties).lease_duration({ 0, 800000000 }, { 0, 200000000 }).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    // Once the initial announcements are over, the participants are only kept alive by the compact announcements.
+    EXPECT_FALSE(reader.wait_participant_undiscovery(std::chrono::seconds(2)));
+    EXPECT_FALSE(writer.wait_participant_undiscovery(std::chrono::seconds(1)));
+
+    EXPECT_GT(compact_size.load(), 0u);
+    EXPECT_LT(compact_size.load(), full_size.load() / 2);
+}
+
+TEST(Discovery, CompactParticipantAnnouncementsRequestFullData)
+{
+    PubSubReader<HelloWorldPubSubType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldPubSubType> writer(TEST_TOPIC_NAME);
+
+    // The full DATA(p) of the writer participant are lost, but not its compact announcements.
+    std::atomic<bool> drop_full_data{true};
+    auto writer_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    writer_transport->sub_messages_filter_ = [&](CDRMessage_t& msg) -> bool
+            {
+                return drop_full_data && DATA == msg.buffer[msg.pos] && msg.pos + 16 <= msg.length &&
+                       0 == memcmp(&msg.buffer[msg.pos + 12], c_EntityId_SPDPWriter.value, 4);
+            };
+
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.compact_participant_announcements", "true");
+
+    reader.disable_builtin_transport().add_user_transport_to_pparams(std::make_shared<test_UDPv4TransportDescriptor>()).
+            property_policy(properties).lease_duration({ 3, 0 }, { 0, 200000000 }).
+            initial_announcements(2, { 0, 100000000 }).
+            reliability(eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.disable_builtin_transport().add_user_transport_to_pparams(writer_transport).
+            property_policy(properties).lease_duration({ 3, 0 }, { 0, 200000000 }).
+            initial_announcements(2, { 0, 100000000 }).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // The reader asks for the full data on each compact announcement, but the answers are lost.
+    EXPECT_FALSE(reader.wait_participant_discovery(1, std::chrono::seconds(1)));
+
+    // The next answer to a request lets the reader discover the writer.
+    drop_full_data = false;
+    EXPECT_TRUE(reader.wait_participant_discovery(1, std::chrono::seconds(2)));
+    reader.wait_discovery(std::chrono::seconds(2));
+    EXPECT_EQ(1u, reader.get_matched());
+}
+
 // Regression test of Refs #2535, github micro-RTPS #1
 TEST(Discovery, PubXmlLoadedPartition)
 {
@@ -16,6 +16,11 @@
 
 #include <gtest/gtest.h>
 
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+
 #include "BlackboxTests.hpp"
 #include "PubSubReader.hpp"
 #include "PubSubWriter.hpp"
@@ -228,6 +233,96 @@ TEST_P(PubSubFlowControllers, AsyncMultipleWritersFlowController64kb)
     entities.block_for_all();
 }
 
+/*
+ * Checks that a remote participant whose rate limit is exhausted does not delay the samples sent to another one.
+ * A writer floods the participant of a first reader, and afterwards a second writer of the same participant and flow
+ * controller sends a few samples to the participant of a second reader, which should receive them without waiting
+ * for the first one.
+ */
+TEST(PubSubFlowControllersDestinationRateLimit, SaturatedParticipantDoesNotDelayTheOthers)
+{
+    using namespace eprosima::fastdds::dds;
+
+    PubSubReader<Data64kbPubSubType> saturated_reader(TEST_TOPIC_NAME + "_saturated");
+    PubSubReader<Data64kbPubSubType> free_reader(TEST_TOPIC_NAME + "_free");
+
+    saturated_reader.reliability(eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS).
+            history_kind(eprosima::fastdds::dds::KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(saturated_reader.isInitialized());
+    free_reader.reliability(eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS).
+            history_kind(eprosima::fastdds::dds::KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(free_reader.isInitialized());
+
+    // Both writers share a flow controller limiting each remote participant to 200 KB/s.
+    static const std::string flow_controller_name("DestinationRateLimitFlowController");
+    auto flow_controller = std::make_shared<eprosima::fastdds::rtps::FlowControllerDescriptor>();
+    flow_controller->name = flow_controller_name.c_str();
+    flow_controller->scheduler = eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::FIFO;
+    flow_controller->destination_rate_limit.bytes_per_second = 200000;
+    flow_controller->destination_rate_limit.burst_bytes = 65536;
+
+    DomainParticipantQos participant_qos;
+    participant_qos.flow_controllers().push_back(flow_controller);
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant((uint32_t)GET_PID() % 230, participant_qos);
+    ASSERT_NE(participant, nullptr);
+
+    TypeSupport type_support(new Data64kbPubSubType());
+    ASSERT_EQ(RETCODE_OK, type_support.register_type(participant));
+    Topic* saturated_topic = participant->create_topic(TEST_TOPIC_NAME + "_saturated", type_support.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    ASSERT_NE(saturated_topic, nullptr);
+    Topic* free_topic = participant->create_topic(TEST_TOPIC_NAME + "_free", type_support.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    ASSERT_NE(free_topic, nullptr);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    DataWriterQos writer_qos;
+    writer_qos.reliability().kind = eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS;
+    writer_qos.history().kind = eprosima::fastdds::dds::KEEP_ALL_HISTORY_QOS;
+    writer_qos.publish_mode().kind = eprosima::fastdds::dds::ASYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.publish_mode().flow_controller_name = flow_controller_name.c_str();
+    DataWriter* saturated_writer = publisher->create_datawriter(saturated_topic, writer_qos);
+    ASSERT_NE(saturated_writer, nullptr);
+    DataWriter* free_writer = publisher->create_datawriter(free_topic, writer_qos);
+    ASSERT_NE(free_writer, nullptr);
+
+    saturated_reader.wait_discovery();
+    free_reader.wait_discovery();
+    for (DataWriter* writer : {saturated_writer, free_writer})
+    {
+        PublicationMatchedStatus status;
+        while (RETCODE_OK == writer->get_publication_matched_status(status) && 0 == status.current_count)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+
+    // About 1.3 MB, which need more than 6 seconds at the rate of the participant.
+    auto saturated_data = default_data64kb_data_generator(20);
+    auto free_data = default_data64kb_data_generator(3);
+    saturated_reader.startReception(saturated_data);
+    free_reader.startReception(free_data);
+
+    for (auto& sample : saturated_data)
+    {
+        ASSERT_EQ(RETCODE_OK, saturated_writer->write(&sample));
+    }
+    for (auto& sample : free_data)
+    {
+        ASSERT_EQ(RETCODE_OK, free_writer->write(&sample));
+    }
+
+    // The samples queued after the ones of the saturated participant are not held back by them.
+    EXPECT_EQ(free_data.size(), free_reader.block_for_all(std::chrono::seconds(3)));
+    EXPECT_GT(saturated_data.size(), saturated_reader.getReceivedCount());
+    EXPECT_EQ(saturated_data.size(), saturated_reader.block_for_all(std::chrono::seconds(30)));
+
+    ASSERT_EQ(RETCODE_OK, participant->delete_contained_entities());
+    ASSERT_EQ(RETCODE_OK, DomainParticipantFactory::get_instance()->delete_participant(participant));
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
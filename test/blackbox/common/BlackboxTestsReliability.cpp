@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -20,6 +21,7 @@
 #include <rtps/transport/test_UDPv4Transport.h>
 
 #include "BlackboxTests.hpp"
+#include "PubSubParticipant.hpp"
 #include "PubSubReader.hpp"
 #include "PubSubWriter.hpp"
 
@@ -102,3 +104,103 @@ TEST(Reliability, DisableHeartbeatPiggybackTrue)
 {
     reliability_disable_heartbeat_piggyback(true);
 }
+
+/*!
+ * Checks that, with the fastdds.heartbeat_coalescing property, the periodic heartbeats of several writers of the same
+ * participant directed to the same remote participant are sent in the same datagram.
+ * The reader does not send acknowledgements, so the writers keep sending periodic heartbeats.
+ */
+TEST(Reliability, CoalescedPeriodicHeartbeats)
+{
+    const unsigned int num_writers = 3;
+
+    std::atomic<bool> start_counting{false};
+    std::atomic<uint32_t> heartbeats_in_datagram{0};
+    std::atomic<uint32_t> max_heartbeats_in_datagram{0};
+
+    auto is_user_entity = [](const EntityId_t& entity_id)
+            {
+                return 0 == (entity_id.value[3] & 0xC0);
+            };
+
+    auto writer_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    writer_transport->sub_messages_filter_ = [&heartbeats_in_datagram](CDRMessage_t& msg) -> bool
+            {
+                // First submessage of a datagram.
+                if (RTPSMESSAGE_HEADER_SIZE == msg.pos)
+                {
+                    heartbeats_in_datagram = 0;
+                }
+                return false;
+            };
+    writer_transport->drop_heartbeat_messages_filter_ =
+            [&](CDRMessage_t& msg) -> bool
+            {
+                auto old_pos = msg.pos;
+                EntityId_t writer_id;
+                msg.pos += 4;
+                CDRMessage::readEntityId(&msg, &writer_id);
+                msg.pos = old_pos;
+
+                if (start_counting && is_user_entity(writer_id))
+                {
+                    uint32_t count = ++heartbeats_in_datagram;
+                    if (count > max_heartbeats_in_datagram)
+                    {
+                        max_heartbeats_in_datagram = count;
+                    }
+                }
+                return false;
+            };
+
+    auto reader_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    reader_transport->drop_ack_nack_messages_filter_ = [&](CDRMessage_t& msg) -> bool
+            {
+                auto old_pos = msg.pos;
+                EntityId_t writer_id;
+                msg.pos += 4;
+                CDRMessage::readEntityId(&msg, &writer_id);
+                msg.pos = old_pos;
+
+                return start_counting && is_user_entity(writer_id);
+            };
+
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.heartbeat_coalescing", "true");
+
+    PubSubParticipant<HelloWorldPubSubType> writers(num_writers, 0u, num_writers, 0u);
+    writers.property_policy(properties)
+            .disable_builtin_transport()
+            .add_user_transport_to_pparams(writer_transport);
+    ASSERT_TRUE(writers.init_participant());
+    writers.pub_topic_name(TEST_TOPIC_NAME)
+            .reliability(eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS);
+    for (unsigned int i = 0; i < num_writers; ++i)
+    {
+        ASSERT_TRUE(writers.init_publisher(i));
+    }
+
+    PubSubReader<HelloWorldPubSubType> reader(TEST_TOPIC_NAME);
+    reader.reliability(eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS)
+            .disable_builtin_transport()
+            .add_user_transport_to_pparams(reader_transport)
+            .init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writers.pub_wait_discovery();
+    reader.wait_discovery(std::chrono::seconds::zero(), num_writers);
+
+    start_counting = true;
+    auto data = default_helloworld_data_generator(num_writers);
+    unsigned int index = 0;
+    for (auto& sample : data)
+    {
+        ASSERT_TRUE(writers.send_sample(sample, index++));
+    }
+
+    // Heartbeat period is 100 milliseconds, so several periods elapse.
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    start_counting = false;
+
+    EXPECT_EQ(num_writers, max_heartbeats_in_datagram.load());
+}
@@ -645,6 +645,117 @@ TEST(DDSStatistics, statistics_with_partition_on_user)
 #endif // FASTDDS_STATISTICS
 }
 
+/*
+ * This test checks that the MEMORY_USAGE_TOPIC periodically reports the bytes held by each DataWriter and DataReader,
+ * and by the transport buffers of the participant.
+ */
+TEST(DDSStatistics, memory_usage_reports)
+{
+#ifdef FASTDDS_STATISTICS
+    auto domain_id = GET_PID() % 100;
+    DomainParticipantFactory* participant_factory = DomainParticipantFactory::get_instance();
+
+    /* Create a participant with a user DataWriter and DataReader, reporting its memory every 100 ms */
+    DomainParticipantQos p_qos = PARTICIPANT_QOS_DEFAULT;
+    p_qos.properties().properties().emplace_back("fastdds.statistics.memory_usage_period_ms", "100");
+    DomainParticipant* p1 = participant_factory->create_participant(domain_id, p_qos);
+    ASSERT_NE(nullptr, p1);
+    auto statistics_p1 = statistics::dds::DomainParticipant::narrow(p1);
+    ASSERT_NE(nullptr, statistics_p1);
+
+    TypeSupport hello_type(new HelloWorldPubSubType);
+    ASSERT_EQ(eprosima::fastdds::dds::RETCODE_OK, hello_type.register_type(p1));
+    Topic* user_topic = p1->create_topic("memory_usage_topic", hello_type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(nullptr, user_topic);
+    Publisher* user_publisher = p1->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(nullptr, user_publisher);
+    DataWriter* user_writer = user_publisher->create_datawriter(user_topic, DATAWRITER_QOS_DEFAULT);
+    ASSERT_NE(nullptr, user_writer);
+    Subscriber* user_subscriber = p1->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(nullptr, user_subscriber);
+    DataReader* user_reader = user_subscriber->create_datareader(user_topic, DATAREADER_QOS_DEFAULT);
+    ASSERT_NE(nullptr, user_reader);
+
+    EXPECT_EQ(eprosima::fastdds::dds::RETCODE_OK,
+            statistics_p1->enable_statistics_datawriter(statistics::MEMORY_USAGE_TOPIC,
+            statistics::dds::STATISTICS_DATAWRITER_QOS));
+
+    /* Read the reports from a second participant */
+    DomainParticipant* p2 = participant_factory->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(nullptr, p2);
+    TypeSupport count_type(new statistics::EntityCountPubSubType);
+    ASSERT_EQ(eprosima::fastdds::dds::RETCODE_OK, count_type.register_type(p2));
+    Topic* topic = p2->create_topic(statistics::MEMORY_USAGE_TOPIC, count_type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(nullptr, topic);
+    Subscriber* subscriber_p2 = p2->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(nullptr, subscriber_p2);
+    DataReader* memory_usage_reader = subscriber_p2->create_datareader(topic,
+                    statistics::dds::STATISTICS_DATAREADER_QOS);
+    ASSERT_NE(nullptr, memory_usage_reader);
+
+    auto to_guid = [](const statistics::detail::GUID_s& guid)
+            {
+                eprosima::fastrtps::rtps::GUID_t ret;
+                for (size_t i = 0; i < guid.guidPrefix().value().size(); i++)
+                {
+                    ret.guidPrefix.value[i] = guid.guidPrefix().value()[i];
+                }
+                for (size_t i = 0; i < guid.entityId().value().size(); i++)
+                {
+                    ret.entityId.value[i] = guid.entityId().value()[i];
+                }
+                return ret;
+            };
+
+    /* Wait until every entity has been reported */
+    uint64_t participant_bytes = 0;
+    uint64_t writer_bytes = 0;
+    uint64_t reader_bytes = 0;
+    for (size_t i = 0; i < 100 && (0 == participant_bytes || 0 == writer_bytes || 0 == reader_bytes); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        LoanableSequence<statistics::EntityCount> count_seq;
+        SampleInfoSeq info_seq;
+        while (eprosima::fastdds::dds::RETCODE_OK == memory_usage_reader->take(count_seq, info_seq))
+        {
+            for (LoanableSequence<statistics::EntityCount>::size_type n = 0; n < info_seq.length(); n++)
+            {
+                if (info_seq[n].valid_data)
+                {
+                    eprosima::fastrtps::rtps::GUID_t entity_guid = to_guid(count_seq[n].guid());
+                    if (p1->guid() == entity_guid)
+                    {
+                        participant_bytes = count_seq[n].count();
+                    }
+                    else if (user_writer->guid() == entity_guid)
+                    {
+                        writer_bytes = count_seq[n].count();
+                    }
+                    else if (user_reader->guid() == entity_guid)
+                    {
+                        reader_bytes = count_seq[n].count();
+                    }
+                }
+            }
+            memory_usage_reader->return_loan(count_seq, info_seq);
+        }
+    }
+
+    EXPECT_LT(0u, participant_bytes);
+    EXPECT_LT(0u, writer_bytes);
+    EXPECT_LT(0u, reader_bytes);
+
+    EXPECT_EQ(eprosima::fastdds::dds::RETCODE_OK,
+            statistics_p1->disable_statistics_datawriter(statistics::MEMORY_USAGE_TOPIC));
+
+    EXPECT_EQ(eprosima::fastdds::dds::RETCODE_OK, p2->delete_contained_entities());
+    EXPECT_EQ(eprosima::fastdds::dds::RETCODE_OK, participant_factory->delete_participant(p2));
+    EXPECT_EQ(eprosima::fastdds::dds::RETCODE_OK, p1->delete_contained_entities());
+    EXPECT_EQ(eprosima::fastdds::dds::RETCODE_OK, participant_factory->delete_participant(p1));
+#endif // FASTDDS_STATISTICS
+}
+
 /*
  * The following tests check that the DISCOVERY_TOPIC carries the correct physical data, i.e.:
  *
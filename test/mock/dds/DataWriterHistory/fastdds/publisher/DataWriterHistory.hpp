@@ -25,6 +25,7 @@
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/common/ChangeKind_t.hpp>
 #include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastdds/rtps/common/Types.h>
@@ -112,6 +113,11 @@ public:
     {
     }
 
+    fastdds::rtps::MemoryUsage get_instances_memory_usage() const
+    {
+        return {};
+    }
+
     bool register_instance(
             const InstanceHandle_t& instance_handle,
             std::unique_lock<RecursiveTimedMutex>&,
@@ -216,6 +222,33 @@ public:
         return add_pub_change(change, wparams, lock, max_blocking_time);
     }
 
+    template<typename PreCommitHook>
+    bool send_pub_change_with_commit_hook(
+            fastrtps::rtps::CacheChange_t* change,
+            fastrtps::rtps::WriteParams& wparams,
+            PreCommitHook pre_commit,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+    {
+        if (!WriterHistory::prepare_change(change, wparams))
+        {
+            return false;
+        }
+
+        pre_commit(*change);
+        WriterHistory::notify_writer(change, max_blocking_time);
+        return true;
+    }
+
+    bool add_pub_batch(
+            fastrtps::rtps::CacheChange_t* change,
+            fastrtps::rtps::WriteParams& wparams,
+            uint32_t /*sample_count*/,
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+    {
+        return add_pub_change(change, wparams, lock, max_blocking_time);
+    }
+
     bool set_next_deadline(
             const InstanceHandle_t&,
             const std::chrono::steady_clock::time_point&)
@@ -25,6 +25,7 @@
 
 #include <fastdds/dds/core/ReturnCode.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
+#include <fastdds/dds/domain/ListenerExecutorMetrics.hpp>
 #include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
 #include <fastdds/dds/domain/qos/ReplierQos.hpp>
 #include <fastdds/dds/domain/qos/RequesterQos.hpp>
@@ -40,6 +41,7 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/InstanceHandle.h>
 #include <fastdds/rtps/common/Types.h>
+#include <fastdds/rtps/flowcontrol/FlowControllerStatistics.hpp>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
 #include <fastdds/rtps/participant/RTPSParticipantListener.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
@@ -57,6 +59,7 @@ namespace dds {
 
 class DomainParticipant;
 class DomainParticipantListener;
+class ListenerExecutor;
 class PublisherListener;
 class TopicDescription;
 
@@ -375,6 +378,30 @@ public:
     MOCK_METHOD1(unregister_content_filter_factory, ReturnCode_t (
                 const char* filter_class_name));
 
+    ReturnCode_t get_memory_usage(
+            fastdds::rtps::ParticipantMemoryUsage& /*usage*/) const
+    {
+        return RETCODE_OK;
+    }
+
+    ReturnCode_t get_flow_controller_statistics(
+            const std::string& /*flow_controller_name*/,
+            fastdds::rtps::FlowControllerStatistics& /*statistics*/) const
+    {
+        return RETCODE_BAD_PARAMETER;
+    }
+
+    ReturnCode_t get_listener_executor_metrics(
+            ListenerExecutorMetrics& /*metrics*/) const
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    ListenerExecutor* get_listener_executor() const
+    {
+        return nullptr;
+    }
+
     MOCK_METHOD1(find_content_filter_factory, IContentFilterFactory * (
                 const char* filter_class_name));
 
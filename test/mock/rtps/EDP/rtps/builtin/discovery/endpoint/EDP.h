@@ -100,6 +100,26 @@ public:
                 const GUID_t& participant_guid,
                 const GUID_t& reader_guid));
 
+    void index_reader_proxy(
+            ReaderProxyData&)
+    {
+    }
+
+    void unindex_reader_proxy(
+            const GUID_t&)
+    {
+    }
+
+    void index_writer_proxy(
+            WriterProxyData&)
+    {
+    }
+
+    void unindex_writer_proxy(
+            const GUID_t&)
+    {
+    }
+
 #if HAVE_SECURITY
     MOCK_METHOD3(pairing_reader_proxy_with_local_writer, bool(const GUID_t& local_writer,
             const GUID_t& remote_participant_guid, ReaderProxyData & rdata));
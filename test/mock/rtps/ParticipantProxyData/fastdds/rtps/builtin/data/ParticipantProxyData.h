@@ -64,6 +64,17 @@ public:
         return true;
     }
 
+    void compact_announcements(
+            bool compact_announcements)
+    {
+        compact_announcements_ = compact_announcements;
+    }
+
+    bool compact_announcements() const
+    {
+        return compact_announcements_;
+    }
+
     GUID_t m_guid;
     uint32_t m_availableBuiltinEndpoints;
     RemoteLocatorList metatraffic_locators;
@@ -75,6 +86,7 @@ public:
     security::ParticipantSecurityAttributesMask security_attributes_ = 0UL;
     security::PluginParticipantSecurityAttributesMask plugin_security_attributes_ = 0UL;
 #endif // if HAVE_SECURITY
+    bool compact_announcements_ = false;
 };
 
 } // namespace rtps
@@ -57,8 +57,9 @@ public:
     RTPSMessageGroup(
             RTPSParticipantImpl*,
             Endpoint*,
-            const RTPSMessageSenderInterface*,
-            std::chrono::steady_clock::time_point)
+            const RTPSMessageSenderInterface* msg_sender,
+            std::chrono::steady_clock::time_point = std::chrono::steady_clock::now() + std::chrono::hours(24))
+        : sender_(msg_sender)
     {
     }
 
@@ -79,6 +80,21 @@ public:
     {
     }
 
+    void endpoint(
+            Endpoint*)
+    {
+    }
+
+    //! Sender the group was created with.
+    const RTPSMessageSenderInterface* msg_sender() const
+    {
+        return sender_;
+    }
+
+private:
+
+    const RTPSMessageSenderInterface* sender_ = nullptr;
+
 };
 
 } // namespace rtps
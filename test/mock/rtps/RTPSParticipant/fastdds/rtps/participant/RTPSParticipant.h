@@ -26,6 +26,8 @@
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/builtin/data/ParticipantProxyData.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerStatistics.hpp>
 #include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
 #include <fastdds/fastdds_dll.hpp>
@@ -184,6 +186,12 @@ public:
         return mp_event_thr;
     }
 
+    ResourceEvent& get_resource_event(
+            const GUID_t& /*entity_guid*/) const
+    {
+        return mp_event_thr;
+    }
+
     MOCK_CONST_METHOD0(typelookup_manager, fastdds::dds::builtin::TypeLookupManager* ());
 
     MOCK_METHOD3(registerWriter, bool(
@@ -226,6 +234,18 @@ public:
         return {};
     }
 
+    fastdds::rtps::MemoryUsage get_transport_memory_usage() const
+    {
+        return {};
+    }
+
+    bool get_flow_controller_statistics(
+            const std::string& /*flow_controller_name*/,
+            fastdds::rtps::FlowControllerStatistics& /*statistics*/) const
+    {
+        return false;
+    }
+
     const RTPSParticipantAttributes& getRTPSParticipantAttributes()
     {
         return attributes_;
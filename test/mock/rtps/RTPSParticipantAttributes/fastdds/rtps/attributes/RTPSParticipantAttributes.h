@@ -460,11 +460,13 @@ public:
                (this->flow_controllers == b.flow_controllers) &&
                (this->builtin_controllers_sender_thread == b.builtin_controllers_sender_thread) &&
                (this->timed_events_thread == b.timed_events_thread) &&
+               (this->timed_events_threads == b.timed_events_threads) &&
 #if HAVE_SECURITY
                (this->security_log_thread == b.security_log_thread) &&
 #endif // if HAVE_SECURITY
                (this->discovery_server_thread == b.discovery_server_thread) &&
                (this->typelookup_service_thread == b.typelookup_service_thread) &&
+               (this->persistence_thread == b.persistence_thread) &&
                (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads);
 
     }
@@ -615,12 +617,21 @@ public:
     //! Thread settings for the timed events thread
     fastdds::rtps::ThreadSettings timed_events_thread;
 
+    /*! Number of threads running timed events, all of them with the timed_events_thread settings.
+     * The events of builtin entities run on the first one, while each user entity has its events run on one of
+     * them.
+     */
+    uint32_t timed_events_threads = 1;
+
     //! Thread settings for the discovery server thread
     fastdds::rtps::ThreadSettings discovery_server_thread;
 
     //! Thread settings for the builtin TypeLookup service requests and replies threads
     fastdds::rtps::ThreadSettings typelookup_service_thread;
 
+    //! Thread settings for the background threads of the persistence services
+    fastdds::rtps::ThreadSettings persistence_thread;
+
     //! Thread settings for the builtin transports reception threads
     fastdds::rtps::ThreadSettings builtin_transports_reception_threads;
 
@@ -293,6 +293,12 @@ public:
         return events_;
     }
 
+    ResourceEvent& getEventResource(
+            const GUID_t& /*entity_guid*/)
+    {
+        return events_;
+    }
+
     void set_endpoint_rtps_protection_supports(
             Endpoint* /*endpoint*/,
             bool /*support*/)
@@ -337,6 +343,17 @@ public:
         return true;
     }
 
+    template<class LocatorIteratorT>
+    bool sendSync(
+            CDRMessage_t* /*msg*/,
+            const GUID_t& /*sender_guid*/,
+            const LocatorIteratorT& /*destination_locators_begin*/,
+            const LocatorIteratorT& /*destination_locators_end*/,
+            std::chrono::steady_clock::time_point& /*max_blocking_time_point*/)
+    {
+        return true;
+    }
+
     template<class Functor>
     Functor forEachUserWriter(
             Functor f)
@@ -24,6 +24,7 @@
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/Endpoint.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/rtps/interfaces/IReaderDataFilter.hpp>
@@ -64,6 +65,12 @@ public:
     virtual bool matched_writer_is_matched(
             const GUID_t& wguid) = 0;
 
+    void get_memory_usage(
+            fastdds::rtps::EndpointMemoryUsage& usage) const
+    {
+        usage.guid = m_guid;
+    }
+
     const GUID_t& getGuid()
     {
         return m_guid;
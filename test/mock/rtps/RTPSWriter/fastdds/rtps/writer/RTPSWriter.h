@@ -26,6 +26,7 @@
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/Endpoint.h>
 #include <fastdds/rtps/interfaces/IReaderDataFilter.hpp>
@@ -34,6 +35,8 @@
 #include <fastdds/rtps/writer/LocatorSelectorSender.hpp>
 #include <fastdds/rtps/writer/WriterListener.h>
 
+#include <rtps/common/SampleBatch.hpp>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -74,6 +77,12 @@ public:
         return false;
     }
 
+    void get_memory_usage(
+            fastdds::rtps::EndpointMemoryUsage& usage) const
+    {
+        usage.guid = m_guid;
+    }
+
     WriterListener* getListener() const
     {
         return listener_;
@@ -97,6 +106,28 @@ public:
         return false;
     }
 
+    void enable_sample_batches()
+    {
+        sample_batches_ = true;
+    }
+
+    bool sends_sample_batches() const
+    {
+        return sample_batches_;
+    }
+
+    bool is_sample_batch(
+            const CacheChange_t& change) const
+    {
+        return sample_batches_ && detail::SampleBatch::is_batch(change.serializedPayload);
+    }
+
+    uint32_t sequence_number_span(
+            const CacheChange_t& change) const
+    {
+        return is_sample_batch(change) ? detail::SampleBatch::sequence_number_span(change) : 1u;
+    }
+
 #ifdef FASTDDS_STATISTICS
 
     template<typename T>
@@ -156,6 +187,11 @@ public:
             const LocatorSelectorSender&,
             std::chrono::steady_clock::time_point&));
 
+    MOCK_METHOD1(begin_sample_batch, void(
+            const std::chrono::time_point<std::chrono::steady_clock>&));
+
+    MOCK_METHOD0(end_sample_batch, void());
+
     MOCK_CONST_METHOD0(is_datasharing_compatible, bool());
 
     MOCK_CONST_METHOD1(is_datasharing_compatible_with, bool(
@@ -286,6 +322,8 @@ public:
     LocatorSelectorSender general_locator_selector_;
 
     LocatorSelectorSender async_locator_selector_;
+
+    bool sample_batches_ = false;
 };
 
 } // namespace rtps
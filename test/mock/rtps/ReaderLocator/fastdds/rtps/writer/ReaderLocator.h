@@ -27,6 +27,7 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
 #include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
@@ -80,6 +81,17 @@ public:
         return remote_guid_;
     }
 
+    bool accepts_sample_batches() const
+    {
+        return accepts_sample_batches_;
+    }
+
+    void accepts_sample_batches(
+            bool accepts_sample_batches)
+    {
+        accepts_sample_batches_ = accepts_sample_batches;
+    }
+
     /**
      * Try to start using this object for a new matched reader.
      *
@@ -239,6 +251,11 @@ public:
         return 0;
     }
 
+    fastdds::rtps::MemoryUsage get_memory_usage() const
+    {
+        return {};
+    }
+
     void lock() override
     {
     }
@@ -250,6 +267,7 @@ public:
 private:
 
     GUID_t remote_guid_;
+    bool accepts_sample_batches_ = false;
     std::vector<GuidPrefix_t> guid_prefix_as_vector_;
     std::vector<GUID_t> guid_as_vector_;
 };
@@ -95,6 +95,17 @@ public:
         return false;
     }
 
+    void sample_batches(
+            bool sample_batches)
+    {
+        sample_batches_ = sample_batches;
+    }
+
+    bool sample_batches() const
+    {
+        return sample_batches_;
+    }
+
     void add_unicast_locator(
             const Locator_t& locator)
     {
@@ -349,6 +360,7 @@ private:
     InstanceHandle_t m_RTPSParticipantKey;
     uint16_t m_userDefinedId;
     fastdds::rtps::ContentFilterProperty content_filter_;
+    bool sample_batches_ = false;
 
 };
 
@@ -19,6 +19,10 @@
 #ifndef _FASTDDS_RTPS_STATEFULWRITER_H_
 #define _FASTDDS_RTPS_STATEFULWRITER_H_
 
+#include <atomic>
+#include <functional>
+
+#include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/interfaces/IReaderDataFilter.hpp>
 #include <fastdds/rtps/writer/RTPSWriter.h>
@@ -27,8 +31,10 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class HeartbeatScheduler;
 class RTPSParticipantImpl;
 class ReaderProxy;
+class TimedEvent;
 
 class StatefulWriter : public RTPSWriter
 {
@@ -75,6 +81,10 @@ public:
 
     MOCK_METHOD0(send_periodic_heartbeat, bool());
 
+    MOCK_METHOD1(prepare_coalesced_heartbeat, void(
+                const std::function<void(const GUID_t&, const LocatorSelectorEntry&)>& add_remote_reader));
+
+    MOCK_METHOD1(add_coalesced_heartbeat_nts, void(RTPSMessageGroup& group));
 
     RTPSParticipantImpl* getRTPSParticipant()
     {
@@ -113,8 +123,13 @@ public:
         return false;
     }
 
+    TimedEvent* periodic_hb_event_ = nullptr;
+
+    std::atomic<bool> coalesced_heartbeat_pending_{false};
+
 private:
 
+    friend class HeartbeatScheduler;
     friend class ReaderProxy;
 
     RTPSParticipantImpl* participant_;
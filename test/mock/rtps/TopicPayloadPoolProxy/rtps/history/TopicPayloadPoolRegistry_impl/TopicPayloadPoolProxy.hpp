@@ -130,6 +130,11 @@ public:
         return inner_pool_->payload_pool_available_size();
     }
 
+    fastdds::rtps::MemoryUsage get_memory_usage() const override
+    {
+        return inner_pool_->get_memory_usage();
+    }
+
 private:
 
     std::string topic_name_;
@@ -124,6 +124,20 @@ public:
         return add_change_(a_change, wparams, &pre_commit, max_blocking_time);
     }
 
+    bool prepare_change(
+            CacheChange_t* a_change,
+            WriteParams& /*wparams*/)
+    {
+        a_change->sequenceNumber = ++last_sequence_number_;
+        return true;
+    }
+
+    void notify_writer(
+            CacheChange_t* /*a_change*/,
+            const std::chrono::time_point<std::chrono::steady_clock>& /*max_blocking_time*/)
+    {
+    }
+
     MOCK_METHOD1(set_fragments, void(
                 CacheChange_t * change));
 
@@ -176,6 +190,15 @@ public:
         return last_sequence_number_ + 1;
     }
 
+    void extend_last_sequence_number(
+            uint32_t count)
+    {
+        if (1 < count)
+        {
+            last_sequence_number_ += static_cast<int>(count - 1);
+        }
+    }
+
     std::vector<CacheChange_t*>::iterator changesBegin()
     {
         return m_changes.begin();
@@ -101,6 +101,17 @@ public:
     {
     }
 
+    void sample_batches(
+            bool sample_batches)
+    {
+        sample_batches_ = sample_batches;
+    }
+
+    bool sample_batches() const
+    {
+        return sample_batches_;
+    }
+
     void set_announced_unicast_locators(
             const LocatorList_t& /*locators*/)
     {
@@ -321,6 +332,7 @@ private:
     InstanceHandle_t m_key;
     InstanceHandle_t m_RTPSParticipantKey;
     uint16_t m_userDefinedId;
+    bool sample_batches_ = false;
 };
 
 } // namespace rtps
@@ -0,0 +1,466 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_CongestionControlTest.cpp
+ *
+ * Measures the throughput of a reliable writer towards two readers, one of them behind a lossy link simulated with
+ * test_UDPv4Transport, with and without the AIMD congestion control of the flow controller.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/qos/WriterQos.hpp>
+#include <fastdds/dds/subscriber/qos/ReaderQos.hpp>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/TopicAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/ReaderListener.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/WriterListener.h>
+#include <fastdds/utils/IPLocator.h>
+
+#include "../optionarg.hpp"
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    SAMPLES,
+    MSG_SIZE,
+    LOSS,
+    PERIOD,
+    TIMEOUT,
+    DOMAIN_ID,
+    PORT
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT, 0, "",  "",        Arg::None,
+      "Usage: CongestionControlTest [options]\n\nGeneral options:" },
+    { HELP,        0, "h", "help",    Arg::None,
+      "  -h         --help                   Produce help message." },
+    { SAMPLES,     0, "s", "samples", Arg::Numeric,
+      "  -s <num>,  --samples=<num>          Number of samples to send (Default: 5000)." },
+    { MSG_SIZE,    0, "m", "msg_size", Arg::Numeric,
+      "  -m <num>,  --msg_size=<num>         Size of each sample in bytes (Default: 1024)." },
+    { LOSS,        0, "l", "loss",    Arg::Numeric,
+      "  -l <num>,  --loss=<num>             Percentage of messages dropped towards the lossy reader (Default: 20)." },
+    { PERIOD,      0, "p", "period",  Arg::Numeric,
+      "  -p <num>,  --period=<num>           Period of the congestion windows in milliseconds (Default: 50)." },
+    { TIMEOUT,     0, "t", "timeout", Arg::Numeric,
+      "  -t <num>,  --timeout=<num>          Maximum seconds waiting for the readers on each run (Default: 60)." },
+    { DOMAIN_ID,   0, "d", "domain",  Arg::Numeric,
+      "  -d <num>,  --domain=<num>           DDS domain ID (Default: 0)." },
+    { PORT,        0, "",  "port",    Arg::Numeric,
+      "             --port=<num>             First unicast port used by the readers (Default: 17900)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+static const char* const flow_controller_name = "congestion_test_controller";
+
+struct RunResults
+{
+    struct Reader
+    {
+        uint32_t received = 0;
+        double elapsed_ms = 0;
+    };
+
+    Reader clean;
+    Reader lossy;
+    uint64_t messages_to_lossy = 0;
+    uint64_t messages_dropped = 0;
+    double writer_elapsed_ms = 0;
+};
+
+class CountingReader : public ReaderListener
+{
+public:
+
+    CountingReader(
+            uint32_t expected)
+        : expected_(expected)
+    {
+    }
+
+    void onNewCacheChangeAdded(
+            RTPSReader* reader,
+            const CacheChange_t* const change) override
+    {
+        reader->getHistory()->remove_change(const_cast<CacheChange_t*>(change));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (++received_ == expected_)
+        {
+            finished_ = std::chrono::steady_clock::now();
+            cv_.notify_all();
+        }
+    }
+
+    void onReaderMatched(
+            RTPSReader*,
+            MatchingInfo& info) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (MATCHED_MATCHING == info.status)
+        {
+            matched_ = true;
+            cv_.notify_all();
+        }
+    }
+
+    bool wait_matched(
+            std::chrono::seconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this]()
+                       {
+                           return matched_;
+                       });
+    }
+
+    RunResults::Reader wait_all(
+            const std::chrono::steady_clock::time_point& start,
+            const std::chrono::steady_clock::time_point& deadline)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait_until(lock, deadline, [this]()
+                {
+                    return received_ == expected_;
+                });
+
+        RunResults::Reader ret;
+        ret.received = received_;
+        auto end = received_ == expected_ ? finished_ : std::chrono::steady_clock::now();
+        ret.elapsed_ms = std::chrono::duration<double, std::milli>(end - start).count();
+        return ret;
+    }
+
+private:
+
+    using ReaderListener::onReaderMatched;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint32_t expected_ = 0;
+    uint32_t received_ = 0;
+    bool matched_ = false;
+    std::chrono::steady_clock::time_point finished_;
+};
+
+static RTPSParticipant* create_reader_participant(
+        uint32_t domain,
+        uint16_t port)
+{
+    RTPSParticipantAttributes attr;
+    attr.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::SIMPLE;
+    attr.useBuiltinTransports = false;
+    attr.userTransports.push_back(std::make_shared<UDPv4TransportDescriptor>());
+    Locator_t locator;
+    IPLocator::setIPv4(locator, 127, 0, 0, 1);
+    locator.port = port;
+    attr.defaultUnicastLocatorList.push_back(locator);
+    return RTPSDomain::createParticipant(domain, attr);
+}
+
+static RunResults run(
+        bool congestion_control,
+        uint32_t samples,
+        uint32_t msg_size,
+        uint8_t loss,
+        uint64_t period_ms,
+        uint32_t timeout_s,
+        uint32_t domain,
+        uint16_t port)
+{
+    RunResults results;
+    std::string topic_name = std::string("CongestionControlTest_") + (congestion_control ? "on" : "off");
+    uint16_t lossy_port = port;
+    std::atomic<uint64_t> messages_to_lossy{0};
+    std::atomic<uint64_t> messages_dropped{0};
+
+    // Writer participant, dropping a percentage of the messages sent to the lossy reader.
+    std::mutex generator_mutex;
+    std::mt19937 generator(static_cast<uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+    std::uniform_int_distribution<int> distribution(0, 99);
+    auto test_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    test_transport->locator_filter_ = [&](const Locator& destination) -> bool
+            {
+                if (lossy_port != IPLocator::getPhysicalPort(destination))
+                {
+                    return false;
+                }
+
+                ++messages_to_lossy;
+                std::lock_guard<std::mutex> lock(generator_mutex);
+                if (distribution(generator) < loss)
+                {
+                    ++messages_dropped;
+                    return true;
+                }
+                return false;
+            };
+
+    auto flow_controller = std::make_shared<FlowControllerDescriptor>();
+    flow_controller->name = flow_controller_name;
+    flow_controller->period_ms = period_ms;
+    flow_controller->congestion_control.enabled = congestion_control;
+
+    RTPSParticipantAttributes writer_participant_attr;
+    writer_participant_attr.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::SIMPLE;
+    writer_participant_attr.useBuiltinTransports = false;
+    writer_participant_attr.userTransports.push_back(test_transport);
+    writer_participant_attr.flow_controllers.push_back(flow_controller);
+    RTPSParticipant* writer_participant = RTPSDomain::createParticipant(domain, writer_participant_attr);
+
+    RTPSParticipant* clean_participant = create_reader_participant(domain, static_cast<uint16_t>(port + 1));
+    RTPSParticipant* lossy_participant = create_reader_participant(domain, lossy_port);
+
+    if (nullptr == writer_participant || nullptr == clean_participant || nullptr == lossy_participant)
+    {
+        printf("Error creating participants\n");
+        RTPSDomain::stopAll();
+        return results;
+    }
+
+    TopicAttributes topic_attr;
+    topic_attr.topicDataType = "CongestionControlTestType";
+    topic_attr.topicName = topic_name;
+
+    // Readers
+    HistoryAttributes reader_history_attr;
+    reader_history_attr.payloadMaxSize = msg_size;
+    reader_history_attr.maximumReservedCaches = 0;
+    ReaderAttributes reader_attr;
+    reader_attr.endpoint.reliabilityKind = RELIABLE;
+    eprosima::fastdds::dds::ReaderQos reader_qos;
+    reader_qos.m_reliability.kind = eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS;
+
+    CountingReader clean_listener(samples);
+    CountingReader lossy_listener(samples);
+    ReaderHistory clean_history(reader_history_attr);
+    ReaderHistory lossy_history(reader_history_attr);
+    RTPSReader* clean_reader = RTPSDomain::createRTPSReader(clean_participant, reader_attr, &clean_history,
+                    &clean_listener);
+    RTPSReader* lossy_reader = RTPSDomain::createRTPSReader(lossy_participant, reader_attr, &lossy_history,
+                    &lossy_listener);
+    clean_participant->registerReader(clean_reader, topic_attr, reader_qos);
+    lossy_participant->registerReader(lossy_reader, topic_attr, reader_qos);
+
+    // Writer
+    HistoryAttributes writer_history_attr;
+    writer_history_attr.payloadMaxSize = msg_size;
+    writer_history_attr.initialReservedCaches = static_cast<int32_t>(samples);
+    writer_history_attr.maximumReservedCaches = static_cast<int32_t>(samples);
+    WriterAttributes writer_attr;
+    writer_attr.endpoint.reliabilityKind = RELIABLE;
+    writer_attr.mode = ASYNCHRONOUS_WRITER;
+    writer_attr.flow_controller_name = flow_controller_name;
+    writer_attr.times.heartbeatPeriod = Duration_t(0, 50000000);
+    writer_attr.times.nackResponseDelay = Duration_t(0, 5000000);
+    eprosima::fastdds::dds::WriterQos writer_qos;
+    writer_qos.m_reliability.kind = eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS;
+
+    WriterHistory writer_history(writer_history_attr);
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(writer_participant, writer_attr, &writer_history);
+    writer_participant->registerWriter(writer, topic_attr, writer_qos);
+
+    if (!clean_listener.wait_matched(std::chrono::seconds(10)) ||
+            !lossy_listener.wait_matched(std::chrono::seconds(10)))
+    {
+        printf("Readers not matched\n");
+    }
+    else
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < samples; ++i)
+        {
+            CacheChange_t* change = writer->new_change([msg_size]() -> uint32_t
+                            {
+                                return msg_size;
+                            }, ALIVE);
+            if (nullptr == change)
+            {
+                break;
+            }
+            memset(change->serializedPayload.data, static_cast<int>(i & 0xFF), msg_size);
+            change->serializedPayload.length = msg_size;
+            writer_history.add_change(change);
+        }
+        results.writer_elapsed_ms =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        auto deadline = start + std::chrono::seconds(timeout_s);
+        results.clean = clean_listener.wait_all(start, deadline);
+        results.lossy = lossy_listener.wait_all(start, deadline);
+    }
+
+    results.messages_to_lossy = messages_to_lossy;
+    results.messages_dropped = messages_dropped;
+
+    RTPSDomain::removeRTPSParticipant(lossy_participant);
+    RTPSDomain::removeRTPSParticipant(clean_participant);
+    RTPSDomain::removeRTPSParticipant(writer_participant);
+
+    return results;
+}
+
+static void print_results(
+        const char* name,
+        uint32_t msg_size,
+        const RunResults& results)
+{
+    auto mbits = [msg_size](const RunResults::Reader& reader) -> double
+            {
+                return 0 < reader.elapsed_ms ? (double)reader.received * msg_size * 8 / (reader.elapsed_ms * 1000) : 0;
+            };
+
+    printf("%-5s %11u %11.1f %11.3f %11u %11.1f %11.3f %13llu %13llu\n",
+            name,
+            results.clean.received, results.clean.elapsed_ms, mbits(results.clean),
+            results.lossy.received, results.lossy.elapsed_ms, mbits(results.lossy),
+            static_cast<unsigned long long>(results.messages_to_lossy),
+            static_cast<unsigned long long>(results.messages_dropped));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    uint32_t samples = 5000;
+    uint32_t msg_size = 1024;
+    uint32_t loss = 20;
+    uint64_t period_ms = 50;
+    uint32_t timeout_s = 60;
+    uint32_t domain = 0;
+    uint32_t port = 17900;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case SAMPLES:
+                samples = strtoul(opt.arg, nullptr, 10);
+                break;
+            case MSG_SIZE:
+                msg_size = strtoul(opt.arg, nullptr, 10);
+                break;
+            case LOSS:
+                loss = strtoul(opt.arg, nullptr, 10);
+                break;
+            case PERIOD:
+                period_ms = strtoull(opt.arg, nullptr, 10);
+                break;
+            case TIMEOUT:
+                timeout_s = strtoul(opt.arg, nullptr, 10);
+                break;
+            case DOMAIN_ID:
+                domain = strtoul(opt.arg, nullptr, 10);
+                break;
+            case PORT:
+                port = strtoul(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (100 < loss || 0 == samples || 0 == msg_size || 65534 < port)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    // Messages have to go through the transport, so the lossy link can be simulated.
+    eprosima::fastdds::LibrarySettings library_settings;
+    library_settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->set_library_settings(library_settings);
+
+    printf("Samples: %u, size: %u bytes, loss towards lossy reader: %u%%, window period: %llu ms\n\n",
+            samples, msg_size, loss, static_cast<unsigned long long>(period_ms));
+    printf("%-5s %11s %11s %11s %11s %11s %11s %13s %13s\n", "AIMD",
+            "Clean recv", "Clean ms", "Clean Mb/s", "Lossy recv", "Lossy ms", "Lossy Mb/s",
+            "Msgs to lossy", "Msgs dropped");
+
+    RunResults off = run(false, samples, msg_size, static_cast<uint8_t>(loss), period_ms, timeout_s, domain,
+                    static_cast<uint16_t>(port));
+    print_results("off", msg_size, off);
+    RunResults on = run(true, samples, msg_size, static_cast<uint8_t>(loss), period_ms, timeout_s, domain,
+                    static_cast<uint16_t>(port));
+    print_results("on", msg_size, on);
+
+    return (samples == on.clean.received && samples == on.lossy.received) ? 0 : 1;
+}
@@ -0,0 +1,354 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DiscoveryLoadTest.cpp
+ *
+ * Measures the network traffic generated by the participant discovery of a set of idle participants, with full and
+ * with compact periodic participant announcements.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/common/EntityId_t.hpp>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <fastdds/rtps/participant/ParticipantDiscoveryInfo.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/participant/RTPSParticipantListener.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
+
+#include "../optionarg.hpp"
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    PARTICIPANTS,
+    SECONDS,
+    PERIOD,
+    DOMAIN_ID
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,  0, "",  "",             Arg::None,
+      "Usage: DiscoveryLoadTest [options]\n\nGeneral options:" },
+    { HELP,         0, "h", "help",         Arg::None,
+      "  -h         --help                   Produce help message." },
+    { PARTICIPANTS, 0, "n", "participants", Arg::Numeric,
+      "  -n <num>,  --participants=<num>     Number of participants (Default: 20)." },
+    { SECONDS,      0, "s", "seconds",      Arg::Numeric,
+      "  -s <num>,  --seconds=<num>          Seconds measuring the idle traffic on each run (Default: 10)." },
+    { PERIOD,       0, "p", "period",       Arg::Numeric,
+      "  -p <num>,  --period=<num>           Announcement period in milliseconds (Default: 1000)." },
+    { DOMAIN_ID,    0, "d", "domain",       Arg::Numeric,
+      "  -d <num>,  --domain=<num>           DDS domain ID (Default: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+struct RunResults
+{
+    uint32_t discovered = 0;
+    uint32_t lost = 0;
+    uint64_t datagrams = 0;
+    uint64_t bytes = 0;
+    uint64_t participant_data = 0;
+    double elapsed_s = 0;
+};
+
+class DiscoveryCounter : public RTPSParticipantListener
+{
+public:
+
+    void onParticipantDiscovery(
+            RTPSParticipant*,
+            ParticipantDiscoveryInfo&& info) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        switch (info.status)
+        {
+            case ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT:
+                ++discovered_;
+                break;
+            case ParticipantDiscoveryInfo::REMOVED_PARTICIPANT:
+            case ParticipantDiscoveryInfo::DROPPED_PARTICIPANT:
+                ++lost_;
+                break;
+            default:
+                break;
+        }
+        cv_.notify_all();
+    }
+
+    bool wait_discovered(
+            uint32_t expected,
+            const std::chrono::steady_clock::time_point& deadline)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_until(lock, deadline, [this, expected]()
+                       {
+                           return discovered_ >= expected;
+                       });
+    }
+
+    uint32_t discovered()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return discovered_;
+    }
+
+    uint32_t lost()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lost_;
+    }
+
+private:
+
+    using RTPSParticipantListener::onParticipantDiscovery;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint32_t discovered_ = 0;
+    uint32_t lost_ = 0;
+};
+
+static RunResults run(
+        bool compact,
+        uint32_t num_participants,
+        uint32_t seconds,
+        uint32_t period_ms,
+        uint32_t domain)
+{
+    RunResults results;
+    std::atomic<bool> measuring{false};
+    std::atomic<uint64_t> datagrams{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> participant_data{0};
+
+    // All the participants share the same transport descriptor, so the traffic of all of them is counted.
+    auto test_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    test_transport->interfaceWhiteList.push_back("127.0.0.1");
+    test_transport->sub_messages_filter_ = [&](CDRMessage_t& msg) -> bool
+            {
+                // Submessage header (4), extra flags and octets to inline QoS (4) and reader id (4)
+                if (measuring && DATA == msg.buffer[msg.pos] && msg.pos + 16 <= msg.length &&
+                        0 == memcmp(&msg.buffer[msg.pos + 12], c_EntityId_SPDPWriter.value, 4))
+                {
+                    ++participant_data;
+                }
+                return false;
+            };
+    test_transport->messages_filter_ = [&](CDRMessage_t& msg) -> bool
+            {
+                if (measuring)
+                {
+                    ++datagrams;
+                    bytes += msg.length;
+                }
+                return false;
+            };
+
+    Duration_t period(static_cast<int32_t>(period_ms / 1000), (period_ms % 1000) * 1000000);
+    uint32_t lease_ms = 5 * period_ms;
+    Duration_t lease(static_cast<int32_t>(lease_ms / 1000), (lease_ms % 1000) * 1000000);
+    std::vector<std::unique_ptr<DiscoveryCounter>> listeners;
+    std::vector<RTPSParticipant*> participants;
+
+    for (uint32_t i = 0; i < num_participants; ++i)
+    {
+        RTPSParticipantAttributes attr;
+        attr.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::SIMPLE;
+        attr.builtin.discovery_config.leaseDuration_announcementperiod = period;
+        attr.builtin.discovery_config.leaseDuration = lease;
+        attr.useBuiltinTransports = false;
+        attr.userTransports.push_back(test_transport);
+        if (compact)
+        {
+            attr.properties.properties().emplace_back("fastdds.compact_participant_announcements", "true");
+        }
+
+        listeners.emplace_back(new DiscoveryCounter());
+        RTPSParticipant* participant = RTPSDomain::createParticipant(domain, attr, listeners.back().get());
+        if (nullptr == participant)
+        {
+            printf("Error creating participant %u\n", i);
+            break;
+        }
+        participants.push_back(participant);
+    }
+
+    if (participants.size() == num_participants)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        for (auto& listener : listeners)
+        {
+            listener->wait_discovered(num_participants - 1, deadline);
+        }
+
+        // Let the initial announcements finish before measuring.
+        std::this_thread::sleep_for(std::chrono::milliseconds(2 * period_ms));
+
+        measuring = true;
+        auto start = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(std::chrono::seconds(seconds));
+        measuring = false;
+        results.elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        for (auto& listener : listeners)
+        {
+            results.discovered += listener->discovered();
+            results.lost += listener->lost();
+        }
+        results.datagrams = datagrams;
+        results.bytes = bytes;
+        results.participant_data = participant_data;
+    }
+
+    for (RTPSParticipant* participant : participants)
+    {
+        RTPSDomain::removeRTPSParticipant(participant);
+    }
+
+    return results;
+}
+
+static void print_results(
+        const char* name,
+        const RunResults& results)
+{
+    double seconds = 0 < results.elapsed_s ? results.elapsed_s : 1;
+    printf("%-8s %11u %7u %11llu %13llu %13.1f %11llu\n",
+            name,
+            results.discovered, results.lost,
+            static_cast<unsigned long long>(results.datagrams),
+            static_cast<unsigned long long>(results.bytes),
+            results.bytes / seconds,
+            static_cast<unsigned long long>(results.participant_data));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    uint32_t num_participants = 20;
+    uint32_t seconds = 10;
+    uint32_t period_ms = 1000;
+    uint32_t domain = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case PARTICIPANTS:
+                num_participants = strtoul(opt.arg, nullptr, 10);
+                break;
+            case SECONDS:
+                seconds = strtoul(opt.arg, nullptr, 10);
+                break;
+            case PERIOD:
+                period_ms = strtoul(opt.arg, nullptr, 10);
+                break;
+            case DOMAIN_ID:
+                domain = strtoul(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (2 > num_participants || 0 == seconds || 0 == period_ms)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    // Announcements have to go through the transport, so they can be counted.
+    eprosima::fastdds::LibrarySettings library_settings;
+    library_settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->set_library_settings(library_settings);
+
+    uint32_t expected = num_participants * (num_participants - 1);
+    printf("Participants: %u, idle time: %u s, announcement period: %u ms\n\n",
+            num_participants, seconds, period_ms);
+    printf("%-8s %11s %7s %11s %13s %13s %11s\n", "Mode",
+            "Discovered", "Lost", "Datagrams", "Bytes", "Bytes/s", "DATA(p)");
+
+    RunResults full = run(false, num_participants, seconds, period_ms, domain);
+    print_results("full", full);
+    RunResults compact = run(true, num_participants, seconds, period_ms, domain);
+    print_results("compact", compact);
+
+    if (0 < full.bytes)
+    {
+        printf("\nIdle discovery traffic reduced by %.1f%%\n",
+                100.0 * (1.0 - static_cast<double>(compact.bytes) / static_cast<double>(full.bytes)));
+    }
+
+    // Both runs should discover all the participants and keep them alive while idle.
+    return (expected == full.discovered && expected == compact.discovered &&
+           0 == full.lost && 0 == compact.lost) ? 0 : 1;
+}
@@ -0,0 +1,354 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DiscoveryScaleTest.cpp
+ *
+ * Measures the time needed to match a large number of endpoints, spread over several topics, created at the same
+ * time on a set of participants.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/TopicAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/MatchingInfo.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/ParticipantDiscoveryInfo.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/participant/RTPSParticipantListener.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/WriterListener.h>
+
+#include "../optionarg.hpp"
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    PARTICIPANTS,
+    ENDPOINTS,
+    TOPICS,
+    PARTITIONS,
+    TIMEOUT,
+    DOMAIN_ID
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,  0, "",  "",             Arg::None,
+      "Usage: DiscoveryScaleTest [options]\n\nGeneral options:" },
+    { HELP,         0, "h", "help",         Arg::None,
+      "  -h         --help                   Produce help message." },
+    { PARTICIPANTS, 0, "n", "participants", Arg::Numeric,
+      "  -n <num>,  --participants=<num>     Number of participants (Default: 2)." },
+    { ENDPOINTS,    0, "e", "endpoints",    Arg::Numeric,
+      "  -e <num>,  --endpoints=<num>        Writers and readers created on each participant (Default: 1250)." },
+    { TOPICS,       0, "t", "topics",       Arg::Numeric,
+      "  -t <num>,  --topics=<num>           Number of topics (Default: 250)." },
+    { PARTITIONS,   0, "a", "partitions",   Arg::Numeric,
+      "  -a <num>,  --partitions=<num>       Partitions of the writers, matched by a wildcard on the readers "
+      "(Default: 0, no partitions)." },
+    { TIMEOUT,      0, "o", "timeout",      Arg::Numeric,
+      "  -o <num>,  --timeout=<num>          Seconds to wait for all the endpoints to match (Default: 120)." },
+    { DOMAIN_ID,    0, "d", "domain",       Arg::Numeric,
+      "  -d <num>,  --domain=<num>           DDS domain ID (Default: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Counts the participants discovered by all the participants.
+class ParticipantCounter : public RTPSParticipantListener
+{
+public:
+
+    void onParticipantDiscovery(
+            RTPSParticipant*,
+            ParticipantDiscoveryInfo&& info) override
+    {
+        if (ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT == info.status)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++discovered_;
+            cv_.notify_all();
+        }
+    }
+
+    bool wait_discovered(
+            uint64_t expected,
+            const std::chrono::steady_clock::time_point& deadline)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_until(lock, deadline, [this, expected]()
+                       {
+                           return discovered_ >= expected;
+                       });
+    }
+
+private:
+
+    using RTPSParticipantListener::onParticipantDiscovery;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint64_t discovered_ = 0;
+};
+
+//! Counts the matches of all the writers.
+class MatchCounter : public WriterListener
+{
+public:
+
+    void onWriterMatched(
+            RTPSWriter*,
+            MatchingInfo& info) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (MATCHED_MATCHING == info.status)
+        {
+            ++matched_;
+        }
+        else if (REMOVED_MATCHING == info.status)
+        {
+            --matched_;
+        }
+        cv_.notify_all();
+    }
+
+    bool wait_matched(
+            int64_t expected,
+            const std::chrono::steady_clock::time_point& deadline)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_until(lock, deadline, [this, expected]()
+                       {
+                           return matched_ >= expected;
+                       });
+    }
+
+    int64_t matched()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return matched_;
+    }
+
+private:
+
+    using WriterListener::onWriterMatched;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int64_t matched_ = 0;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    uint32_t num_participants = 2;
+    uint32_t num_endpoints = 1250;
+    uint32_t num_topics = 250;
+    uint32_t num_partitions = 0;
+    uint32_t timeout = 120;
+    uint32_t domain = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case PARTICIPANTS:
+                num_participants = strtoul(opt.arg, nullptr, 10);
+                break;
+            case ENDPOINTS:
+                num_endpoints = strtoul(opt.arg, nullptr, 10);
+                break;
+            case TOPICS:
+                num_topics = strtoul(opt.arg, nullptr, 10);
+                break;
+            case PARTITIONS:
+                num_partitions = strtoul(opt.arg, nullptr, 10);
+                break;
+            case TIMEOUT:
+                timeout = strtoul(opt.arg, nullptr, 10);
+                break;
+            case DOMAIN_ID:
+                domain = strtoul(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == num_participants || 0 == num_endpoints || 0 == num_topics || 0 == timeout)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    ParticipantCounter participant_counter;
+    MatchCounter match_counter;
+    std::vector<RTPSParticipant*> participants;
+    std::vector<std::unique_ptr<WriterHistory>> writer_histories;
+    std::vector<std::unique_ptr<ReaderHistory>> reader_histories;
+
+    auto transport = std::make_shared<UDPv4TransportDescriptor>();
+    transport->interfaceWhiteList.push_back("127.0.0.1");
+
+    for (uint32_t i = 0; i < num_participants; ++i)
+    {
+        RTPSParticipantAttributes attr;
+        attr.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::SIMPLE;
+        attr.useBuiltinTransports = false;
+        attr.userTransports.push_back(transport);
+
+        RTPSParticipant* participant = RTPSDomain::createParticipant(domain, attr, &participant_counter);
+        if (nullptr == participant)
+        {
+            printf("Error creating participant %u\n", i);
+            break;
+        }
+        participants.push_back(participant);
+    }
+
+    bool success = participants.size() == num_participants;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout);
+    uint64_t expected_participants = static_cast<uint64_t>(num_participants) * (num_participants - 1);
+    success = success && participant_counter.wait_discovered(expected_participants, deadline);
+
+    // Every writer matches all the readers on its topic, including the ones on its own participant.
+    std::vector<int64_t> writers_per_topic(num_topics, 0);
+    std::vector<int64_t> readers_per_topic(num_topics, 0);
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t p = 0; success && p < participants.size(); ++p)
+    {
+        for (uint32_t e = 0; success && e < num_endpoints; ++e)
+        {
+            uint32_t topic = e % num_topics;
+            std::string topic_name = "discovery_scale_" + std::to_string(topic);
+            TopicAttributes topic_attr(topic_name.c_str(), "DiscoveryScaleType");
+            HistoryAttributes history_attr;
+            history_attr.payloadMaxSize = 256;
+
+            WriterAttributes writer_attr;
+            writer_attr.endpoint.reliabilityKind = BEST_EFFORT;
+            eprosima::fastdds::dds::WriterQos writer_qos;
+            writer_qos.m_reliability.kind = eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS;
+            if (0 < num_partitions)
+            {
+                writer_qos.m_partition.push_back(("partition_" + std::to_string(e % num_partitions)).c_str());
+            }
+
+            writer_histories.emplace_back(new WriterHistory(history_attr));
+            RTPSWriter* writer = RTPSDomain::createRTPSWriter(participants[p], writer_attr,
+                            writer_histories.back().get(), &match_counter);
+            success = nullptr != writer && participants[p]->registerWriter(writer, topic_attr, writer_qos);
+            ++writers_per_topic[topic];
+
+            ReaderAttributes reader_attr;
+            reader_attr.endpoint.reliabilityKind = BEST_EFFORT;
+            eprosima::fastdds::dds::ReaderQos reader_qos;
+            reader_qos.m_reliability.kind = eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS;
+            if (0 < num_partitions)
+            {
+                reader_qos.m_partition.push_back("partition_*");
+            }
+
+            reader_histories.emplace_back(new ReaderHistory(history_attr));
+            RTPSReader* reader = RTPSDomain::createRTPSReader(participants[p], reader_attr,
+                            reader_histories.back().get());
+            success = success && nullptr != reader && participants[p]->registerReader(reader, topic_attr, reader_qos);
+            ++readers_per_topic[topic];
+        }
+    }
+
+    auto created = std::chrono::steady_clock::now();
+
+    int64_t expected_matches = 0;
+    for (uint32_t topic = 0; topic < num_topics; ++topic)
+    {
+        expected_matches += writers_per_topic[topic] * readers_per_topic[topic];
+    }
+
+    success = success && match_counter.wait_matched(expected_matches, deadline);
+    auto matched = std::chrono::steady_clock::now();
+
+    printf("Participants: %u, endpoints per participant: %u writers and %u readers, topics: %u, partitions: %u\n\n",
+            num_participants, num_endpoints, num_endpoints, num_topics, num_partitions);
+    printf("%-24s %12.1f ms\n", "Endpoint creation",
+            std::chrono::duration<double, std::milli>(created - start).count());
+    printf("%-24s %12.1f ms\n", "All endpoints matched",
+            std::chrono::duration<double, std::milli>(matched - start).count());
+    printf("%-24s %12lld / %lld\n", "Matches",
+            static_cast<long long>(match_counter.matched()), static_cast<long long>(expected_matches));
+
+    for (RTPSParticipant* participant : participants)
+    {
+        RTPSDomain::removeRTPSParticipant(participant);
+    }
+
+    return success ? 0 : 1;
+}
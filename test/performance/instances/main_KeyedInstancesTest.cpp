@@ -0,0 +1,459 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_KeyedInstancesTest.cpp
+ *
+ * Measures the cost of instance management on a keyed topic with a large number of instances.
+ * A writer and a reader on the same participant are used, so samples are delivered through intraprocess and
+ * every write goes through the instance lookup of both the DataWriterHistory and the DataReaderHistory.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include "../optionarg.hpp"
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    INSTANCES,
+    UPDATES,
+    RATE,
+    MSG_SIZE,
+    PREALLOCATED,
+    DOMAIN_ID
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,  0, "",  "",          Arg::None,
+      "Usage: KeyedInstancesTest [options]\n\nGeneral options:" },
+    { HELP,         0, "h", "help",      Arg::None,
+      "  -h         --help                   Produce help message." },
+    { INSTANCES,    0, "i", "instances", Arg::Numeric,
+      "  -i <num>,  --instances=<num>        Number of instances (Default: 100000)." },
+    { UPDATES,      0, "u", "updates",   Arg::Numeric,
+      "  -u <num>,  --updates=<num>          Number of samples written on random instances (Default: 500000)." },
+    { RATE,         0, "r", "rate",      Arg::Numeric,
+      "  -r <num>,  --rate=<num>             Samples per second written on random instances, 0 means no limit "
+      "(Default: 0)." },
+    { MSG_SIZE,     0, "m", "msg_size",  Arg::Numeric,
+      "  -m <num>,  --msg_size=<num>         Size of the sample data in bytes (Default: 32)." },
+    { PREALLOCATED, 0, "p", "preallocated", Arg::None,
+      "  -p         --preallocated           Use a preallocated memory policy, so instances are preallocated." },
+    { DOMAIN_ID,    0, "d", "domain",    Arg::Numeric,
+      "  -d <num>,  --domain=<num>           DDS domain ID (Default: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+struct KeyedSample
+{
+    uint32_t id = 0;
+    uint32_t seq = 0;
+    std::vector<uint8_t> data;
+};
+
+/**
+ * Type with a single uint32_t key field, serialized in little endian.
+ */
+class KeyedSampleType : public TopicDataType
+{
+public:
+
+    KeyedSampleType(
+            uint32_t data_size)
+        : data_size_(data_size)
+    {
+        setName("KeyedSample");
+        m_typeSize = SerializedPayload_t::representation_header_size + 2 * sizeof(uint32_t) + data_size_;
+        m_isGetKeyDefined = true;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t) override
+    {
+        static const uint8_t encapsulation[4] = { 0x0, 0x1, 0x0, 0x0 };
+        const KeyedSample* sample = static_cast<const KeyedSample*>(data);
+
+        uint8_t* ser_data = payload->data;
+        memcpy(ser_data, encapsulation, SerializedPayload_t::representation_header_size);
+        ser_data += SerializedPayload_t::representation_header_size;
+        memcpy(ser_data, &sample->id, sizeof(sample->id));
+        ser_data += sizeof(sample->id);
+        memcpy(ser_data, &sample->seq, sizeof(sample->seq));
+        ser_data += sizeof(sample->seq);
+        memcpy(ser_data, sample->data.data(), (std::min)(data_size_, static_cast<uint32_t>(sample->data.size())));
+        payload->length = m_typeSize;
+        payload->encapsulation = CDR_LE;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        if (payload->length < m_typeSize)
+        {
+            return false;
+        }
+
+        KeyedSample* sample = static_cast<KeyedSample*>(data);
+        const uint8_t* ser_data = payload->data + SerializedPayload_t::representation_header_size;
+        memcpy(&sample->id, ser_data, sizeof(sample->id));
+        ser_data += sizeof(sample->id);
+        memcpy(&sample->seq, ser_data, sizeof(sample->seq));
+        ser_data += sizeof(sample->seq);
+        sample->data.assign(ser_data, ser_data + data_size_);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*,
+            DataRepresentationId_t) override
+    {
+        uint32_t size = m_typeSize;
+        return [size]() -> uint32_t
+               {
+                   return size;
+               };
+    }
+
+    void* createData() override
+    {
+        return new KeyedSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<KeyedSample*>(data);
+    }
+
+    bool getKey(
+            void* data,
+            InstanceHandle_t* ihandle,
+            bool /*force_md5*/) override
+    {
+        // Keys shorter than 16 bytes are used directly, serialized as big endian
+        uint32_t id = static_cast<KeyedSample*>(data)->id;
+        ihandle->value[0] = static_cast<uint8_t>(id >> 24);
+        ihandle->value[1] = static_cast<uint8_t>(id >> 16);
+        ihandle->value[2] = static_cast<uint8_t>(id >> 8);
+        ihandle->value[3] = static_cast<uint8_t>(id);
+        return true;
+    }
+
+    bool is_bounded() const override
+    {
+        return true;
+    }
+
+private:
+
+    uint32_t data_size_;
+};
+
+static void print_result(
+        const char* phase,
+        uint64_t operations,
+        const std::chrono::steady_clock::duration& elapsed)
+{
+    double elapsed_ms = std::chrono::duration<double, std::milli>(elapsed).count();
+    printf("%-10s %12llu %14.2f %12.1f\n", phase, static_cast<unsigned long long>(operations), elapsed_ms,
+            0 < operations ? elapsed_ms * 1e6 / static_cast<double>(operations) : 0.0);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    uint32_t instances = 100000;
+    uint32_t updates = 500000;
+    uint32_t rate = 0;
+    uint32_t msg_size = 32;
+    bool preallocated = false;
+    uint32_t domain = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case INSTANCES:
+                instances = strtoul(opt.arg, nullptr, 10);
+                break;
+            case UPDATES:
+                updates = strtoul(opt.arg, nullptr, 10);
+                break;
+            case RATE:
+                rate = strtoul(opt.arg, nullptr, 10);
+                break;
+            case MSG_SIZE:
+                msg_size = strtoul(opt.arg, nullptr, 10);
+                break;
+            case PREALLOCATED:
+                preallocated = true;
+                break;
+            case DOMAIN_ID:
+                domain = strtoul(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == instances)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        fprintf(stderr, "Error creating participant\n");
+        return 1;
+    }
+
+    TypeSupport type(new KeyedSampleType(msg_size));
+    type.register_type(participant);
+    Topic* topic = participant->create_topic("KeyedInstancesTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    auto memory_policy = preallocated ?
+            eprosima::fastrtps::rtps::PREALLOCATED_MEMORY_MODE :
+            eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+
+    DataWriterQos wqos = publisher->get_default_datawriter_qos();
+    wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    wqos.history().kind = KEEP_LAST_HISTORY_QOS;
+    wqos.history().depth = 1;
+    wqos.resource_limits().max_instances = static_cast<int32_t>(instances);
+    wqos.resource_limits().max_samples_per_instance = 1;
+    wqos.resource_limits().max_samples = static_cast<int32_t>(instances);
+    wqos.resource_limits().allocated_samples = preallocated ? static_cast<int32_t>(instances) : 100;
+    wqos.endpoint().history_memory_policy = memory_policy;
+    DataWriter* writer = publisher->create_datawriter(topic, wqos);
+
+    DataReaderQos rqos = subscriber->get_default_datareader_qos();
+    rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    rqos.history().kind = KEEP_LAST_HISTORY_QOS;
+    rqos.history().depth = 1;
+    rqos.resource_limits().max_instances = static_cast<int32_t>(instances);
+    rqos.resource_limits().max_samples_per_instance = 1;
+    rqos.resource_limits().max_samples = static_cast<int32_t>(instances);
+    rqos.resource_limits().allocated_samples = preallocated ? static_cast<int32_t>(instances) : 100;
+    rqos.endpoint().history_memory_policy = memory_policy;
+    DataReader* reader = subscriber->create_datareader(topic, rqos);
+
+    if (nullptr == writer || nullptr == reader)
+    {
+        fprintf(stderr, "Error creating endpoints\n");
+        DomainParticipantFactory::get_instance()->delete_participant(participant);
+        return 1;
+    }
+
+    // Wait for local matching
+    PublicationMatchedStatus matched;
+    for (int i = 0; i < 100 && (RETCODE_OK != writer->get_publication_matched_status(matched) ||
+            0 == matched.current_count); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    KeyedSample sample;
+    sample.data.assign(msg_size, 0xAA);
+    std::vector<InstanceHandle_t> handles(instances);
+
+    printf("Instances: %u, data size: %u bytes, memory policy: %s\n", instances, msg_size,
+            preallocated ? "PREALLOCATED" : "PREALLOCATED_WITH_REALLOC");
+    printf("%-10s %12s %14s %12s\n", "Phase", "Operations", "Total [ms]", "Op [ns]");
+
+    // Every write creates an instance on both histories
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < instances; ++i)
+    {
+        sample.id = i;
+        ++sample.seq;
+        writer->write(&sample);
+    }
+    print_result("create", instances, std::chrono::steady_clock::now() - start);
+
+    // Writes on existing instances. With depth 1, each one evicts the previous sample of the instance on both
+    // histories.
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<uint32_t> ids(0, instances - 1);
+    // When the rate is limited, samples are written in bursts of 1 ms
+    uint32_t burst = 0 < rate ? (std::max)(rate / 1000u, 1u) : updates;
+    std::chrono::nanoseconds burst_period(0 < rate ? 1000000000ull * burst / rate : 0);
+    std::chrono::steady_clock::duration busy(0);
+    start = std::chrono::steady_clock::now();
+    auto next_burst = start;
+    for (uint32_t i = 0; i < updates;)
+    {
+        auto burst_start = std::chrono::steady_clock::now();
+        for (uint32_t j = 0; j < burst && i < updates; ++j, ++i)
+        {
+            sample.id = ids(gen);
+            ++sample.seq;
+            writer->write(&sample);
+        }
+        busy += std::chrono::steady_clock::now() - burst_start;
+
+        if (0 < rate)
+        {
+            next_burst += burst_period;
+            std::this_thread::sleep_until(next_burst);
+        }
+    }
+    auto update_elapsed = std::chrono::steady_clock::now() - start;
+    print_result("update", updates, busy);
+
+    start = std::chrono::steady_clock::now();
+    uint32_t found = 0;
+    for (uint32_t i = 0; i < instances; ++i)
+    {
+        sample.id = i;
+        handles[i] = writer->lookup_instance(&sample);
+        found += handles[i].isDefined() ? 1 : 0;
+    }
+    print_result("lookup", instances, std::chrono::steady_clock::now() - start);
+
+    // Read each instance by handle, in random order
+    std::shuffle(handles.begin(), handles.end(), gen);
+    start = std::chrono::steady_clock::now();
+    uint32_t read = 0;
+    for (const InstanceHandle_t& handle : handles)
+    {
+        LoanableSequence<KeyedSample> data;
+        SampleInfoSeq infos;
+        if (RETCODE_OK == reader->read_instance(data, infos, 1, handle))
+        {
+            read += static_cast<uint32_t>(data.length());
+            reader->return_loan(data, infos);
+        }
+    }
+    print_result("read", instances, std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    uint32_t taken = 0;
+    while (true)
+    {
+        LoanableSequence<KeyedSample> data;
+        SampleInfoSeq infos;
+        if (RETCODE_OK != reader->take(data, infos, 1000))
+        {
+            break;
+        }
+        taken += static_cast<uint32_t>(data.length());
+        reader->return_loan(data, infos);
+    }
+    print_result("take", taken, std::chrono::steady_clock::now() - start);
+
+    double update_s = std::chrono::duration<double>(update_elapsed).count();
+    printf("Update rate: %.0f samples/s", 0 < update_s ? updates / update_s : 0.0);
+    if (0 < rate)
+    {
+        printf(" (requested %u samples/s, writer busy %.1f%% of the time)", rate,
+                100.0 * std::chrono::duration<double>(busy).count() / update_s);
+    }
+    printf("\n");
+
+    participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+
+    if (found != instances || read != instances || taken != instances)
+    {
+        fprintf(stderr, "Unexpected result: %u instances found, %u read, %u taken\n", found, read, taken);
+        return 1;
+    }
+
+    return 0;
+}
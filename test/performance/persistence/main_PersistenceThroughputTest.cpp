@@ -0,0 +1,436 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_PersistenceThroughputTest.cpp
+ *
+ * Measures the throughput of a TRANSIENT writer and reader using the SQLite3 persistence service.
+ * Every sample written is stored by the writer and every sample received updates the state stored by the reader,
+ * so the results show the cost of the persistence service with and without group commit.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include "../optionarg.hpp"
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+using eprosima::fastrtps::rtps::PropertyPolicy;
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    SAMPLES,
+    MSG_SIZE,
+    DEPTH,
+    GROUP_COMMIT,
+    MAX_DELAY,
+    MAX_BATCH,
+    DB_FILE,
+    DOMAIN_ID
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,  0, "",  "",             Arg::None,
+      "Usage: PersistenceThroughputTest [options]\n\nGeneral options:" },
+    { HELP,         0, "h", "help",         Arg::None,
+      "  -h         --help                   Produce help message." },
+    { SAMPLES,      0, "s", "samples",      Arg::Numeric,
+      "  -s <num>,  --samples=<num>          Number of samples written (Default: 10000)." },
+    { MSG_SIZE,     0, "m", "msg_size",     Arg::Numeric,
+      "  -m <num>,  --msg_size=<num>         Size of the sample data in bytes (Default: 256)." },
+    { DEPTH,        0, "k", "depth",        Arg::Numeric,
+      "  -k <num>,  --depth=<num>            Depth of the KEEP_LAST histories (Default: 100)." },
+    { GROUP_COMMIT, 0, "g", "group_commit", Arg::None,
+      "  -g         --group_commit           Commit the persistence operations in groups." },
+    { MAX_DELAY,    0, "w", "max_delay",    Arg::Numeric,
+      "  -w <num>,  --max_delay=<num>        Maximum time in ms an operation waits to be committed "
+      "(Default: 10)." },
+    { MAX_BATCH,    0, "b", "max_batch",    Arg::Numeric,
+      "  -b <num>,  --max_batch=<num>        Operations that trigger a commit before max_delay (Default: 1024)." },
+    { DB_FILE,      0, "f", "file",         Arg::String,
+      "  -f <name>, --file=<name>            Prefix of the database files (Default: persistence_throughput)." },
+    { DOMAIN_ID,    0, "d", "domain",       Arg::Numeric,
+      "  -d <num>,  --domain=<num>           DDS domain ID (Default: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+struct PersistentSample
+{
+    uint32_t seq = 0;
+    std::vector<uint8_t> data;
+};
+
+/**
+ * Keyless type with a sequence number and a blob, serialized in little endian.
+ */
+class PersistentSampleType : public TopicDataType
+{
+public:
+
+    PersistentSampleType(
+            uint32_t data_size)
+        : data_size_(data_size)
+    {
+        setName("PersistentSample");
+        m_typeSize = SerializedPayload_t::representation_header_size + sizeof(uint32_t) + data_size_;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t) override
+    {
+        static const uint8_t encapsulation[4] = { 0x0, 0x1, 0x0, 0x0 };
+        const PersistentSample* sample = static_cast<const PersistentSample*>(data);
+
+        uint8_t* ser_data = payload->data;
+        memcpy(ser_data, encapsulation, SerializedPayload_t::representation_header_size);
+        ser_data += SerializedPayload_t::representation_header_size;
+        memcpy(ser_data, &sample->seq, sizeof(sample->seq));
+        ser_data += sizeof(sample->seq);
+        memcpy(ser_data, sample->data.data(), (std::min)(data_size_, static_cast<uint32_t>(sample->data.size())));
+        payload->length = m_typeSize;
+        payload->encapsulation = CDR_LE;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        if (payload->length < m_typeSize)
+        {
+            return false;
+        }
+
+        PersistentSample* sample = static_cast<PersistentSample*>(data);
+        const uint8_t* ser_data = payload->data + SerializedPayload_t::representation_header_size;
+        memcpy(&sample->seq, ser_data, sizeof(sample->seq));
+        ser_data += sizeof(sample->seq);
+        sample->data.assign(ser_data, ser_data + data_size_);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*,
+            DataRepresentationId_t) override
+    {
+        uint32_t size = m_typeSize;
+        return [size]() -> uint32_t
+               {
+                   return size;
+               };
+    }
+
+    void* createData() override
+    {
+        return new PersistentSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<PersistentSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+    bool is_bounded() const override
+    {
+        return true;
+    }
+
+private:
+
+    uint32_t data_size_;
+};
+
+static void add_persistence_properties(
+        PropertyPolicy& properties,
+        const std::string& filename,
+        const char* persistence_guid,
+        bool group_commit,
+        uint32_t max_delay_ms,
+        uint32_t max_batch_size)
+{
+    properties.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    properties.properties().emplace_back("dds.persistence.sqlite3.filename", filename);
+    properties.properties().emplace_back("dds.persistence.guid", persistence_guid);
+    if (group_commit)
+    {
+        properties.properties().emplace_back("dds.persistence.sqlite3.group_commit", "true");
+        properties.properties().emplace_back("dds.persistence.sqlite3.group_commit.max_delay_ms",
+                std::to_string(max_delay_ms));
+        properties.properties().emplace_back("dds.persistence.sqlite3.group_commit.max_batch_size",
+                std::to_string(max_batch_size));
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    uint32_t samples = 10000;
+    uint32_t msg_size = 256;
+    uint32_t depth = 100;
+    bool group_commit = false;
+    uint32_t max_delay_ms = 10;
+    uint32_t max_batch_size = 1024;
+    std::string db_prefix = "persistence_throughput";
+    uint32_t domain = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case SAMPLES:
+                samples = strtoul(opt.arg, nullptr, 10);
+                break;
+            case MSG_SIZE:
+                msg_size = strtoul(opt.arg, nullptr, 10);
+                break;
+            case DEPTH:
+                depth = strtoul(opt.arg, nullptr, 10);
+                break;
+            case GROUP_COMMIT:
+                group_commit = true;
+                break;
+            case MAX_DELAY:
+                max_delay_ms = strtoul(opt.arg, nullptr, 10);
+                break;
+            case MAX_BATCH:
+                max_batch_size = strtoul(opt.arg, nullptr, 10);
+                break;
+            case DB_FILE:
+                db_prefix = opt.arg;
+                break;
+            case DOMAIN_ID:
+                domain = strtoul(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == samples || 0 == depth)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    // Start from empty databases, so previous runs are not loaded
+    const std::string writer_db = db_prefix + "_writer.db";
+    const std::string reader_db = db_prefix + "_reader.db";
+    for (const std::string& file : {writer_db, reader_db})
+    {
+        std::remove(file.c_str());
+        std::remove((file + "-wal").c_str());
+        std::remove((file + "-shm").c_str());
+    }
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        fprintf(stderr, "Error creating participant\n");
+        return 1;
+    }
+
+    TypeSupport type(new PersistentSampleType(msg_size));
+    type.register_type(participant);
+    Topic* topic = participant->create_topic("PersistenceThroughputTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    DataWriterQos wqos = publisher->get_default_datawriter_qos();
+    wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    wqos.durability().kind = TRANSIENT_DURABILITY_QOS;
+    wqos.history().kind = KEEP_LAST_HISTORY_QOS;
+    wqos.history().depth = static_cast<int32_t>(depth);
+    add_persistence_properties(wqos.properties(), writer_db, "77.72.69.74.65.72.5f.70.65.72.73.5f|67.75.69.64",
+            group_commit, max_delay_ms, max_batch_size);
+    DataWriter* writer = publisher->create_datawriter(topic, wqos);
+
+    DataReaderQos rqos = subscriber->get_default_datareader_qos();
+    rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    rqos.durability().kind = TRANSIENT_DURABILITY_QOS;
+    rqos.history().kind = KEEP_LAST_HISTORY_QOS;
+    rqos.history().depth = static_cast<int32_t>(depth);
+    add_persistence_properties(rqos.properties(), reader_db, "77.65.61.64.65.72.5f.70.65.72.73.5f|68.76.70.65",
+            group_commit, max_delay_ms, max_batch_size);
+    DataReader* reader = subscriber->create_datareader(topic, rqos);
+
+    if (nullptr == writer || nullptr == reader)
+    {
+        fprintf(stderr, "Error creating endpoints. Is SQLite3 persistence support enabled?\n");
+        participant->delete_contained_entities();
+        DomainParticipantFactory::get_instance()->delete_participant(participant);
+        return 1;
+    }
+
+    // Wait for local matching
+    PublicationMatchedStatus matched;
+    for (int i = 0; i < 100 && (RETCODE_OK != writer->get_publication_matched_status(matched) ||
+            0 == matched.current_count); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    PersistentSample sample;
+    sample.data.assign(msg_size, 0xAA);
+
+    printf("Samples: %u, data size: %u bytes, depth: %u, group commit: ", samples, msg_size, depth);
+    if (group_commit)
+    {
+        printf("%u ms / %u operations\n", max_delay_ms, max_batch_size);
+    }
+    else
+    {
+        printf("disabled\n");
+    }
+
+    // Samples are taken while writing, so the reader history never blocks the writer
+    uint32_t received = 0;
+    auto take_all = [&]()
+            {
+                LoanableSequence<PersistentSample> data;
+                SampleInfoSeq infos;
+                while (RETCODE_OK == reader->take(data, infos))
+                {
+                    received += static_cast<uint32_t>(data.length());
+                    reader->return_loan(data, infos);
+                }
+            };
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < samples; ++i)
+    {
+        sample.seq = i;
+        writer->write(&sample);
+        take_all();
+    }
+    auto write_elapsed = std::chrono::steady_clock::now() - start;
+
+    for (int i = 0; i < 1000 && received < samples; ++i)
+    {
+        take_all();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    auto total_elapsed = std::chrono::steady_clock::now() - start;
+
+    double write_s = std::chrono::duration<double>(write_elapsed).count();
+    double total_s = std::chrono::duration<double>(total_elapsed).count();
+    printf("%-10s %12s %14s %14s\n", "Phase", "Samples", "Total [ms]", "Samples/s");
+    printf("%-10s %12u %14.2f %14.1f\n", "write", samples, write_s * 1e3,
+            0 < write_s ? samples / write_s : 0.0);
+    printf("%-10s %12u %14.2f %14.1f\n", "receive", received, total_s * 1e3,
+            0 < total_s ? received / total_s : 0.0);
+
+    participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+
+    for (const std::string& file : {writer_db, reader_db})
+    {
+        std::remove(file.c_str());
+        std::remove((file + "-wal").c_str());
+        std::remove((file + "-shm").c_str());
+    }
+
+    if (0 == received)
+    {
+        fprintf(stderr, "No samples were received\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -37,12 +37,15 @@
 #include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/TypeDescriptor.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
 #include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
 
 using namespace eprosima::fastdds::dds;
 using namespace eprosima::fastrtps::rtps;
 
+static const char* const async_flow_controller_name = "ThroughputTestFlowController";
+
 // *******************************************************************************************
 // ********************************* DATA WRITER LISTENER ************************************
 // *******************************************************************************************
@@ -129,6 +132,7 @@ bool ThroughputPublisher::init(
         Arg::EnablerValue data_sharing,
         bool data_loans,
         Arg::EnablerValue shared_memory,
+        uint32_t async_threads,
         int forced_domain)
 {
     pid_ = pid;
@@ -137,6 +141,7 @@ bool ThroughputPublisher::init(
     data_sharing_ = data_sharing;
     data_loans_ = data_loans;
     shared_memory_ = shared_memory;
+    async_threads_ = async_threads;
     reliable_ = reliable;
     forced_domain_ = forced_domain;
     demands_file_ = demands_file;
@@ -199,6 +204,15 @@ bool ThroughputPublisher::init(
         pqos.transport().use_builtin_transports = false;
     }
 
+    // Register the flow controller used to publish asynchronously.
+    if (0 < async_threads_)
+    {
+        auto flow_controller = std::make_shared<eprosima::fastdds::rtps::FlowControllerDescriptor>();
+        flow_controller->name = async_flow_controller_name;
+        flow_controller->num_sender_threads = async_threads_;
+        pqos.flow_controllers().push_back(flow_controller);
+    }
+
     // Create the participant
     participant_ =
             DomainParticipantFactory::get_instance()->create_participant(domainId, pqos);
@@ -285,6 +299,13 @@ bool ThroughputPublisher::init(
         dw_qos_.data_sharing(dsp);
     }
 
+    // Publish asynchronously if requested
+    if (0 < async_threads_)
+    {
+        dw_qos_.publish_mode().kind = eprosima::fastdds::dds::ASYNCHRONOUS_PUBLISH_MODE;
+        dw_qos_.publish_mode().flow_controller_name = async_flow_controller_name;
+    }
+
     // Create Command topic
     {
         std::ostringstream topic_name;
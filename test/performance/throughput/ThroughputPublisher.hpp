@@ -60,6 +60,7 @@ public:
             Arg::EnablerValue data_sharing,
             bool data_loans,
             Arg::EnablerValue shared_memory,
+            uint32_t async_threads,
             int forced_domain);
 
     ~ThroughputPublisher();
@@ -139,6 +140,7 @@ private:
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
     bool data_loans_ = false;
     Arg::EnablerValue shared_memory_ = Arg::EnablerValue::NO_SET;
+    uint32_t async_threads_ = 0;
     bool ready_ = true;
     bool reliable_ = false;
     bool hostname_ = false;
@@ -62,7 +62,8 @@ enum  optionIndex
     SUBSCRIBERS,
     DATA_SHARING,
     DATA_LOAN,
-    SHARED_MEMORY
+    SHARED_MEMORY,
+    ASYNC_THREADS
 };
 
 enum TestAgent
@@ -95,6 +96,8 @@ const option::Descriptor usage[] = {
       "               --data_loans          Use loan sample API." },
     { SHARED_MEMORY,    0, "", "shared_memory", Arg::Enabler,
       "               --shared_memory=[on|off]             Explicitly enable/disable shared memory transport." },
+    { ASYNC_THREADS,    0, "", "async_threads", Arg::Numeric,
+      "               --async_threads=<num>  Publish asynchronously using <num> sender threads (Default: synchronous)." },
 #if HAVE_SECURITY
     {
         USE_SECURITY,  0, "",  "security",        Arg::Required,
@@ -172,6 +175,7 @@ int main(
     Arg::EnablerValue data_sharing = Arg::EnablerValue::NO_SET;
     bool data_loans = false;
     Arg::EnablerValue shared_memory = Arg::EnablerValue::NO_SET;
+    uint32_t async_threads = 0;
 
     argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
     if (argc)
@@ -351,6 +355,9 @@ int main(
                     shared_memory = Arg::EnablerValue::OFF;
                 }
                 break;
+            case ASYNC_THREADS:
+                async_threads = strtol(opt.arg, nullptr, 10);
+                break;
             case UNKNOWN_OPT:
                 option::printUsage(fwrite, stdout, usage, columns);
                 return 0;
@@ -480,6 +487,7 @@ int main(
                     data_sharing,
                     data_loans,
                     shared_memory,
+                    async_threads,
                     forced_domain)
                 )
         {
@@ -537,6 +545,7 @@ int main(
                     data_sharing,
                     data_loans,
                     shared_memory,
+                    async_threads,
                     forced_domain))
         {
             return_code = 1;
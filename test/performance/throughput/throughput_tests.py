@@ -89,6 +89,12 @@ if __name__ == '__main__':
         help='Explicitly enable/disable shared memory transport. (Defaults: Fast DDS default settings)',
         required=False
         )
+    parser.add_argument(
+        '-a',
+        '--async_threads',
+        help='Publish asynchronously with the given number of sender threads (Defaults: synchronous)',
+        required=False
+        )
 
     # Parse arguments
     args = parser.parse_args()
@@ -171,6 +177,20 @@ if __name__ == '__main__':
         else:
             data_options += ['--shared_memory=off']
 
+    # Asynchronous publication options
+    async_options = []
+    if args.async_threads:
+        if str.isdigit(args.async_threads) and int(args.async_threads) > 0:
+            async_options = ['--async_threads={}'.format(args.async_threads)]
+            filename_options += '_async_{}'.format(args.async_threads)
+        else:
+            print(
+                '"async_threads" must be a positive integer, NOT {}'.format(
+                    args.async_threads
+                )
+            )
+            exit(1)  # Exit with error
+
     # Recoveries files options
     recoveries_options = []
     if args.recoveries_file:
@@ -254,6 +274,7 @@ if __name__ == '__main__':
         pub_command += xml_options
         pub_command += data_options
         pub_command += reliability_options
+        pub_command += async_options
 
         sub_command += domain_options
         sub_command += xml_options
@@ -311,6 +332,7 @@ if __name__ == '__main__':
         command += xml_options
         command += data_options
         command += reliability_options
+        command += async_options
 
         print('Executable command: {}'.format(
             ' '.join(element for element in command)),
@@ -0,0 +1,282 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TimedEventBenchmark.cpp
+ *
+ * Measures the cost of a ResourceEvent with a large number of active periodic TimedEvents: how long it takes to
+ * schedule them, the lateness of their callbacks while all of them are running, and how long the event thread takes
+ * to process cancellations and restarts of random timers.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+
+#include "../optionarg.hpp"
+
+using eprosima::fastrtps::rtps::ResourceEvent;
+using eprosima::fastrtps::rtps::TimedEvent;
+using Clock = std::chrono::steady_clock;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    TIMERS,
+    MIN_PERIOD,
+    MAX_PERIOD,
+    DURATION,
+    CHURN
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,  0, "",  "",             Arg::None,
+      "Usage: TimedEventBenchmark [options]\n\nGeneral options:" },
+    { HELP,         0, "h", "help",         Arg::None,
+      "  -h         --help                   Produce help message." },
+    { TIMERS,       0, "t", "timers",       Arg::Numeric,
+      "  -t <num>,  --timers=<num>           Number of active timers (Default: 100000)." },
+    { MIN_PERIOD,   0, "m", "min_period",   Arg::Numeric,
+      "  -m <num>,  --min_period=<num>       Minimum period of the timers in ms (Default: 100)." },
+    { MAX_PERIOD,   0, "M", "max_period",   Arg::Numeric,
+      "  -M <num>,  --max_period=<num>       Maximum period of the timers in ms (Default: 1000)." },
+    { DURATION,     0, "d", "duration",     Arg::Numeric,
+      "  -d <num>,  --duration=<num>         Time in seconds the timers are running (Default: 5)." },
+    { CHURN,        0, "c", "churn",        Arg::Numeric,
+      "  -c <num>,  --churn=<num>            Number of timers canceled and restarted (Default: 100000)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Periodic timer recording how late its callbacks are executed.
+struct BenchmarkTimer
+{
+    Clock::duration period;
+    std::atomic<Clock::time_point> expected;
+    std::unique_ptr<TimedEvent> event;
+};
+
+struct Lateness
+{
+    std::mutex mutex;
+    uint64_t triggers = 0;
+    Clock::duration total{};
+    Clock::duration max{};
+};
+
+//! Wait until the event thread has processed all the operations requested before calling this function.
+static Clock::duration sync_event_thread(
+        ResourceEvent& service,
+        Clock::time_point start)
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool triggered = false;
+    Clock::time_point end;
+
+    TimedEvent marker(service, [&]() -> bool
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                end = Clock::now();
+                triggered = true;
+                cv.notify_one();
+                return false;
+            }, 0);
+    marker.restart_timer();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&]()
+            {
+                return triggered;
+            });
+    return end - start;
+}
+
+static double to_ms(
+        Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    uint32_t num_timers = 100000;
+    uint32_t min_period = 100;
+    uint32_t max_period = 1000;
+    uint32_t duration = 5;
+    uint32_t churn = 100000;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case TIMERS:
+                num_timers = strtoul(opt.arg, nullptr, 10);
+                break;
+            case MIN_PERIOD:
+                min_period = strtoul(opt.arg, nullptr, 10);
+                break;
+            case MAX_PERIOD:
+                max_period = strtoul(opt.arg, nullptr, 10);
+                break;
+            case DURATION:
+                duration = strtoul(opt.arg, nullptr, 10);
+                break;
+            case CHURN:
+                churn = strtoul(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == num_timers || 0 == min_period || max_period < min_period)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    ResourceEvent service;
+    service.init_thread();
+
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<uint32_t> period_distribution(min_period, max_period);
+    std::uniform_int_distribution<uint32_t> timer_distribution(0, num_timers - 1);
+
+    Lateness lateness;
+    std::vector<BenchmarkTimer> timers(num_timers);
+    for (BenchmarkTimer& timer : timers)
+    {
+        uint32_t period = period_distribution(generator);
+        timer.period = std::chrono::milliseconds(period);
+        timer.event.reset(new TimedEvent(service, [&timer, &lateness]() -> bool
+                {
+                    Clock::time_point now = Clock::now();
+                    Clock::duration late = (std::max)(now - timer.expected.load(), Clock::duration::zero());
+                    timer.expected = now + timer.period;
+
+                    std::lock_guard<std::mutex> guard(lateness.mutex);
+                    ++lateness.triggers;
+                    lateness.total += late;
+                    lateness.max = (std::max)(lateness.max, late);
+                    return true;
+                }, period));
+    }
+
+    printf("Timers: %u, periods: [%u, %u] ms\n", num_timers, min_period, max_period);
+
+    // Schedule all the timers
+    Clock::time_point start = Clock::now();
+    for (BenchmarkTimer& timer : timers)
+    {
+        timer.expected = Clock::now() + timer.period;
+        timer.event->restart_timer();
+    }
+    Clock::duration schedule_time = Clock::now() - start;
+    Clock::duration processed_time = sync_event_thread(service, start);
+    printf("Schedule:   %10.3f ms (%.1f ns/timer), processed by the event thread after %.3f ms\n",
+            to_ms(schedule_time), to_ms(schedule_time) * 1e6 / num_timers, to_ms(processed_time));
+
+    // Let all the timers run
+    {
+        std::lock_guard<std::mutex> guard(lateness.mutex);
+        lateness.triggers = 0;
+        lateness.total = Clock::duration::zero();
+        lateness.max = Clock::duration::zero();
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(duration));
+    {
+        std::lock_guard<std::mutex> guard(lateness.mutex);
+        printf("Run:        %10llu triggers in %u s (%.0f triggers/s), lateness mean %.3f ms, max %.3f ms\n",
+                static_cast<unsigned long long>(lateness.triggers), duration,
+                static_cast<double>(lateness.triggers) / (std::max)(duration, 1u),
+                0 < lateness.triggers ? to_ms(lateness.total) / lateness.triggers : 0.0,
+                to_ms(lateness.max));
+    }
+
+    // Cancel and restart random timers
+    start = Clock::now();
+    for (uint32_t i = 0; i < churn; ++i)
+    {
+        BenchmarkTimer& timer = timers[timer_distribution(generator)];
+        timer.event->cancel_timer();
+        timer.expected = Clock::now() + timer.period;
+        timer.event->restart_timer();
+    }
+    processed_time = sync_event_thread(service, start);
+    printf("Churn:      %10u cancel+restart processed by the event thread after %.3f ms (%.1f ns/operation)\n",
+            churn, to_ms(processed_time), 0 < churn ? to_ms(processed_time) * 1e6 / churn : 0.0);
+
+    // Cancel all the timers
+    start = Clock::now();
+    for (BenchmarkTimer& timer : timers)
+    {
+        timer.event->cancel_timer();
+    }
+    processed_time = sync_event_thread(service, start);
+    printf("Cancel:     %10u timers processed by the event thread after %.3f ms\n",
+            num_timers, to_ms(processed_time));
+
+    timers.clear();
+    return 0;
+}
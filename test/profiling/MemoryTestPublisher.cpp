@@ -67,7 +67,8 @@ bool MemoryTestPublisher::init(
         const eprosima::fastrtps::rtps::PropertyPolicy& property_policy,
         const std::string& sXMLConfigFile,
         uint32_t data_size,
-        bool dynamic_types)
+        bool dynamic_types,
+        const MemoryTestPoolOptions& pool_options)
 {
     m_sXMLConfigFile = sXMLConfigFile;
     n_samples = n_sam;
@@ -76,6 +77,7 @@ bool MemoryTestPublisher::init(
     m_exportPrefix = export_prefix;
     reliable_ = reliable;
     m_data_size = data_size;
+    pool_options_ = pool_options;
     dynamic_data_ = dynamic_types;
 
     if (dynamic_data_) // Dummy type registration
@@ -180,6 +182,20 @@ bool MemoryTestPublisher::init(
         writer_qos.publish_mode().kind = ASYNCHRONOUS_PUBLISH_MODE;
     }
 
+    if (pool_options_.set_memory_policy)
+    {
+        writer_qos.endpoint().history_memory_policy = pool_options_.memory_policy;
+    }
+    if (pool_options_.depth > 0)
+    {
+        writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+        writer_qos.history().depth = pool_options_.depth;
+    }
+    if (pool_options_.large_data_size > 60000)
+    {
+        writer_qos.publish_mode().kind = ASYNCHRONOUS_PUBLISH_MODE;
+    }
+
     if (m_sXMLConfigFile.length() > 0)
     {
         data_writer_ = publisher_->create_datawriter_with_profile(data_topic_, profile_name, &this->m_datapublistener);
@@ -399,6 +415,10 @@ bool MemoryTestPublisher::test(
     else
     {
         memory_ = new MemoryType(datasize);
+        if (0 < pool_options_.large_data_size && 0 < pool_options_.large_data_period)
+        {
+            large_memory_ = new MemoryType(pool_options_.large_data_size);
+        }
     }
     std::chrono::duration<double, std::micro> test_time_us = std::chrono::seconds(test_time);
     auto t_end_ = std::chrono::steady_clock::now();
@@ -436,6 +456,11 @@ bool MemoryTestPublisher::test(
                 m_DynData->set_uint32_value(0, count);
                 data_writer_->write(&m_DynData);
             }
+            else if (large_memory_ != nullptr && 0 == count % pool_options_.large_data_period)
+            {
+                large_memory_->seqnum = count;
+                data_writer_->write((void*)large_memory_);
+            }
             else
             {
                 memory_->seqnum = count;
@@ -464,6 +489,8 @@ bool MemoryTestPublisher::test(
     else
     {
         delete(memory_);
+        delete(large_memory_);
+        large_memory_ = nullptr;
     }
 
     return true;
@@ -82,7 +82,8 @@ public:
             const eprosima::fastrtps::rtps::PropertyPolicy& property_policy,
             const std::string& sXMLConfigFile,
             uint32_t data_size,
-            bool dynamic_types);
+            bool dynamic_types,
+            const MemoryTestPoolOptions& pool_options);
     void run(
             uint32_t test_time);
     bool test(
@@ -164,9 +165,11 @@ public:
     std::string m_sXMLConfigFile;
     bool reliable_;
     uint32_t m_data_size {0};
+    MemoryTestPoolOptions pool_options_;
     bool dynamic_data_ {false};
     // Static Data
     MemoryType* memory_ {nullptr};
+    MemoryType* large_memory_ {nullptr};
     MemoryDataType memory_t;
     // Dynamic Data
     eprosima::fastdds::dds::DynamicData::_ref_type m_DynData;
@@ -55,12 +55,14 @@ bool MemoryTestSubscriber::init(
         const eprosima::fastrtps::rtps::PropertyPolicy& property_policy,
         const std::string& sXMLConfigFile,
         uint32_t data_size,
-        bool dynamic_types)
+        bool dynamic_types,
+        const MemoryTestPoolOptions& pool_options)
 {
     m_sXMLConfigFile = sXMLConfigFile;
     m_echo = echo;
     n_samples = nsam;
     m_data_size = data_size;
+    pool_options_ = pool_options;
     dynamic_data_ = dynamic_types;
 
     if (dynamic_data_) // Dummy type registration
@@ -156,6 +158,15 @@ bool MemoryTestSubscriber::init(
         reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
     }
     reader_qos.properties(property_policy);
+    if (pool_options_.set_memory_policy)
+    {
+        reader_qos.endpoint().history_memory_policy = pool_options_.memory_policy;
+    }
+    if (pool_options_.depth > 0)
+    {
+        reader_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+        reader_qos.history().depth = pool_options_.depth;
+    }
 
     if (m_sXMLConfigFile.length() > 0)
     {
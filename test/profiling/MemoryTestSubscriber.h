@@ -76,7 +76,8 @@ public:
             const eprosima::fastrtps::rtps::PropertyPolicy& property_policy,
             const std::string& sXMLConfigFile,
             uint32_t data_size,
-            bool dynamic_types);
+            bool dynamic_types,
+            const MemoryTestPoolOptions& pool_options);
 
     void run();
     bool test(
@@ -157,6 +158,7 @@ public:
     bool m_echo {true};
     std::string m_sXMLConfigFile;
     uint32_t m_data_size {0};
+    MemoryTestPoolOptions pool_options_;
     bool dynamic_data_ {false};
     // Static Data
     MemoryType* memory_ {nullptr};
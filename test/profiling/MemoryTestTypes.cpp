@@ -53,7 +53,7 @@ bool MemoryDataType::deserialize(
     MemoryType* lt = (MemoryType*)data;
     lt->seqnum = *(uint32_t*)payload->data;
     uint32_t siz = *(uint32_t*)(payload->data + 4);
-    std::copy(payload->data + 8, payload->data + 8 + siz, lt->data.begin());
+    lt->data.assign(payload->data + 8, payload->data + 8 + siz);
     return true;
 }
 
@@ -25,6 +25,23 @@
 #include <vector>
 
 #include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/rtps/resources/ResourceManagement.h>
+
+//! Configuration of the payload pools of the data endpoints.
+struct MemoryTestPoolOptions
+{
+    //! Whether memory_policy should replace the default history memory policy.
+    bool set_memory_policy = false;
+    //! History memory policy of the data endpoints.
+    eprosima::fastrtps::rtps::MemoryManagementPolicy_t memory_policy =
+            eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+    //! KEEP_LAST depth of the data endpoints. Default history when 0.
+    int32_t depth = 0;
+    //! Size of the occasional large samples. No large samples when 0.
+    uint32_t large_data_size = 0;
+    //! A large sample is sent every large_data_period samples.
+    uint32_t large_data_period = 0;
+};
 
 class MemoryType
 {
@@ -142,7 +142,11 @@ enum  optionIndex
     XML_FILE,
     DATA_SIZE,
     DYNAMIC_TYPES,
-    TIME
+    TIME,
+    MEMORY_POLICY,
+    HISTORY_DEPTH,
+    LARGE_DATA_SIZE,
+    LARGE_DATA_PERIOD
 };
 
 const option::Descriptor usage[] = {
@@ -176,6 +180,15 @@ const option::Descriptor usage[] = {
     },
     { DATA_SIZE, 0, "", "size",             Arg::Numeric,   "\t--size\tData size." },
     { DYNAMIC_TYPES, 0, "", "dynamic_types", Arg::None,      "\t--dynamic_types \tUse dynamic types." },
+    { MEMORY_POLICY, 0, "", "memory_policy",  Arg::Required,
+      "\t--memory_policy=<arg> \tHistory memory policy of the data endpoints (\"PREALLOCATED\"/"
+      "\"PREALLOCATED_WITH_REALLOC\"/\"DYNAMIC\"/\"DYNAMIC_REUSABLE\"/\"DYNAMIC_SIZE_CLASS\")." },
+    { HISTORY_DEPTH, 0, "", "depth",          Arg::Numeric,
+      "\t--depth=<num> \tKEEP_LAST history depth of the data endpoints." },
+    { LARGE_DATA_SIZE, 0, "", "large_size",   Arg::Numeric,
+      "\t--large_size=<num> \tData size of the occasional large samples." },
+    { LARGE_DATA_PERIOD, 0, "", "large_period", Arg::Numeric,
+      "\t--large_period=<num> \tSend a large sample every <num> samples." },
     { 0, 0, 0, 0, 0, 0 }
 };
 
@@ -220,6 +233,7 @@ int main(
     uint32_t test_time_sec = 5;
     std::string export_prefix = "";
     std::string sXMLConfigFile = "";
+    MemoryTestPoolOptions pool_options;
 
     argc -= (argc > 0);
     argv += (argc > 0); // skip program name argv[0] if present
@@ -359,6 +373,47 @@ int main(
                 test_time_sec = strtol(opt.arg, nullptr, 10);
                 break;
 
+            case MEMORY_POLICY:
+                pool_options.set_memory_policy = true;
+                if (strcmp(opt.arg, "PREALLOCATED") == 0)
+                {
+                    pool_options.memory_policy = PREALLOCATED_MEMORY_MODE;
+                }
+                else if (strcmp(opt.arg, "PREALLOCATED_WITH_REALLOC") == 0)
+                {
+                    pool_options.memory_policy = PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+                }
+                else if (strcmp(opt.arg, "DYNAMIC") == 0)
+                {
+                    pool_options.memory_policy = DYNAMIC_RESERVE_MEMORY_MODE;
+                }
+                else if (strcmp(opt.arg, "DYNAMIC_REUSABLE") == 0)
+                {
+                    pool_options.memory_policy = DYNAMIC_REUSABLE_MEMORY_MODE;
+                }
+                else if (strcmp(opt.arg, "DYNAMIC_SIZE_CLASS") == 0)
+                {
+                    pool_options.memory_policy = DYNAMIC_SIZE_CLASS_MEMORY_MODE;
+                }
+                else
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 0;
+                }
+                break;
+
+            case HISTORY_DEPTH:
+                pool_options.depth = strtol(opt.arg, nullptr, 10);
+                break;
+
+            case LARGE_DATA_SIZE:
+                pool_options.large_data_size = strtol(opt.arg, nullptr, 10);
+                break;
+
+            case LARGE_DATA_PERIOD:
+                pool_options.large_data_period = strtol(opt.arg, nullptr, 10);
+                break;
+
 #if HAVE_SECURITY
             case USE_SECURITY:
                 if (strcmp(opt.arg, "true") == 0)
@@ -442,14 +497,15 @@ int main(
             std::endl;
         MemoryTestPublisher memoryPub;
         memoryPub.init(sub_number, n_samples, reliable, seed, hostname, export_csv, export_prefix,
-                pub_part_property_policy, pub_property_policy, sXMLConfigFile, data_size, dynamic_types);
+                pub_part_property_policy, pub_property_policy, sXMLConfigFile, data_size, dynamic_types,
+                pool_options);
         memoryPub.run(test_time_sec);
     }
     else
     {
         MemoryTestSubscriber memorySub;
         memorySub.init(echo, n_samples, reliable, seed, hostname, sub_part_property_policy, sub_property_policy,
-                sXMLConfigFile, data_size, dynamic_types);
+                sXMLConfigFile, data_size, dynamic_types, pool_options);
         memorySub.run();
     }
 
@@ -12,7 +12,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-import shlex, subprocess, time, os, socket, sys, threading
+import csv, shlex, subprocess, time, os, socket, sys, threading
 
 if os.environ.get("PROFILING_BINS"):
     binaries = os.environ.get("PROFILING_BINS").split(';')
@@ -59,6 +59,53 @@ def start_test(command, pubsub, time, transport):
     # print("Command: " + py_command)
     p = subprocess.Popen(py_command, shell=True)
 
+def read_peak_heap(csv_path):
+    with open(csv_path) as csv_file:
+        rows = list(csv.DictReader(csv_file))
+    return int(rows[0]['heap'])
+
+def compare_payload_policies(command, time):
+    """Peak heap with mostly small samples and an occasional large one, for each payload pool policy."""
+    os.system("mkdir -p output")
+
+    policies = ["PREALLOCATED_WITH_REALLOC", "DYNAMIC_SIZE_CLASS"]
+    options = ["--time=" + time, "--seed=81", "-r", "reliable", "--size=1024", "--depth=100",
+            "--large_size=2097152", "--large_period=100"]
+
+    if certs_path:
+        options.extend(["--security=true", "--certs=" + certs_path])
+
+    peak_heap = {}
+    for policy in policies:
+        procs = []
+        for pubsub in ["publisher", "subscriber"]:
+            massif_file = "./output/consumption_" + pubsub + "_" + policy + ".out"
+            valgrind_command = [valgrind, "--tool=massif", "--stacks=yes", "--detailed-freq=1", "--max-snapshots=1000",
+                    "--massif-out-file=" + massif_file]
+            procs.append(subprocess.Popen(valgrind_command +
+                    [command, pubsub, "--memory_policy=" + policy] +
+                    options))
+
+        for proc in procs:
+            proc.communicate()
+
+        for pubsub in ["publisher", "subscriber"]:
+            csv_path = "./output/MemoryTest_" + pubsub + "_" + policy + ".csv"
+            subprocess.call(["python3", "./memory_analysis.py",
+                    "./output/consumption_" + pubsub + "_" + policy + ".out", csv_path])
+            peak_heap[(pubsub, policy)] = read_peak_heap(csv_path)
+
+    with open("./output/MemoryTest_payload_policies.csv", 'w+') as csv_file:
+        csv_writer = csv.writer(csv_file, delimiter=',', quoting=csv.QUOTE_ALL)
+        csv_writer.writerow(['entity'] + policies + ['saving'])
+        for pubsub in ["publisher", "subscriber"]:
+            reference = peak_heap[(pubsub, policies[0])]
+            size_class = peak_heap[(pubsub, policies[1])]
+            saving = 100.0 * (reference - size_class) / reference if reference else 0.0
+            csv_writer.writerow([pubsub, reference, size_class, "{:.1f}%".format(saving)])
+            print("Peak heap of the " + pubsub + ": " + str(reference) + " bytes with " + policies[0] + ", " +
+                    str(size_class) + " bytes with " + policies[1] + " ({:.1f}% saved)".format(saving))
+
 transport = ""
 
 if len(sys.argv) >= 5:
@@ -79,5 +126,8 @@ for command in binaries:
         tpub.start()
         tsub = threading.Thread(target=start_test, args=(command, "subscriber", test_time, transport))
         tsub.start()
+        tpub.join()
+        tsub.join()
+        compare_payload_policies(command, test_time)
 
 quit()
@@ -14,6 +14,10 @@
 
 #include <thread>
 
+#ifdef __linux__
+#include <poll.h>
+#endif // ifdef __linux__
+
 #include <gtest/gtest.h>
 
 #include <fastdds/core/condition/StatusConditionImpl.hpp>
@@ -372,6 +376,58 @@ TEST_F(ConditionTests, status_condition_trigger)
     wait_for_trigger();
 }
 
+#ifdef __linux__
+TEST_F(ConditionTests, native_handle)
+{
+    auto is_readable = [](int handle)
+            {
+                pollfd fds{handle, POLLIN, 0};
+                return 1 == poll(&fds, 1, 0) && 0 != (fds.revents & POLLIN);
+            };
+
+    WaitSet wait_set;
+    ConditionSeq conditions;
+    GuardCondition cond;
+
+    // Condition handle
+    int cond_handle = cond.get_native_handle();
+    ASSERT_LE(0, cond_handle);
+    EXPECT_EQ(cond_handle, cond.get_native_handle());
+    EXPECT_FALSE(is_readable(cond_handle));
+    EXPECT_EQ(RETCODE_OK, cond.set_trigger_value(true));
+    EXPECT_TRUE(is_readable(cond_handle));
+
+    // WaitSet handle is readable right away when an attached condition is already triggered
+    EXPECT_EQ(RETCODE_OK, wait_set.attach_condition(cond));
+    int wait_set_handle = wait_set.get_native_handle();
+    ASSERT_LE(0, wait_set_handle);
+    EXPECT_TRUE(is_readable(wait_set_handle));
+
+    // Handle keeps signaled while the condition is active, even after waiting on the WaitSet
+    EXPECT_EQ(RETCODE_OK, wait_set.wait(conditions, eprosima::fastrtps::Duration_t(0, 0)));
+    ASSERT_EQ(1u, conditions.size());
+    EXPECT_EQ(&cond, conditions[0]);
+    EXPECT_TRUE(is_readable(wait_set_handle));
+    EXPECT_TRUE(is_readable(wait_set_handle));
+    EXPECT_EQ(RETCODE_OK, wait_set.wait(conditions, eprosima::fastrtps::Duration_t(0, 0)));
+    EXPECT_EQ(1u, conditions.size());
+    EXPECT_TRUE(is_readable(wait_set_handle));
+
+    // Waiting once the condition is no longer active consumes the signal
+    EXPECT_EQ(RETCODE_OK, cond.set_trigger_value(false));
+    EXPECT_TRUE(is_readable(wait_set_handle));
+    EXPECT_EQ(RETCODE_TIMEOUT, wait_set.wait(conditions, eprosima::fastrtps::Duration_t(0, 0)));
+    EXPECT_FALSE(is_readable(wait_set_handle));
+
+    // Triggering the condition signals the WaitSet handle
+    EXPECT_EQ(RETCODE_OK, cond.set_trigger_value(true));
+    pollfd fds{wait_set_handle, POLLIN, 0};
+    EXPECT_EQ(1, poll(&fds, 1, 1000));
+    EXPECT_EQ(RETCODE_OK, wait_set.wait(conditions, eprosima::fastrtps::Duration_t(0, 0)));
+    EXPECT_EQ(1u, conditions.size());
+}
+#endif // ifdef __linux__
+
 int main(
         int argc,
         char** argv)
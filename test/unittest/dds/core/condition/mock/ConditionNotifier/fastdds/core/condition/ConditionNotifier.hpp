@@ -51,6 +51,13 @@ struct ConditionNotifier
      */
     MOCK_METHOD0(notify, void());
 
+    /**
+     * Get the native handle signalled each time notify() is called.
+     * @param is_triggered Whether the condition is currently triggered.
+     * @return The native handle, or -1 if not supported on this platform.
+     */
+    MOCK_METHOD1(get_native_handle, int(bool is_triggered));
+
     /**
      * Inform all the WaitSet implementations attached to this notifier that
      * a condition is going to be deleted.
@@ -2984,6 +2984,166 @@ TEST(ParticipantTests, ContainsEntity)
     ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), RETCODE_OK);
 }
 
+/*
+ * This test checks the get_memory_usage() DomainParticipant member function.
+ * 1. Check that a disabled participant returns RETCODE_NOT_ENABLED.
+ * 2. Check that each enabled DataWriter and DataReader is reported with its GUID and the memory of its pools.
+ * 3. Check that the transport buffers are reported.
+ * 4. Check that the proxies of the matched endpoints are reported.
+ */
+TEST(ParticipantTests, GetMemoryUsage)
+{
+    DomainParticipantFactoryQos factory_qos;
+    DomainParticipantFactory::get_instance()->get_qos(factory_qos);
+    factory_qos.entity_factory().autoenable_created_entities = false;
+    DomainParticipantFactory::get_instance()->set_qos(factory_qos);
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(
+        (uint32_t)GET_PID() % 230, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    factory_qos.entity_factory().autoenable_created_entities = true;
+    DomainParticipantFactory::get_instance()->set_qos(factory_qos);
+
+    eprosima::fastdds::rtps::ParticipantMemoryUsage usage;
+    EXPECT_EQ(participant->get_memory_usage(usage), RETCODE_NOT_ENABLED);
+    ASSERT_EQ(participant->enable(), RETCODE_OK);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+    DataWriter* data_writer = publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+    ASSERT_NE(data_writer, nullptr);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+    DataReader* data_reader = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT);
+    ASSERT_NE(data_reader, nullptr);
+
+    ASSERT_EQ(participant->get_memory_usage(usage), RETCODE_OK);
+    ASSERT_EQ(usage.writers.size(), 1u);
+    ASSERT_EQ(usage.readers.size(), 1u);
+    EXPECT_EQ(usage.writers[0].guid, data_writer->guid());
+    EXPECT_EQ(usage.readers[0].guid, data_reader->guid());
+    EXPECT_GT(usage.writers[0].change_pool.reserved_bytes, 0u);
+    EXPECT_GT(usage.writers[0].payload_pool.reserved_bytes, 0u);
+    EXPECT_GT(usage.readers[0].change_pool.reserved_bytes, 0u);
+    EXPECT_GE(usage.writers[0].total().reserved_bytes, usage.writers[0].total().live_bytes);
+    EXPECT_GE(usage.readers[0].total().reserved_bytes, usage.readers[0].total().live_bytes);
+    EXPECT_GT(usage.transport_buffers.reserved_bytes, 0u);
+
+    // The writer and the reader match each other
+    PublicationMatchedStatus pub_status;
+    SubscriptionMatchedStatus sub_status;
+    for (int i = 0; i < 100 && (0 == pub_status.current_count || 0 == sub_status.current_count); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        data_writer->get_publication_matched_status(pub_status);
+        data_reader->get_subscription_matched_status(sub_status);
+    }
+    ASSERT_EQ(pub_status.current_count, 1);
+    ASSERT_EQ(sub_status.current_count, 1);
+
+    ASSERT_EQ(participant->get_memory_usage(usage), RETCODE_OK);
+    EXPECT_GT(usage.writers[0].proxies.live_bytes, 0u);
+    EXPECT_GT(usage.readers[0].proxies.live_bytes, 0u);
+    EXPECT_GE(usage.writers[0].proxies.reserved_bytes, usage.writers[0].proxies.live_bytes);
+    EXPECT_GE(usage.readers[0].proxies.reserved_bytes, usage.readers[0].proxies.live_bytes);
+
+    ASSERT_EQ(participant->delete_contained_entities(), RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), RETCODE_OK);
+}
+
+/*
+ * This test checks the get_flow_controller_statistics() DomainParticipant member function.
+ * 1. Check that a disabled participant returns RETCODE_NOT_ENABLED.
+ * 2. Check that unknown flow controllers, and flow controllers not keeping counters, are rejected.
+ * 3. Check that the samples sent by a DataWriter using an earliest deadline first flow controller are counted.
+ */
+TEST(ParticipantTests, GetFlowControllerStatistics)
+{
+    DomainParticipantFactoryQos factory_qos;
+    DomainParticipantFactory::get_instance()->get_qos(factory_qos);
+    factory_qos.entity_factory().autoenable_created_entities = false;
+    DomainParticipantFactory::get_instance()->set_qos(factory_qos);
+
+    DomainParticipantQos participant_qos = PARTICIPANT_QOS_DEFAULT;
+    auto edf_controller = std::make_shared<eprosima::fastdds::rtps::FlowControllerDescriptor>();
+    edf_controller->name = "edf_controller";
+    edf_controller->scheduler = eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST;
+    participant_qos.flow_controllers().push_back(edf_controller);
+    auto fifo_controller = std::make_shared<eprosima::fastdds::rtps::FlowControllerDescriptor>();
+    fifo_controller->name = "fifo_controller";
+    participant_qos.flow_controllers().push_back(fifo_controller);
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(
+        (uint32_t)GET_PID() % 230, participant_qos);
+    ASSERT_NE(participant, nullptr);
+
+    factory_qos.entity_factory().autoenable_created_entities = true;
+    DomainParticipantFactory::get_instance()->set_qos(factory_qos);
+
+    eprosima::fastdds::rtps::FlowControllerStatistics statistics;
+    EXPECT_EQ(participant->get_flow_controller_statistics("edf_controller", statistics), RETCODE_NOT_ENABLED);
+    ASSERT_EQ(participant->enable(), RETCODE_OK);
+
+    EXPECT_EQ(participant->get_flow_controller_statistics("unknown_controller", statistics),
+            RETCODE_BAD_PARAMETER);
+    EXPECT_EQ(participant->get_flow_controller_statistics("fifo_controller", statistics), RETCODE_BAD_PARAMETER);
+    ASSERT_EQ(participant->get_flow_controller_statistics("edf_controller", statistics), RETCODE_OK);
+    EXPECT_EQ(statistics.samples_sent, 0u);
+    EXPECT_EQ(statistics.samples_dropped_before_send, 0u);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+    DataReader* data_reader = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT);
+    ASSERT_NE(data_reader, nullptr);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.publish_mode().kind = ASYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.publish_mode().flow_controller_name = "edf_controller";
+    writer_qos.deadline().period = Duration_t(10, 0);
+    DataWriter* data_writer = publisher->create_datawriter(topic, writer_qos);
+    ASSERT_NE(data_writer, nullptr);
+
+    PublicationMatchedStatus pub_status;
+    for (int i = 0; i < 100 && 0 == pub_status.current_count; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        data_writer->get_publication_matched_status(pub_status);
+    }
+    ASSERT_EQ(pub_status.current_count, 1);
+
+    BarType data;
+    data.index(1);
+    ASSERT_EQ(data_writer->write(&data, HANDLE_NIL), RETCODE_OK);
+    EXPECT_TRUE(data_reader->wait_for_unread_message(Duration_t(1, 0)));
+
+    for (int i = 0; i < 100 && 0 == statistics.samples_sent; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ASSERT_EQ(participant->get_flow_controller_statistics("edf_controller", statistics), RETCODE_OK);
+    }
+    EXPECT_EQ(statistics.samples_sent, 1u);
+    EXPECT_EQ(statistics.samples_dropped_before_send, 0u);
+    EXPECT_EQ(statistics.samples_with_deadline, 1u);
+    EXPECT_EQ(statistics.deadline_misses, 0u);
+    EXPECT_GT(statistics.min_deadline_slack_ns, 0);
+    EXPECT_EQ(statistics.total_deadline_slack_ns, statistics.min_deadline_slack_ns);
+
+    ASSERT_EQ(participant->delete_contained_entities(), RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), RETCODE_OK);
+}
+
 /*
  * This test checks the unregister_type() DomainParticipant member function.
  * 1. Check that an error is given at trying to unregister a type with an empty name.
@@ -3160,6 +3320,11 @@ TEST(ParticipantTests, UpdatableDomainParticipantQos)
     pqos.timed_events_thread().affinity = 1;
     ASSERT_EQ(participant->set_qos(pqos), RETCODE_IMMUTABLE_POLICY);
 
+    // Check that the timed_events_threads can not be changed in an enabled participant
+    participant->get_qos(pqos);
+    pqos.timed_events_threads(2);
+    ASSERT_EQ(participant->set_qos(pqos), RETCODE_IMMUTABLE_POLICY);
+
     // Check that the discovery_server_thread can not be changed in an enabled participant
     participant->get_qos(pqos);
     pqos.discovery_server_thread().affinity = 1;
@@ -3170,6 +3335,21 @@ TEST(ParticipantTests, UpdatableDomainParticipantQos)
     pqos.typelookup_service_thread().affinity = 1;
     ASSERT_EQ(participant->set_qos(pqos), RETCODE_IMMUTABLE_POLICY);
 
+    // Check that the persistence_thread can not be changed in an enabled participant
+    participant->get_qos(pqos);
+    pqos.persistence_thread().affinity = 1;
+    ASSERT_EQ(participant->set_qos(pqos), RETCODE_IMMUTABLE_POLICY);
+
+    // Check that the listener_executor_thread can not be changed in an enabled participant
+    participant->get_qos(pqos);
+    pqos.listener_executor_thread().affinity = 1;
+    ASSERT_EQ(participant->set_qos(pqos), RETCODE_IMMUTABLE_POLICY);
+
+    // Check that the listener_executor_threads can not be changed in an enabled participant
+    participant->get_qos(pqos);
+    pqos.listener_executor_threads(2);
+    ASSERT_EQ(participant->set_qos(pqos), RETCODE_IMMUTABLE_POLICY);
+
 #if HAVE_SECURITY
     // Check that the security_log_thread can not be changed in an enabled participant
     participant->get_qos(pqos);
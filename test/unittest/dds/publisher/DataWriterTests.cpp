@@ -834,6 +834,103 @@ TEST(DataWriterTests, WriteWithTimestamp)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == RETCODE_OK);
 }
 
+TEST(DataWriterTests, WriteMany)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    qos.history().depth = 10;
+    DataWriter* datawriter = publisher->create_datawriter(topic, qos);
+    ASSERT_NE(datawriter, nullptr);
+
+    FooType data[3];
+    data[0].message("Hello");
+    data[1].message("Batched");
+    data[2].message("World");
+
+    // 1. An empty batch writes nothing
+    EXPECT_EQ(RETCODE_OK, datawriter->write_many({}));
+    // 2. A nullptr sample rejects the whole batch
+    EXPECT_EQ(RETCODE_BAD_PARAMETER, datawriter->write_many({&data[0], nullptr, &data[2]}));
+    // 3. Correct case
+    std::vector<void*> samples{&data[0], &data[1], &data[2]};
+    EXPECT_EQ(RETCODE_OK, datawriter->write_many(samples));
+    size_t removed = 0;
+    EXPECT_EQ(RETCODE_OK, datawriter->clear_history(&removed));
+    EXPECT_EQ(samples.size(), removed);
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == RETCODE_OK);
+}
+
+/*
+ * This test checks that the timed events of the DataWriters keep working when they are distributed among several
+ * event threads with the timed_events_threads QoS.
+ */
+TEST(DataWriterTests, TimedEventThreads)
+{
+    DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
+    pqos.timed_events_threads(4);
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, pqos);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.deadline().period = Duration_t(0, 10000000);
+
+    std::vector<DataWriter*> datawriters;
+    for (int i = 0; i < 8; ++i)
+    {
+        DataWriter* datawriter = publisher->create_datawriter(topic, qos);
+        ASSERT_NE(datawriter, nullptr);
+        datawriters.push_back(datawriter);
+    }
+
+    FooType data;
+    data.message("HelloWorld");
+    for (DataWriter* datawriter : datawriters)
+    {
+        EXPECT_EQ(RETCODE_OK, datawriter->write(&data));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    for (DataWriter* datawriter : datawriters)
+    {
+        OfferedDeadlineMissedStatus status;
+        EXPECT_EQ(RETCODE_OK, datawriter->get_offered_deadline_missed_status(status));
+        EXPECT_LT(0, status.total_count);
+        ASSERT_EQ(RETCODE_OK, publisher->delete_datawriter(datawriter));
+    }
+
+    ASSERT_TRUE(participant->delete_topic(topic) == RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == RETCODE_OK);
+}
+
 void set_listener_test (
         DataWriter* writer,
         DataWriterListener* listener,
@@ -1607,6 +1704,11 @@ public:
         return &history_;
     }
 
+    bool uses_history_bypass() const
+    {
+        return use_history_bypass(fastrtps::rtps::ALIVE);
+    }
+
 };
 
 /**
@@ -1700,6 +1802,189 @@ TEST(DataWriterTests, InstanceWaitForAcknowledgement)
 }
 #endif // __QNXNTO__
 
+class FastPathTypeSupport : public TopicDataTypeMock
+{
+public:
+
+    bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* /*data*/,
+            fastrtps::rtps::SerializedPayload_t* payload,
+            DataRepresentationId_t /*data_representation*/) override
+    {
+        // Only the encapsulation is serialized
+        payload->data[0] = 0;
+        payload->data[1] = CDR_LE;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        payload->encapsulation = CDR_LE;
+        payload->length = 4u;
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* /*data*/,
+            DataRepresentationId_t /*data_representation*/) override
+    {
+        return []()->uint32_t
+               {
+                   return 4u;
+               };
+    }
+
+};
+
+/**
+ * This test checks which DataWriters send their samples without going through the history, and that those
+ * samples are delivered
+ */
+TEST(DataWriterTests, HistoryBypass)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+
+    TypeSupport type(new FastPathTypeSupport());
+    type.register_type(participant);
+    TypeSupport instance_type(new InstanceTopicDataTypeMock());
+    instance_type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+    Topic* instance_topic = participant->create_topic("instancefootopic", instance_type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    ASSERT_NE(instance_topic, nullptr);
+
+    DataWriterQos bypass_qos = DATAWRITER_QOS_DEFAULT;
+    bypass_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    bypass_qos.durability().kind = VOLATILE_DURABILITY_QOS;
+    bypass_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    bypass_qos.history().depth = 1;
+    bypass_qos.data_sharing().off();
+
+    auto uses_history_bypass = [publisher](
+        Topic* writer_topic,
+        const DataWriterQos& qos)
+            {
+                DataWriter* datawriter = publisher->create_datawriter(writer_topic, qos);
+                EXPECT_NE(nullptr, datawriter);
+                if (nullptr == datawriter)
+                {
+                    return false;
+                }
+
+                DataWriterImplTest* impl =
+                        static_cast<DataWriterImplTest*>(static_cast<DataWriterTest*>(datawriter)->get_impl());
+                bool ret = impl->uses_history_bypass();
+                EXPECT_EQ(RETCODE_OK, publisher->delete_datawriter(datawriter));
+                return ret;
+            };
+
+    // 1. Selection of the history bypass
+    EXPECT_TRUE(uses_history_bypass(topic, bypass_qos));
+    EXPECT_FALSE(uses_history_bypass(instance_topic, bypass_qos));
+
+    DataWriterQos qos = bypass_qos;
+    qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    EXPECT_FALSE(uses_history_bypass(topic, qos));
+
+    qos = bypass_qos;
+    qos.durability().kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+    EXPECT_FALSE(uses_history_bypass(topic, qos));
+
+    qos = bypass_qos;
+    qos.history().depth = 2;
+    EXPECT_FALSE(uses_history_bypass(topic, qos));
+
+    qos = bypass_qos;
+    qos.publish_mode().kind = ASYNCHRONOUS_PUBLISH_MODE;
+    EXPECT_FALSE(uses_history_bypass(topic, qos));
+
+    qos = bypass_qos;
+    qos.deadline().period = Duration_t(10, 0);
+    EXPECT_FALSE(uses_history_bypass(topic, qos));
+
+    qos = bypass_qos;
+    qos.lifespan().duration = Duration_t(10, 0);
+    EXPECT_FALSE(uses_history_bypass(topic, qos));
+
+    // 2. Delivery of the samples sent through the history bypass
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    reader_qos.history().depth = 10;
+    DataReader* datareader = subscriber->create_datareader(topic, reader_qos);
+    ASSERT_NE(nullptr, datareader);
+
+    DataWriter* datawriter = publisher->create_datawriter(topic, bypass_qos);
+    ASSERT_NE(nullptr, datawriter);
+    DataWriterImplTest* impl = static_cast<DataWriterImplTest*>(static_cast<DataWriterTest*>(datawriter)->get_impl());
+    ASSERT_TRUE(impl->uses_history_bypass());
+
+    // Write until the reader is matched
+    FooType data;
+    for (uint32_t i = 0; i < 50 && 0u == datareader->get_unread_count(); ++i)
+    {
+        ASSERT_EQ(RETCODE_OK, datawriter->write(&data, HANDLE_NIL));
+        datareader->wait_for_unread_message(Duration_t(0, 100000000));
+    }
+    ASSERT_LT(0u, datareader->get_unread_count());
+
+    FooType sample;
+    SampleInfo info;
+    while (RETCODE_OK == datareader->take_next_sample(&sample, &info))
+    {
+    }
+
+    // Samples are not kept on the history, and keep consecutive sequence numbers
+    EXPECT_EQ(0u, impl->get_history()->getHistorySize());
+    constexpr uint32_t num_samples = 5;
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        ASSERT_EQ(RETCODE_OK, datawriter->write(&data, HANDLE_NIL));
+        EXPECT_EQ(0u, impl->get_history()->getHistorySize());
+    }
+
+    SequenceNumber_t last_sequence_number;
+    uint32_t received = 0;
+    for (uint32_t i = 0; i < 10 && received < num_samples; ++i)
+    {
+        datareader->wait_for_unread_message(Duration_t(0, 100000000));
+        while (RETCODE_OK == datareader->take_next_sample(&sample, &info))
+        {
+            ASSERT_TRUE(info.valid_data);
+            if (0u < received)
+            {
+                EXPECT_EQ(last_sequence_number + 1, info.sample_identity.sequence_number());
+            }
+            last_sequence_number = info.sample_identity.sequence_number();
+            ++received;
+        }
+    }
+    EXPECT_EQ(num_samples, received);
+
+    ASSERT_EQ(RETCODE_OK, participant->delete_contained_entities());
+    ASSERT_EQ(RETCODE_OK, DomainParticipantFactory::get_instance()->delete_participant(participant));
+}
+
 class DataWriterUnsupportedTests : public ::testing::Test
 {
 public:
@@ -15,10 +15,12 @@
 #include <array>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <forward_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <thread>
 #include <type_traits>
@@ -1678,6 +1680,83 @@ TEST_F(DataReaderTests, get_unread_count)
     EXPECT_EQ(0, data_reader_->get_unread_count());
 }
 
+/*
+ * This test checks take_columns():
+ * 1. Wrong parameters are rejected.
+ * 2. Samples are deserialized into the caller's array, and only the requested SampleInfo columns are filled.
+ * 3. Samples are removed from the history, and max_samples is honored.
+ */
+TEST_F(DataReaderTests, take_columns)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr int32_t num_samples = 10;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = num_samples;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.resource_limits().max_instances = 1;
+    reader_qos.resource_limits().max_samples_per_instance = num_samples;
+    reader_qos.resource_limits().max_samples = num_samples;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(0);
+    data.message()[1] = '\0';
+
+    for (char i = 0; i < num_samples; ++i)
+    {
+        data.message()[0] = i + '0';
+        EXPECT_EQ(RETCODE_OK, data_writer_->write(&data, handle_ok_));
+    }
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    std::array<FooType, num_samples> values;
+    std::array<eprosima::fastrtps::rtps::Time_t, num_samples> timestamps;
+    std::array<bool, num_samples> valid;
+    SampleInfoColumns columns;
+    columns.source_timestamp = timestamps.data();
+    columns.valid_data = valid.data();
+    int32_t taken = -1;
+
+    EXPECT_EQ(RETCODE_BAD_PARAMETER, data_reader_->take_columns(values.data(), columns, 0, taken));
+    EXPECT_EQ(0, taken);
+    EXPECT_EQ(RETCODE_BAD_PARAMETER, data_reader_->take_columns(static_cast<void*>(values.data()), 0, columns,
+            num_samples, taken));
+
+    // Take only a part of the samples
+    ASSERT_EQ(RETCODE_OK, data_reader_->take_columns(values.data(), columns, 4, taken));
+    ASSERT_EQ(4, taken);
+    for (int32_t i = 0; i < taken; ++i)
+    {
+        EXPECT_TRUE(valid[i]);
+        EXPECT_EQ(static_cast<char>(i + '0'), values[i].message()[0]);
+        EXPECT_NE(eprosima::fastrtps::rtps::Time_t(), timestamps[i]);
+    }
+    EXPECT_EQ(static_cast<uint64_t>(num_samples - 4), data_reader_->get_unread_count());
+
+    // Take the rest, only requesting the information
+    std::array<InstanceHandle_t, num_samples> handles;
+    columns = SampleInfoColumns();
+    columns.instance_handle = handles.data();
+    ASSERT_EQ(RETCODE_OK, data_reader_->take_columns(nullptr, 0, columns, num_samples, taken));
+    ASSERT_EQ(num_samples - 4, taken);
+    for (int32_t i = 0; i < taken; ++i)
+    {
+        EXPECT_EQ(handle_ok_, handles[i]);
+    }
+
+    EXPECT_EQ(RETCODE_NO_DATA, data_reader_->take_columns(values.data(), columns, num_samples, taken));
+    EXPECT_EQ(0, taken);
+}
+
 template<typename DataType>
 void lookup_instance_test(
         DataType& data,
@@ -2453,6 +2532,177 @@ TEST_F(DataReaderTests, SetListener)
     }
 }
 
+/*
+ * This test checks that on_data_available is called from the listener executor when the participant configures it
+ */
+TEST_F(DataReaderTests, listener_executor)
+{
+    class ThreadListener : public DataReaderListener
+    {
+    public:
+
+        void on_data_available(
+                DataReader* reader) override
+        {
+            FooType data;
+            SampleInfo info;
+            while (RETCODE_OK == reader->take_next_sample(&data, &info))
+            {
+            }
+
+            std::lock_guard<std::mutex> guard(mutex);
+            thread_id = std::this_thread::get_id();
+            ++calls;
+            cv.notify_all();
+        }
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::thread::id thread_id;
+        uint32_t calls = 0;
+    };
+
+    DomainParticipantQos participant_qos = PARTICIPANT_QOS_DEFAULT;
+    participant_qos.listener_executor_threads(2);
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, participant_qos);
+    ASSERT_NE(participant, nullptr);
+
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new FooTypeSupport());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    ThreadListener listener;
+    DataReader* data_reader = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT, &listener);
+    ASSERT_NE(data_reader, nullptr);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.reliability().kind = eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS;
+    DataWriter* data_writer = publisher->create_datawriter(topic, writer_qos);
+    ASSERT_NE(data_writer, nullptr);
+
+    FooType data;
+    data.index(0);
+    data.message()[0] = '\0';
+
+    // Write until the reader is matched and the callback is received
+    bool received = false;
+    for (uint32_t i = 0; i < 50 && !received; ++i)
+    {
+        EXPECT_EQ(RETCODE_OK, data_writer->write(&data, HANDLE_NIL));
+
+        std::unique_lock<std::mutex> lock(listener.mutex);
+        received = listener.cv.wait_for(lock, std::chrono::milliseconds(100), [&listener]()
+                        {
+                            return 0 < listener.calls;
+                        });
+    }
+    ASSERT_TRUE(received);
+
+    {
+        std::lock_guard<std::mutex> guard(listener.mutex);
+        EXPECT_NE(std::this_thread::get_id(), listener.thread_id);
+    }
+
+    ListenerExecutorMetrics metrics;
+    EXPECT_EQ(RETCODE_OK, participant->get_listener_executor_metrics(metrics));
+    EXPECT_LE(1u, metrics.max_queue_depth);
+
+    ASSERT_EQ(RETCODE_OK, participant->delete_contained_entities());
+    ASSERT_EQ(RETCODE_OK, DomainParticipantFactory::get_instance()->delete_participant(participant));
+
+    // Participants without the property have no executor
+    participant = DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+    EXPECT_EQ(RETCODE_NOT_ENABLED, participant->get_listener_executor_metrics(metrics));
+    ASSERT_EQ(RETCODE_OK, DomainParticipantFactory::get_instance()->delete_participant(participant));
+}
+
+/*
+ * This test checks that a DataReader can be deleted from its own listener when the listener executor is used
+ */
+TEST_F(DataReaderTests, listener_executor_delete_from_callback)
+{
+    class DeletingListener : public DataReaderListener
+    {
+    public:
+
+        void on_data_available(
+                DataReader* reader) override
+        {
+            ReturnCode_t ret = subscriber->delete_datareader(reader);
+
+            std::lock_guard<std::mutex> guard(mutex);
+            deleted = RETCODE_OK == ret;
+            cv.notify_all();
+        }
+
+        Subscriber* subscriber = nullptr;
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool deleted = false;
+    };
+
+    DomainParticipantQos participant_qos = PARTICIPANT_QOS_DEFAULT;
+    participant_qos.listener_executor_threads(1);
+    participant_qos.listener_executor_thread().stack_size = 1024 * 1024;
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, participant_qos);
+    ASSERT_NE(participant, nullptr);
+
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new FooTypeSupport());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DeletingListener listener;
+    listener.subscriber = subscriber;
+    DataReader* data_reader = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT, &listener);
+    ASSERT_NE(data_reader, nullptr);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.reliability().kind = eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS;
+    DataWriter* data_writer = publisher->create_datawriter(topic, writer_qos);
+    ASSERT_NE(data_writer, nullptr);
+
+    FooType data;
+    data.index(0);
+    data.message()[0] = '\0';
+
+    // Write until the reader is matched and deletes itself from the callback
+    bool deleted = false;
+    for (uint32_t i = 0; i < 50 && !deleted; ++i)
+    {
+        EXPECT_EQ(RETCODE_OK, data_writer->write(&data, HANDLE_NIL));
+
+        std::unique_lock<std::mutex> lock(listener.mutex);
+        deleted = listener.cv.wait_for(lock, std::chrono::milliseconds(100), [&listener]()
+                        {
+                            return listener.deleted;
+                        });
+    }
+    ASSERT_TRUE(deleted);
+    EXPECT_FALSE(subscriber->has_datareaders());
+
+    ASSERT_EQ(RETCODE_OK, participant->delete_contained_entities());
+    ASSERT_EQ(RETCODE_OK, DomainParticipantFactory::get_instance()->delete_participant(participant));
+}
+
 TEST_F(DataReaderTests, get_listening_locators)
 {
     // Prepare specific listening locators
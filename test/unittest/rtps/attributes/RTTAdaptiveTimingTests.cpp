@@ -0,0 +1,89 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/attributes/RTTAdaptiveTiming.hpp>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace std::chrono;
+
+/*!
+ * @fn TEST(RTTAdaptiveTimingTests, DefaultBoundsNeverShorten)
+ * @brief This test checks that, by default, the adapted timings are never shorter than the static one.
+ */
+TEST(RTTAdaptiveTimingTests, DefaultBoundsNeverShorten)
+{
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.rtt_adaptive_timing", "true");
+
+    RTTAdaptiveTiming timing = RTTAdaptiveTiming::from_properties(properties, 100, 5);
+    ASSERT_TRUE(timing.enabled);
+    EXPECT_EQ(100, timing.min_ms);
+    EXPECT_EQ(1000, timing.max_ms);
+
+    // A low round-trip time keeps the static timing
+    EXPECT_EQ(100, timing.bound(microseconds(200)));
+    // A high round-trip time slows down the timing, up to the upper bound
+    EXPECT_EQ(400, timing.bound(milliseconds(400)));
+    EXPECT_EQ(1000, timing.bound(seconds(5)));
+}
+
+/*!
+ * @fn TEST(RTTAdaptiveTimingTests, ConfiguredBounds)
+ * @brief This test checks that a lower bound can be configured to shorten the timings on fast networks.
+ */
+TEST(RTTAdaptiveTimingTests, ConfiguredBounds)
+{
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.rtt_adaptive_timing", "true");
+    properties.properties().emplace_back("fastdds.rtt_adaptive_timing.min_ms", "10");
+    properties.properties().emplace_back("fastdds.rtt_adaptive_timing.max_ms", "200");
+
+    RTTAdaptiveTiming timing = RTTAdaptiveTiming::from_properties(properties, 100, 5);
+    ASSERT_TRUE(timing.enabled);
+    EXPECT_EQ(10, timing.bound(microseconds(200)));
+    EXPECT_EQ(40, timing.bound(milliseconds(40)));
+    EXPECT_EQ(200, timing.bound(seconds(5)));
+
+    // A lower bound greater than the upper one disables the adaptive mode
+    properties.properties().clear();
+    properties.properties().emplace_back("fastdds.rtt_adaptive_timing", "true");
+    properties.properties().emplace_back("fastdds.rtt_adaptive_timing.min_ms", "300");
+    properties.properties().emplace_back("fastdds.rtt_adaptive_timing.max_ms", "200");
+    EXPECT_FALSE(RTTAdaptiveTiming::from_properties(properties, 100, 5).enabled);
+}
+
+/*!
+ * @fn TEST(RTTAdaptiveTimingTests, Disabled)
+ * @brief This test checks that the adaptive mode is disabled by default.
+ */
+TEST(RTTAdaptiveTimingTests, Disabled)
+{
+    PropertyPolicy properties;
+    EXPECT_FALSE(RTTAdaptiveTiming::from_properties(properties, 100, 5).enabled);
+
+    properties.properties().emplace_back("fastdds.rtt_adaptive_timing", "false");
+    EXPECT_FALSE(RTTAdaptiveTiming::from_properties(properties, 100, 5).enabled);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
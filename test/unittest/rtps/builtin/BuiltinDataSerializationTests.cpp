@@ -693,6 +693,27 @@ TEST(BuiltinDataSerializationTests, other_vendor_parameter_list_with_custom_pids
         CacheChange_t change;
         update_cache_change(change, data_buffer, buffer_length, 0);
     }
+
+    // PID_COMPACT_ANNOUNCEMENTS_SUPPORT
+    {
+        octet data_buffer[] =
+        {
+            // Encapsulation
+            0x00, 0x03, 0x00, 0x00,
+            // PID_COMPACT_ANNOUNCEMENTS_SUPPORT
+            0x0b, 0x80, 4, 0,
+            1, 0, 0, 0,
+            // PID_SENTINEL
+            0x01, 0, 0, 0
+        };
+
+        uint32_t buffer_length = static_cast<uint32_t>(sizeof(data_buffer));
+
+        // ParticipantProxyData check
+        ParticipantProxyData participant_pdata(RTPSParticipantAllocationAttributes{});
+        participant_read(data_buffer, buffer_length, participant_pdata);
+        ASSERT_FALSE(participant_pdata.compact_announcements());
+    }
 }
 
 // Check interoperability of compatible custom PIDs when vendor ID is RTI Connext
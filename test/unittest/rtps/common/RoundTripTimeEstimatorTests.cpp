@@ -0,0 +1,119 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/RoundTripTimeEstimator.hpp>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace std::chrono;
+
+/*!
+ * @fn TEST(RoundTripTimeEstimator, FirstSample)
+ * @brief This test checks the estimation is initialized with the first sample.
+ */
+TEST(RoundTripTimeEstimator, FirstSample)
+{
+    RoundTripTimeEstimator estimator;
+    EXPECT_FALSE(estimator.has_estimation());
+
+    auto now = steady_clock::now();
+    estimator.request_sent(now);
+    EXPECT_TRUE(estimator.is_pending());
+    EXPECT_TRUE(estimator.response_received(now + milliseconds(40)));
+    EXPECT_FALSE(estimator.is_pending());
+
+    ASSERT_TRUE(estimator.has_estimation());
+    EXPECT_EQ(milliseconds(40), estimator.srtt());
+    EXPECT_EQ(milliseconds(20), estimator.rttvar());
+    EXPECT_EQ(milliseconds(120), estimator.retransmission_timeout());
+}
+
+/*!
+ * @fn TEST(RoundTripTimeEstimator, Smoothing)
+ * @brief This test checks the smoothing of consecutive samples.
+ */
+TEST(RoundTripTimeEstimator, Smoothing)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.add_sample(milliseconds(80));
+    estimator.add_sample(milliseconds(160));
+
+    // rttvar = 3/4 * 40 + 1/4 * |80 - 160|, srtt = 7/8 * 80 + 1/8 * 160
+    EXPECT_EQ(milliseconds(50), estimator.rttvar());
+    EXPECT_EQ(milliseconds(90), estimator.srtt());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        estimator.add_sample(milliseconds(10));
+    }
+    EXPECT_LT(estimator.srtt(), milliseconds(11));
+    EXPECT_LT(estimator.rttvar(), milliseconds(1));
+}
+
+/*!
+ * @fn TEST(RoundTripTimeEstimator, AmbiguousResponse)
+ * @brief This test checks no sample is taken when the response cannot be associated to a single request.
+ */
+TEST(RoundTripTimeEstimator, AmbiguousResponse)
+{
+    RoundTripTimeEstimator estimator;
+    auto now = steady_clock::now();
+
+    // Response without request.
+    EXPECT_FALSE(estimator.response_received(now));
+
+    estimator.request_sent(now);
+    estimator.request_sent(now + milliseconds(10));
+    EXPECT_FALSE(estimator.response_received(now + milliseconds(20)));
+    EXPECT_FALSE(estimator.has_estimation());
+
+    estimator.request_sent(now + milliseconds(30));
+    EXPECT_TRUE(estimator.response_received(now + milliseconds(35)));
+    EXPECT_EQ(milliseconds(5), estimator.srtt());
+
+    estimator.reset();
+    EXPECT_FALSE(estimator.has_estimation());
+    EXPECT_FALSE(estimator.is_pending());
+}
+
+/*!
+ * @fn TEST(RoundTripTimeEstimator, ResponseDelay)
+ * @brief This test checks the time the remote endpoint waits before responding is not part of the samples.
+ */
+TEST(RoundTripTimeEstimator, ResponseDelay)
+{
+    RoundTripTimeEstimator estimator;
+    auto now = steady_clock::now();
+
+    estimator.request_sent(now);
+    EXPECT_TRUE(estimator.response_received(now + milliseconds(45), milliseconds(5)));
+    EXPECT_EQ(milliseconds(40), estimator.srtt());
+
+    // A response faster than the expected delay gives an empty sample.
+    estimator.reset();
+    estimator.request_sent(now);
+    EXPECT_TRUE(estimator.response_received(now + milliseconds(3), milliseconds(5)));
+    EXPECT_EQ(nanoseconds::zero(), estimator.srtt());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,185 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/common/SampleBatch.hpp>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::rtps::detail;
+
+static void fill_sample(
+        SerializedPayload_t& sample,
+        uint32_t length,
+        octet value)
+{
+    sample.reserve(length);
+    sample.length = length;
+    sample.data[0] = 0x00;
+    sample.data[1] = 0x01; // CDR_LE
+    for (uint32_t i = 2; i < length; ++i)
+    {
+        sample.data[i] = value;
+    }
+}
+
+/*!
+ * @fn TEST(SampleBatch, RoundTrip)
+ * @brief This test checks the samples added to a batch are read back with their metadata.
+ */
+TEST(SampleBatch, RoundTrip)
+{
+    SampleBatchBuilder builder;
+    EXPECT_TRUE(builder.empty());
+    EXPECT_EQ(SampleBatch::header_size, builder.size());
+
+    InstanceHandle_t handle;
+    handle.value[0] = 0xAB;
+    handle.value[15] = 0xCD;
+
+    SerializedPayload_t first;
+    fill_sample(first, 10, 0x11);
+    SerializedPayload_t second;
+    fill_sample(second, 64, 0x22);
+
+    EXPECT_EQ(SampleBatch::header_size + SampleBatch::entry_size(10), builder.size_with(10));
+    builder.add(first, handle, Time_t(10, 20u));
+    builder.add(second, InstanceHandle_t(), Time_t(30, 40u));
+    EXPECT_EQ(2u, builder.count());
+    EXPECT_EQ(SampleBatch::header_size + SampleBatch::entry_size(10) + SampleBatch::entry_size(64), builder.size());
+
+    SerializedPayload_t batch(builder.size());
+    builder.copy_to(batch);
+    ASSERT_TRUE(SampleBatch::is_batch(batch));
+    EXPECT_EQ(2u, SampleBatch::sample_count(batch));
+
+    SampleBatchReader reader(batch);
+    SerializedPayload_t sample;
+    InstanceHandle_t sample_handle;
+    Time_t timestamp;
+
+    ASSERT_TRUE(reader.next(sample, sample_handle, timestamp));
+    EXPECT_FALSE(SampleBatch::is_batch(sample));
+    EXPECT_EQ(10u, sample.length);
+    EXPECT_EQ(CDR_LE, sample.encapsulation);
+    EXPECT_EQ(0, memcmp(first.data, sample.data, 10));
+    EXPECT_EQ(handle, sample_handle);
+    EXPECT_EQ(Time_t(10, 20u), timestamp);
+
+    sample_handle.clear();
+    ASSERT_TRUE(reader.next(sample, sample_handle, timestamp));
+    EXPECT_EQ(64u, sample.length);
+    EXPECT_EQ(0, memcmp(second.data, sample.data, 64));
+    EXPECT_FALSE(sample_handle.isDefined());
+    EXPECT_EQ(Time_t(30, 40u), timestamp);
+
+    EXPECT_FALSE(reader.next(sample, sample_handle, timestamp));
+    sample.data = nullptr;
+
+    builder.clear();
+    EXPECT_TRUE(builder.empty());
+    EXPECT_EQ(SampleBatch::header_size, builder.size());
+}
+
+/*!
+ * @fn TEST(SampleBatch, SequenceNumberSpan)
+ * @brief This test checks a batch change covers one sequence number per sample, and a regular change only one.
+ */
+TEST(SampleBatch, SequenceNumberSpan)
+{
+    CacheChange_t change;
+    fill_sample(change.serializedPayload, 16, 0x33);
+    EXPECT_FALSE(SampleBatch::is_batch(change.serializedPayload));
+    EXPECT_EQ(1u, SampleBatch::sequence_number_span(change));
+
+    SampleBatchBuilder builder;
+    SerializedPayload_t sample;
+    fill_sample(sample, 4, 0x44);
+    for (int i = 0; i < 5; ++i)
+    {
+        builder.add(sample, InstanceHandle_t(), Time_t());
+    }
+
+    CacheChange_t batch_change(builder.size());
+    builder.copy_to(batch_change.serializedPayload);
+    EXPECT_EQ(5u, SampleBatch::sequence_number_span(batch_change));
+}
+
+/*!
+ * @fn TEST(SampleBatch, Truncated)
+ * @brief This test checks a truncated batch does not read out of its bounds.
+ */
+TEST(SampleBatch, Truncated)
+{
+    SampleBatchBuilder builder;
+    SerializedPayload_t sample;
+    fill_sample(sample, 32, 0x55);
+    builder.add(sample, InstanceHandle_t(), Time_t());
+    builder.add(sample, InstanceHandle_t(), Time_t());
+
+    SerializedPayload_t batch(builder.size());
+    builder.copy_to(batch);
+    batch.length -= 8;
+
+    SampleBatchReader reader(batch);
+    SerializedPayload_t read_sample;
+    InstanceHandle_t handle;
+    Time_t timestamp;
+    EXPECT_TRUE(reader.next(read_sample, handle, timestamp));
+    EXPECT_FALSE(reader.next(read_sample, handle, timestamp));
+    read_sample.data = nullptr;
+}
+
+/*!
+ * @fn TEST(SampleBatch, SampleStartingLikeABatch)
+ * @brief This test checks a sample starting like a batch is read back as is from the batch carrying it.
+ */
+TEST(SampleBatch, SampleStartingLikeABatch)
+{
+    SampleBatchBuilder inner_builder;
+    SerializedPayload_t inner_sample;
+    fill_sample(inner_sample, 8, 0x66);
+    inner_builder.add(inner_sample, InstanceHandle_t(), Time_t());
+    inner_builder.add(inner_sample, InstanceHandle_t(), Time_t());
+
+    SerializedPayload_t escaped(inner_builder.size());
+    inner_builder.copy_to(escaped);
+    ASSERT_TRUE(SampleBatch::is_batch(escaped));
+
+    SampleBatchBuilder builder;
+    builder.add(escaped, InstanceHandle_t(), Time_t(1, 2u));
+    SerializedPayload_t batch(builder.size());
+    builder.copy_to(batch);
+    EXPECT_EQ(1u, SampleBatch::sample_count(batch));
+
+    SampleBatchReader reader(batch);
+    SerializedPayload_t sample;
+    InstanceHandle_t handle;
+    Time_t timestamp;
+    ASSERT_TRUE(reader.next(sample, handle, timestamp));
+    EXPECT_TRUE(SampleBatch::is_batch(sample));
+    EXPECT_EQ(escaped.length, sample.length);
+    EXPECT_EQ(0, memcmp(escaped.data, sample.data, escaped.length));
+    EXPECT_EQ(Time_t(1, 2u), timestamp);
+    EXPECT_FALSE(reader.next(sample, handle, timestamp));
+    sample.data = nullptr;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -266,6 +266,31 @@ TEST_F(EdpTests, CheckPartitionCompatibility)
     check_expectations(true);
 }
 
+TEST_F(EdpTests, CheckCachedPartitionCompatibility)
+{
+    // Results of previous checks should not be reused for a different combination of partitions
+    wdata->m_qos.m_partition.push_back("Partition1");
+    wdata->m_qos.m_partition.push_back("Partition2");
+    rdata->m_qos.m_partition.push_back("Partition2");
+    check_expectations(true);
+    check_expectations(true);
+
+    rdata->m_qos.m_partition.clear();
+    rdata->m_qos.m_partition.push_back("Partition1Partition2");
+    check_expectations(false);
+
+    rdata->m_qos.m_partition.clear();
+    rdata->m_qos.m_partition.push_back("Partition1");
+    rdata->m_qos.m_partition.push_back("Partition2");
+    wdata->m_qos.m_partition.clear();
+    wdata->m_qos.m_partition.push_back("Partition1Partition2");
+    check_expectations(false);
+
+    wdata->m_qos.m_partition.clear();
+    wdata->m_qos.m_partition.push_back("Partition2");
+    check_expectations(true);
+}
+
 TEST_F(EdpTests, CheckDurabilityCompatibility)
 {
     std::vector<QosTestingCase<fastdds::dds::DurabilityQosPolicyKind>> testing_cases{
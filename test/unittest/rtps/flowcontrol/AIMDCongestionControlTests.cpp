@@ -0,0 +1,175 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <limits>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <rtps/flowcontrol/AIMDCongestionControl.hpp>
+
+using namespace eprosima::fastdds::rtps;
+using namespace eprosima::fastrtps::rtps;
+
+static GUID_t reader_guid(
+        uint8_t id)
+{
+    GUID_t guid;
+    guid.guidPrefix.value[0] = id;
+    guid.entityId = c_EntityId_Unknown;
+    guid.entityId.value[3] = 0x07;
+    return guid;
+}
+
+TEST(AIMDCongestionControl, additive_increase_multiplicative_decrease)
+{
+    FlowControllerCongestionControl config;
+    config.enabled = true;
+    config.initial_window = 10000;
+    config.min_window = 1000;
+    config.max_window = 12000;
+    config.additive_increase = 1000;
+    config.multiplicative_decrease = 0.5;
+    AIMDCongestionControl cc(config, 100000);
+    GUID_t reader = reader_guid(1);
+
+    EXPECT_EQ(10000u, cc.window(reader));
+    // The window only grows while it is being used.
+    EXPECT_TRUE(cc.try_reserve(reader, 10000));
+    cc.on_feedback(reader, 0);
+    EXPECT_EQ(11000u, cc.window(reader));
+    cc.on_feedback(reader, 0);
+    cc.on_feedback(reader, 0);
+    EXPECT_EQ(12000u, cc.window(reader));
+
+    cc.on_feedback(reader, 3);
+    EXPECT_EQ(6000u, cc.window(reader));
+
+    // Only one decrease per period.
+    cc.on_feedback(reader, 3);
+    EXPECT_EQ(6000u, cc.window(reader));
+
+    cc.remove(reader);
+    EXPECT_EQ(10000u, cc.window(reader));
+}
+
+TEST(AIMDCongestionControl, idle_window_does_not_grow)
+{
+    FlowControllerCongestionControl config;
+    config.enabled = true;
+    config.initial_window = 10000;
+    config.additive_increase = 1000;
+    AIMDCongestionControl cc(config, 100000);
+    GUID_t reader = reader_guid(1);
+
+    // ACKNACKs answering heartbeats while nothing is sent.
+    for (int i = 0; i < 100; ++i)
+    {
+        cc.on_feedback(reader, 0);
+    }
+    EXPECT_EQ(10000u, cc.window(reader));
+
+    // A small usage does not make the window grow either.
+    EXPECT_TRUE(cc.try_reserve(reader, 1000));
+    cc.on_feedback(reader, 0);
+    EXPECT_EQ(10000u, cc.window(reader));
+
+    EXPECT_TRUE(cc.try_reserve(reader, 4000));
+    cc.on_feedback(reader, 0);
+    EXPECT_EQ(11000u, cc.window(reader));
+}
+
+TEST(AIMDCongestionControl, unbounded_window_saturates)
+{
+    FlowControllerCongestionControl config;
+    config.enabled = true;
+    config.initial_window = (std::numeric_limits<uint32_t>::max)() - 1000;
+    config.max_window = 0;
+    config.additive_increase = 1500;
+    AIMDCongestionControl cc(config, 100000);
+    GUID_t reader = reader_guid(1);
+
+    EXPECT_TRUE(cc.try_reserve(reader, (std::numeric_limits<uint32_t>::max)()));
+    cc.on_feedback(reader, 0);
+    EXPECT_EQ((std::numeric_limits<uint32_t>::max)(), cc.window(reader));
+    cc.on_feedback(reader, 0);
+    EXPECT_EQ((std::numeric_limits<uint32_t>::max)(), cc.window(reader));
+
+    // Reservations do not wrap around either.
+    EXPECT_FALSE(cc.try_reserve(reader, 1));
+}
+
+TEST(AIMDCongestionControl, windows_are_per_destination)
+{
+    FlowControllerCongestionControl config;
+    config.enabled = true;
+    config.initial_window = 3000;
+    AIMDCongestionControl cc(config, 100000);
+    GUID_t congested = reader_guid(1);
+    GUID_t healthy = reader_guid(2);
+
+    // First reservation is always accepted, even if bigger than the window.
+    EXPECT_TRUE(cc.try_reserve(congested, 4000));
+    EXPECT_FALSE(cc.try_reserve(congested, 1));
+
+    EXPECT_TRUE(cc.try_reserve(healthy, 1000));
+    EXPECT_TRUE(cc.try_reserve(healthy, 2000));
+    EXPECT_FALSE(cc.try_reserve(healthy, 1));
+}
+
+TEST(AIMDCongestionControl, windows_refilled_each_period)
+{
+    FlowControllerCongestionControl config;
+    config.enabled = true;
+    config.initial_window = 1000;
+    AIMDCongestionControl cc(config, 10);
+    GUID_t reader = reader_guid(1);
+
+    EXPECT_TRUE(cc.try_reserve(reader, 1000));
+    EXPECT_FALSE(cc.try_reserve(reader, 1000));
+
+    std::this_thread::sleep_until(cc.next_period());
+    EXPECT_TRUE(cc.try_reserve(reader, 1000));
+}
+
+TEST(AIMDCongestionControl, refunded_bytes_can_be_reserved_again)
+{
+    FlowControllerCongestionControl config;
+    config.enabled = true;
+    config.initial_window = 3000;
+    AIMDCongestionControl cc(config, 100000);
+    GUID_t reader = reader_guid(1);
+
+    EXPECT_TRUE(cc.try_reserve(reader, 2000));
+    EXPECT_FALSE(cc.try_reserve(reader, 2000));
+
+    // Bytes not finally sent are given back to the window.
+    cc.refund(reader, 2000);
+    EXPECT_TRUE(cc.try_reserve(reader, 3000));
+    EXPECT_FALSE(cc.try_reserve(reader, 1));
+
+    // Refunds never leave the window with more bytes than it had.
+    cc.refund(reader, 5000);
+    cc.refund(reader_guid(2), 1000);
+    EXPECT_TRUE(cc.try_reserve(reader, 3000));
+    EXPECT_FALSE(cc.try_reserve(reader, 1));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
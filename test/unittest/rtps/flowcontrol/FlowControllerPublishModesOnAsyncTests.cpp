@@ -14,10 +14,15 @@
 
 #include "FlowControllerPublishModesTests.hpp"
 
+#include <future>
+#include <map>
+#include <set>
 #include <thread>
 
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
 
+#include <rtps/flowcontrol/FlowControllerPool.hpp>
+
 using namespace eprosima::fastdds::rtps;
 using namespace testing;
 
@@ -421,3 +426,285 @@ TYPED_TEST(FlowControllerPublishModes, async_publish_mode)
 
     async.unregister_writer(&writer1);
 }
+
+TYPED_TEST(FlowControllerPublishModes, async_pool_publish_mode)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.num_sender_threads = 2;
+    FlowControllerPool<FlowControllerAsyncPublishMode, TypeParam> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{});
+    async.init();
+    ASSERT_EQ(2u, async.num_lanes());
+
+    // Instantiate writers. Their entity keys make them be served by different lanes.
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+    writer1.m_guid.entityId.value[2] = 0;
+    eprosima::fastrtps::rtps::RTPSWriter writer2;
+    writer2.m_guid.entityId.value[2] = 1;
+
+    // The first sample of writer1 is not delivered until a sample of writer2 was delivered, which is only possible
+    // if they are sent by different threads.
+    std::promise<void> writer2_delivered;
+    std::future<void> writer2_delivered_future = writer2_delivered.get_future();
+    bool writer2_first = true;
+    std::map<const eprosima::fastrtps::rtps::RTPSWriter*, std::set<std::thread::id>> delivering_threads;
+
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender& selector,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                const eprosima::fastrtps::rtps::RTPSWriter* writer =
+                        &selector == &writer1.async_locator_selector_ ? &writer1 : &writer2;
+                if (&writer1 == writer && 1 == change->sequenceNumber.low)
+                {
+                    EXPECT_EQ(std::future_status::ready, writer2_delivered_future.wait_for(std::chrono::seconds(10)));
+                }
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                    delivering_threads[writer].insert(std::this_thread::get_id());
+                    if (&writer2 == writer && writer2_first)
+                    {
+                        writer2_first = false;
+                        writer2_delivered.set_value();
+                    }
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+
+    eprosima::fastrtps::rtps::CacheChange_t changes_writer1[5];
+    eprosima::fastrtps::rtps::CacheChange_t changes_writer2[5];
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        INIT_CACHE_CHANGE(changes_writer1[i], writer1, i + 1);
+        INIT_CACHE_CHANGE(changes_writer2[i], writer2, i + 1);
+    }
+
+    EXPECT_CALL(writer1, deliver_sample_nts(_, _, Ref(writer1.async_locator_selector_), _)).Times(5).
+            WillRepeatedly(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer2, deliver_sample_nts(_, _, Ref(writer2.async_locator_selector_), _)).Times(5).
+            WillRepeatedly(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+
+    writer1.getMutex().lock();
+    for (auto& change : changes_writer1)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer1, &change,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer1.getMutex().unlock();
+    writer2.getMutex().lock();
+    for (auto& change : changes_writer2)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer2, &change,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer2.getMutex().unlock();
+    this->wait_changes_was_delivered(10);
+
+    // Each writer is served by a single thread, different for each writer, and keeps the order of its samples.
+    ASSERT_EQ(1u, delivering_threads[&writer1].size());
+    ASSERT_EQ(1u, delivering_threads[&writer2].size());
+    EXPECT_NE(*delivering_threads[&writer1].begin(), *delivering_threads[&writer2].begin());
+    EXPECT_NE(std::this_thread::get_id(), *delivering_threads[&writer1].begin());
+    uint32_t next_writer1 = 1;
+    uint32_t next_writer2 = 1;
+    for (auto change : this->changes_delivered)
+    {
+        if (change->writerGUID == writer1.getGuid())
+        {
+            EXPECT_EQ(next_writer1++, change->sequenceNumber.low);
+        }
+        else
+        {
+            EXPECT_EQ(next_writer2++, change->sequenceNumber.low);
+        }
+    }
+    this->changes_delivered.clear();
+
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+}
+
+TYPED_TEST(FlowControllerPublishModes, async_pool_wakes_up_lanes_over_destination_rate_limit)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.num_sender_threads = 2;
+    flow_controller_descr.destination_rate_limit.bytes_per_second = 100000;
+    flow_controller_descr.destination_rate_limit.burst_bytes = 1000;
+    FlowControllerPool<FlowControllerAsyncPublishMode, TypeParam> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{});
+    async.init();
+
+    // Both writers, served by different lanes, send to the same remote participant, whose bucket only holds one
+    // sample. Each lane has to be woken up when the bucket can accept the sample refused to it.
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+    writer1.m_guid.entityId.value[2] = 0;
+    eprosima::fastrtps::rtps::RTPSWriter writer2;
+    writer2.m_guid.entityId.value[2] = 1;
+    eprosima::fastrtps::rtps::GuidPrefix_t destination;
+    destination.value[0] = 1;
+
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::RTPSWriter* writer,
+        eprosima::fastrtps::rtps::CacheChange_t* change)
+            {
+                if (!async.try_reserve_participant_bytes(writer, destination, 1000))
+                {
+                    return eprosima::fastrtps::rtps::DeliveryRetCode::EXCEEDED_DESTINATION_LIMIT;
+                }
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+                return eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED;
+            };
+
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+
+    eprosima::fastrtps::rtps::CacheChange_t changes_writer1[3];
+    eprosima::fastrtps::rtps::CacheChange_t changes_writer2[3];
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        INIT_CACHE_CHANGE(changes_writer1[i], writer1, i + 1);
+        INIT_CACHE_CHANGE(changes_writer2[i], writer2, i + 1);
+    }
+
+    EXPECT_CALL(writer1, deliver_sample_nts(_, _, Ref(writer1.async_locator_selector_), _)).
+            WillRepeatedly(WithArg<0>([&](eprosima::fastrtps::rtps::CacheChange_t* change)
+            {
+                return send_functor(&writer1, change);
+            }));
+    EXPECT_CALL(writer2, deliver_sample_nts(_, _, Ref(writer2.async_locator_selector_), _)).
+            WillRepeatedly(WithArg<0>([&](eprosima::fastrtps::rtps::CacheChange_t* change)
+            {
+                return send_functor(&writer2, change);
+            }));
+
+    writer1.getMutex().lock();
+    for (auto& change : changes_writer1)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer1, &change,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer1.getMutex().unlock();
+    writer2.getMutex().lock();
+    for (auto& change : changes_writer2)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer2, &change,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer2.getMutex().unlock();
+
+    {
+        std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+        EXPECT_TRUE(this->number_changes_delivered_cv.wait_for(lock, std::chrono::seconds(10), [&]()
+                {
+                    return 6u == this->changes_delivered.size();
+                }));
+    }
+
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+    this->changes_delivered.clear();
+}
+
+TYPED_TEST(FlowControllerPublishModes, async_publish_mode_parks_writers_over_destination_limits)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.period_ms = 10;
+    flow_controller_descr.congestion_control.enabled = true;
+    FlowControllerImpl<FlowControllerAsyncPublishMode, TypeParam> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{});
+    async.init();
+
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+    eprosima::fastrtps::rtps::RTPSWriter writer2;
+
+    // The destinations of writer1 refuse its first sample until the samples of writer2 are queued.
+    std::promise<void> writer2_queued;
+    std::shared_future<void> writer2_queued_future = writer2_queued.get_future().share();
+
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+    auto saturated_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t*,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                EXPECT_EQ(std::future_status::ready, writer2_queued_future.wait_for(std::chrono::seconds(10)));
+            };
+
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+
+    eprosima::fastrtps::rtps::CacheChange_t changes_writer1[3];
+    eprosima::fastrtps::rtps::CacheChange_t changes_writer2[3];
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        INIT_CACHE_CHANGE(changes_writer1[i], writer1, i + 1);
+        INIT_CACHE_CHANGE(changes_writer2[i], writer2, i + 1);
+    }
+
+    auto& saturated_call = EXPECT_CALL(writer1,
+                    deliver_sample_nts(&changes_writer1[0], _, Ref(writer1.async_locator_selector_), _)).
+                    WillOnce(DoAll(saturated_functor,
+                    Return(eprosima::fastrtps::rtps::DeliveryRetCode::EXCEEDED_DESTINATION_LIMIT)));
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&changes_writer1[0], _, Ref(writer1.async_locator_selector_), _)).
+            After(saturated_call).
+            WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    for (uint32_t i = 1; i < 3; ++i)
+    {
+        EXPECT_CALL(writer1,
+                deliver_sample_nts(&changes_writer1[i], _, Ref(writer1.async_locator_selector_), _)).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    }
+    EXPECT_CALL(writer2, deliver_sample_nts(_, _, Ref(writer2.async_locator_selector_), _)).Times(3).
+            WillRepeatedly(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+
+    writer1.getMutex().lock();
+    for (auto& change : changes_writer1)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer1, &change,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer1.getMutex().unlock();
+    writer2.getMutex().lock();
+    for (auto& change : changes_writer2)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer2, &change,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer2.getMutex().unlock();
+    writer2_queued.set_value();
+    this->wait_changes_was_delivered(6);
+
+    // writer2 was not held back by writer1, which kept the order of its samples.
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(&changes_writer2[i], this->changes_delivered[i]);
+        EXPECT_EQ(&changes_writer1[i], this->changes_delivered[3 + i]);
+    }
+    this->changes_delivered.clear();
+
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+}
@@ -2561,6 +2561,238 @@ TEST_F(FlowControllerSchedulers, PriorityWithReservation)
     async.unregister_writer(&writer10);
 }
 
+TEST_F(FlowControllerSchedulers, EarliestDeadlineFirst)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 10200;
+    flow_controller_descr.period_ms = 10;
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock, FlowControllerEarliestDeadlineFirstSchedule> async(
+        nullptr, &flow_controller_descr, 0, ThreadSettings{});
+    async.init();
+
+    // Instantiate writers.
+    eprosima::fastrtps::rtps::Property property;
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+    eprosima::fastrtps::rtps::RTPSWriter writer2;
+    property.name("fastdds.sfc.deadline_ns");
+    property.value("1000000000");
+    writer2.m_att.endpoint.properties.properties().push_back(property);
+    eprosima::fastrtps::rtps::RTPSWriter writer3;
+    property.value("100000000");
+    writer3.m_att.endpoint.properties.properties().push_back(property);
+    eprosima::fastrtps::rtps::RTPSWriter writer4;
+    property.name("fastdds.sfc.lifespan_ns");
+    property.value("500000000");
+    writer4.m_att.endpoint.properties.properties().push_back(property);
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->current_bytes_processed += change->serializedPayload.length;
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+    async.register_writer(&writer3);
+    async.register_writer(&writer4);
+
+    eprosima::fastrtps::rtps::Time_t now;
+    eprosima::fastrtps::rtps::Time_t::now(now);
+    eprosima::fastrtps::rtps::Time_t expired;
+    expired.from_ns(now.to_ns() - 10000000000);
+
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_2;
+    INIT_CACHE_CHANGE(change_writer1_1, writer1, 1);
+    INIT_CACHE_CHANGE(change_writer1_2, writer1, 2);
+    change_writer1_1.sourceTimestamp = now;
+    change_writer1_2.sourceTimestamp = now;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_2;
+    INIT_CACHE_CHANGE(change_writer2_1, writer2, 1);
+    INIT_CACHE_CHANGE(change_writer2_2, writer2, 2);
+    change_writer2_1.sourceTimestamp = now;
+    change_writer2_2.sourceTimestamp = now;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer3_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer3_2;
+    INIT_CACHE_CHANGE(change_writer3_1, writer3, 1);
+    INIT_CACHE_CHANGE(change_writer3_2, writer3, 2);
+    change_writer3_1.sourceTimestamp = now;
+    change_writer3_2.sourceTimestamp = now;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer4_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer4_2;
+    INIT_CACHE_CHANGE(change_writer4_1, writer4, 1);
+    INIT_CACHE_CHANGE(change_writer4_2, writer4, 2);
+    change_writer4_1.sourceTimestamp = expired;
+    change_writer4_2.sourceTimestamp = now;
+
+    {
+        this->current_bytes_processed = 10100;
+        this->allow_resetting = false;
+        EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+                get_current_bytes_processed()).WillRepeatedly(
+            ReturnPointee(&this->current_bytes_processed));
+        EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+                reset_current_bytes_processed()).WillRepeatedly([&]()
+                {
+                    if (this->allow_resetting)
+                    {
+                        this->current_bytes_processed = 0;
+                    }
+                });
+        // Lifespan of change_writer4_1 has expired, so it is never delivered.
+        auto& call_change_writer3_1 = EXPECT_CALL(writer3,
+                        deliver_sample_nts(&change_writer3_1, _, Ref(writer3.async_locator_selector_), _)).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer3_2 = EXPECT_CALL(writer3,
+                        deliver_sample_nts(&change_writer3_2, _, Ref(writer3.async_locator_selector_), _)).
+                        After(call_change_writer3_1).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer4_2 = EXPECT_CALL(writer4,
+                        deliver_sample_nts(&change_writer4_2, _, Ref(writer4.async_locator_selector_), _)).
+                        After(call_change_writer3_2).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer2_1 = EXPECT_CALL(writer2,
+                        deliver_sample_nts(&change_writer2_1, _, Ref(writer2.async_locator_selector_), _)).
+                        After(call_change_writer4_2).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer2_2 = EXPECT_CALL(writer2,
+                        deliver_sample_nts(&change_writer2_2, _, Ref(writer2.async_locator_selector_), _)).
+                        After(call_change_writer2_1).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer1_1 = EXPECT_CALL(writer1,
+                        deliver_sample_nts(&change_writer1_1, _, Ref(writer1.async_locator_selector_), _)).
+                        After(call_change_writer2_2).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        EXPECT_CALL(writer1,
+                deliver_sample_nts(&change_writer1_2, _, Ref(writer1.async_locator_selector_), _)).
+                After(call_change_writer1_1).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        writer1.getMutex().lock();
+        ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_1,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_2,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        writer1.getMutex().unlock();
+        writer2.getMutex().lock();
+        ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_1,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_2,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        writer2.getMutex().unlock();
+        writer3.getMutex().lock();
+        ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_1,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_2,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        writer3.getMutex().unlock();
+        writer4.getMutex().lock();
+        ASSERT_TRUE(async.add_new_sample(&writer4, &change_writer4_1,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        ASSERT_TRUE(async.add_new_sample(&writer4, &change_writer4_2,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        writer4.getMutex().unlock();
+        this->allow_resetting = true;
+        this->wait_changes_was_delivered(7);
+        this->changes_delivered.clear();
+        this->current_bytes_processed = 0;
+    }
+
+    EXPECT_FALSE(change_writer4_1.writer_info.is_linked.load());
+
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+    async.unregister_writer(&writer3);
+    async.unregister_writer(&writer4);
+}
+
+TEST_F(FlowControllerSchedulers, EarliestDeadlineFirstStatistics)
+{
+    FlowControllerEarliestDeadlineFirstSchedule sched;
+
+    // Removes the change from the queue, as the flow controller does before delivering it.
+    auto unlink = [](
+        eprosima::fastrtps::rtps::CacheChange_t* change)
+            {
+                change->writer_info.previous->writer_info.next = change->writer_info.next;
+                change->writer_info.next->writer_info.previous = change->writer_info.previous;
+                change->writer_info.previous = nullptr;
+                change->writer_info.next = nullptr;
+                change->writer_info.is_linked.store(false);
+            };
+
+    eprosima::fastrtps::rtps::Property property;
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+    property.name("fastdds.sfc.deadline_ns");
+    property.value("100000000");
+    writer1.m_att.endpoint.properties.properties().push_back(property);
+    eprosima::fastrtps::rtps::RTPSWriter writer2;
+    property.name("fastdds.sfc.lifespan_ns");
+    property.value("1000000000");
+    writer2.m_att.endpoint.properties.properties().push_back(property);
+    sched.register_writer(&writer1);
+    sched.register_writer(&writer2);
+
+    eprosima::fastrtps::rtps::Time_t now;
+    eprosima::fastrtps::rtps::Time_t::now(now);
+    eprosima::fastrtps::rtps::Time_t past;
+    past.from_ns(now.to_ns() - 10000000000);
+
+    // Deadline of change_writer1_1 has already passed.
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_2;
+    INIT_CACHE_CHANGE(change_writer1_1, writer1, 1);
+    INIT_CACHE_CHANGE(change_writer1_2, writer1, 2);
+    change_writer1_1.sourceTimestamp = past;
+    change_writer1_2.sourceTimestamp = now;
+    // Lifespan of change_writer2_1 has already expired.
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_2;
+    INIT_CACHE_CHANGE(change_writer2_1, writer2, 1);
+    INIT_CACHE_CHANGE(change_writer2_2, writer2, 2);
+    change_writer2_1.sourceTimestamp = past;
+    change_writer2_2.sourceTimestamp = now;
+
+    sched.add_new_sample(&writer1, &change_writer1_1);
+    sched.add_new_sample(&writer1, &change_writer1_2);
+    sched.add_new_sample(&writer2, &change_writer2_1);
+    sched.add_new_sample(&writer2, &change_writer2_2);
+    sched.add_interested_changes_to_queue_nts();
+
+    std::vector<eprosima::fastrtps::rtps::CacheChange_t*> expected_order = {
+        &change_writer1_1, &change_writer1_2, &change_writer2_2
+    };
+    for (eprosima::fastrtps::rtps::CacheChange_t* expected_change : expected_order)
+    {
+        eprosima::fastrtps::rtps::CacheChange_t* change = sched.get_next_change_nts();
+        ASSERT_EQ(expected_change, change);
+        unlink(change);
+        sched.work_done();
+    }
+    EXPECT_EQ(nullptr, sched.get_next_change_nts());
+
+    const FlowControllerStatistics& statistics = sched.get_statistics();
+    EXPECT_EQ(3u, statistics.samples_sent);
+    EXPECT_EQ(1u, statistics.samples_dropped_before_send);
+    EXPECT_EQ(1u, statistics.deadline_misses);
+    EXPECT_EQ(3u, statistics.samples_with_deadline);
+    EXPECT_GT(0, statistics.min_deadline_slack_ns);
+    EXPECT_FALSE(change_writer2_1.writer_info.is_linked.load());
+
+    sched.unregister_writer(&writer1);
+    sched.unregister_writer(&writer2);
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,154 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <rtps/flowcontrol/TokenBucketRateLimiter.hpp>
+
+using namespace eprosima::fastdds::rtps;
+using namespace eprosima::fastrtps::rtps;
+
+static GuidPrefix_t participant_prefix(
+        uint8_t id)
+{
+    GuidPrefix_t prefix;
+    prefix.value[0] = id;
+    return prefix;
+}
+
+TEST(TokenBucketRateLimiter, disabled_by_default)
+{
+    FlowControllerDestinationRateLimit config;
+    TokenBucketRateLimiter limiter(config);
+    EXPECT_FALSE(limiter.enabled());
+}
+
+TEST(TokenBucketRateLimiter, burst_then_sustained_rate)
+{
+    FlowControllerDestinationRateLimit config;
+    config.bytes_per_second = 1000;
+    config.burst_bytes = 3000;
+    TokenBucketRateLimiter limiter(config);
+    TokenBucketRateLimiter::Waiter waiter;
+    GuidPrefix_t participant = participant_prefix(1);
+
+    // A new destination can send a whole burst.
+    EXPECT_TRUE(limiter.try_consume(participant, 1000, waiter));
+    EXPECT_TRUE(limiter.try_consume(participant, 2000, waiter));
+    EXPECT_FALSE(limiter.try_consume(participant, 1000, waiter));
+
+    // The bucket is refilled at the sustained rate. Refusing 1000 bytes needs about one second.
+    auto available = limiter.next_available(waiter);
+    EXPECT_LT(std::chrono::steady_clock::now() + std::chrono::milliseconds(500), available);
+    EXPECT_GE(std::chrono::steady_clock::now() + std::chrono::milliseconds(1000), available);
+    EXPECT_EQ(std::chrono::steady_clock::time_point::max(), limiter.next_available(waiter));
+}
+
+TEST(TokenBucketRateLimiter, buckets_are_per_destination)
+{
+    FlowControllerDestinationRateLimit config;
+    config.bytes_per_second = 1000;
+    config.burst_bytes = 3000;
+    TokenBucketRateLimiter limiter(config);
+    TokenBucketRateLimiter::Waiter waiter;
+    GuidPrefix_t saturated = participant_prefix(1);
+    GuidPrefix_t idle = participant_prefix(2);
+
+    // A full bucket accepts samples bigger than its capacity, and then stays in debt.
+    EXPECT_TRUE(limiter.try_consume(saturated, 4000, waiter));
+    EXPECT_FALSE(limiter.try_consume(saturated, 1, waiter));
+    EXPECT_GT(0.0, limiter.tokens(saturated));
+
+    EXPECT_TRUE(limiter.try_consume(idle, 1000, waiter));
+    EXPECT_TRUE(limiter.try_consume(idle, 2000, waiter));
+    EXPECT_FALSE(limiter.try_consume(idle, 1000, waiter));
+}
+
+TEST(TokenBucketRateLimiter, buckets_refilled_over_time)
+{
+    FlowControllerDestinationRateLimit config;
+    config.bytes_per_second = 100000;
+    config.burst_bytes = 1000;
+    TokenBucketRateLimiter limiter(config);
+    TokenBucketRateLimiter::Waiter waiter;
+    GuidPrefix_t participant = participant_prefix(1);
+
+    EXPECT_TRUE(limiter.try_consume(participant, 1000, waiter));
+    EXPECT_FALSE(limiter.try_consume(participant, 1000, waiter));
+
+    // Only full buckets are forgotten.
+    limiter.release(participant);
+    EXPECT_GT(1000.0, limiter.tokens(participant));
+
+    std::this_thread::sleep_until(limiter.next_available(waiter));
+    EXPECT_TRUE(limiter.try_consume(participant, 1000, waiter));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_DOUBLE_EQ(1000.0, limiter.tokens(participant));
+    limiter.release(participant);
+    EXPECT_DOUBLE_EQ(1000.0, limiter.tokens(participant));
+}
+
+TEST(TokenBucketRateLimiter, refunded_bytes_can_be_consumed_again)
+{
+    FlowControllerDestinationRateLimit config;
+    config.bytes_per_second = 1;
+    config.burst_bytes = 3000;
+    TokenBucketRateLimiter limiter(config);
+    TokenBucketRateLimiter::Waiter waiter;
+    GuidPrefix_t participant = participant_prefix(1);
+
+    EXPECT_TRUE(limiter.try_consume(participant, 2000, waiter));
+    EXPECT_FALSE(limiter.try_consume(participant, 2000, waiter));
+
+    // Bytes not finally sent are given back to the bucket.
+    limiter.refund(participant, 2000);
+    EXPECT_TRUE(limiter.try_consume(participant, 3000, waiter));
+    EXPECT_FALSE(limiter.try_consume(participant, 1000, waiter));
+
+    // Refunds never fill a bucket over its capacity.
+    limiter.refund(participant, 5000);
+    limiter.refund(participant_prefix(2), 1000);
+    EXPECT_DOUBLE_EQ(3000.0, limiter.tokens(participant));
+    EXPECT_DOUBLE_EQ(3000.0, limiter.tokens(participant_prefix(2)));
+}
+
+TEST(TokenBucketRateLimiter, wake_up_time_per_waiter)
+{
+    FlowControllerDestinationRateLimit config;
+    config.bytes_per_second = 1000;
+    config.burst_bytes = 1000;
+    TokenBucketRateLimiter limiter(config);
+    TokenBucketRateLimiter::Waiter refused;
+    TokenBucketRateLimiter::Waiter other;
+    GuidPrefix_t participant = participant_prefix(1);
+
+    EXPECT_TRUE(limiter.try_consume(participant, 1000, other));
+    EXPECT_FALSE(limiter.try_consume(participant, 1000, refused));
+
+    // Only the waiter whose bytes were refused is woken up, and taking its time does not affect the others.
+    EXPECT_EQ(std::chrono::steady_clock::time_point::max(), limiter.next_available(other));
+    EXPECT_NE(std::chrono::steady_clock::time_point::max(), limiter.next_available(refused));
+    EXPECT_EQ(std::chrono::steady_clock::time_point::max(), limiter.next_available(refused));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -133,6 +133,7 @@ TEST_P(BasicPoolsTest, reserve_cache)
                 ASSERT_EQ(ch->serializedPayload.max_size, data_size);
                 break;
             case MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE:
+            case MemoryManagementPolicy::DYNAMIC_SIZE_CLASS_MEMORY_MODE:
                 ASSERT_EQ(ch->serializedPayload.max_size, data_size);
                 break;
         }
@@ -221,7 +222,8 @@ GTEST_INSTANTIATE_TEST_MACRO(
     Values(MemoryManagementPolicy::PREALLOCATED_MEMORY_MODE,
     MemoryManagementPolicy::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
     MemoryManagementPolicy::DYNAMIC_RESERVE_MEMORY_MODE,
-    MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE))
+    MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE,
+    MemoryManagementPolicy::DYNAMIC_SIZE_CLASS_MEMORY_MODE))
     );
 
 int main(
@@ -240,6 +240,53 @@ TEST_F(ReaderHistoryTests, change_order)
     }
 }
 
+TEST_F(ReaderHistoryTests, remove_changes_out_of_order)
+{
+    constexpr uint32_t n_writers = 4;
+    constexpr uint32_t changes_per_writer = 5;
+    std::vector<CacheChange_t*> changes;
+
+    // Changes from different writers share source timestamps
+    for (uint32_t i = 1; i <= n_writers; i++)
+    {
+        GUID_t writer_guid = GUID_t(GuidPrefix_t::unknown(), i);
+
+        for (uint32_t j = 1; j <= changes_per_writer; j++)
+        {
+            CacheChange_t* ch = new CacheChange_t(0);
+            ch->writerGUID = writer_guid;
+            ch->sequenceNumber = SequenceNumber_t(0, j);
+            ch->sourceTimestamp = rtps::Time_t(0, j % 2);
+
+            changes.push_back(ch);
+        }
+    }
+
+    int total_changes = static_cast<int>(changes.size());
+    EXPECT_CALL(*readerMock, change_removed_by_history(_)).Times(total_changes).WillRepeatedly(Return(true));
+    EXPECT_CALL(*readerMock, releaseCache(_)).Times(total_changes);
+
+    for (CacheChange_t* ch : changes)
+    {
+        history->add_change(ch);
+    }
+
+    auto rng = std::default_random_engine{};
+    std::shuffle(std::begin(changes), std::end(changes), rng);
+    for (size_t n = 0; n < changes.size(); ++n)
+    {
+        ASSERT_TRUE(history->remove_change(changes[n]));
+        ASSERT_EQ(history->getHistorySize(), changes.size() - n - 1);
+        ASSERT_EQ(history->changesEnd(), std::find(history->changesBegin(), history->changesEnd(), changes[n]));
+    }
+
+    // Clean-up
+    for (CacheChange_t* ch : changes)
+    {
+        delete ch;
+    }
+}
+
 TEST_F(ReaderHistoryTests, get_min_change_from_writer)
 {
     for (uint32_t i = 0; i < num_changes; i++)
@@ -57,3 +57,21 @@ TEST(TopicPayloadPoolRegistryTests, basic_checks)
     // Destructor should have been called a certain number of times
     EXPECT_EQ(detail::TopicPayloadPoolProxy::DestructorHelper::instance().get(), 2u);
 }
+
+TEST(TopicPayloadPoolRegistryTests, numa_node_pools)
+{
+    PoolConfig cfg{ PREALLOCATED_MEMORY_MODE, 4u, 4u, 4u };
+
+    // Same topic and policy on different NUMA nodes should result on different pools
+    auto pool_default = TopicPayloadPoolRegistry::get("topic_numa", cfg);
+    cfg.numa_node = 0;
+    auto pool_node_0 = TopicPayloadPoolRegistry::get("topic_numa", cfg);
+    cfg.numa_node = 1;
+    auto pool_node_1 = TopicPayloadPoolRegistry::get("topic_numa", cfg);
+    EXPECT_NE(pool_default, pool_node_0);
+    EXPECT_NE(pool_default, pool_node_1);
+    EXPECT_NE(pool_node_0, pool_node_1);
+
+    // Same node should result on same pool
+    EXPECT_EQ(pool_node_1, TopicPayloadPoolRegistry::get("topic_numa", cfg));
+}
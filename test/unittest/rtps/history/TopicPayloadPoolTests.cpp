@@ -14,8 +14,11 @@
 
 #include <gtest/gtest.h>
 
+#include <rtps/history/PoolNumaNode.hpp>
 #include <rtps/history/TopicPayloadPool.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <tuple>
 
 using namespace eprosima::fastrtps::rtps;
@@ -88,6 +91,7 @@ protected:
                 break;
             case MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE:
             case MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE:
+            case MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE:
                 expected_pool_size = 0;
                 break;
         }
@@ -114,6 +118,7 @@ protected:
             case MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE:
             case MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
             case MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE:
+            case MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE:
                 expected_pool_size = expected_max_pool_size;
                 if (expected_max_pool_size == 0)
                 {
@@ -171,6 +176,10 @@ protected:
                 case MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE:
                     ASSERT_GE(ch->serializedPayload.max_size, data_size);
                     break;
+                case MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE:
+                    ASSERT_GE(ch->serializedPayload.max_size, data_size);
+                    ASSERT_LT(ch->serializedPayload.max_size, 2 * data_size + 64u);
+                    break;
             }
         }
 
@@ -488,6 +497,172 @@ TEST(TopicPayloalPoolTests, dynamic_reusable_memory_zero_size)
     do_dynamic_topic_payload_pool_zero_size_test(config);
 }
 
+//! Claiming a payload with size 0 is properly handled with DYNAMIC_SIZE_CLASS Memory Modes
+TEST(TopicPayloalPoolTests, dynamic_size_class_memory_zero_size)
+{
+    PoolConfig config{ DYNAMIC_SIZE_CLASS_MEMORY_MODE, 128, 0, 1};
+    do_dynamic_topic_payload_pool_zero_size_test(config);
+}
+
+//! Payloads released by large samples are not used for small ones
+TEST(TopicPayloalPoolTests, dynamic_size_class_memory_reuse)
+{
+    PoolConfig config{ DYNAMIC_SIZE_CLASS_MEMORY_MODE, 128, 0, 4};
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+
+    CacheChange_t large;
+    ASSERT_TRUE(pool->get_payload(2 * 1024 * 1024, large));
+    EXPECT_EQ(large.serializedPayload.max_size, 2u * 1024u * 1024u);
+    octet* large_data = large.serializedPayload.data;
+    ASSERT_TRUE(pool->release_payload(large));
+
+    CacheChange_t small;
+    ASSERT_TRUE(pool->get_payload(100, small));
+    EXPECT_EQ(small.serializedPayload.max_size, 128u);
+    EXPECT_EQ(pool->payload_pool_allocated_size(), 2u);
+    ASSERT_TRUE(pool->release_payload(small));
+
+    // A sample on the same size class reuses the large payload
+    ASSERT_TRUE(pool->get_payload(1024 * 1024 + 1, large));
+    EXPECT_EQ(large.serializedPayload.data, large_data);
+    EXPECT_EQ(pool->payload_pool_allocated_size(), 2u);
+    ASSERT_TRUE(pool->release_payload(large));
+    EXPECT_EQ(pool->payload_pool_available_size(), 2u);
+
+    // When the pool is full, free payloads from other size classes are freed
+    std::vector<CacheChange_t> changes(4);
+    for (CacheChange_t& ch : changes)
+    {
+        ASSERT_TRUE(pool->get_payload(1000, ch));
+        EXPECT_EQ(ch.serializedPayload.max_size, 1024u);
+    }
+    EXPECT_EQ(pool->payload_pool_allocated_size(), 4u);
+    EXPECT_EQ(pool->payload_pool_available_size(), 0u);
+    for (CacheChange_t& ch : changes)
+    {
+        ASSERT_TRUE(pool->release_payload(ch));
+    }
+
+    ASSERT_TRUE(pool->release_history(config, false));
+    EXPECT_EQ(pool->payload_pool_allocated_size(), 0u);
+}
+
+//! Pools placing payloads on a NUMA node keep working when the node cannot be used
+TEST(TopicPayloalPoolTests, numa_node_payloads)
+{
+    PoolConfig config{ PREALLOCATED_WITH_REALLOC_MEMORY_MODE, 64 * 1024, 2, 0};
+    config.numa_node = 0;
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+    EXPECT_EQ(pool->payload_pool_allocated_size(), 2u);
+
+    // Payloads moved by realloc are placed on the node again
+    CacheChange_t change;
+    ASSERT_TRUE(pool->get_payload(1024 * 1024, change));
+    EXPECT_EQ(change.serializedPayload.max_size, 1024u * 1024u);
+    memset(change.serializedPayload.data, 0xAA, change.serializedPayload.max_size);
+    ASSERT_TRUE(pool->release_payload(change));
+
+    ASSERT_TRUE(pool->release_history(config, false));
+}
+
+//! Payloads placed on a NUMA node start on a page, so the whole payload can be bound
+TEST(TopicPayloalPoolTests, numa_node_payloads_alignment)
+{
+    size_t granularity = eprosima::get_numa_binding_granularity();
+    if (0 == granularity)
+    {
+        GTEST_SKIP() << "Binding memory to a NUMA node is not supported on this platform";
+    }
+
+    PoolConfig config{ PREALLOCATED_WITH_REALLOC_MEMORY_MODE, 128, 2, 0};
+    config.numa_node = 0;
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+
+    // Only the metadata of the payload precedes its data on the first page
+    CacheChange_t change;
+    ASSERT_TRUE(pool->get_payload(128, change));
+    EXPECT_GT(64u, reinterpret_cast<uintptr_t>(change.serializedPayload.data) & (granularity - 1));
+
+    // Also after being enlarged
+    CacheChange_t big_change;
+    ASSERT_TRUE(pool->get_payload(static_cast<uint32_t>(3 * granularity), big_change));
+    EXPECT_GT(64u, reinterpret_cast<uintptr_t>(big_change.serializedPayload.data) & (granularity - 1));
+    memset(big_change.serializedPayload.data, 0xAA, big_change.serializedPayload.max_size);
+
+    ASSERT_TRUE(pool->release_payload(change));
+    ASSERT_TRUE(pool->release_payload(big_change));
+    ASSERT_TRUE(pool->release_history(config, false));
+}
+
+//! The NUMA node property accepts a node number or the node of the consumer thread
+TEST(TopicPayloalPoolTests, pool_numa_node_property)
+{
+    eprosima::fastdds::rtps::ThreadSettings no_affinity;
+    PropertyPolicy properties;
+    EXPECT_EQ(-1, get_pool_numa_node(properties, no_affinity));
+
+    properties.properties().emplace_back(pool_numa_node_property, "3");
+    EXPECT_EQ(3, get_pool_numa_node(properties, no_affinity));
+
+    for (const char* wrong_value : {"", "abc", "-1", "64", "3x"})
+    {
+        properties.properties().back().value() = wrong_value;
+        EXPECT_EQ(-1, get_pool_numa_node(properties, no_affinity)) << "Value: '" << wrong_value << "'";
+    }
+
+    // Without affinity, the node of the calling thread is used
+    properties.properties().back().value() = "consumer";
+    EXPECT_EQ(eprosima::get_numa_node_of_current_thread(), get_pool_numa_node(properties, no_affinity));
+
+    // Otherwise, the node of the first processor in the affinity
+    eprosima::fastdds::rtps::ThreadSettings cpu_0;
+    cpu_0.affinity = 1u;
+    int32_t cpu_0_node = eprosima::get_numa_node_of_affinity(cpu_0.affinity);
+    int32_t expected = 0 <= cpu_0_node ? cpu_0_node : eprosima::get_numa_node_of_current_thread();
+    EXPECT_EQ(expected, get_pool_numa_node(properties, cpu_0));
+}
+
+TEST(TopicPayloalPoolTests, memory_usage)
+{
+    for (MemoryManagementPolicy_t policy : {
+            MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE,
+            MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
+            MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE,
+            MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE,
+            MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE})
+    {
+        PoolConfig config{ policy, 128, 2, 0};
+        std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+        ASSERT_TRUE(pool->reserve_history(config, false));
+
+        eprosima::fastdds::rtps::MemoryUsage initial = pool->get_memory_usage();
+        EXPECT_EQ(initial.live_bytes, 0u);
+
+        CacheChange_t change;
+        ASSERT_TRUE(pool->get_payload(100, change));
+        eprosima::fastdds::rtps::MemoryUsage taken = pool->get_memory_usage();
+        EXPECT_GE(taken.live_bytes, change.serializedPayload.max_size);
+        EXPECT_GE(taken.reserved_bytes, taken.live_bytes);
+
+        ASSERT_TRUE(pool->release_payload(change));
+        eprosima::fastdds::rtps::MemoryUsage released = pool->get_memory_usage();
+        EXPECT_EQ(released.live_bytes, 0u);
+        if (MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE == policy)
+        {
+            EXPECT_EQ(released.reserved_bytes, 0u);
+        }
+        else
+        {
+            EXPECT_EQ(released.reserved_bytes, taken.reserved_bytes);
+        }
+
+        ASSERT_TRUE(pool->release_history(config, false));
+    }
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
@@ -503,7 +678,8 @@ GTEST_INSTANTIATE_TEST_MACRO(
     Values(MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE,
     MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
     MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE,
-    MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE))
+    MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE,
+    MemoryManagementPolicy_t::DYNAMIC_SIZE_CLASS_MEMORY_MODE))
     );
 
 int main(
@@ -0,0 +1,402 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+
+#include <rtps/history/CacheChangePool.h>
+#include <rtps/persistence/PersistenceService.h>
+#include <utils/SystemInfo.hpp>
+
+using namespace eprosima::fastrtps::rtps;
+
+class NoOpPayloadPool : public IPayloadPool
+{
+    virtual bool get_payload(
+            uint32_t,
+            CacheChange_t&) override
+    {
+        return true;
+    }
+
+    virtual bool get_payload(
+            SerializedPayload_t&,
+            IPayloadPool*&,
+            CacheChange_t&) override
+    {
+        return true;
+    }
+
+    virtual bool release_payload(
+            CacheChange_t&) override
+    {
+        return true;
+    }
+
+};
+
+class MappedLogPersistenceTest : public ::testing::Test
+{
+protected:
+
+    IPersistenceService* service = nullptr;
+
+    std::shared_ptr<NoOpPayloadPool> payload_pool_ = std::make_shared<NoOpPayloadPool>();
+
+    virtual void SetUp()
+    {
+        // Create the file prefix from test name and PID
+        auto info = ::testing::UnitTest::GetInstance()->current_test_info();
+        std::ostringstream ss;
+        ss << info->test_case_name() << "_" << info->name() << "_" << eprosima::SystemInfo::instance().process_id();
+        filename = ss.str();
+
+        policy.properties().emplace_back("dds.persistence.plugin", "builtin.MAPPED_LOG");
+        policy.properties().emplace_back("dds.persistence.mapped_log.filename", filename);
+    }
+
+    virtual void TearDown()
+    {
+        if (service != nullptr)
+        {
+            delete service;
+        }
+
+        remove_log(writer_persist_guid);
+        remove_log(reader_persist_guid);
+    }
+
+    std::string segment_filename(
+            const std::string& guid,
+            uint32_t index) const
+    {
+        return filename + "." + guid + "." + std::to_string(index) + ".log";
+    }
+
+    bool segment_exists(
+            const std::string& guid,
+            uint32_t index) const
+    {
+        return std::ifstream(segment_filename(guid, index)).good();
+    }
+
+    //! Wait for the background compaction to delete a segment.
+    bool wait_segment_deleted(
+            const std::string& guid,
+            uint32_t index) const
+    {
+        for (uint32_t i = 0; i < 100 && segment_exists(guid, index); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return !segment_exists(guid, index);
+    }
+
+    void remove_log(
+            const std::string& guid)
+    {
+        std::remove((filename + "." + guid + ".head").c_str());
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            std::remove(segment_filename(guid, i).c_str());
+        }
+    }
+
+    void restart()
+    {
+        delete service;
+        service = PersistenceFactory::create_persistence_service(policy);
+        ASSERT_NE(service, nullptr);
+    }
+
+    const std::string writer_persist_guid = "TEST_WRITER";
+    const std::string reader_persist_guid = "TEST_READER";
+    std::string filename;
+    PropertyPolicy policy;
+};
+
+/*!
+ * @fn TEST_F(MappedLogPersistenceTest, Writer)
+ * @brief This test checks the writer persistence interface of the mapped log persistence service.
+ */
+TEST_F(MappedLogPersistenceTest, Writer)
+{
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    // Initial load should return empty vector
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(writer_persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 0u);
+
+    // Add two changes
+    change.sequenceNumber.low = 1;
+    ASSERT_TRUE(service->add_writer_change_to_storage(writer_persist_guid, change));
+    change.sequenceNumber.low = 2;
+    ASSERT_TRUE(service->add_writer_change_to_storage(writer_persist_guid, change));
+
+    // Should not be able to add same sequence again
+    change.sequenceNumber.low = 1;
+    ASSERT_FALSE(service->add_writer_change_to_storage(writer_persist_guid, change));
+
+    // Remove seq = 1, and test it can be safely removed twice
+    ASSERT_TRUE(service->remove_writer_change_from_storage(writer_persist_guid, change));
+    ASSERT_TRUE(service->remove_writer_change_from_storage(writer_persist_guid, change));
+
+    // Loading after a restart should return one change (seq = 2)
+    restart();
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(writer_persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 1u);
+    ASSERT_EQ((*history.m_changes.begin())->sequenceNumber, SequenceNumber_t(0, 2));
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+    pool->release_cache(*history.m_changes.begin());
+}
+
+/*!
+ * @fn TEST_F(MappedLogPersistenceTest, Reader)
+ * @brief This test checks the reader persistence interface of the mapped log persistence service.
+ */
+TEST_F(MappedLogPersistenceTest, Reader)
+{
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    IPersistenceService::map_allocator_t pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map(pool);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(pool);
+    GUID_t guid_1(GuidPrefix_t::unknown(), 1U);
+    GUID_t guid_2(GuidPrefix_t::unknown(), 2U);
+
+    // Initial load should return empty map
+    ASSERT_TRUE(service->load_reader_from_storage(reader_persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded.size(), 0u);
+
+    // Add and update two writers
+    seq_map[guid_1] = SequenceNumber_t(0, 100);
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_persist_guid, guid_1, SequenceNumber_t(0, 1)));
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_persist_guid, guid_1, seq_map[guid_1]));
+    seq_map[guid_2] = SequenceNumber_t(1, 200);
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_persist_guid, guid_2, seq_map[guid_2]));
+
+    // Loading after a restart should return local map
+    restart();
+    ASSERT_TRUE(service->load_reader_from_storage(reader_persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+}
+
+/*!
+ * @fn TEST_F(MappedLogPersistenceTest, InvalidSegmentSize)
+ * @brief This test checks that the factory rejects segments too small to be useful.
+ */
+TEST_F(MappedLogPersistenceTest, InvalidSegmentSize)
+{
+    for (const char* segment_size : {"0", "16", "4095"})
+    {
+        PropertyPolicy invalid_policy = policy;
+        invalid_policy.properties().emplace_back("dds.persistence.mapped_log.segment_size", segment_size);
+        service = PersistenceFactory::create_persistence_service(invalid_policy);
+        ASSERT_EQ(service, nullptr) << segment_size;
+    }
+
+    policy.properties().emplace_back("dds.persistence.mapped_log.segment_size", "4096");
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+}
+
+/*!
+ * @fn TEST_F(MappedLogPersistenceTest, Compaction)
+ * @brief This test checks that segments with removed changes are compacted, and that the live changes are
+ * recovered after a restart.
+ */
+TEST_F(MappedLogPersistenceTest, Compaction)
+{
+    const uint32_t num_changes = 500;
+    const uint32_t depth = 10;
+
+    policy.properties().emplace_back("dds.persistence.mapped_log.segment_size", "4096");
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.reserve(100);
+    change.serializedPayload.length = 100;
+
+    // Keep the last changes, as a KEEP_LAST writer would do
+    for (uint32_t i = 1; i <= num_changes; ++i)
+    {
+        memset(change.serializedPayload.data, static_cast<int>(i), change.serializedPayload.length);
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(writer_persist_guid, change));
+        if (i > depth)
+        {
+            change.sequenceNumber.low = i - depth;
+            ASSERT_TRUE(service->remove_writer_change_from_storage(writer_persist_guid, change));
+        }
+    }
+
+    // The first segments should be compacted on the background
+    ASSERT_TRUE(wait_segment_deleted(writer_persist_guid, 0));
+
+    restart();
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, depth, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    WriterHistory history;
+    ASSERT_TRUE(service->load_writer_from_storage(writer_persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), depth);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, num_changes));
+    uint32_t seq = num_changes - depth;
+    for (CacheChange_t* loaded : history.m_changes)
+    {
+        ++seq;
+        ASSERT_EQ(loaded->sequenceNumber, SequenceNumber_t(0, seq));
+        ASSERT_EQ(loaded->serializedPayload.length, 100u);
+        ASSERT_EQ(loaded->serializedPayload.data[0], static_cast<octet>(seq));
+        pool->release_cache(loaded);
+    }
+}
+
+/*!
+ * @fn TEST_F(MappedLogPersistenceTest, CompactionOfMiddleSegments)
+ * @brief This test checks that the segments after an oldest one holding long-lived changes are compacted, and that
+ * neither a live change nor a removed one is lost or recovered again after a restart.
+ */
+TEST_F(MappedLogPersistenceTest, CompactionOfMiddleSegments)
+{
+    // Each record takes 176 bytes, so the first segment holds the long-lived changes and a few more.
+    const uint32_t num_long_lived = 20;
+    const uint32_t num_changes = 500;
+    const uint32_t depth = 5;
+
+    policy.properties().emplace_back("dds.persistence.mapped_log.segment_size", "4096");
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.reserve(100);
+    change.serializedPayload.length = 100;
+
+    auto add_change = [&](uint32_t seq)
+            {
+                memset(change.serializedPayload.data, static_cast<int>(seq), change.serializedPayload.length);
+                change.sequenceNumber.low = seq;
+                return service->add_writer_change_to_storage(writer_persist_guid, change);
+            };
+    auto remove_change = [&](uint32_t seq)
+            {
+                change.sequenceNumber.low = seq;
+                return service->remove_writer_change_from_storage(writer_persist_guid, change);
+            };
+
+    for (uint32_t seq = 1; seq <= num_long_lived; ++seq)
+    {
+        ASSERT_TRUE(add_change(seq));
+    }
+
+    for (uint32_t seq = num_long_lived + 1; seq <= num_changes; ++seq)
+    {
+        ASSERT_TRUE(add_change(seq));
+        if (seq > num_long_lived + depth)
+        {
+            ASSERT_TRUE(remove_change(seq - depth));
+        }
+
+        // The removal of a change on the oldest segment is written on the second one, and should survive its
+        // compaction
+        if (num_long_lived + 20 == seq)
+        {
+            ASSERT_TRUE(remove_change(1));
+        }
+    }
+
+    ASSERT_TRUE(wait_segment_deleted(writer_persist_guid, 1));
+    ASSERT_TRUE(wait_segment_deleted(writer_persist_guid, 2));
+    ASSERT_TRUE(segment_exists(writer_persist_guid, 0));
+
+    restart();
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, num_long_lived + depth, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    WriterHistory history;
+    ASSERT_TRUE(service->load_writer_from_storage(writer_persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), num_long_lived - 1 + depth);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, num_changes));
+
+    std::vector<uint32_t> expected;
+    for (uint32_t seq = 2; seq <= num_long_lived; ++seq)
+    {
+        expected.push_back(seq);
+    }
+    for (uint32_t seq = num_changes - depth + 1; seq <= num_changes; ++seq)
+    {
+        expected.push_back(seq);
+    }
+    auto expected_it = expected.begin();
+    for (CacheChange_t* loaded : history.m_changes)
+    {
+        ASSERT_EQ(loaded->sequenceNumber, SequenceNumber_t(0, *expected_it));
+        ASSERT_EQ(loaded->serializedPayload.data[0], static_cast<octet>(*expected_it));
+        ++expected_it;
+        pool->release_cache(loaded);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <climits>
 #include <sstream>
 
@@ -461,6 +462,143 @@ TEST_F(PersistenceTest, Reader)
     ASSERT_EQ(seq_map_loaded, seq_map);
 }
 
+/*!
+ * @fn TEST_F(PersistenceTest, GroupCommit)
+ * @brief This test checks that operations queued on group commit mode are stored in order,
+ * and that they are visible to loads done before the commit window expires.
+ */
+TEST_F(PersistenceTest, GroupCommit)
+{
+    const std::string writer_persist_guid("TEST_WRITER");
+    const std::string reader_persist_guid("TEST_READER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.sqlite3.group_commit", "true");
+    policy.properties().emplace_back("dds.persistence.sqlite3.group_commit.max_delay_ms", "60000");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    // Add three changes and remove the first one on the same batch
+    for (uint32_t i = 1; i <= 3; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(writer_persist_guid, change));
+    }
+    change.sequenceNumber.low = 1;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(writer_persist_guid, change));
+
+    // Loading commits the queued operations
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(writer_persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 2u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 3u));
+    uint32_t i = 1;
+    for (auto it : history.m_changes)
+    {
+        ++i;
+        ASSERT_EQ(it->sequenceNumber, SequenceNumber_t(0, i));
+    }
+    for (auto it : history.m_changes)
+    {
+        pool->release_cache(it);
+    }
+
+    IPersistenceService::map_allocator_t map_pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(map_pool);
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_persist_guid, guid, SequenceNumber_t(0, 1)));
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_persist_guid, guid, SequenceNumber_t(0, 2)));
+    ASSERT_TRUE(service->load_reader_from_storage(reader_persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded.size(), 1u);
+    ASSERT_EQ(seq_map_loaded[guid], SequenceNumber_t(0, 2));
+
+    // Operations still queued are committed when the service is destroyed
+    change.sequenceNumber.low = 4;
+    ASSERT_TRUE(service->add_writer_change_to_storage(writer_persist_guid, change));
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(writer_persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 3u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 4u));
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, GroupCommitQueueLimit)
+ * @brief This test checks that queuing operations beyond the queue limit blocks the caller until the queue is
+ * committed, instead of waiting for the commit window, and that no operation is lost.
+ */
+TEST_F(PersistenceTest, GroupCommitQueueLimit)
+{
+    const std::string writer_persist_guid("TEST_WRITER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.sqlite3.group_commit", "true");
+    policy.properties().emplace_back("dds.persistence.sqlite3.group_commit.max_delay_ms", "60000");
+    policy.properties().emplace_back("dds.persistence.sqlite3.group_commit.max_queued_operations", "2");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    // The commit window would keep these operations queued for a minute
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 1; i <= 10; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(writer_persist_guid, change));
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(30));
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    WriterHistory history;
+    ASSERT_TRUE(service->load_writer_from_storage(writer_persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 10u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 10u));
+    for (auto it : history.m_changes)
+    {
+        pool->release_cache(it);
+    }
+
+    // A queue limit of 0 is rejected
+    PropertyPolicy invalid_policy(policy);
+    invalid_policy.properties().back().value() = "0";
+    ASSERT_EQ(PersistenceFactory::create_persistence_service(invalid_policy), nullptr);
+}
+
 int main(
         int argc,
         char** argv)
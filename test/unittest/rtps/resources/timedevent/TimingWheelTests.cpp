@@ -0,0 +1,354 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rtps/resources/TimedEventImpl.h>
+#include <rtps/resources/TimingWheel.hpp>
+
+using namespace eprosima::fastrtps::rtps;
+
+class TimingWheelTests : public ::testing::Test
+{
+protected:
+
+    using Clock = TimingWheel::Clock;
+
+    //! Ticks covered by the slots of each level.
+    static constexpr uint64_t level1_ticks = uint64_t(1) << 8;
+    static constexpr uint64_t level2_ticks = uint64_t(1) << 16;
+    static constexpr uint64_t level3_ticks = uint64_t(1) << 24;
+    static constexpr uint64_t wheel_ticks = uint64_t(1) << 32;
+
+    Clock::time_point origin = Clock::now();
+    TimingWheel wheel{origin};
+    std::vector<std::unique_ptr<TimedEventImpl>> events;
+
+    Clock::time_point time_at(
+            uint64_t ms) const
+    {
+        return origin + std::chrono::milliseconds(ms);
+    }
+
+    //! Create an event triggering at a number of milliseconds from the origin, and add it to the wheel.
+    TimedEventImpl* insert(
+            uint64_t ms)
+    {
+        events.emplace_back(new TimedEventImpl([]()
+                {
+                    return false;
+                }, std::chrono::milliseconds(ms)));
+        TimedEventImpl* event = events.back().get();
+        event->go_ready();
+        event->update(origin, origin);
+        EXPECT_EQ(time_at(ms), event->next_trigger_time());
+        wheel.insert(event);
+        return event;
+    }
+
+    std::vector<TimedEventImpl*> advance(
+            uint64_t ms)
+    {
+        std::vector<TimedEventImpl*> expired;
+        wheel.advance(time_at(ms), expired);
+        return expired;
+    }
+
+    //! Check that an event is not returned before its trigger time, and is returned just at it.
+    void expect_expires_at(
+            TimedEventImpl* event,
+            uint64_t ms)
+    {
+        EXPECT_TRUE(advance(ms - 1).empty());
+        EXPECT_TRUE(wheel.contains(event));
+        EXPECT_LE(wheel.next_expiration(), time_at(ms));
+
+        std::vector<TimedEventImpl*> expired = advance(ms);
+        ASSERT_EQ(1u, expired.size());
+        EXPECT_EQ(event, expired.front());
+        EXPECT_FALSE(wheel.contains(event));
+    }
+
+};
+
+/*!
+ * @fn TEST_F(TimingWheelTests, cascade_from_each_level)
+ * @brief This test checks that events beyond the lowest level are moved down and returned at their trigger time.
+ */
+TEST_F(TimingWheelTests, cascade_from_each_level)
+{
+    TimedEventImpl* level1 = insert(level1_ticks + 44);
+    TimedEventImpl* level2 = insert(level2_ticks + 300);
+    TimedEventImpl* level3 = insert(level3_ticks + 70000);
+    EXPECT_EQ(3u, wheel.size());
+
+    // While the events are on the higher levels, the wheel should be advanced when they are moved down
+    EXPECT_EQ(time_at(level1_ticks), wheel.next_expiration());
+
+    expect_expires_at(level1, level1_ticks + 44);
+    expect_expires_at(level2, level2_ticks + 300);
+    expect_expires_at(level3, level3_ticks + 70000);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(Clock::time_point::max(), wheel.next_expiration());
+}
+
+/*!
+ * @fn TEST_F(TimingWheelTests, cascade_in_steps)
+ * @brief This test checks that advancing tick by tick around the level boundaries returns each event once.
+ */
+TEST_F(TimingWheelTests, cascade_in_steps)
+{
+    std::vector<uint64_t> times = {255, 256, 257, 511, 512, 65535, 65536, 65537, 65536 + 256};
+    for (uint64_t ms : times)
+    {
+        insert(ms);
+    }
+
+    std::vector<uint64_t> expired_times;
+    for (uint64_t ms = 0; ms <= 65536 + 256; ++ms)
+    {
+        for (TimedEventImpl* event : advance(ms))
+        {
+            EXPECT_EQ(time_at(ms), event->next_trigger_time());
+            expired_times.push_back(ms);
+        }
+    }
+
+    EXPECT_EQ(times, expired_times);
+    EXPECT_TRUE(wheel.empty());
+}
+
+/*!
+ * @fn TEST_F(TimingWheelTests, clamp_beyond_wheel)
+ * @brief This test checks that events beyond the range of the wheel (about 49 days) are not returned before their
+ * trigger time.
+ */
+TEST_F(TimingWheelTests, clamp_beyond_wheel)
+{
+    const uint64_t sixty_days = 60ull * 24 * 3600 * 1000;
+    TimedEventImpl* last_tick = insert(wheel_ticks - 1);
+    TimedEventImpl* far = insert(sixty_days);
+    TimedEventImpl* very_far = insert(3 * wheel_ticks + 5);
+
+    std::vector<TimedEventImpl*> expired = advance(wheel_ticks - 1);
+    ASSERT_EQ(1u, expired.size());
+    EXPECT_EQ(last_tick, expired.front());
+
+    // The events clamped on the last slot are placed again when it is cascaded
+    EXPECT_TRUE(advance(wheel_ticks).empty());
+    EXPECT_TRUE(wheel.contains(far));
+    EXPECT_TRUE(wheel.contains(very_far));
+
+    expect_expires_at(far, sixty_days);
+    expect_expires_at(very_far, 3 * wheel_ticks + 5);
+    EXPECT_TRUE(wheel.empty());
+}
+
+/*!
+ * @fn TEST_F(TimingWheelTests, slot_aliasing)
+ * @brief This test checks that events on the slot of a higher level already passed on the current round are not
+ * returned before their trigger time.
+ */
+TEST_F(TimingWheelTests, slot_aliasing)
+{
+    // Move away from the start of the rounds of every level
+    ASSERT_TRUE(advance(level3_ticks + level2_ticks + level1_ticks + 1).empty());
+    const uint64_t now = level3_ticks + level2_ticks + level1_ticks + 1;
+
+    // Each of these events lands on the slot of its level which covers the current tick, and which was already
+    // cascaded, so it should stay there until the next round of that level.
+    TimedEventImpl* level1 = insert(now + level2_ticks - 1);
+    TimedEventImpl* level2 = insert(now + level3_ticks - 1);
+    TimedEventImpl* level3 = insert(now + wheel_ticks - 1);
+    TimedEventImpl* clamped = insert(now + wheel_ticks + 10);
+
+    // Events sharing the slots on a previous round of the lowest levels
+    TimedEventImpl* level0 = insert(now + 255);
+    TimedEventImpl* next_level1 = insert(now + level1_ticks);
+
+    expect_expires_at(level0, now + 255);
+    expect_expires_at(next_level1, now + level1_ticks);
+    expect_expires_at(level1, now + level2_ticks - 1);
+    expect_expires_at(level2, now + level3_ticks - 1);
+    expect_expires_at(level3, now + wheel_ticks - 1);
+    expect_expires_at(clamped, now + wheel_ticks + 10);
+    EXPECT_TRUE(wheel.empty());
+}
+
+/*!
+ * @fn TEST_F(TimingWheelTests, insert_remove_across_levels)
+ * @brief This test checks removing events from every level, before and after they are moved down, and that the
+ * events are returned in order of trigger time.
+ */
+TEST_F(TimingWheelTests, insert_remove_across_levels)
+{
+    TimedEventImpl* a = insert(10);
+    TimedEventImpl* b = insert(300);
+    TimedEventImpl* c = insert(301);
+    TimedEventImpl* d = insert(70000);
+    TimedEventImpl* e = insert(70001);
+    TimedEventImpl* f = insert(level3_ticks + 1);
+    EXPECT_EQ(6u, wheel.size());
+
+    // Removing from the higher levels
+    wheel.remove(c);
+    wheel.remove(f);
+    EXPECT_FALSE(wheel.contains(c));
+    EXPECT_FALSE(wheel.contains(f));
+    EXPECT_EQ(4u, wheel.size());
+
+    // Removing twice does nothing
+    wheel.remove(c);
+    EXPECT_EQ(4u, wheel.size());
+
+    // Once past the first levels, d and e have been moved down to the lowest one
+    std::vector<TimedEventImpl*> expired = advance(level2_ticks);
+    ASSERT_EQ(2u, expired.size());
+    EXPECT_EQ(a, expired[0]);
+    EXPECT_EQ(b, expired[1]);
+    ASSERT_TRUE(advance(69999).empty());
+    wheel.remove(d);
+    EXPECT_EQ(1u, wheel.size());
+
+    // Events in the past are placed on the current tick
+    TimedEventImpl* late = insert(5);
+    TimedEventImpl* g = insert(70001);
+    wheel.remove(e);
+    wheel.insert(e);
+    EXPECT_EQ(3u, wheel.size());
+
+    expired = advance(70001);
+    ASSERT_EQ(3u, expired.size());
+    EXPECT_EQ(late, expired[0]);
+    EXPECT_TRUE((e == expired[1] && g == expired[2]) || (g == expired[1] && e == expired[2]));
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(Clock::time_point::max(), wheel.next_expiration());
+}
+
+/*!
+ * @fn TEST_F(TimingWheelTests, next_expiration_skips_empty_levels)
+ * @brief This test checks that the wheel does not need to be advanced on every round of the lowest level when the
+ * events are far away.
+ */
+TEST_F(TimingWheelTests, next_expiration_skips_empty_levels)
+{
+    TimedEventImpl* level3 = insert(3 * level3_ticks + 5);
+    EXPECT_EQ(time_at(level3_ticks), wheel.next_expiration());
+
+    TimedEventImpl* level2 = insert(level2_ticks + 5);
+    EXPECT_EQ(time_at(level2_ticks), wheel.next_expiration());
+
+    wheel.remove(level2);
+    EXPECT_EQ(time_at(level3_ticks), wheel.next_expiration());
+
+    // Once on the lower level, the next time is the one of the event
+    ASSERT_TRUE(advance(3 * level3_ticks).empty());
+    EXPECT_EQ(time_at(3 * level3_ticks + 5), wheel.next_expiration());
+    expect_expires_at(level3, 3 * level3_ticks + 5);
+}
+
+/*!
+ * @fn TEST_F(TimingWheelTests, random_operations)
+ * @brief This test checks random insertions, removals and advances against a sorted collection of the events.
+ */
+TEST_F(TimingWheelTests, random_operations)
+{
+    std::mt19937_64 generator(12345);
+    std::set<std::pair<Clock::time_point, TimedEventImpl*>> expected;
+    uint64_t now = 0;
+
+    for (uint32_t i = 0; i < 20000; ++i)
+    {
+        uint32_t operation = generator() % 4;
+        if (0 == operation || expected.empty())
+        {
+            // Delays spread over every level of the wheel, and beyond it
+            uint32_t level = generator() % 5;
+            uint64_t delay = generator() % (uint64_t(1) << (8 * level + 8));
+            TimedEventImpl* event = insert(now + delay);
+            expected.emplace(event->next_trigger_time(), event);
+        }
+        else if (1 == operation)
+        {
+            auto it = expected.begin();
+            std::advance(it, generator() % expected.size());
+            wheel.remove(it->second);
+            expected.erase(it);
+        }
+        else
+        {
+            uint32_t level = generator() % 4;
+            now += generator() % (uint64_t(1) << (8 * level + 4));
+            std::vector<TimedEventImpl*> expired = advance(now);
+
+            std::vector<TimedEventImpl*> expected_expired;
+            while (!expected.empty() && expected.begin()->first <= time_at(now))
+            {
+                expected_expired.push_back(expected.begin()->second);
+                expected.erase(expected.begin());
+            }
+            ASSERT_EQ(expected_expired.size(), expired.size());
+            for (size_t n = 0; n < expired.size(); ++n)
+            {
+                EXPECT_EQ(expected_expired[n]->next_trigger_time(), expired[n]->next_trigger_time());
+            }
+        }
+
+        ASSERT_EQ(expected.size(), wheel.size());
+        if (!expected.empty())
+        {
+            ASSERT_LE(wheel.next_expiration(), expected.begin()->first);
+        }
+    }
+}
+
+/*!
+ * @fn TEST_F(TimingWheelTests, exact_trigger_time)
+ * @brief This test checks that the events of the current tick are returned at their exact time, not at the start
+ * of the tick.
+ */
+TEST_F(TimingWheelTests, exact_trigger_time)
+{
+    events.emplace_back(new TimedEventImpl([]()
+            {
+                return false;
+            }, std::chrono::microseconds(1500)));
+    TimedEventImpl* event = events.back().get();
+    event->go_ready();
+    event->update(origin, origin);
+    wheel.insert(event);
+
+    std::vector<TimedEventImpl*> expired;
+    wheel.advance(origin + std::chrono::microseconds(1499), expired);
+    EXPECT_TRUE(expired.empty());
+    EXPECT_EQ(origin + std::chrono::microseconds(1500), wheel.next_expiration());
+    wheel.advance(origin + std::chrono::microseconds(1500), expired);
+    ASSERT_EQ(1u, expired.size());
+    EXPECT_EQ(event, expired.front());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
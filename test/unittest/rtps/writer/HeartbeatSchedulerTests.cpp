@@ -0,0 +1,278 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#define TEST_FRIENDS \
+    FRIEND_TEST(HeartbeatSchedulerTests, due_writers_grouped_by_participant); \
+    FRIEND_TEST(HeartbeatSchedulerTests, activate_and_deactivate); \
+    FRIEND_TEST(HeartbeatSchedulerTests, unregister_waits_only_for_writer_in_use);
+
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+#include <fastdds/rtps/writer/StatefulWriter.h>
+
+#include <rtps/builtin/discovery/participant/DirectMessageSender.hpp>
+#include <rtps/writer/HeartbeatScheduler.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using AddRemoteReader = std::function<void (const GUID_t&, const LocatorSelectorEntry&)>;
+
+static GUID_t reader_guid(
+        octet participant,
+        octet reader)
+{
+    GUID_t guid;
+    guid.guidPrefix.value[0] = participant;
+    guid.entityId.value[0] = reader;
+    guid.entityId.value[3] = 0x07;
+    return guid;
+}
+
+/**
+ * Writer whose periodic heartbeats are sent by the scheduler.
+ * Records the remote participant of each message its heartbeat is added to.
+ */
+class TestWriter
+{
+public:
+
+    TestWriter(
+            ResourceEvent& service,
+            double period_ms)
+        : hb_event(service, nullptr, period_ms)
+    {
+        ON_CALL(hb_event, getIntervalMilliSec()).WillByDefault(Return(period_ms));
+        writer.periodic_hb_event_ = &hb_event;
+
+        ON_CALL(writer, prepare_coalesced_heartbeat(_)).WillByDefault(Invoke(
+                    [this](const AddRemoteReader& add_remote_reader)
+                    {
+                        for (const auto& reader : readers)
+                        {
+                            add_remote_reader(reader.first, reader.second);
+                        }
+                    }));
+
+        ON_CALL(writer, add_coalesced_heartbeat_nts(_)).WillByDefault(Invoke(
+                    [this](RTPSMessageGroup& group)
+                    {
+                        auto sender = static_cast<const DirectMessageSender*>(group.msg_sender());
+                        destinations.push_back(sender->destination_guid_prefix());
+                    }));
+    }
+
+    void add_reader(
+            const GUID_t& guid)
+    {
+        Locator_t locator;
+        locator.kind = LOCATOR_KIND_UDPv4;
+        locator.port = 7400 + guid.guidPrefix.value[0];
+
+        LocatorSelectorEntry entry(1, 0);
+        entry.remote_guid = guid;
+        entry.unicast.push_back(locator);
+        readers.emplace_back(guid, entry);
+    }
+
+    NiceMock<TimedEvent> hb_event;
+    NiceMock<StatefulWriter> writer;
+    std::vector<std::pair<GUID_t, LocatorSelectorEntry>> readers;
+    std::vector<GuidPrefix_t> destinations;
+};
+
+TEST(HeartbeatSchedulerTests, due_writers_grouped_by_participant)
+{
+    NiceMock<ResourceEvent> service;
+    HeartbeatScheduler scheduler(nullptr, service);
+    EXPECT_CALL(*scheduler.event_, update_interval_millisec(200)).Times(1);
+
+    // Writers a and b send heartbeats to the first participant, and c to the second one.
+    TestWriter a(service, 200);
+    TestWriter b(service, 400);
+    TestWriter c(service, 200);
+    a.add_reader(reader_guid(1, 1));
+    b.add_reader(reader_guid(1, 2));
+    c.add_reader(reader_guid(2, 1));
+    GuidPrefix_t p1 = reader_guid(1, 1).guidPrefix;
+    GuidPrefix_t p2 = reader_guid(2, 1).guidPrefix;
+
+    scheduler.register_writer(&a.writer);
+    scheduler.register_writer(&b.writer);
+    scheduler.register_writer(&c.writer);
+    scheduler.activate(&a.writer);
+    scheduler.activate(&b.writer);
+    scheduler.activate(&c.writer);
+
+    // First tick: all the writers are due, and the heartbeats of a and b share the same message.
+    EXPECT_TRUE(scheduler.on_tick());
+    EXPECT_EQ(std::vector<GuidPrefix_t>({p1}), a.destinations);
+    EXPECT_EQ(std::vector<GuidPrefix_t>({p1}), b.destinations);
+    EXPECT_EQ(std::vector<GuidPrefix_t>({p2}), c.destinations);
+    HeartbeatScheduler::Statistics statistics = scheduler.get_statistics();
+    EXPECT_EQ(1u, statistics.ticks);
+    EXPECT_EQ(3u, statistics.heartbeats);
+    EXPECT_EQ(2u, statistics.messages);
+
+    // Second tick: only the writers with the shortest period are due.
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_TRUE(scheduler.on_tick());
+    EXPECT_EQ(2u, a.destinations.size());
+    EXPECT_EQ(1u, b.destinations.size());
+    EXPECT_EQ(2u, c.destinations.size());
+    statistics = scheduler.get_statistics();
+    EXPECT_EQ(2u, statistics.ticks);
+    EXPECT_EQ(5u, statistics.heartbeats);
+    EXPECT_EQ(4u, statistics.messages);
+
+    // Third tick: all the writers are due again.
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_TRUE(scheduler.on_tick());
+    EXPECT_EQ(std::vector<GuidPrefix_t>({p1, p1, p1}), a.destinations);
+    EXPECT_EQ(std::vector<GuidPrefix_t>({p1, p1}), b.destinations);
+    EXPECT_EQ(std::vector<GuidPrefix_t>({p2, p2, p2}), c.destinations);
+    statistics = scheduler.get_statistics();
+    EXPECT_EQ(3u, statistics.ticks);
+    EXPECT_EQ(8u, statistics.heartbeats);
+    EXPECT_EQ(6u, statistics.messages);
+
+    scheduler.unregister_writer(&a.writer);
+    scheduler.unregister_writer(&b.writer);
+    scheduler.unregister_writer(&c.writer);
+}
+
+TEST(HeartbeatSchedulerTests, activate_and_deactivate)
+{
+    NiceMock<ResourceEvent> service;
+    HeartbeatScheduler scheduler(nullptr, service);
+
+    TestWriter a(service, 100);
+    a.add_reader(reader_guid(1, 1));
+    scheduler.register_writer(&a.writer);
+
+    // Not activated: the timer is stopped and no heartbeats are sent.
+    EXPECT_CALL(a.writer, prepare_coalesced_heartbeat(_)).Times(0);
+    EXPECT_FALSE(scheduler.on_tick());
+    ::testing::Mock::VerifyAndClearExpectations(&a.writer);
+
+    // Activated: the timer is started and the heartbeat is sent on the next tick.
+    EXPECT_CALL(*scheduler.event_, restart_timer()).Times(1);
+    scheduler.activate(&a.writer);
+    ::testing::Mock::VerifyAndClearExpectations(scheduler.event_);
+    EXPECT_CALL(a.writer, prepare_coalesced_heartbeat(_)).Times(1);
+    EXPECT_TRUE(scheduler.on_tick());
+    ::testing::Mock::VerifyAndClearExpectations(&a.writer);
+    EXPECT_EQ(1u, a.destinations.size());
+
+    // Deactivated: the heartbeats stop.
+    scheduler.deactivate(&a.writer);
+    EXPECT_CALL(a.writer, prepare_coalesced_heartbeat(_)).Times(0);
+    EXPECT_FALSE(scheduler.on_tick());
+    ::testing::Mock::VerifyAndClearExpectations(&a.writer);
+
+    // Activated again, it is due on the next tick even if its period has not elapsed.
+    // The writer deactivates itself when all its changes are acknowledged.
+    scheduler.activate(&a.writer);
+    EXPECT_CALL(a.writer, prepare_coalesced_heartbeat(_)).WillOnce(Invoke(
+                [&a](const AddRemoteReader&)
+                {
+                    a.writer.coalesced_heartbeat_pending_ = false;
+                }));
+    EXPECT_FALSE(scheduler.on_tick());
+    ::testing::Mock::VerifyAndClearExpectations(&a.writer);
+    EXPECT_EQ(1u, a.destinations.size());
+    EXPECT_EQ(1u, scheduler.get_statistics().ticks);
+
+    scheduler.unregister_writer(&a.writer);
+}
+
+TEST(HeartbeatSchedulerTests, unregister_waits_only_for_writer_in_use)
+{
+    NiceMock<ResourceEvent> service;
+    HeartbeatScheduler scheduler(nullptr, service);
+
+    TestWriter a(service, 100);
+    TestWriter b(service, 100);
+    a.add_reader(reader_guid(1, 1));
+    b.add_reader(reader_guid(1, 2));
+    scheduler.register_writer(&a.writer);
+    scheduler.register_writer(&b.writer);
+    scheduler.activate(&a.writer);
+    scheduler.activate(&b.writer);
+
+    // The tick blocks while preparing the heartbeat of a.
+    std::promise<void> entered;
+    std::promise<void> resume;
+    std::shared_future<void> resumed = resume.get_future().share();
+    EXPECT_CALL(a.writer, prepare_coalesced_heartbeat(_)).WillOnce(Invoke(
+                [&entered, resumed](const AddRemoteReader&)
+                {
+                    entered.set_value();
+                    resumed.wait();
+                }));
+    EXPECT_CALL(b.writer, prepare_coalesced_heartbeat(_)).Times(0);
+    std::thread tick([&scheduler]()
+            {
+                scheduler.on_tick();
+            });
+    entered.get_future().wait();
+
+    // Unregistering a writer not in use does not wait for the tick.
+    auto unregister_b = std::async(std::launch::async, [&scheduler, &b]()
+                    {
+                        scheduler.unregister_writer(&b.writer);
+                    });
+    EXPECT_EQ(std::future_status::ready, unregister_b.wait_for(std::chrono::seconds(5)));
+
+    // Unregistering the writer in use waits until the tick stops accessing it.
+    auto unregister_a = std::async(std::launch::async, [&scheduler, &a]()
+                    {
+                        scheduler.unregister_writer(&a.writer);
+                    });
+    EXPECT_EQ(std::future_status::timeout, unregister_a.wait_for(std::chrono::milliseconds(100)));
+    resume.set_value();
+    EXPECT_EQ(std::future_status::ready, unregister_a.wait_for(std::chrono::seconds(5)));
+
+    tick.join();
+    EXPECT_TRUE(a.destinations.empty());
+    EXPECT_TRUE(b.destinations.empty());
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -12,14 +12,23 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 #include <fastdds/rtps/RTPSDomain.h>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/utils/IPLocator.h>
 
 
 namespace eprosima {
@@ -173,6 +182,126 @@ TEST(RTPSWriterTests, WriterWithCustomPayloadPool_DoesNotInitializePool_WhenDyna
     pool_initialization_test(DYNAMIC_REUSABLE_MEMORY_MODE);
 }
 
+// Set by the transport when the datagram being sent contains a DATA submessage
+static thread_local bool sending_data = false;
+
+/*!
+ * With a NACK aggregation window, the NACKs received from readers sharing a multicast locator are answered by a
+ * single repair sent to the multicast locator, even when they do not arrive at the same time.
+ */
+TEST(RTPSWriterTests, MulticastNacksAggregatedInOneRepair)
+{
+    std::mutex data_destinations_mutex;
+    std::vector<Locator_t> data_destinations;
+
+    // The datagrams are not sent, but the destinations of those with DATA submessages are recorded
+    auto transport = std::make_shared<eprosima::fastdds::rtps::test_UDPv4TransportDescriptor>();
+    transport->interfaceWhiteList.push_back("127.0.0.1");
+    transport->drop_data_messages_filter_ = [](CDRMessage_t&)
+            {
+                sending_data = true;
+                return false;
+            };
+    transport->locator_filter_ = [&](const Locator_t& destination)
+            {
+                if (sending_data)
+                {
+                    sending_data = false;
+                    std::lock_guard<std::mutex> guard(data_destinations_mutex);
+                    data_destinations.push_back(destination);
+                }
+                return true;
+            };
+
+    RTPSParticipantAttributes p_attr;
+    p_attr.useBuiltinTransports = false;
+    p_attr.userTransports.push_back(transport);
+    p_attr.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol_t::NONE;
+    p_attr.builtin.use_WriterLivelinessProtocol = false;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, true, p_attr);
+    ASSERT_NE(participant, nullptr);
+
+    HistoryAttributes h_attr;
+    h_attr.payloadMaxSize = TestDataType::data_size;
+    WriterHistory* history = new WriterHistory(h_attr);
+
+    WriterAttributes w_attr;
+    w_attr.endpoint.reliabilityKind = RELIABLE;
+    w_attr.endpoint.properties.properties().emplace_back("fastdds.nack_aggregation_window", "100");
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, w_attr, history);
+    ASSERT_NE(writer, nullptr);
+
+    // Two remote readers listening on the same multicast locator
+    Locator_t multicast_locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "239.255.1.4", 7900, multicast_locator);
+    std::vector<GUID_t> reader_guids;
+    for (uint32_t i = 1; i <= 2; ++i)
+    {
+        GUID_t reader_guid;
+        reader_guid.guidPrefix.value[0] = 0x0F;
+        reader_guid.guidPrefix.value[11] = static_cast<octet>(i);
+        reader_guid.entityId = EntityId_t(0x00000107);
+        reader_guids.push_back(reader_guid);
+
+        Locator_t unicast_locator;
+        IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", 7900 + i, unicast_locator);
+
+        ReaderProxyData reader(1, 1);
+        reader.guid(reader_guid);
+        reader.m_qos.m_reliability.kind = eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS;
+        reader.add_unicast_locator(unicast_locator);
+        reader.add_multicast_locator(multicast_locator);
+        ASSERT_TRUE(writer->matched_reader_add(reader));
+    }
+
+    CacheChange_t* change = writer->new_change([]() -> uint32_t
+                    {
+                        return TestDataType::data_size;
+                    }, ALIVE);
+    ASSERT_NE(change, nullptr);
+    change->serializedPayload.length = TestDataType::data_size;
+    ASSERT_TRUE(history->add_change(change));
+
+    // Wait for the sample to be sent and the NACK supression to finish
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+        std::lock_guard<std::mutex> guard(data_destinations_mutex);
+        data_destinations.clear();
+    }
+
+    // The second reader NACKs the sample after the NACK response delay of the first one has elapsed
+    SequenceNumberSet_t sn_set(change->sequenceNumber);
+    sn_set.add(change->sequenceNumber);
+    bool result = false;
+    EXPECT_TRUE(writer->process_acknack(writer->getGuid(), reader_guids[0], 1, sn_set, false, result));
+    EXPECT_TRUE(result);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_TRUE(writer->process_acknack(writer->getGuid(), reader_guids[1], 1, sn_set, false, result));
+    EXPECT_TRUE(result);
+
+    // A single repair is sent, to the multicast locator
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    {
+        std::lock_guard<std::mutex> guard(data_destinations_mutex);
+        EXPECT_EQ(std::vector<Locator_t>({multicast_locator}), data_destinations);
+        data_destinations.clear();
+    }
+
+    // The repair requested by only one of the readers is also sent to the multicast locator, as the other reader
+    // will receive it anyway
+    EXPECT_TRUE(writer->process_acknack(writer->getGuid(), reader_guids[0], 2, sn_set, false, result));
+    EXPECT_TRUE(result);
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    {
+        std::lock_guard<std::mutex> guard(data_destinations_mutex);
+        EXPECT_EQ(std::vector<Locator_t>({multicast_locator}), data_destinations);
+    }
+
+    RTPSDomain::removeRTPSWriter(writer);
+    RTPSDomain::removeRTPSParticipant(participant);
+    delete(history);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
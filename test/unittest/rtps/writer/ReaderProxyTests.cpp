@@ -151,6 +151,40 @@ TEST(ReaderProxyTests, requested_changes_set_test)
 }
 #endif // __QNXNTO__
 
+TEST(ReaderProxyTests, requested_changes_merge_test)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+    CacheChange_t seq1; seq1.sequenceNumber = {0, 1};
+    CacheChange_t seq2; seq2.sequenceNumber = {0, 2};
+    CacheChange_t seq3; seq3.sequenceNumber = {0, 3};
+
+    ReaderProxyData reader_attributes(0, 0);
+    reader_attributes.m_qos.m_reliability.kind = fastdds::dds::RELIABLE_RELIABILITY_QOS;
+    rproxy.start(reader_attributes);
+
+    rproxy.add_change(ChangeForReader_t(&seq1), true, false);
+    rproxy.add_change(ChangeForReader_t(&seq2), true, false);
+    rproxy.add_change(ChangeForReader_t(&seq3), true, false);
+    rproxy.from_unsent_to_status(seq1.sequenceNumber, UNACKNOWLEDGED, false);
+    rproxy.from_unsent_to_status(seq3.sequenceNumber, UNACKNOWLEDGED, false);
+
+    // Change 2 is still unsent, and change 5 is unknown by this reader.
+    std::vector<SequenceNumber_t> other_requested = {{0, 1}, {0, 2}, {0, 3}, {0, 5}};
+    EXPECT_EQ(2u, rproxy.requested_changes_merge(other_requested));
+
+    std::vector<SequenceNumber_t> requested;
+    rproxy.requested_changes_get(requested);
+    ASSERT_EQ(2u, requested.size());
+    EXPECT_EQ(SequenceNumber_t(0, 1), requested[0]);
+    EXPECT_EQ(SequenceNumber_t(0, 3), requested[1]);
+
+    // Already requested changes are not merged again.
+    EXPECT_EQ(0u, rproxy.requested_changes_merge(other_requested));
+}
+
 FragmentNumber_t mark_next_fragment_sent(
         ReaderProxy& rproxy,
         SequenceNumber_t sequence_number,
@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <condition_variable>
 #include <map>
+#include <mutex>
 #include <thread>
 
 #if defined(_WIN32)
@@ -38,9 +40,11 @@
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
 #include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/RTPSDomain.h>
 #include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/StatefulWriter.h>
 #include <fastdds/statistics/IListeners.hpp>
 
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -132,6 +136,9 @@ struct MockListener : IListener
             case EventKind::SUBSCRIPTION_THROUGHPUT:
                 on_subscriber_throughput(data.entity_data());
                 break;
+            case EventKind::ROUND_TRIP_TIME:
+                on_round_trip_time(data.writer_reader_data());
+                break;
             default:
                 on_unexpected_kind(kind);
                 break;
@@ -154,6 +161,7 @@ struct MockListener : IListener
     MOCK_METHOD1(on_sample_datas, void(const eprosima::fastdds::statistics::SampleIdentityCount&));
     MOCK_METHOD1(on_publisher_throughput, void(const eprosima::fastdds::statistics::EntityData&));
     MOCK_METHOD1(on_subscriber_throughput, void(const eprosima::fastdds::statistics::EntityData&));
+    MOCK_METHOD1(on_round_trip_time, void(const eprosima::fastdds::statistics::WriterReaderData&));
     MOCK_METHOD1(on_unexpected_kind, void(uint32_t));
 };
 
@@ -204,6 +212,9 @@ protected:
     fastrtps::rtps::RTPSWriter* writer_ = nullptr;
     fastrtps::rtps::RTPSReader* reader_ = nullptr;
 
+    // Properties of the endpoints created by the fixture
+    fastrtps::rtps::PropertyPolicy endpoint_properties_;
+
     // Getters and setters for the transport filter
     using filter = fastdds::rtps::test_UDPv4TransportDescriptor::filter;
 
@@ -289,6 +300,7 @@ public:
         ReaderAttributes r_att;
         r_att.endpoint.reliabilityKind = reliability_qos;
         r_att.endpoint.durabilityKind = durability_qos;
+        r_att.endpoint.properties = endpoint_properties_;
 
         // Setting localhost as the only locator ensures that DATA submessages will be sent only once.
         Locator_t local_locator;
@@ -315,6 +327,7 @@ public:
         w_att.times.heartbeatPeriod.nanosec = 250 * 1000 * 1000; // reduce acknowledgement wait
         w_att.endpoint.reliabilityKind = reliability_qos;
         w_att.endpoint.durabilityKind = durability_qos;
+        w_att.endpoint.properties = endpoint_properties_;
 
         writer_ = RTPSDomain::createRTPSWriter(participant_, w_att, writer_history_);
     }
@@ -1090,6 +1103,135 @@ TEST_F(RTPSStatisticsTests, statistics_rpts_listener_gap_callback)
     EXPECT_TRUE(participant_->remove_statistics_listener(participant_writer_listener, EventKind::GAP_COUNT));
 }
 
+/*
+ * This test checks the round-trip time estimation of the RTT adaptive timing mode.
+ * - ROUND_TRIP_TIME callbacks are performed by the writer (HEARTBEAT to ACKNACK) and the reader (ACKNACK to repair)
+ * - The estimations are available through the endpoints
+ * - The writer shortens its periodic heartbeat to the estimated round-trip time, down to the configured lower bound
+ */
+TEST_F(RTPSStatisticsTests, statistics_rpts_listener_round_trip_time)
+{
+    using namespace ::testing;
+    using namespace fastrtps;
+    using namespace fastrtps::rtps;
+    using namespace std;
+
+    // Drop the first transmission of the first sample, so the reader has to request it
+    std::atomic<unsigned int> samples_filtered{0};
+    set_transport_filter(
+        DATA,
+        [&samples_filtered](fastrtps::rtps::CDRMessage_t& msg)-> bool
+        {
+            uint32_t old_pos = msg.pos;
+
+            EntityId_t readerID, writerID;
+            SequenceNumber_t sn;
+
+            msg.pos += 2; // flags
+            msg.pos += 2; // octets to inline quos
+            CDRMessage::readEntityId(&msg, &readerID);
+            CDRMessage::readEntityId(&msg, &writerID);
+            CDRMessage::readSequenceNumber(&msg, &sn);
+
+            msg.pos = old_pos;
+
+            if (samples_filtered < 1
+            && (writerID.value[3] & 0xC0) == 0      // only user endpoints
+            && (sn == SequenceNumber_t{0, 1}))     // only first sample
+            {
+                ++samples_filtered;
+                return true;
+            }
+
+            return false;
+        });
+
+    endpoint_properties_.properties().emplace_back("fastdds.rtt_adaptive_timing", "true");
+    // By default the adapted timings are never shorter than the static ones
+    endpoint_properties_.properties().emplace_back("fastdds.rtt_adaptive_timing.min_ms", "25");
+
+    uint16_t length = 255;
+    create_endpoints(length, RELIABLE);
+    participant_->set_enabled_statistics_writers_mask(EventKind::ROUND_TRIP_TIME | EventKind::HEARTBEAT_COUNT);
+
+    auto writer_listener = make_shared<MockListener>();
+    ASSERT_TRUE(writer_->add_statistics_listener(writer_listener));
+    auto reader_listener = make_shared<MockListener>();
+    ASSERT_TRUE(reader_->add_statistics_listener(reader_listener));
+
+    const GUID_t writer_guid = writer_->getGuid();
+    const GUID_t reader_guid = reader_->getGuid();
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool writer_rtt = false;
+    bool reader_rtt = false;
+    uint32_t heartbeats = 0;
+
+    auto check_guids = [&](const WriterReaderData& data)
+            {
+                EXPECT_EQ(0, memcmp(&writer_guid, &data.writer_guid(), sizeof(GUID_t)));
+                EXPECT_EQ(0, memcmp(&reader_guid, &data.reader_guid(), sizeof(GUID_t)));
+                EXPECT_LE(0.0f, data.data());
+            };
+
+    EXPECT_CALL(*writer_listener, on_round_trip_time)
+            .Times(AtLeast(1))
+            .WillRepeatedly(Invoke([&](const WriterReaderData& data)
+            {
+                check_guids(data);
+                std::lock_guard<std::mutex> guard(mtx);
+                writer_rtt = true;
+                cv.notify_all();
+            }));
+    EXPECT_CALL(*writer_listener, on_heartbeat_count)
+            .WillRepeatedly(Invoke([&](const EntityCount& data)
+            {
+                std::lock_guard<std::mutex> guard(mtx);
+                heartbeats = static_cast<uint32_t>(data.count());
+            }));
+    EXPECT_CALL(*reader_listener, on_round_trip_time)
+            .Times(AtLeast(1))
+            .WillRepeatedly(Invoke([&](const WriterReaderData& data)
+            {
+                check_guids(data);
+                std::lock_guard<std::mutex> guard(mtx);
+                reader_rtt = true;
+                cv.notify_all();
+            }));
+
+    match_endpoints(false, "string", "statisticsSmallTopic");
+    write_small_sample(length);
+
+    // wait for the repair and the estimations on both sides
+    EXPECT_TRUE(reader_->wait_for_unread_cache(Duration_t(5, 0)));
+    EXPECT_TRUE(writer_->wait_for_all_acked(Duration_t(5, 0)));
+    uint32_t first_heartbeat = 0;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        EXPECT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&]()
+                {
+                    return writer_rtt && reader_rtt;
+                }));
+        first_heartbeat = heartbeats;
+    }
+
+    Duration_t rtt;
+    EXPECT_TRUE(static_cast<StatefulWriter*>(writer_)->get_round_trip_time(reader_guid, rtt));
+    EXPECT_TRUE(static_cast<StatefulReader*>(reader_)->get_round_trip_time(writer_guid, rtt));
+
+    // The static heartbeat period (250 ms) would send 2 heartbeats in 500 ms, while the adapted one is bounded to the
+    // configured lower bound, a tenth of it.
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    {
+        std::lock_guard<std::mutex> guard(mtx);
+        EXPECT_GT(heartbeats - first_heartbeat, 4u);
+    }
+
+    EXPECT_TRUE(writer_->remove_statistics_listener(writer_listener));
+    EXPECT_TRUE(reader_->remove_statistics_listener(reader_listener));
+}
+
 /*
  * This test checks the participant discovery callbacks
  */
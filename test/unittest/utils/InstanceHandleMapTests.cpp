@@ -0,0 +1,194 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <memory>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <utils/collections/InstanceHandleMap.hpp>
+
+using namespace eprosima::fastdds;
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+
+static InstanceHandle_t make_handle(
+        uint32_t id)
+{
+    // Same layout as a serialized key with a single big endian uint32_t field
+    InstanceHandle_t handle;
+    handle.value[0] = static_cast<uint8_t>(id >> 24);
+    handle.value[1] = static_cast<uint8_t>(id >> 16);
+    handle.value[2] = static_cast<uint8_t>(id >> 8);
+    handle.value[3] = static_cast<uint8_t>(id);
+    return handle;
+}
+
+TEST(InstanceHandleMapTests, insert_find_erase)
+{
+    InstanceHandleMap<uint32_t> uut;
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(uut.end(), uut.find(make_handle(1)));
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        auto ret = uut.emplace(make_handle(i), i);
+        EXPECT_TRUE(ret.second);
+        EXPECT_EQ(i, ret.first->second);
+    }
+    EXPECT_EQ(1000u, uut.size());
+
+    auto ret = uut.emplace(make_handle(10), 20u);
+    EXPECT_FALSE(ret.second);
+    EXPECT_EQ(10u, ret.first->second);
+
+    for (uint32_t i = 0; i < 1000; i += 2)
+    {
+        EXPECT_EQ(1u, uut.erase(make_handle(i)));
+    }
+    EXPECT_EQ(0u, uut.erase(make_handle(0)));
+    EXPECT_EQ(500u, uut.size());
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        auto it = uut.find(make_handle(i));
+        if (0 == i % 2)
+        {
+            EXPECT_EQ(uut.end(), it);
+        }
+        else
+        {
+            ASSERT_NE(uut.end(), it);
+            EXPECT_EQ(make_handle(i), it->first);
+            EXPECT_EQ(i, it->second);
+        }
+    }
+
+    // Unset handle is a valid key, different from a handle set to all zeros
+    InstanceHandle_t nil;
+    uut[nil] = 5u;
+    EXPECT_EQ(5u, uut.find(nil)->second);
+    EXPECT_EQ(uut.end(), uut.find(make_handle(0)));
+}
+
+TEST(InstanceHandleMapTests, matches_std_map)
+{
+    InstanceHandleMap<uint32_t> uut;
+    std::map<InstanceHandle_t, uint32_t> reference;
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<uint32_t> keys(0, 2000);
+
+    for (uint32_t i = 0; i < 50000; ++i)
+    {
+        InstanceHandle_t handle = make_handle(keys(gen));
+        switch (gen() % 3)
+        {
+            case 0:
+                EXPECT_EQ(reference.emplace(handle, i).second, uut.emplace(handle, i).second);
+                break;
+            case 1:
+                EXPECT_EQ(reference.erase(handle), uut.erase(handle));
+                break;
+            default:
+            {
+                auto it = uut.find(handle);
+                auto ref_it = reference.find(handle);
+                ASSERT_EQ(reference.end() == ref_it, uut.end() == it);
+                if (reference.end() != ref_it)
+                {
+                    EXPECT_EQ(ref_it->second, it->second);
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(reference.size(), uut.size());
+    }
+
+    size_t count = 0;
+    for (const auto& item : uut)
+    {
+        auto ref_it = reference.find(item.first);
+        ASSERT_NE(reference.end(), ref_it);
+        EXPECT_EQ(ref_it->second, item.second);
+        ++count;
+    }
+    EXPECT_EQ(reference.size(), count);
+}
+
+TEST(InstanceHandleMapTests, erase_while_iterating)
+{
+    InstanceHandleMap<uint32_t> uut;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        uut.emplace(make_handle(i), i);
+    }
+
+    size_t visited = 0;
+    for (auto it = uut.begin(); it != uut.end();)
+    {
+        ++visited;
+        it = (0 == it->second % 3) ? uut.erase(it) : std::next(it);
+    }
+    EXPECT_EQ(100u, visited);
+    EXPECT_EQ(66u, uut.size());
+}
+
+TEST(InstanceHandleMapTests, references_are_stable)
+{
+    InstanceHandleMap<std::unique_ptr<uint32_t>> uut;
+    uint32_t* first = uut.emplace(make_handle(0), new uint32_t(0)).first->second.get();
+    const InstanceHandle_t* first_key = &uut.find(make_handle(0))->first;
+
+    for (uint32_t i = 1; i < 10000; ++i)
+    {
+        uut.emplace(make_handle(i), new uint32_t(i));
+    }
+
+    auto it = uut.find(make_handle(0));
+    EXPECT_EQ(first_key, &it->first);
+    EXPECT_EQ(first, it->second.get());
+}
+
+TEST(InstanceHandleMapTests, nodes_are_reused)
+{
+    auto shared = std::make_shared<int>(0);
+    InstanceHandleMap<std::shared_ptr<int>> uut;
+    uut.reserve(100);
+    size_t capacity = uut.capacity();
+    EXPECT_LE(100u, capacity);
+
+    for (uint32_t round = 0; round < 10; ++round)
+    {
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            uut.emplace(make_handle(round * 100 + i), shared);
+        }
+        EXPECT_EQ(101, shared.use_count());
+        EXPECT_EQ(capacity, uut.capacity());
+
+        uut.clear();
+        EXPECT_TRUE(uut.empty());
+        EXPECT_EQ(uut.begin(), uut.end());
+        // Erased elements are destroyed
+        EXPECT_EQ(1, shared.use_count());
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,87 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <utils/collections/sorted_vector_find.hpp>
+
+using eprosima::utilities::collections::sorted_vector_find;
+
+// Ordered by the first field, identified by both fields
+using Item = std::pair<int, int>;
+
+static bool item_less(
+        const Item& lhs,
+        const Item& rhs)
+{
+    return lhs.first < rhs.first;
+}
+
+static bool item_matches(
+        const Item& lhs,
+        const Item& rhs)
+{
+    return lhs == rhs;
+}
+
+TEST(SortedVectorFindTests, find_ordered)
+{
+    std::vector<Item> uut;
+    EXPECT_EQ(uut.end(), sorted_vector_find(uut, Item{1, 0}, item_less, item_matches));
+
+    for (int i = 0; i < 100; ++i)
+    {
+        uut.emplace_back(i * 2, i);
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        auto it = sorted_vector_find(uut, Item{i * 2, i}, item_less, item_matches);
+        ASSERT_NE(uut.end(), it);
+        EXPECT_EQ(i, it - uut.cbegin());
+    }
+
+    EXPECT_EQ(uut.end(), sorted_vector_find(uut, Item{3, 1}, item_less, item_matches));
+    EXPECT_EQ(uut.end(), sorted_vector_find(uut, Item{300, 150}, item_less, item_matches));
+}
+
+TEST(SortedVectorFindTests, find_with_ties)
+{
+    // Several items share the ordering field, so the binary search may land on a different one
+    std::vector<Item> uut;
+    for (int i = 0; i < 10; ++i)
+    {
+        uut.emplace_back(1, i);
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        auto it = sorted_vector_find(uut, Item{1, i}, item_less, item_matches);
+        ASSERT_NE(uut.end(), it);
+        EXPECT_EQ(i, it->second);
+    }
+
+    EXPECT_EQ(uut.end(), sorted_vector_find(uut, Item{1, 10}, item_less, item_matches));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1902,6 +1902,7 @@ TEST_F(XMLParserTests, getXMLPublishModeQosSynchronousKind)
  * 3. Check that the history memory policy mode is set to PREALLOCATED_WITH_REALLOC_MEMORY_MODE.
  * 4. Check that the history memory policy mode is set to DYNAMIC_RESERVE_MEMORY_MODE.
  * 5. Check that the history memory policy mode is set to DYNAMIC_REUSABLE_MEMORY_MODE.
+ * 6. Check that the history memory policy mode is set to DYNAMIC_SIZE_CLASS_MEMORY_MODE.
  */
 TEST_F(XMLParserTests, getXMLHistoryMemoryPolicy)
 {
@@ -1915,7 +1916,8 @@ TEST_F(XMLParserTests, getXMLHistoryMemoryPolicy)
         {"PREALLOCATED", MemoryManagementPolicy::PREALLOCATED_MEMORY_MODE},
         {"PREALLOCATED_WITH_REALLOC", MemoryManagementPolicy::PREALLOCATED_WITH_REALLOC_MEMORY_MODE},
         {"DYNAMIC", MemoryManagementPolicy::DYNAMIC_RESERVE_MEMORY_MODE},
-        {"DYNAMIC_REUSABLE", MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE}
+        {"DYNAMIC_REUSABLE", MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE},
+        {"DYNAMIC_SIZE_CLASS", MemoryManagementPolicy::DYNAMIC_SIZE_CLASS_MEMORY_MODE}
     };
 
     // Parametrized XML